@@ -0,0 +1,227 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Standalone kernel benchmarks of EDGE, reporting machine-readable JSON.
+ **/
+#include "parallel/Mpi.h"
+#include "parallel/Shared.h"
+
+#include "io/logging.h"
+#ifdef PP_USE_EASYLOGGING
+INITIALIZE_EASYLOGGINGPP
+#endif
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#pragma GCC diagnostic push
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include "submodules/optionparser/optionparser.h"
+#pragma GCC diagnostic pop
+
+/**
+ * Argument checks of the option parser.
+ **/
+struct Arg: public option::Arg {
+  static option::ArgStatus Unknown( const option::Option & i_option,
+                                    bool                   i_msg ) {
+    if( i_msg ) EDGE_LOG_ERROR << "Unknown option '" << i_option.name << "'\n";
+    return option::ARG_ILLEGAL;
+  }
+
+  static option::ArgStatus NonEmpty( const option::Option & i_option,
+                                     bool                   i_msg ) {
+    if( i_option.arg != 0 && i_option.arg[0] != 0 )
+      return option::ARG_OK;
+
+    if( i_msg ) EDGE_LOG_ERROR << "Option '" << i_option.name << "' requires a non-empty argument\n";
+    return option::ARG_ILLEGAL;
+  }
+};
+
+#include "setups/Cpu.h"
+#include "data/Internal.hpp"
+
+#if defined PP_T_EQUATIONS_SEISMIC
+#include "impl/seismic/Bench.hpp"
+#else
+#error benchmarks are only implemented for seismic setups
+#endif
+
+/**
+ * Writes the results of the benchmarks as JSON.
+ *
+ * @param i_nEls number of elements in the synthetic batch.
+ * @param i_nReps number of repetitions per benchmark.
+ * @param i_backend backend of the build.
+ * @param i_res results of the benchmarks.
+ * @param io_stream stream which is written.
+ *
+ * @paramt TL_T_RES type of the results.
+ **/
+template< typename TL_T_RES >
+static void writeJson( int_el                         i_nEls,
+                       unsigned int                   i_nReps,
+                       std::string            const & i_backend,
+                       std::vector< TL_T_RES > const & i_res,
+                       std::ostream                  & io_stream ) {
+#if defined PP_T_ELEMENTS_TRIA3
+  std::string l_elementType = "tria3";
+#elif defined PP_T_ELEMENTS_QUAD4R
+  std::string l_elementType = "quad4r";
+#elif defined PP_T_ELEMENTS_TET4
+  std::string l_elementType = "tet4";
+#elif defined PP_T_ELEMENTS_HEX8R
+  std::string l_elementType = "hex8r";
+#else
+  std::string l_elementType = "unknown";
+#endif
+
+  io_stream.precision( 9 );
+  io_stream << "{\n";
+  io_stream << "  \"config\": {\n";
+  io_stream << "    \"edge_version\": \"" << PP_EDGE_VERSION << "\",\n";
+  io_stream << "    \"element_type\": \"" << l_elementType << "\",\n";
+  io_stream << "    \"order\": " << ORDER << ",\n";
+  io_stream << "    \"precision\": " << PP_PRECISION << ",\n";
+  io_stream << "    \"cfr\": " << N_CRUNS << ",\n";
+  io_stream << "    \"relaxation_mechanisms\": " << N_RELAXATION_MECHANISMS << ",\n";
+  io_stream << "    \"kernels\": \"" << i_backend << "\",\n";
+  io_stream << "    \"threads\": " << edge::parallel::g_nThreads << ",\n";
+  io_stream << "    \"elements\": " << i_nEls << ",\n";
+  io_stream << "    \"repetitions\": " << i_nReps << "\n";
+  io_stream << "  },\n";
+  io_stream << "  \"results\": [";
+
+  for( std::size_t l_re = 0; l_re < i_res.size(); l_re++ ) {
+    TL_T_RES const & l_res = i_res[l_re];
+
+    io_stream << ( (l_re == 0) ? "\n" : ",\n" );
+    io_stream << "    {\n";
+    io_stream << "      \"kernel\": \"" << l_res.kernel << "\",\n";
+    io_stream << "      \"backend\": \"" << l_res.backend << "\",\n";
+    io_stream << "      \"element_updates\": " << l_res.nUps << ",\n";
+    io_stream << "      \"time\": " << l_res.time << ",\n";
+    io_stream << "      \"time_per_element_update\": " << l_res.time / l_res.nUps << ",\n";
+    io_stream << "      \"flops\": " << l_res.flops << ",\n";
+    io_stream << "      \"gflops\": " << l_res.flops / l_res.time * 1.0E-9 << ",\n";
+    io_stream << "      \"bytes\": " << l_res.bytes << ",\n";
+    io_stream << "      \"bandwidth_gbs\": " << l_res.bytes / l_res.time * 1.0E-9 << "\n";
+    io_stream << "    }";
+  }
+
+  io_stream << "\n  ]\n";
+  io_stream << "}\n";
+}
+
+int main( int i_argc, char *i_argv[] ) {
+  // set CPU flags
+  edge::setups::Cpu::setFlushToZero( true );
+  edge::setups::Cpu::setDenormalsAreZero( true );
+
+  // disable logging file-IO
+  edge::io::logging::config();
+
+  // start shared memory parallelization
+  edge::parallel::Shared l_shared;
+  l_shared.init();
+
+  // start MPI, the benchmarks are rank-local
+  edge::parallel::Mpi l_mpi;
+  l_mpi.start( i_argc, i_argv );
+
+  // reconfigure the logging interface with rank and thread id
+  edge::io::logging::config();
+
+  /*
+   * parse command line arguments
+   */
+  enum  optionIndex { UNKNOWN,
+                      HELP,
+                      ELEMENTS,
+                      REPS,
+                      OUT };
+  const option::Descriptor l_usage[] = {
+    { UNKNOWN,  0, "",  "",         Arg::Unknown,          "USAGE: ./edge_bench [options]\n\n Options:" },
+    { HELP,     0, "h", "help",     option::Arg::None,     "  --help, -h  \tPrint usage and exit." },
+    { ELEMENTS, 0, "e", "elements", Arg::NonEmpty,         "  --elements, -e  \tNumber of elements in the synthetic batch (default: 32 MiB of DOFs)." },
+    { REPS,     0, "r", "reps",     Arg::NonEmpty,         "  --reps, -r  \tNumber of repetitions per benchmark (default: 10)." },
+    { OUT,      0, "o", "out",      Arg::NonEmpty,         "  --out, -o  \tPath of the JSON output (default: stdout)." },
+    { 0,0,0,0,0,0 }
+  };
+
+  // ignore program name
+  int l_argc = i_argc - ( i_argc>0 );
+  char **l_argv = i_argv + ( i_argc>0 );
+
+  option::Stats l_stats( l_usage, l_argc, l_argv );
+  std::vector< option::Option > l_options( l_stats.options_max );
+  std::vector< option::Option > l_buffer(  l_stats.buffer_max  );
+  option::Parser l_parse( l_usage, l_argc, l_argv, l_options.data(), l_buffer.data() );
+
+  if( l_parse.error() ) {
+    exit( EXIT_FAILURE );
+  }
+  if( l_options[HELP] ) {
+    if( edge::parallel::g_rank == 0 ) option::printUsage( std::cout, l_usage );
+    exit( EXIT_SUCCESS );
+  }
+
+  std::size_t  l_nEls  = l_options[ELEMENTS] ? std::strtoull( l_options[ELEMENTS].arg, nullptr, 10 ) : 0;
+  unsigned int l_nReps = l_options[REPS]     ? std::strtoul(  l_options[REPS].arg,     nullptr, 10 ) : 10;
+  std::string  l_out   = l_options[OUT]      ? l_options[OUT].arg : "";
+  EDGE_CHECK_GT( l_nReps, 0 );
+
+  // scratch memory and matrix kernels of the solver
+  edge::data::Internal l_internal;
+  l_internal.initScratch();
+
+  // run the benchmarks
+  edge::seismic::Bench< real_base,
+                        N_RELAXATION_MECHANISMS,
+                        T_SDISC.ELEMENT,
+                        ORDER,
+                        ORDER,
+                        N_CRUNS > l_bench( l_nEls, l_nReps );
+  l_bench.run( l_internal.m_mm );
+
+  // write the results
+  if( edge::parallel::g_rank == 0 ) {
+    if( l_out == "" ) {
+      writeJson( l_bench.getNEls(), l_nReps, l_bench.backend(), l_bench.getResults(), std::cout );
+    }
+    else {
+      std::ofstream l_file( l_out );
+      EDGE_CHECK( l_file.good() ) << "could not open " << l_out;
+      writeJson( l_bench.getNEls(), l_nReps, l_bench.backend(), l_bench.getResults(), l_file );
+      EDGE_LOG_INFO << "wrote results to " << l_out;
+    }
+  }
+
+  l_internal.finalize();
+  l_mpi.fin();
+
+  return EXIT_SUCCESS;
+}
@@ -210,6 +210,8 @@ constexpr unsigned short CE_N_FLUXN_MATRICES( t_entityType i_enType ) {
  * --- Input: Simulation related definitions ---
  * PP_PRECISION:                Floating point precision in bits.
  * PP_N_CRUNS:                  Number of concurrent forward runs executed in a single execution of EDGE.
+ * PP_N_ELEMENT_BATCH:          Number of elements, which are interleaved in the kernels of single forward runs (optional, default: 1).
+ * PP_USE_MIXED_PRECISION:      If defined, updates of the elastic DOFs are accumulated through compensated summation (optional).
  * PP_ORDER                     Order of convergence.
  *
  * --- Global definitions: Independent of the mesh.
@@ -245,7 +247,7 @@ constexpr unsigned short CE_N_FLUXN_MATRICES( t_entityType i_enType ) {
  * N_QUANTITIES              Number of quantities.
  *
  * N_STEPS_PER_UPDATE Number of steps per DOF-update.
- * N_ENTRIES_CONTROL_FLOW Number of entries in the control flow of the simulation.
+ * N_ENTRIES_CONTROL_FLOW Number of entries in the control flow of the simulation, i.e., work regions per time group.
  *
  * --- Element related definitions ---
  * N_ELEMENT_MODES:          Number of modes per element.
@@ -281,6 +283,10 @@ constexpr char EDGE_LOGO[] =
 
 // copy over variables of the preprocessor
 const unsigned short N_CRUNS = PP_N_CRUNS;
+#ifndef PP_N_ELEMENT_BATCH
+#define PP_N_ELEMENT_BATCH 1
+#endif
+const unsigned short N_ELEMENT_BATCH = PP_N_ELEMENT_BATCH;
 const unsigned short ORDER = PP_ORDER;
 const unsigned short N_DIM = PP_N_DIM;
 
@@ -719,7 +725,7 @@ static_assert( ALIGNMENT.FACE_MODES.PRIVATE >= ALIGNMENT.FACE_MODES.SHARED,
 /*
  * Kernel configuration
  */
-#ifdef PP_T_KERNELS_XSMM
+#if defined(PP_T_KERNELS_XSMM) || defined(PP_T_KERNELS_SIMD)
 const bool MM_KERNELS_SPARSE = true;
 #else
 const bool MM_KERNELS_SPARSE = false;
@@ -230,6 +230,80 @@ class edge::data::DataLayout {
       o_recv.back().push_back( (unsigned char *) l_raw );
     }
   }
+
+    /**
+     * Derives the MPI-pointers of a single sparse type in EDGE's flex data.
+     * The data of the sparse type is stored linearly in memory, following the entity layout.
+     * Thus, the data of a communication region starts at the first entity of the region with the sparse type,
+     * or, if no entity of the region has the sparse type, at the data of the next entity with the sparse type.
+     *
+     * Example:
+     *   entities:                   0,    1,    2,       3,    4,      5
+     *   region:                   inner, inner, send, send, recv,   recv
+     *   pointers of sparse type:  nullptr, p0,  nullptr, p1, nullptr, nullptr
+     *   send:                       p1, p1+1
+     *   recv:                       p1+1, p1+1
+     *
+     * @param i_lay entity layout.
+     * @param i_ptrs pointers of the sparse type, nullptr if an entity doesn't have the sparse type.
+     * @param i_bytesPerEntry number of bytes per entity with the sparse type.
+     * @param o_send will be set to pointers into the raw data, for use within MPI-send. Size is the number of MPI regions+1 for the derivation of messages sizes.
+     * @param o_recv will be set to pointers into the raw data, for use within MPI-recv. Size is the number of MPI regions+1 for message size derivation.
+     *
+     * @paramt TL_T_PTR type of the pointers.
+     **/
+    template< typename TL_T_PTR >
+    static void flex( t_enLayout const & i_lay,
+                      TL_T_PTR   const * i_ptrs,
+                      std::size_t        i_bytesPerEntry,
+                      std::vector<
+                        std::vector<
+                          unsigned char *
+                        >
+                       >               & o_send,
+                      std::vector<
+                        std::vector<
+                          unsigned char *
+                        >
+                       >               & o_recv ) {
+      // derive start of the data for every entity, including a ghost entity at the end
+      std::vector< unsigned char * > l_pos( i_lay.nEnts+1, nullptr );
+
+      unsigned char *l_next = nullptr;
+      for( int_el l_en = 0; l_en < i_lay.nEnts; l_en++ ) {
+        if( i_ptrs[l_en] != nullptr ) {
+          l_next = (unsigned char *) i_ptrs[l_en];
+          break;
+        }
+      }
+
+      for( int_el l_en = 0; l_en < i_lay.nEnts; l_en++ ) {
+        l_pos[l_en] = l_next;
+        if( i_ptrs[l_en] != nullptr ) {
+          EDGE_CHECK_EQ( (unsigned char *) i_ptrs[l_en], l_next );
+          l_next += i_bytesPerEntry;
+        }
+      }
+      l_pos[i_lay.nEnts] = l_next;
+
+      // assemble the communication data
+      for( std::size_t l_tg = 0; l_tg < i_lay.timeGroups.size(); l_tg++ ) {
+        o_send.resize( o_send.size()+1 );
+        o_recv.resize( o_recv.size()+1 );
+
+        int_el l_first = i_lay.timeGroups[l_tg].inner.first;
+        int_el l_nOwn  = i_lay.timeGroups[l_tg].nEntsOwn;
+        int_el l_nNot  = i_lay.timeGroups[l_tg].nEntsNotOwn;
+
+        for( std::size_t l_sr = 0; l_sr < i_lay.timeGroups[l_tg].send.size(); l_sr++ )
+          o_send.back().push_back( l_pos[ i_lay.timeGroups[l_tg].send[l_sr].first ] );
+        o_send.back().push_back( l_pos[ l_first + l_nOwn ] );
+
+        for( std::size_t l_rr = 0; l_rr < i_lay.timeGroups[l_tg].receive.size(); l_rr++ )
+          o_recv.back().push_back( l_pos[ i_lay.timeGroups[l_tg].receive[l_rr].first ] );
+        o_recv.back().push_back( l_pos[ l_first + l_nOwn + l_nNot ] );
+      }
+    }
 };
 
 #endif
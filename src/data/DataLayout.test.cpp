@@ -24,6 +24,7 @@
 #define private public
 #include "DataLayout.hpp"
 #undef private
+#include "EntityLayout.h"
 
 
 TEST_CASE( "Data Layout: Sparse adjacency.", "[dataLayout][spAd]" ) {
@@ -151,3 +152,73 @@ TEST_CASE( "Data Layout: Sparse adjacency.", "[dataLayout][spAd]" ) {
   REQUIRE( l_recv1[0][2] == (unsigned char*) (l_dataRaw1 + 19) );
   REQUIRE( l_recv1[0][3] == (unsigned char*) (l_dataRaw1 + 22) );
 }
+
+TEST_CASE( "Data Layout: MPI-pointers of flex data.", "[dataLayout][flex]" ) {
+  /*
+   * Our example
+   *
+   *   en | tg | inner | send | recv | sparse
+   *   0  | 0  | x     |      |      |
+   *   1  | 0  | x     |      |      | x
+   *   2  | 0  |       | 0    |      |
+   *   3  | 0  |       | 1    |      | x
+   *   4  | 0  |       |      | 0    | x
+   *   5  | 0  |       |      | 1    |
+   *   6  | 1  | x     |      |      |
+   *   7  | 1  |       | 0    |      | x
+   *   8  | 1  |       |      | 0    |
+   */
+  t_enLayout l_lay;
+  l_lay.timeGroups.resize(2);
+  l_lay.timeGroups[0].inner.size = 2;
+  l_lay.timeGroups[0].send.resize(2);
+  l_lay.timeGroups[0].receive.resize(2);
+  l_lay.timeGroups[0].send[0].size    = 1;
+  l_lay.timeGroups[0].send[1].size    = 1;
+  l_lay.timeGroups[0].receive[0].size = 1;
+  l_lay.timeGroups[0].receive[1].size = 1;
+
+  l_lay.timeGroups[1].inner.size = 1;
+  l_lay.timeGroups[1].send.resize(1);
+  l_lay.timeGroups[1].receive.resize(1);
+  l_lay.timeGroups[1].send[0].size    = 1;
+  l_lay.timeGroups[1].receive[0].size = 1;
+
+  edge::data::EntityLayout::sizesToLayout( l_lay );
+  REQUIRE( l_lay.nEnts == 9 );
+
+  // flex data with two doubles per sparse entity
+  double l_raw[4*2];
+  double *l_ptrs[9] = { nullptr, l_raw,   nullptr, l_raw+2, l_raw+4,
+                        nullptr, nullptr, l_raw+6, nullptr };
+
+  std::vector< std::vector< unsigned char * > > l_send;
+  std::vector< std::vector< unsigned char * > > l_recv;
+
+  edge::data::DataLayout::flex( l_lay,
+                                l_ptrs,
+                                2*sizeof(double),
+                                l_send,
+                                l_recv );
+
+  REQUIRE( l_send.size() == 2 );
+  REQUIRE( l_recv.size() == 2 );
+  REQUIRE( l_send[0].size() == 3 );
+  REQUIRE( l_recv[0].size() == 3 );
+  REQUIRE( l_send[1].size() == 2 );
+  REQUIRE( l_recv[1].size() == 2 );
+
+  REQUIRE( l_send[0][0] == (unsigned char*) (l_raw+2) );
+  REQUIRE( l_send[0][1] == (unsigned char*) (l_raw+2) );
+  REQUIRE( l_send[0][2] == (unsigned char*) (l_raw+4) );
+
+  REQUIRE( l_recv[0][0] == (unsigned char*) (l_raw+4) );
+  REQUIRE( l_recv[0][1] == (unsigned char*) (l_raw+6) );
+  REQUIRE( l_recv[0][2] == (unsigned char*) (l_raw+6) );
+
+  REQUIRE( l_send[1][0] == (unsigned char*) (l_raw+6) );
+  REQUIRE( l_send[1][1] == (unsigned char*) (l_raw+8) );
+
+  REQUIRE( l_recv[1][0] == (unsigned char*) (l_raw+8) );
+  REQUIRE( l_recv[1][1] == (unsigned char*) (l_raw+8) );
+}
@@ -91,3 +91,13 @@ void edge::data::EntityLayout::sizesToLayout( t_enLayout &io_enLayout ) {
     io_enLayout.nEnts += io_enLayout.timeGroups[l_tg].nEntsNotOwn;
   }
 }
+
+void edge::data::EntityLayout::getTgs( t_enLayout const &i_enLayout,
+                                       int_tg           *o_tgs ) {
+  for( std::size_t l_tg = 0; l_tg < i_enLayout.timeGroups.size(); l_tg++ ) {
+    int_el l_first = i_enLayout.timeGroups[l_tg].inner.first;
+    int_el l_size  = i_enLayout.timeGroups[l_tg].nEntsOwn + i_enLayout.timeGroups[l_tg].nEntsNotOwn;
+
+    for( int_el l_en = l_first; l_en < l_first+l_size; l_en++ ) o_tgs[l_en] = l_tg;
+  }
+}
@@ -48,6 +48,15 @@ class edge::data::EntityLayout {
      * @param io_enLayout layout which will be completed.
      **/
     static void sizesToLayout( t_enLayout &io_enLayout );
+
+    /**
+     * Derives the time group of every entity in the (complete) layout.
+     *
+     * @param i_enLayout entity layout.
+     * @param o_tgs will be set to the time groups of the entities, size: #entities.
+     **/
+    static void getTgs( t_enLayout const &i_enLayout,
+                        int_tg           *o_tgs );
 };
 
 #endif
@@ -142,3 +142,26 @@ TEST_CASE( "Entity layout: Completion of a partial layout.", "[sizesToLayout][En
   REQUIRE( l_layout.timeGroups[1].receive[2].first == 37 );
   REQUIRE( l_layout.timeGroups[1].receive[2].size  == 1  );
 }
+
+TEST_CASE( "Entity layout: Time groups of entities.", "[getTgs][EntityLayout]" ) {
+  t_enLayout l_layout;
+  l_layout.timeGroups.resize( 3 );
+
+  l_layout.timeGroups[0].inner.size = 2;
+  l_layout.timeGroups[1].inner.size = 3;
+  l_layout.timeGroups[2].inner.size = 1;
+
+  l_layout.timeGroups[1].send.resize(    1 );
+  l_layout.timeGroups[1].receive.resize( 1 );
+  l_layout.timeGroups[1].send[0].size    = 1;
+  l_layout.timeGroups[1].receive[0].size = 2;
+
+  edge::data::EntityLayout::sizesToLayout( l_layout );
+  REQUIRE( l_layout.nEnts == 9 );
+
+  int_tg l_tgs[9];
+  edge::data::EntityLayout::getTgs( l_layout, l_tgs );
+
+  int_tg l_ref[9] = { 0, 0, 1, 1, 1, 1, 1, 1, 2 };
+  for( unsigned short l_en = 0; l_en < 9; l_en++ ) REQUIRE( l_tgs[l_en] == l_ref[l_en] );
+}
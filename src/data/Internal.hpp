@@ -33,7 +33,7 @@
 #include "io/logging.h"
 #include "parallel/Shared.h"
 
-#if defined PP_T_KERNELS_VANILLA
+#if defined PP_T_KERNELS_VANILLA || defined PP_T_KERNELS_SIMD
 #include "data/MmVanilla.hpp"
 #elif defined PP_T_KERNELS_XSMM_DENSE_SINGLE
 #include "data/MmXsmmSingle.hpp"
@@ -52,7 +52,7 @@ class edge::data::Internal {
     /**
      * Matrix-matrix multiplication kernels
      **/
-#if defined PP_T_KERNELS_VANILLA
+#if defined PP_T_KERNELS_VANILLA || defined PP_T_KERNELS_SIMD
     data::MmVanilla< real_base > m_mm;
 #elif defined PP_T_KERNELS_XSMM_DENSE_SINGLE
     data::MmXsmmSingle< real_base > m_mm;
@@ -0,0 +1,341 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Data structures and micro-kernels of the portable SIMD matrix-matrix multiplications.
+ **/
+
+#ifndef EDGE_DATA_MM_SIMD_HPP
+#define EDGE_DATA_MM_SIMD_HPP
+
+#include <vector>
+#include "constants.hpp"
+#include "io/logging.h"
+
+#include "linalg/Matrix.h"
+
+namespace edge {
+  namespace data {
+    template< typename       TL_T_REAL,
+              unsigned short TL_N_CRS >
+    class MmSimd;
+  }
+}
+
+/**
+ * Holds the sparsity patterns and portable micro-kernels for fused simulations.
+ * The micro-kernels are compiler-vectorized over the fused simulations (OpenMP SIMD) and do not depend on LIBXSMM.
+ * Matrix sizes, which are known at compile time, are passed as template parameters, which allows the compiler to fully unroll the loops;
+ * only the number of columns of B and C and the sparsity patterns are runtime parameters.
+ *
+ * All matrices are given in row-major storage, matrices carrying the fused simulations have an additional, contiguous dimension of size TL_N_CRS:
+ *   A[m][k][TL_N_CRS], B[k][n][TL_N_CRS], C[m][n][TL_N_CRS]
+ *
+ * In element-batched settings, the fused dimension holds TL_N_CRS interleaved elements of a single simulation.
+ * The element-local matrices then differ per lane, which is supported by the sparse-A and dense-A kernels through TL_N_LAS=TL_N_CRS.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_CRS >
+class edge::data::MmSimd {
+  public:
+    //! sparsity pattern of a matrix in compressed sparse row or compressed sparse column format
+    typedef struct {
+      //! true if the pattern is CSR, false if CSC
+      bool csr;
+
+      //! row (CSR) or column (CSC) pointer
+      std::vector< unsigned int > ptr;
+
+      //! column (CSR) or row (CSC) index
+      std::vector< unsigned int > idx;
+
+      //! number of columns in B and C
+      unsigned short n;
+    } t_pattern;
+
+    //! sparsity patterns of the kernels
+    std::vector< std::vector< t_pattern > > m_pats;
+
+    /**
+     * Adds a sparsity pattern.
+     * If the given kernel group does not exist, new groups until the given id are created.
+     *
+     * @param i_group id of the kernel group.
+     * @param i_csr true if CSR, false if CSC.
+     * @param i_nPtrs number of entries in the row (CSR) or column (CSC) pointer.
+     * @param i_ptr row (CSR) or column (CSC) pointer.
+     * @param i_idx column (CSR) or row (CSC) index.
+     * @param i_n number of columns in B and C.
+     **/
+    void add( unsigned short         i_group,
+              bool                   i_csr,
+              unsigned int           i_nPtrs,
+              unsigned int   const * i_ptr,
+              unsigned int   const * i_idx,
+              unsigned short         i_n ) {
+      // verbose output
+      EDGE_VLOG(1) << "  adding simd-pattern #" << ( (i_group < m_pats.size()) ? m_pats[i_group].size() : 0 )
+                   << " of group " << i_group << ( i_csr ? " (csr)" : " (csc)" )
+                   << " N=" << i_n << " nz=" << i_ptr[i_nPtrs-1]
+                   << " cfr=" << TL_N_CRS;
+
+      // add kernel groups, if required
+      if( i_group >= m_pats.size() ) m_pats.resize( i_group+1 );
+
+      t_pattern l_pat;
+      l_pat.csr = i_csr;
+      l_pat.ptr.assign( i_ptr, i_ptr + i_nPtrs );
+      l_pat.idx.assign( i_idx, i_idx + i_ptr[i_nPtrs-1] );
+      l_pat.n = i_n;
+
+      m_pats[i_group].push_back( l_pat );
+    }
+
+    /**
+     * Sparse matrix B in CSC format, fused matrices A and C: C += A.B or C = A.B.
+     * The kernel register-blocks a full column of C over all rows and fused simulations.
+     *
+     * @param i_pat sparsity pattern of B.
+     * @param i_a fused matrix A.
+     * @param i_valB non-zero values of B, ordered as the CSC-pattern.
+     * @param io_c fused matrix C.
+     *
+     * @paramt TL_M number of rows in A and C.
+     * @paramt TL_LD_A leading dimension of A (excluding the fused simulations).
+     * @paramt TL_LD_C leading dimension of C (excluding the fused simulations).
+     * @paramt TL_BETA0 if true, C is overwritten, otherwise the result is added to C.
+     **/
+    template< unsigned short TL_M,
+              unsigned short TL_LD_A,
+              unsigned short TL_LD_C,
+              bool           TL_BETA0 >
+    static void cscB( t_pattern const & i_pat,
+                      TL_T_REAL const * i_a,
+                      TL_T_REAL const * i_valB,
+                      TL_T_REAL       * io_c ) {
+      unsigned int const * l_colPtr = i_pat.ptr.data();
+      unsigned int const * l_rowIdx = i_pat.idx.data();
+
+      for( unsigned short l_n = 0; l_n < i_pat.n; l_n++ ) {
+        // accumulators for the entire column of C
+        TL_T_REAL l_acc[TL_M][TL_N_CRS];
+
+        for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            l_acc[l_m][l_cr] = TL_BETA0 ? TL_T_REAL(0) : io_c[ (l_m*TL_LD_C + l_n)*TL_N_CRS + l_cr ];
+          }
+        }
+
+        // accumulate the non-zeros of the column
+        for( unsigned int l_nz = l_colPtr[l_n]; l_nz < l_colPtr[l_n+1]; l_nz++ ) {
+          TL_T_REAL const * l_a = i_a + l_rowIdx[l_nz] * TL_N_CRS;
+          TL_T_REAL l_b = i_valB[l_nz];
+
+          for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              l_acc[l_m][l_cr] += l_a[l_m*TL_LD_A*TL_N_CRS + l_cr] * l_b;
+            }
+          }
+        }
+
+        for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            io_c[ (l_m*TL_LD_C + l_n)*TL_N_CRS + l_cr ] = l_acc[l_m][l_cr];
+          }
+        }
+      }
+    }
+
+    /**
+     * Sparse matrix B in CSC format, matrix A without fused simulations, single lane of the fused matrix C: C[:][:][lane] = A.B.
+     * Used for element-batched kernels, if the sparsity pattern of B differs per lane.
+     *
+     * @param i_pat sparsity pattern of B.
+     * @param i_lane lane of C, which is written.
+     * @param i_a matrix A without fused simulations.
+     * @param i_valB non-zero values of B, ordered as the CSC-pattern.
+     * @param o_c fused matrix C, only the given lane is written.
+     *
+     * @paramt TL_M number of rows in A and C.
+     * @paramt TL_LD_A leading dimension of A.
+     * @paramt TL_LD_C leading dimension of C (excluding the fused simulations).
+     **/
+    template< unsigned short TL_M,
+              unsigned short TL_LD_A,
+              unsigned short TL_LD_C >
+    static void cscBLane( t_pattern const & i_pat,
+                          unsigned short    i_lane,
+                          TL_T_REAL const * i_a,
+                          TL_T_REAL const * i_valB,
+                          TL_T_REAL       * o_c ) {
+      unsigned int const * l_colPtr = i_pat.ptr.data();
+      unsigned int const * l_rowIdx = i_pat.idx.data();
+
+      for( unsigned short l_n = 0; l_n < i_pat.n; l_n++ ) {
+        TL_T_REAL l_acc[TL_M];
+        for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) l_acc[l_m] = 0;
+
+        for( unsigned int l_nz = l_colPtr[l_n]; l_nz < l_colPtr[l_n+1]; l_nz++ ) {
+          TL_T_REAL const * l_a = i_a + l_rowIdx[l_nz];
+          TL_T_REAL l_b = i_valB[l_nz];
+
+#pragma omp simd
+          for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+            l_acc[l_m] += l_a[l_m*TL_LD_A] * l_b;
+          }
+        }
+
+        for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+          o_c[ (l_m*TL_LD_C + l_n)*TL_N_CRS + i_lane ] = l_acc[l_m];
+        }
+      }
+    }
+
+    /**
+     * Sparse matrix A in CSR format, fused matrices B and C: C += A.B or C = A.B.
+     * The first n columns of a row are contiguous in B and C, the kernel vectorizes over these.
+     *
+     * @param i_pat sparsity pattern of A.
+     * @param i_valA non-zero values of A, ordered as the CSR-pattern; [#nz][TL_N_LAS].
+     * @param i_b fused matrix B.
+     * @param io_c fused matrix C.
+     *
+     * @paramt TL_M number of rows in A and C.
+     * @paramt TL_LD_B leading dimension of B (excluding the fused simulations).
+     * @paramt TL_LD_C leading dimension of C (excluding the fused simulations).
+     * @paramt TL_BETA0 if true, C is overwritten, otherwise the result is added to C.
+     * @paramt TL_N_LAS number of lanes of A: 1 applies the same A to all fused simulations, TL_N_CRS a lane-local A.
+     **/
+    template< unsigned short TL_M,
+              unsigned short TL_LD_B,
+              unsigned short TL_LD_C,
+              bool           TL_BETA0,
+              unsigned short TL_N_LAS = 1 >
+    static void csrA( t_pattern const & i_pat,
+                      TL_T_REAL const * i_valA,
+                      TL_T_REAL const * i_b,
+                      TL_T_REAL       * io_c ) {
+      static_assert( TL_N_LAS == 1 || TL_N_LAS == TL_N_CRS, "lanes of A not supported" );
+
+      unsigned int const * l_rowPtr = i_pat.ptr.data();
+      unsigned int const * l_colIdx = i_pat.idx.data();
+      unsigned int l_nEns = i_pat.n * TL_N_CRS;
+
+      for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+        TL_T_REAL * l_c = io_c + l_m * TL_LD_C * TL_N_CRS;
+
+        if( TL_BETA0 ) {
+#pragma omp simd
+          for( unsigned int l_en = 0; l_en < l_nEns; l_en++ ) l_c[l_en] = 0;
+        }
+
+        for( unsigned int l_nz = l_rowPtr[l_m]; l_nz < l_rowPtr[l_m+1]; l_nz++ ) {
+          TL_T_REAL const * l_b = i_b + l_colIdx[l_nz] * TL_LD_B * TL_N_CRS;
+
+          if( TL_N_LAS == 1 ) {
+            TL_T_REAL l_a = i_valA[l_nz];
+
+#pragma omp simd
+            for( unsigned int l_en = 0; l_en < l_nEns; l_en++ ) {
+              l_c[l_en] += l_a * l_b[l_en];
+            }
+          }
+          else {
+            TL_T_REAL const * l_a = i_valA + l_nz * TL_N_LAS;
+
+            for( unsigned short l_n = 0; l_n < i_pat.n; l_n++ ) {
+#pragma omp simd
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                l_c[l_n*TL_N_CRS + l_cr] += l_a[l_cr] * l_b[l_n*TL_N_CRS + l_cr];
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /**
+     * Dense matrix A, fused matrices B and C: C += A.B or C = A.B.
+     * Used for the flux solvers, which are dense.
+     *
+     * @param i_a dense matrix A in row-major storage (TL_M x TL_K x TL_N_LAS).
+     * @param i_b fused matrix B.
+     * @param io_c fused matrix C.
+     *
+     * @paramt TL_M number of rows in A and C.
+     * @paramt TL_N number of columns in B and C.
+     * @paramt TL_K number of columns in A and rows in B.
+     * @paramt TL_LD_B leading dimension of B (excluding the fused simulations).
+     * @paramt TL_LD_C leading dimension of C (excluding the fused simulations).
+     * @paramt TL_BETA0 if true, C is overwritten, otherwise the result is added to C.
+     * @paramt TL_N_LAS number of lanes of A: 1 applies the same A to all fused simulations, TL_N_CRS a lane-local A.
+     **/
+    template< unsigned short TL_M,
+              unsigned short TL_N,
+              unsigned short TL_K,
+              unsigned short TL_LD_B,
+              unsigned short TL_LD_C,
+              bool           TL_BETA0,
+              unsigned short TL_N_LAS = 1 >
+    static void denseA( TL_T_REAL const * i_a,
+                        TL_T_REAL const * i_b,
+                        TL_T_REAL       * io_c ) {
+      static_assert( TL_N_LAS == 1 || TL_N_LAS == TL_N_CRS, "lanes of A not supported" );
+
+      for( unsigned short l_m = 0; l_m < TL_M; l_m++ ) {
+        TL_T_REAL * l_c = io_c + l_m * TL_LD_C * TL_N_CRS;
+
+        if( TL_BETA0 ) {
+#pragma omp simd
+          for( unsigned int l_en = 0; l_en < TL_N*TL_N_CRS; l_en++ ) l_c[l_en] = 0;
+        }
+
+        for( unsigned short l_k = 0; l_k < TL_K; l_k++ ) {
+          TL_T_REAL const * l_b = i_b + l_k * TL_LD_B * TL_N_CRS;
+
+          if( TL_N_LAS == 1 ) {
+            TL_T_REAL l_a = i_a[l_m*TL_K + l_k];
+
+#pragma omp simd
+            for( unsigned int l_en = 0; l_en < TL_N*TL_N_CRS; l_en++ ) {
+              l_c[l_en] += l_a * l_b[l_en];
+            }
+          }
+          else {
+            TL_T_REAL const * l_a = i_a + (l_m*TL_K + l_k) * TL_N_LAS;
+
+            for( unsigned short l_n = 0; l_n < TL_N; l_n++ ) {
+#pragma omp simd
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                l_c[l_n*TL_N_CRS + l_cr] += l_a[l_cr] * l_b[l_n*TL_N_CRS + l_cr];
+              }
+            }
+          }
+        }
+      }
+    }
+};
+
+#endif
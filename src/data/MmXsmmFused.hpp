@@ -5,6 +5,7 @@
  *         Alexander Heinecke (alexander.heinecke AT intel.com)
  *
  * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
  * Copyright (c) 2016-2018, Regents of the University of California
  * Copyright (c) 2016, Intel Corporation
  * All rights reserved.
@@ -27,6 +28,7 @@
 #define EDGE_DATA_MM_XSMM_FUSED_HPP
  
 #include <vector>
+#include <string>
 #include "constants.hpp"
 #include "io/logging.h"
 #include "linalg/Matrix.h"
@@ -35,6 +37,9 @@
  
 namespace edge {
   namespace data {
+    template< typename TL_T_REAL >
+    class MmXsmmFusedChunks;
+
     template< typename TL_T_REAL >
     class MmXsmmFused;
 
@@ -46,11 +51,140 @@ namespace edge {
   }
 }
 
+/**
+ * Splits the fused simulations into chunks, which match the vector width of the fused LIBXSMM kernels.
+ *
+ * Fused data is stored as [..][#cols][#fused sims].
+ * For #fused sims = #chunks * vector width, the data is equivalent to [..][#cols * #chunks][vector width].
+ * Thus, kernels with fused matrices B and C (sparse A, CSR) operate on #chunks times as many columns.
+ * Kernels with fused matrices A and C (sparse B, CSC) additionally require the Kronecker product of B with the #chunks x #chunks identity matrix.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ **/
+template< typename TL_T_REAL >
+class edge::data::MmXsmmFusedChunks {
+  protected:
+    //! number of chunks of the fused simulations
+    unsigned short m_nChs = 1;
+
+    /**
+     * Derives the number of chunks and limits the LIBXSMM target architecture, if required.
+     * 512-bit chunks are used if supported by the build (compile time) and the machine (run time), 256-bit chunks otherwise.
+     **/
+    void initChunks() {
+      unsigned short l_bytesCrs = PP_N_CRUNS * sizeof(TL_T_REAL);
+      unsigned short l_bytesCh = 0;
+      int l_arch = libxsmm_get_target_archid();
+
+#if defined(__AVX512F__)
+      if( l_arch >= LIBXSMM_X86_AVX512 && l_bytesCrs % 64 == 0 ) {
+        l_bytesCh = 64;
+      }
+#endif
+      if( l_bytesCh == 0 && l_arch >= LIBXSMM_X86_AVX && l_bytesCrs % 32 == 0 ) {
+        l_bytesCh = 32;
+
+        if( l_arch >= LIBXSMM_X86_AVX2 ) {
+          EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx2 to match 256-bit chunks of fused sims";
+          libxsmm_set_target_arch( "avx2" );
+        }
+        else {
+          EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx to match 256-bit chunks of fused sims";
+          libxsmm_set_target_arch( "avx" );
+        }
+      }
+
+      if( l_bytesCh == 0 ) {
+        EDGE_LOG_FATAL << "fused LIBXSMM kernels require the fused sims to be a multiple of 256 bit, got "
+                       << PP_N_CRUNS << "x" << sizeof(TL_T_REAL)*8 << " bit";
+      }
+
+      m_nChs = l_bytesCrs / l_bytesCh;
+      EDGE_VLOG(1) << "splitting " << PP_N_CRUNS << " fused sims in " << m_nChs << " chunk(s) of "
+                   << l_bytesCh*8 << " bit";
+    }
+
+    /**
+     * Splits a CSC matrix B (sparse) into chunks: B' = B (x) I, with the #chunks x #chunks identity matrix I.
+     *
+     * @param i_nChs number of chunks.
+     * @param i_n number of columns in B.
+     * @param i_ptr column pointer of B.
+     * @param i_idx row index of B.
+     * @param i_val non-zero values of B.
+     * @param o_ptr will be set to the column pointer of B'.
+     * @param o_idx will be set to the row index of B'.
+     * @param o_val will be set to the non-zero values of B'.
+     **/
+    static void splitCsc( unsigned short                    i_nChs,
+                          unsigned int                      i_n,
+                          unsigned int              const * i_ptr,
+                          unsigned int              const * i_idx,
+                          TL_T_REAL                 const * i_val,
+                          std::vector< unsigned int >     & o_ptr,
+                          std::vector< unsigned int >     & o_idx,
+                          std::vector< TL_T_REAL >        & o_val ) {
+      o_ptr.resize( 0 );
+      o_idx.resize( 0 );
+      o_val.resize( 0 );
+      o_ptr.push_back( 0 );
+
+      for( unsigned int l_co = 0; l_co < i_n; l_co++ ) {
+        for( unsigned short l_ch = 0; l_ch < i_nChs; l_ch++ ) {
+          for( unsigned int l_nz = i_ptr[l_co]; l_nz < i_ptr[l_co+1]; l_nz++ ) {
+            o_idx.push_back( i_idx[l_nz] * i_nChs + l_ch );
+            o_val.push_back( i_val[l_nz] );
+          }
+          o_ptr.push_back( o_idx.size() );
+        }
+      }
+    }
+
+  public:
+    /**
+     * Gets the number of chunks of the fused simulations.
+     *
+     * @return number of chunks.
+     **/
+    unsigned short getNChs() const { return m_nChs; }
+
+    /**
+     * Gets the candidate fill-in strategies of sparse CSC matrices for the target architecture.
+     * The first candidate is the default, if no tuning is performed.
+     *
+     * @return fill-in strategies.
+     **/
+    static std::vector< std::string > getFillIns() {
+      if( libxsmm_get_target_archid() == LIBXSMM_X86_AVX512_KNM ) return { "qfma", "none", "dense" };
+      return { "none", "dense" };
+    }
+
+    /**
+     * Appends the non-zero values of a split CSC matrix, as used by the kernels at runtime.
+     * Every column of the input matrix is repeated once per chunk.
+     *
+     * @param i_nChs number of chunks.
+     * @param i_csc CSC matrix.
+     * @param io_vals values to which the non-zeros are appended.
+     **/
+    static void appendCscVals( unsigned short                 i_nChs,
+                               t_matCsc               const & i_csc,
+                               std::vector< TL_T_REAL >     & io_vals ) {
+      for( std::size_t l_co = 0; l_co+1 < i_csc.colPtr.size(); l_co++ ) {
+        for( unsigned short l_ch = 0; l_ch < i_nChs; l_ch++ ) {
+          for( unsigned int l_nz = i_csc.colPtr[l_co]; l_nz < i_csc.colPtr[l_co+1]; l_nz++ ) {
+            io_vals.push_back( i_csc.val[l_nz] );
+          }
+        }
+      }
+    }
+};
+
 /**
  * Holds LIBXSMM kernels for fused, single precision simulations.
  **/
 template<>
-class edge::data::MmXsmmFused< float > {
+class edge::data::MmXsmmFused< float >: public edge::data::MmXsmmFusedChunks< float > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
@@ -60,28 +194,10 @@ class edge::data::MmXsmmFused< float > {
     std::vector< std::vector< libxsmm_smmfunction > > m_kernels;
 
     /**
-     * @brief Constructor, which limits the LIBXSMM target architecture, if required.
+     * @brief Constructor, which splits the fused simulations into chunks and limits the LIBXSMM target architecture, if required.
      */
     MmXsmmFused() {
-      if( PP_N_CRUNS == 16 ) {
-#if !defined(__AVX512F__)
-        EDGE_LOG_FATAL;
-#endif
-      }
-      else if( PP_N_CRUNS == 8 ) {
-#if defined(__AVX2__)
-        EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx2 to match 8 FP32-fused sims";
-        libxsmm_set_target_arch( "avx2" );
-#elif defined(__AVX__)
-        EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx to match 8 FP32-fused sims";
-        libxsmm_set_target_arch( "avx" );
-#else
-        EDGE_LOG_FATAL;
-#endif
-      }
-      else {
-        EDGE_LOG_FATAL;
-      }
+      initChunks();
     }
 
     /**
@@ -126,6 +242,26 @@ class edge::data::MmXsmmFused< float > {
         m_kernels.resize( i_group+1 );
       }
 
+      // split the fused sims into chunks
+      std::vector< unsigned int > l_ptr;
+      std::vector< unsigned int > l_idx;
+      std::vector< float > l_val;
+      if( m_nChs > 1 ) {
+        if( i_csr ) {
+          i_ldB *= m_nChs;
+        }
+        else {
+          splitCsc( m_nChs, i_n, i_ptr, i_idx, i_val, l_ptr, l_idx, l_val );
+          i_ptr = l_ptr.data();
+          i_idx = l_idx.data();
+          i_val = l_val.data();
+          i_k   *= m_nChs;
+          i_ldA *= m_nChs;
+        }
+        i_n   *= m_nChs;
+        i_ldC *= m_nChs;
+      }
+
       // add description
       libxsmm_descriptor_blob l_xgemmBlob;
       const libxsmm_gemm_descriptor* l_desc = 0;
@@ -182,6 +318,14 @@ class edge::data::MmXsmmFused< float > {
         m_kernels.resize( i_group+1 );
       }
 
+      // split the fused sims into chunks, dense matrices B are not split
+      if( m_nChs > 1 ) {
+        EDGE_CHECK( i_fusedBC ) << "dense kernels with fused matrices A and C require a single chunk of fused sims";
+        i_n   *= m_nChs;
+        i_ldB *= m_nChs;
+        i_ldC *= m_nChs;
+      }
+
       // add description
       libxsmm_descriptor_blob l_xgemmBlob;
       const libxsmm_gemm_descriptor* l_desc = 0;
@@ -223,7 +367,7 @@ class edge::data::MmXsmmFused< float > {
  * Holds LIBXSMM kernels for fused, double precision simulations.
  **/
 template<>
-class edge::data::MmXsmmFused< double > {
+class edge::data::MmXsmmFused< double >: public edge::data::MmXsmmFusedChunks< double > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
@@ -233,28 +377,10 @@ class edge::data::MmXsmmFused< double > {
     std::vector< std::vector< libxsmm_dmmfunction > > m_kernels;
  
     /**
-     * @brief Constructor, which limits the LIBXSMM target architecture, if required.
+     * @brief Constructor, which splits the fused simulations into chunks and limits the LIBXSMM target architecture, if required.
      */
     MmXsmmFused() {
-      if( PP_N_CRUNS == 8 ) {
-#if !defined(__AVX512F__)
-        EDGE_LOG_FATAL;
-#endif
-      }
-      else if( PP_N_CRUNS == 4 ) {
-#if defined(__AVX2__)
-        EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx2 to match 4 FP64-fused sims";
-        libxsmm_set_target_arch( "avx2" );
-#elif defined(__AVX__)
-        EDGE_VLOG(1) << "limiting LIBXSMM inst. set to avx to match 4 FP64-fused sims";
-        libxsmm_set_target_arch( "avx" );
-#else
-        EDGE_LOG_FATAL;
-#endif
-      }
-      else {
-        EDGE_LOG_FATAL;
-      }
+      initChunks();
     }
 
     /**
@@ -300,6 +426,26 @@ class edge::data::MmXsmmFused< double > {
         m_kernels.resize( i_group+1 );
       }
 
+      // split the fused sims into chunks
+      std::vector< unsigned int > l_ptr;
+      std::vector< unsigned int > l_idx;
+      std::vector< double > l_val;
+      if( m_nChs > 1 ) {
+        if( i_csr ) {
+          i_ldB *= m_nChs;
+        }
+        else {
+          splitCsc( m_nChs, i_n, i_ptr, i_idx, i_val, l_ptr, l_idx, l_val );
+          i_ptr = l_ptr.data();
+          i_idx = l_idx.data();
+          i_val = l_val.data();
+          i_k   *= m_nChs;
+          i_ldA *= m_nChs;
+        }
+        i_n   *= m_nChs;
+        i_ldC *= m_nChs;
+      }
+
       // add description
       libxsmm_descriptor_blob l_xgemmBlob;
       const libxsmm_gemm_descriptor* l_desc = 0;
@@ -356,6 +502,14 @@ class edge::data::MmXsmmFused< double > {
         m_kernels.resize( i_group+1 );
       }
 
+      // split the fused sims into chunks, dense matrices B are not split
+      if( m_nChs > 1 ) {
+        EDGE_CHECK( i_fusedBC ) << "dense kernels with fused matrices A and C require a single chunk of fused sims";
+        i_n   *= m_nChs;
+        i_ldB *= m_nChs;
+        i_ldC *= m_nChs;
+      }
+
       // add description
       libxsmm_descriptor_blob l_xgemmBlob;
       const libxsmm_gemm_descriptor* l_desc = 0;
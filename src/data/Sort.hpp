@@ -0,0 +1,178 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Sorting through key permutations.
+ **/
+#ifndef EDGE_DATA_SORT_HPP
+#define EDGE_DATA_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef PP_USE_OMP
+#include <omp.h>
+#endif
+
+namespace edge {
+  namespace data {
+    class Sort;
+  }
+}
+
+/**
+ * Sorting through key permutations.
+ * Instead of moving the (possibly large) entities, the ids of the entities are sorted by their keys.
+ * The obtained permutation is applied afterwards.
+ **/
+class edge::data::Sort {
+  public:
+    //! minimum number of entries for which the parallel variant is used
+    static std::size_t const m_parMin = 1 << 16;
+
+    /**
+     * Derives the permutation which sorts the keys in ascending order.
+     * Entries with equal keys keep their relative order.
+     *
+     * @param i_nEns number of entries.
+     * @param i_keys keys of the entries, TL_T_KEY has to provide operator<.
+     * @param o_perm will be set to the sorted ids: o_perm[new] = old.
+     *
+     * @paramt TL_T_KEY type of the keys.
+     * @paramt TL_T_LID integral type of the ids.
+     **/
+    template< typename TL_T_KEY,
+              typename TL_T_LID >
+    static void perm( TL_T_LID         i_nEns,
+                      TL_T_KEY const * i_keys,
+                      TL_T_LID       * o_perm ) {
+      for( TL_T_LID l_en = 0; l_en < i_nEns; l_en++ ) o_perm[l_en] = l_en;
+
+      std::stable_sort( o_perm,
+                        o_perm+i_nEns,
+                        [i_keys]( TL_T_LID i_a, TL_T_LID i_b ) { return i_keys[i_a] < i_keys[i_b]; } );
+    }
+
+    /**
+     * Parallel variant of the permutation sort.
+     * The ids are split into one chunk per thread, the chunks are sorted concurrently and merged pairwise afterwards.
+     * The result is identical to the one of the sequential variant.
+     *
+     * @param i_nEns number of entries.
+     * @param i_keys keys of the entries, TL_T_KEY has to provide operator<.
+     * @param o_perm will be set to the sorted ids: o_perm[new] = old.
+     *
+     * @paramt TL_T_KEY type of the keys.
+     * @paramt TL_T_LID integral type of the ids.
+     **/
+    template< typename TL_T_KEY,
+              typename TL_T_LID >
+    static void permPar( TL_T_LID         i_nEns,
+                         TL_T_KEY const * i_keys,
+                         TL_T_LID       * o_perm ) {
+#ifdef PP_USE_OMP
+      int l_nChs = omp_get_max_threads();
+#else
+      int l_nChs = 1;
+#endif
+      if( l_nChs < 2 || i_nEns < (TL_T_LID) l_nChs ) {
+        perm( i_nEns, i_keys, o_perm );
+        return;
+      }
+
+      for( TL_T_LID l_en = 0; l_en < i_nEns; l_en++ ) o_perm[l_en] = l_en;
+
+      auto l_comp = [i_keys]( TL_T_LID i_a, TL_T_LID i_b ) { return i_keys[i_a] < i_keys[i_b]; };
+
+      // boundaries of the chunks
+      std::vector< TL_T_LID > l_bnds( l_nChs+1 );
+      for( int l_ch = 0; l_ch <= l_nChs; l_ch++ )
+        l_bnds[l_ch] = (TL_T_LID) ( (std::size_t) i_nEns * l_ch / l_nChs );
+
+      // sort the chunks
+#ifdef PP_USE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+      for( int l_ch = 0; l_ch < l_nChs; l_ch++ ) {
+        std::stable_sort( o_perm+l_bnds[l_ch],
+                          o_perm+l_bnds[l_ch+1],
+                          l_comp );
+      }
+
+      // merge neighboring chunks, left before right keeps the sort stable
+      for( int l_wd = 1; l_wd < l_nChs; l_wd *= 2 ) {
+#ifdef PP_USE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+        for( int l_ch = 0; l_ch < l_nChs; l_ch += 2*l_wd ) {
+          if( l_ch + l_wd < l_nChs ) {
+            std::inplace_merge( o_perm+l_bnds[l_ch],
+                                o_perm+l_bnds[l_ch+l_wd],
+                                o_perm+l_bnds[std::min( l_ch+2*l_wd, l_nChs )],
+                                l_comp );
+          }
+        }
+      }
+    }
+
+    /**
+     * Derives the sorting permutation and applies it to the given values.
+     * The parallel variant is used for at least m_parMin entries.
+     *
+     * @param i_nEns number of entries.
+     * @param i_keys keys of the entries.
+     * @param io_vals values which will be sorted by the keys.
+     *
+     * @paramt TL_T_KEY type of the keys.
+     * @paramt TL_T_VAL type of the values.
+     **/
+    template< typename TL_T_KEY,
+              typename TL_T_VAL >
+    static void byKey( std::size_t         i_nEns,
+                       TL_T_KEY    const * i_keys,
+                       TL_T_VAL          * io_vals ) {
+      std::vector< std::size_t > l_perm( i_nEns );
+      if( i_nEns >= m_parMin ) permPar( i_nEns, i_keys, l_perm.data() );
+      else                     perm(    i_nEns, i_keys, l_perm.data() );
+
+      apply( i_nEns, l_perm.data(), io_vals );
+    }
+
+    /**
+     * Applies the permutation to the values.
+     *
+     * @param i_nEns number of entries.
+     * @param i_perm permutation: i_perm[new] = old.
+     * @param io_vals values which will be permuted.
+     *
+     * @paramt TL_T_LID integral type of the ids.
+     * @paramt TL_T_VAL type of the values.
+     **/
+    template< typename TL_T_LID,
+              typename TL_T_VAL >
+    static void apply( TL_T_LID         i_nEns,
+                       TL_T_LID const * i_perm,
+                       TL_T_VAL       * io_vals ) {
+      std::vector< TL_T_VAL > l_tmp( io_vals, io_vals+i_nEns );
+      for( TL_T_LID l_en = 0; l_en < i_nEns; l_en++ ) io_vals[l_en] = l_tmp[ i_perm[l_en] ];
+    }
+};
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the sorting through key permutations.
+ **/
+#include <array>
+#include <cstdint>
+#include <catch.hpp>
+#include "Sort.hpp"
+
+TEST_CASE( "Sort: Permutation of keys.", "[Sort][perm]" ) {
+  int l_keys[10] = { 5, 3, 9, 3, 0, 7, 5, 1, 3, 8 };
+
+  unsigned int l_perm[10];
+  edge::data::Sort::perm( 10u,
+                          l_keys,
+                          l_perm );
+
+  // stable w.r.t. equal keys
+  unsigned int l_ref[10] = { 4, 7, 1, 3, 8, 0, 6, 5, 9, 2 };
+  for( unsigned short l_en = 0; l_en < 10; l_en++ ) REQUIRE( l_perm[l_en] == l_ref[l_en] );
+
+  // apply to values
+  char l_vals[10] = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j' };
+  edge::data::Sort::apply( 10u,
+                           l_perm,
+                           l_vals );
+  char l_valsRef[10] = { 'e', 'h', 'b', 'd', 'i', 'a', 'g', 'f', 'j', 'c' };
+  for( unsigned short l_en = 0; l_en < 10; l_en++ ) REQUIRE( l_vals[l_en] == l_valsRef[l_en] );
+}
+
+TEST_CASE( "Sort: Lexicographic keys.", "[Sort][lex]" ) {
+  std::array< int, 3 > l_keys[4] = { {{ 2, 5, 7 }},
+                                     {{ 1, 9, 9 }},
+                                     {{ 2, 3, 8 }},
+                                     {{ 2, 5, 6 }} };
+  double l_vals[4] = { 0, 1, 2, 3 };
+
+  edge::data::Sort::byKey( 4,
+                           l_keys,
+                           l_vals );
+
+  REQUIRE( l_vals[0] == 1 );
+  REQUIRE( l_vals[1] == 2 );
+  REQUIRE( l_vals[2] == 3 );
+  REQUIRE( l_vals[3] == 0 );
+}
+
+TEST_CASE( "Sort: Parallel permutation.", "[Sort][permPar]" ) {
+  std::size_t l_nEns = edge::data::Sort::m_parMin + 1234;
+
+  // pseudo-random keys with many duplicates
+  std::vector< std::uint32_t > l_keys( l_nEns );
+  std::uint32_t l_state = 17;
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) {
+    l_state = l_state * 1664525u + 1013904223u;
+    l_keys[l_en] = l_state >> 20;
+  }
+
+  std::vector< std::size_t > l_permSeq( l_nEns );
+  std::vector< std::size_t > l_permPar( l_nEns );
+  edge::data::Sort::perm(    l_nEns, l_keys.data(), l_permSeq.data() );
+  edge::data::Sort::permPar( l_nEns, l_keys.data(), l_permPar.data() );
+
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) {
+    REQUIRE( l_permSeq[l_en] == l_permPar[l_en] );
+  }
+  for( std::size_t l_en = 1; l_en < l_nEns; l_en++ ) {
+    REQUIRE( l_keys[ l_permSeq[l_en-1] ] <= l_keys[ l_permSeq[l_en] ] );
+  }
+
+  // sort values through the keys
+  std::vector< std::size_t > l_vals( l_nEns );
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) l_vals[l_en] = l_en;
+  edge::data::Sort::byKey( l_nEns, l_keys.data(), l_vals.data() );
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) {
+    REQUIRE( l_vals[l_en] == l_permSeq[l_en] );
+  }
+}
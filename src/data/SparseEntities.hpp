@@ -24,10 +24,13 @@
 #ifndef EDGE_DATA_SPARSE_ENTITIES_HPP
 #define EDGE_DATA_SPARSE_ENTITIES_HPP
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 #include "parallel/Mpi.h"
 #include "io/logging.h"
 #include "linalg/Geom.hpp"
+#include "mesh/Bvh.hpp"
 
 #include "EntityLayout.h"
 namespace edge {
@@ -1056,6 +1059,7 @@ class edge::data::SparseEntities {
      *        If an input point is outside the given entities, the closest-by entity is returned.
      *        If the respective entity resides outside the current partition, std::numeric_limits< TL_T_LID >::max() is returned.
      *        If an entity is part of the send-region and possibly duplicated, only the first entity is returned.
+     *        The owned entities are searched through a bounding volume hierarchy of their bounding boxes.
      *
      * @param i_enType considered entity type.
      * @param i_nPts number of points.
@@ -1099,51 +1103,74 @@ class edge::data::SparseEntities {
         l_minDist[l_pt] = std::numeric_limits< TL_T_REAL >::max();
       }
 
+      // owned entities and their bounding boxes
+      std::vector< TL_T_LID > l_owned;
+      TL_T_LID l_first = 0;
+      for( std::size_t l_tg = 0; l_tg < i_enLayout.timeGroups.size(); l_tg++ ) {
+        for( TL_T_LID l_en = l_first; l_en < l_first+i_enLayout.timeGroups[l_tg].nEntsOwn; l_en++ ) {
+          l_owned.push_back( l_en );
+        }
+        l_first += i_enLayout.timeGroups[l_tg].nEntsOwn +
+                   i_enLayout.timeGroups[l_tg].nEntsNotOwn;
+      }
+
+      std::vector< TL_T_REAL > l_boxes( l_owned.size() * 6 );
+      EDGE_CHECK_LE( l_nVe, 8 );
+      for( std::size_t l_ow = 0; l_ow < l_owned.size(); l_ow++ ) {
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          l_boxes[l_ow*6 +     l_di] = std::numeric_limits< TL_T_REAL >::max();
+          l_boxes[l_ow*6 + 3 + l_di] = std::numeric_limits< TL_T_REAL >::lowest();
+        }
+        for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
+          TL_T_LID l_veId = i_enVe[l_owned[l_ow]*l_nVe+l_ve];
+
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            TL_T_REAL l_crd = i_charsVe[l_veId].coords[l_di];
+            l_boxes[l_ow*6 +     l_di] = std::min( l_boxes[l_ow*6 +     l_di], l_crd );
+            l_boxes[l_ow*6 + 3 + l_di] = std::max( l_boxes[l_ow*6 + 3 + l_di], l_crd );
+          }
+        }
+      }
+
+      mesh::Bvh< TL_T_REAL, TL_T_LID > l_bvh;
+      l_bvh.init( l_owned.size(),
+                  (TL_T_REAL (*)[2][3]) l_boxes.data() );
+
       // iterate over the given points
 #ifdef PP_USE_OMP
 #pragma omp parallel for
 #endif
       for( TL_T_LID l_pt = 0; l_pt < i_nPts; l_pt++ ) {
-        // first considered entity
-        TL_T_LID l_first = 0;
-
-        // iterate over the time groups
-        for( std::size_t l_tg = 0; l_tg < i_enLayout.timeGroups.size(); l_tg++ ) {
-          TL_T_LID l_size  = i_enLayout.timeGroups[l_tg].nEntsOwn;
-
-          // iterate over the owned entities
-          for( TL_T_LID l_en = l_first; l_en < l_first+l_size; l_en++ ) {
-            // buffer entity ves
-            EDGE_CHECK_LE( l_nVe, 8 );
-            TL_T_REAL l_tmpVe[ 3*8 ];
-            for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
-              TL_T_LID l_veId = i_enVe[l_en*l_nVe+l_ve];
-
-              for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
-                l_tmpVe[l_di*l_nVe + l_ve] = i_charsVe[l_veId].coords[l_di];
-              }
-            }
+        // distance of the point to an owned entity (projected if not inside)
+        auto l_dist = [&]( TL_T_LID i_ow ) {
+          TL_T_LID l_en = l_owned[i_ow];
+
+          // buffer entity ves
+          TL_T_REAL l_tmpVe[ 3*8 ];
+          for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
+            TL_T_LID l_veId = i_enVe[l_en*l_nVe+l_ve];
 
-            // compute distance (projected if not inside)
-            TL_T_REAL l_tmpCrds[3];
             for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
-              l_tmpCrds[l_di] = i_ptCrds[l_pt][l_di];
-            }
-            edge::linalg::Geom::closestPoint( i_enType,
-                                              l_tmpVe,
-                                              l_tmpCrds );
-            TL_T_REAL l_dist = edge::linalg::GeomT< 3 >::norm( l_tmpCrds,
-                                                               i_ptCrds[l_pt] );
-
-            // save if this is a new minimum
-            if( l_dist < l_minDist[l_pt] ) {
-              o_de[l_pt] = l_en;
-              l_minDist[l_pt] = l_dist;
+              l_tmpVe[l_di*l_nVe + l_ve] = i_charsVe[l_veId].coords[l_di];
             }
           }
-          l_first += i_enLayout.timeGroups[l_tg].nEntsOwn +
-                     i_enLayout.timeGroups[l_tg].nEntsNotOwn;
-        }
+
+          TL_T_REAL l_tmpCrds[3];
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            l_tmpCrds[l_di] = i_ptCrds[l_pt][l_di];
+          }
+          edge::linalg::Geom::closestPoint( i_enType,
+                                            l_tmpVe,
+                                            l_tmpCrds );
+          return edge::linalg::GeomT< 3 >::norm( l_tmpCrds,
+                                                 i_ptCrds[l_pt] );
+        };
+
+        // query the closest-by owned entity, ties resolve to the smaller dense id
+        TL_T_LID l_ow = l_bvh.nearest( i_ptCrds[l_pt],
+                                       l_dist,
+                                       l_minDist[l_pt] );
+        if( l_ow != std::numeric_limits< TL_T_LID >::max() ) o_de[l_pt] = l_owned[l_ow];
       }
 
       // derive points, which are closest to our owned entities
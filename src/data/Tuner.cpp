@@ -0,0 +1,116 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Selection of kernel variants through runtime measurements and an on-disk cache of the decisions.
+ **/
+#include "Tuner.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <limits>
+#include <algorithm>
+#include "parallel/global.h"
+#include "io/logging.h"
+
+edge::data::Tuner::Tuner( std::string const & i_path ): m_path( i_path ) {
+  if( m_path == "" ) return;
+
+  std::ifstream l_file( m_path );
+  if( !l_file.is_open() ) {
+    EDGE_LOG_INFO << "  no kernel tuning cache at " << m_path << ", tuning from scratch";
+    return;
+  }
+
+  std::string l_line;
+  while( std::getline( l_file, l_line ) ) {
+    std::size_t l_sep = l_line.find_last_of( " \t" );
+    if( l_line.empty() || l_line[0] == '#' || l_sep == std::string::npos ) continue;
+
+    std::size_t l_end = l_line.find_last_not_of( " \t", l_sep );
+    if( l_end == std::string::npos ) continue;
+
+    m_decs[ l_line.substr( 0, l_end+1 ) ] = l_line.substr( l_sep+1 );
+  }
+
+  EDGE_LOG_INFO << "  read " << m_decs.size() << " kernel tuning decisions from " << m_path;
+}
+
+void edge::data::Tuner::write() const {
+  if( m_path == "" || parallel::g_rank != 0 ) return;
+
+  std::string l_tmp = m_path + ".tmp";
+  std::ofstream l_file( l_tmp, std::ios::trunc );
+  if( !l_file.is_open() ) {
+    EDGE_LOG_WARNING << "  could not write kernel tuning cache " << l_tmp;
+    return;
+  }
+
+  l_file << "# kernel tuning decisions: key value" << std::endl;
+  for( std::map< std::string, std::string >::const_iterator l_it = m_decs.begin(); l_it != m_decs.end(); l_it++ ) {
+    l_file << l_it->first << " " << l_it->second << std::endl;
+  }
+  l_file.close();
+
+  if( std::rename( l_tmp.c_str(), m_path.c_str() ) != 0 ) {
+    EDGE_LOG_WARNING << "  could not move kernel tuning cache to " << m_path;
+  }
+}
+
+std::string edge::data::Tuner::get( std::string const & i_key ) const {
+  std::map< std::string, std::string >::const_iterator l_it = m_decs.find( i_key );
+  if( l_it == m_decs.end() ) return "";
+  return l_it->second;
+}
+
+std::string edge::data::Tuner::select( std::string                                    const & i_key,
+                                       std::vector< std::string >                     const & i_cands,
+                                       std::function< double( std::string const & ) > const & i_time ) {
+  EDGE_CHECK( !i_cands.empty() );
+
+  // use the cached decision, if valid
+  std::string l_cached = get( i_key );
+  if( std::find( i_cands.begin(), i_cands.end(), l_cached ) != i_cands.end() ) {
+    EDGE_LOG_INFO << "  using cached kernel variant " << l_cached << " for " << i_key;
+    return l_cached;
+  }
+
+  // measure all candidates
+  std::string l_best = i_cands[0];
+  double l_bestTime = std::numeric_limits< double >::max();
+  if( i_cands.size() > 1 ) {
+    for( std::size_t l_ca = 0; l_ca < i_cands.size(); l_ca++ ) {
+      double l_time = i_time( i_cands[l_ca] );
+      EDGE_VLOG(1) << "    " << i_key << ": " << i_cands[l_ca] << " took " << l_time;
+
+      if( l_time < l_bestTime ) {
+        l_bestTime = l_time;
+        l_best = i_cands[l_ca];
+      }
+    }
+  }
+
+  EDGE_LOG_INFO << "  selected kernel variant " << l_best << " for " << i_key;
+
+  m_decs[i_key] = l_best;
+  write();
+
+  return l_best;
+}
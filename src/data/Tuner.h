@@ -0,0 +1,89 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Selection of kernel variants through runtime measurements and an on-disk cache of the decisions.
+ **/
+#ifndef EDGE_DATA_TUNER_H
+#define EDGE_DATA_TUNER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+
+namespace edge {
+  namespace data {
+    class Tuner;
+  }
+}
+
+/**
+ * Selects the fastest of a set of candidate variants.
+ * Decisions are identified by a key, which should capture everything the decision depends on (order, precision, target architecture, ..).
+ * If a cache file is given, decisions are read from the file on construction and written to the file after each new decision.
+ * Later runs with the same keys skip the measurements.
+ *
+ * The cache file is plain text with one "key value" pair per line, where the value is the last whitespace-separated token.
+ **/
+class edge::data::Tuner {
+  private:
+    //! path of the cache file, empty if disabled
+    std::string m_path;
+
+    //! cached decisions
+    std::map< std::string, std::string > m_decs;
+
+    /**
+     * Writes the cached decisions to the cache file.
+     * Only the first rank writes; the file is replaced atomically.
+     **/
+    void write() const;
+
+  public:
+    /**
+     * Constructor.
+     *
+     * @param i_path path of the cache file. Use an empty string to disable the cache.
+     **/
+    Tuner( std::string const & i_path = "" );
+
+    /**
+     * Gets a cached decision.
+     *
+     * @param i_key key of the decision.
+     * @return cached value, empty string if no decision is cached.
+     **/
+    std::string get( std::string const & i_key ) const;
+
+    /**
+     * Selects the fastest candidate.
+     * If a cached decision exists and is a valid candidate, it is returned without measurements.
+     *
+     * @param i_key key of the decision.
+     * @param i_cands candidates.
+     * @param i_time function which returns the time (or any other cost) of a candidate, lower is better.
+     * @return selected candidate.
+     **/
+    std::string select( std::string                                    const & i_key,
+                        std::vector< std::string >                     const & i_cands,
+                        std::function< double( std::string const & ) > const & i_time );
+};
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests of the kernel-variant selection.
+ **/
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#define private public
+#include "Tuner.h"
+#undef private
+
+TEST_CASE( "Tuner: Selection and caching of kernel variants.", "[Tuner][select]" ) {
+  std::string l_path = "tuner.test.cache";
+  std::remove( l_path.c_str() );
+
+  unsigned short l_nCalls = 0;
+  std::function< double( std::string const & ) > l_time = [&l_nCalls]( std::string const & i_var ) {
+    l_nCalls++;
+    if( i_var == "none"  ) return 3.0;
+    if( i_var == "dense" ) return 1.0;
+    return 2.0;
+  };
+
+  std::vector< std::string > l_cands = { "none", "dense", "qfma" };
+
+  // no cache: candidates are measured
+  edge::data::Tuner l_tuner0;
+  REQUIRE( l_tuner0.select( "a o=4", l_cands, l_time ) == "dense" );
+  REQUIRE( l_nCalls == 3 );
+  REQUIRE( l_tuner0.get( "a o=4" ) == "dense" );
+  REQUIRE( l_tuner0.get( "b o=4" ) == "" );
+
+  // single candidate: no measurements
+  l_nCalls = 0;
+  REQUIRE( l_tuner0.select( "b o=4", {"none"}, l_time ) == "none" );
+  REQUIRE( l_nCalls == 0 );
+
+  // write the decisions to disk
+  edge::data::Tuner l_tuner1( l_path );
+  l_nCalls = 0;
+  REQUIRE( l_tuner1.select( "a o=4", l_cands, l_time ) == "dense" );
+  REQUIRE( l_tuner1.select( "a o=5", {"none", "qfma"}, l_time ) == "qfma" );
+  REQUIRE( l_nCalls == 5 );
+
+  // read the decisions from disk
+  edge::data::Tuner l_tuner2( l_path );
+  REQUIRE( l_tuner2.m_decs.size() == 2 );
+  l_nCalls = 0;
+  REQUIRE( l_tuner2.select( "a o=4", l_cands, l_time ) == "dense" );
+  REQUIRE( l_tuner2.select( "a o=5", l_cands, l_time ) == "qfma" );
+  REQUIRE( l_nCalls == 0 );
+
+  // cached decisions, which are not a candidate, are measured again
+  REQUIRE( l_tuner2.select( "a o=5", {"none", "dense"}, l_time ) == "dense" );
+  REQUIRE( l_nCalls == 2 );
+
+  std::remove( l_path.c_str() );
+}
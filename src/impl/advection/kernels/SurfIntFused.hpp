@@ -0,0 +1,263 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Optimized surface integration for fused advection forward runs.
+ **/
+#ifndef EDGE_ADVECTION_KERNELS_SURF_INT_FUSED_HPP
+#define EDGE_ADVECTION_KERNELS_SURF_INT_FUSED_HPP
+
+#include <limits>
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "dg/Basis.h"
+#include "linalg/Matrix.h"
+#include "data/Dynamic.h"
+#include "data/MmXsmmFused.hpp"
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_N_CRS >
+      class SurfIntFused;
+    }
+  }
+}
+
+/**
+ * Optimized quadrature-free ADER-DG surface integration for fused advection forward runs.
+ *
+ * The flux solvers of the advection equation are scalars.
+ * Thus, the local contribution scales the face-projected DOFs of all faces first and then lifts them through the stacked, transposed flux matrices in a single call.
+ *
+ * @paramt TL_T_REAL real type.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_N_CRS >
+class edge::advection::kernels::SurfIntFused {
+  private:
+    //! number of faces
+    static unsigned short const TL_N_FAS = C_ENT[TL_T_EL].N_FACES;
+
+    //! number of face modes
+    static unsigned short const TL_N_MDS_FA = CE_N_ELEMENT_MODES( C_ENT[TL_T_EL].TYPE_FACES, TL_O_SP );
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS_EL = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of neigboring contribution flux matrices
+    static unsigned short const TL_N_FMNS = CE_N_FLUXN_MATRICES( TL_T_EL );
+
+    //! matrix kernels
+    edge::data::MmXsmmFused< TL_T_REAL > m_mm;
+
+    //! non-zeros of the local and neighboring flux matrices
+    TL_T_REAL *m_fIntLN[TL_N_FAS+TL_N_FMNS];
+
+    //! non-zeros of the stacked, transposed flux matrices of all faces
+    TL_T_REAL *m_fIntTSt = nullptr;
+
+    //! non-zeros of the transposed flux matrices
+    TL_T_REAL *m_fIntT[TL_N_FAS];
+
+    /**
+     * Adds a sparse kernel for the given dense matrix B (fused A and C).
+     *
+     * @param i_group kernel group.
+     * @param i_nRows number of rows of the row-major matrix B.
+     * @param i_nCols number of columns of the row-major matrix B.
+     * @param i_b dense matrix B.
+     * @param i_beta beta parameter of the kernel.
+     * @param io_mm matrix kernels to which the kernel is added.
+     * @param io_nzs will be extended by the non-zeros of B, split w.r.t. the chunks of fused runs.
+     * @return offset of the non-zeros in io_nzs.
+     **/
+    static std::size_t addCsc( unsigned short                         i_group,
+                               unsigned int                           i_nRows,
+                               unsigned int                           i_nCols,
+                               TL_T_REAL                      const * i_b,
+                               TL_T_REAL                              i_beta,
+                               edge::data::MmXsmmFused< TL_T_REAL > & io_mm,
+                               std::vector< TL_T_REAL >             & io_nzs ) {
+      t_matCsc l_csc;
+      edge::linalg::Matrix::denseToCsc< TL_T_REAL >( i_nRows,
+                                                     i_nCols,
+                                                     i_b,
+                                                     l_csc,
+                                                     TOL.BASIS,
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     edge::data::MmXsmmFused< TL_T_REAL >::getFillIns()[0] );
+
+      io_mm.add( i_group,           // group
+                 false,             // csc
+                 &l_csc.colPtr[0],  // column pointer
+                 &l_csc.rowIdx[0],  // row index
+                 &l_csc.val[0],     // values
+                 1,                 // m
+                 i_nCols,           // n
+                 i_nRows,           // k
+                 i_nRows,           // ldA
+                 0,                 // ldB
+                 i_nCols,           // ldC
+                 TL_T_REAL(1.0),    // alpha
+                 i_beta,            // beta
+                 LIBXSMM_GEMM_PREFETCH_NONE );
+
+      std::size_t l_off = io_nzs.size();
+      edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( io_mm.getNChs(), l_csc, io_nzs );
+      return l_off;
+    }
+
+  public:
+    /**
+     * Constructor of the optimized surface integration for fused forward runs.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    SurfIntFused( data::Dynamic & io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get flux matrices
+      TL_T_REAL l_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA];
+      TL_T_REAL l_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA];
+      TL_T_REAL l_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL];
+      l_basis.getFluxDense( l_fIntL[0][0],
+                            l_fIntN[0][0],
+                            l_fIntT[0][0] );
+
+      // generate the kernels and gather the non-zeros
+      std::vector< TL_T_REAL > l_nzs;
+      std::size_t l_offLN[TL_N_FAS+TL_N_FMNS];
+      std::size_t l_offT[TL_N_FAS];
+
+      // local and neighboring flux matrices
+      for( unsigned short l_fm = 0; l_fm < TL_N_FAS+TL_N_FMNS; l_fm++ ) {
+        TL_T_REAL const * l_fInt = (l_fm < TL_N_FAS) ? l_fIntL[l_fm][0] : l_fIntN[l_fm-TL_N_FAS][0];
+        l_offLN[l_fm] = addCsc( 0, TL_N_MDS_EL, TL_N_MDS_FA, l_fInt, TL_T_REAL(0.0), m_mm, l_nzs );
+      }
+
+      // stacked transposed flux matrices of all faces
+      std::size_t l_offTSt = addCsc( 1, TL_N_FAS * TL_N_MDS_FA, TL_N_MDS_EL, l_fIntT[0][0], TL_T_REAL(1.0), m_mm, l_nzs );
+
+      // transposed flux matrices of the single faces
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        l_offT[l_fa] = addCsc( 1, TL_N_MDS_FA, TL_N_MDS_EL, l_fIntT[l_fa][0], TL_T_REAL(1.0), m_mm, l_nzs );
+      }
+
+      // copy the non-zeros to a permanent data structure and assign the pointers
+      TL_T_REAL *l_nzsRaw = (TL_T_REAL*) io_dynMem.allocate( l_nzs.size() * sizeof(TL_T_REAL),
+                                                             4096,
+                                                             true );
+      for( std::size_t l_nz = 0; l_nz < l_nzs.size(); l_nz++ ) l_nzsRaw[l_nz] = l_nzs[l_nz];
+
+      for( unsigned short l_fm = 0; l_fm < TL_N_FAS+TL_N_FMNS; l_fm++ ) m_fIntLN[l_fm] = l_nzsRaw + l_offLN[l_fm];
+      m_fIntTSt = l_nzsRaw + l_offTSt;
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) m_fIntT[l_fa] = l_nzsRaw + l_offT[l_fa];
+    }
+
+    /**
+     * Element-local contribution.
+     *
+     * @param i_fs flux solvers.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be updated with the contribution of the local surface integral.
+     **/
+    void local( TL_T_REAL const i_fs[TL_N_FAS],
+                TL_T_REAL const i_tDofs[1][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL       io_dofs[1][TL_N_MDS_EL][TL_N_CRS] ) const {
+      // scaled, face-projected DOFs of all faces
+      TL_T_REAL l_scratch[TL_N_FAS][TL_N_MDS_FA][TL_N_CRS];
+
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        m_mm.m_kernels[0][l_fa]( i_tDofs[0][0],
+                                 m_fIntLN[l_fa],
+                                 l_scratch[l_fa][0] );
+
+        for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            l_scratch[l_fa][l_md][l_cr] *= i_fs[l_fa];
+          }
+        }
+      }
+
+      m_mm.m_kernels[1][0]( l_scratch[0][0],
+                            m_fIntTSt,
+                            io_dofs[0][0] );
+    }
+
+    /**
+     * Contribution of a neighboring element to the surface integral.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fs flux solver.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be update with the neighboring element's contribution.
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL            i_fs,
+                TL_T_REAL      const i_tDofs[1][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofs[1][TL_N_MDS_EL][TL_N_CRS] ) const {
+      // derive the id of the neighboring flux matrix
+      unsigned short l_fMatId = std::numeric_limits< unsigned short >::max();
+      if( i_vId != std::numeric_limits< unsigned short >::max() ) {
+        l_fMatId = TL_N_FAS + i_vId * TL_N_FAS;
+        l_fMatId += i_fId;
+      }
+      else {
+        l_fMatId = i_fa;
+      }
+
+      // scaled, face-projected DOFs
+      TL_T_REAL l_scratch[TL_N_MDS_FA][TL_N_CRS];
+
+      m_mm.m_kernels[0][l_fMatId]( i_tDofs[0][0],
+                                   m_fIntLN[l_fMatId],
+                                   l_scratch[0] );
+
+      for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
+#pragma omp simd
+        for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+          l_scratch[l_md][l_cr] *= i_fs;
+        }
+      }
+
+      m_mm.m_kernels[1][1+i_fa]( l_scratch[0],
+                                 m_fIntT[i_fa],
+                                 io_dofs[0][0] );
+    }
+};
+
+#endif
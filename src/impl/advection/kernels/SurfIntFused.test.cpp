@@ -0,0 +1,86 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the optimized advection surface integration for fused forward simulations.
+ **/
+#include <catch.hpp>
+#define private public
+#include "SurfInt.hpp"
+#include "SurfIntFused.hpp"
+#undef private
+
+TEST_CASE( "Optimized advection surface integration for fused simulations.", "[advection][SurfIntFused]" ) {
+  static unsigned short const l_nFas = C_ENT[T_SDISC.ELEMENT].N_FACES;
+  static unsigned short const l_nMds = CE_N_ELEMENT_MODES( T_SDISC.ELEMENT, ORDER );
+  static unsigned short const l_nVes = CE_N_FLUXN_MATRICES( T_SDISC.ELEMENT ) / l_nFas;
+
+  // set up kernels
+  edge::data::Dynamic l_dynMem;
+  edge::advection::kernels::SurfInt< real_base,
+                                     T_SDISC.ELEMENT,
+                                     ORDER,
+                                     N_CRUNS > l_ref( l_dynMem );
+  edge::advection::kernels::SurfIntFused< real_base,
+                                          T_SDISC.ELEMENT,
+                                          ORDER,
+                                          N_CRUNS > l_surf( l_dynMem );
+
+  // flux solvers, time integrated DOFs and initial DOFs
+  real_base l_fs[l_nFas];
+  for( unsigned short l_fa = 0; l_fa < l_nFas; l_fa++ ) l_fs[l_fa] = real_base(0.7) - real_base(0.3) * l_fa;
+
+  real_base l_tDofs[1][l_nMds][N_CRUNS];
+  real_base l_dofsRef[1][l_nMds][N_CRUNS];
+  real_base l_dofs[1][l_nMds][N_CRUNS];
+  for( unsigned short l_md = 0; l_md < l_nMds; l_md++ ) {
+    for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+      l_tDofs[0][l_md][l_cr] = real_base( (l_md*7 + l_cr*3) % 11 ) / 10 - real_base(0.5);
+      l_dofsRef[0][l_md][l_cr] = l_dofs[0][l_md][l_cr] = real_base( (l_md*5 + l_cr) % 13 ) / 20;
+    }
+  }
+
+  // element-local contribution
+  l_ref.local( l_fs, l_tDofs, l_dofsRef );
+  l_surf.local( l_fs, l_tDofs, l_dofs );
+
+  for( unsigned short l_md = 0; l_md < l_nMds; l_md++ ) {
+    for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+      REQUIRE( l_dofs[0][l_md][l_cr] == Approx( l_dofsRef[0][l_md][l_cr] ).margin(1E-5) );
+    }
+  }
+
+  // neighboring contributions, covering all flux matrices and the boundary case (no vertex id)
+  for( unsigned short l_fa = 0; l_fa < l_nFas; l_fa++ ) {
+    for( unsigned short l_ve = 0; l_ve <= l_nVes; l_ve++ ) {
+      unsigned short l_vId = (l_ve < l_nVes) ? l_ve : std::numeric_limits< unsigned short >::max();
+
+      for( unsigned short l_fId = 0; l_fId < l_nFas; l_fId++ ) {
+        l_ref.neigh( l_fa, l_vId, l_fId, l_fs[l_fId], l_tDofs, l_dofsRef );
+        l_surf.neigh( l_fa, l_vId, l_fId, l_fs[l_fId], l_tDofs, l_dofs );
+
+        for( unsigned short l_md = 0; l_md < l_nMds; l_md++ ) {
+          for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+            REQUIRE( l_dofs[0][l_md][l_cr] == Approx( l_dofsRef[0][l_md][l_cr] ).margin(1E-4) );
+          }
+        }
+      }
+    }
+  }
+}
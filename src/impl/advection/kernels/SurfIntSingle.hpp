@@ -0,0 +1,201 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Optimized surface integration for single advection forward runs.
+ **/
+#ifndef EDGE_ADVECTION_KERNELS_SURF_INT_SINGLE_HPP
+#define EDGE_ADVECTION_KERNELS_SURF_INT_SINGLE_HPP
+
+#include <limits>
+#include "constants.hpp"
+#include "dg/SurfInt.hpp"
+#include "data/MmXsmmSingle.hpp"
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP >
+      class SurfIntSingle;
+    }
+  }
+}
+
+/**
+ * Optimized quadrature-free ADER-DG surface integration for single advection forward runs.
+ *
+ * The flux solvers of the advection equation are scalars.
+ * Thus, the local contribution scales the face-projected DOFs of all faces first and then lifts them through the stacked, transposed flux matrices in a single call.
+ *
+ * @paramt TL_T_REAL real type.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP >
+class edge::advection::kernels::SurfIntSingle {
+  private:
+    //! number of faces
+    static unsigned short const TL_N_FAS = C_ENT[TL_T_EL].N_FACES;
+
+    //! number of face modes
+    static unsigned short const TL_N_MDS_FA = CE_N_ELEMENT_MODES( C_ENT[TL_T_EL].TYPE_FACES, TL_O_SP );
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS_EL = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of neigboring contribution flux matrices
+    static unsigned short const TL_N_FMNS = CE_N_FLUXN_MATRICES( TL_T_EL );
+
+    //! matrix kernels
+    edge::data::MmXsmmSingle< TL_T_REAL > m_mm;
+
+    //! pointers to the local and neighboring flux matrices
+    TL_T_REAL *m_fIntLN[TL_N_FAS+TL_N_FMNS];
+
+    //! pointers to the transposed flux matrices, which are stored consecutively
+    TL_T_REAL *m_fIntT[TL_N_FAS];
+
+  public:
+    /**
+     * Constructor of the optimized surface integration for single forward runs.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    SurfIntSingle( data::Dynamic & io_dynMem ) {
+      // store flux matrices
+      dg::SurfInt< TL_T_EL,
+                   TL_O_SP >::storeFluxDense( io_dynMem,
+                                              m_fIntLN,
+                                              m_fIntT );
+
+      // local and neighboring flux matrices
+      m_mm.add( 0,                           // group
+                TL_N_MDS_FA,                 // m
+                1,                           // n
+                TL_N_MDS_EL,                 // k
+                TL_N_MDS_FA,                 // ldA
+                TL_N_MDS_EL,                 // ldB
+                TL_N_MDS_FA,                 // ldC
+                static_cast<TL_T_REAL>(1.0), // alpha
+                static_cast<TL_T_REAL>(0.0), // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+
+      // stacked transposed flux matrices of all faces
+      m_mm.add( 1,                           // group
+                TL_N_MDS_EL,                 // m
+                1,                           // n
+                TL_N_FAS * TL_N_MDS_FA,      // k
+                TL_N_MDS_EL,                 // ldA
+                TL_N_FAS * TL_N_MDS_FA,      // ldB
+                TL_N_MDS_EL,                 // ldC
+                static_cast<TL_T_REAL>(1.0), // alpha
+                static_cast<TL_T_REAL>(1.0), // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+
+      // transposed flux matrix of a single face
+      m_mm.add( 1,                           // group
+                TL_N_MDS_EL,                 // m
+                1,                           // n
+                TL_N_MDS_FA,                 // k
+                TL_N_MDS_EL,                 // ldA
+                TL_N_MDS_FA,                 // ldB
+                TL_N_MDS_EL,                 // ldC
+                static_cast<TL_T_REAL>(1.0), // alpha
+                static_cast<TL_T_REAL>(1.0), // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+    }
+
+    /**
+     * Element-local contribution.
+     *
+     * @param i_fs flux solvers.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be updated with the contribution of the local surface integral.
+     **/
+    void local( TL_T_REAL const i_fs[TL_N_FAS],
+                TL_T_REAL const i_tDofs[1][TL_N_MDS_EL][1],
+                TL_T_REAL       io_dofs[1][TL_N_MDS_EL][1] ) const {
+      // scaled, face-projected DOFs of all faces
+      TL_T_REAL l_scratch[TL_N_FAS][TL_N_MDS_FA];
+
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        m_mm.m_kernels[0][0]( m_fIntLN[l_fa],
+                              i_tDofs[0][0],
+                              l_scratch[l_fa] );
+
+#pragma omp simd
+        for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
+          l_scratch[l_fa][l_md] *= i_fs[l_fa];
+        }
+      }
+
+      m_mm.m_kernels[1][0]( m_fIntT[0],
+                            l_scratch[0],
+                            io_dofs[0][0] );
+    }
+
+    /**
+     * Contribution of a neighboring element to the surface integral.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fs flux solver.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be update with the neighboring element's contribution.
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL            i_fs,
+                TL_T_REAL      const i_tDofs[1][TL_N_MDS_EL][1],
+                TL_T_REAL            io_dofs[1][TL_N_MDS_EL][1] ) const {
+      // derive the id of the neighboring flux matrix
+      unsigned short l_fMatId = std::numeric_limits< unsigned short >::max();
+      if( i_vId != std::numeric_limits< unsigned short >::max() ) {
+        l_fMatId = TL_N_FAS + i_vId * TL_N_FAS;
+        l_fMatId += i_fId;
+      }
+      else {
+        l_fMatId = i_fa;
+      }
+
+      // scaled, face-projected DOFs
+      TL_T_REAL l_scratch[TL_N_MDS_FA];
+
+      m_mm.m_kernels[0][0]( m_fIntLN[l_fMatId],
+                            i_tDofs[0][0],
+                            l_scratch );
+
+#pragma omp simd
+      for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
+        l_scratch[l_md] *= i_fs;
+      }
+
+      m_mm.m_kernels[1][1]( m_fIntT[i_fa],
+                            l_scratch,
+                            io_dofs[0][0] );
+    }
+};
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Optimized ADER time prediction for fused advection forward runs.
+ **/
+#ifndef EDGE_ADVECTION_KERNELS_TIME_PRED_FUSED_HPP
+#define EDGE_ADVECTION_KERNELS_TIME_PRED_FUSED_HPP
+
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "dg/Basis.h"
+#include "linalg/Matrix.h"
+#include "data/Dynamic.h"
+#include "data/MmXsmmFused.hpp"
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_O_TI,
+                unsigned short TL_N_CRS >
+      class TimePredFused;
+    }
+  }
+}
+
+/**
+ * Optimized ADER time prediction for fused advection forward runs.
+ *
+ * The star "matrices" of the advection equation are scalars.
+ * Thus, the derivatives are scaled for all dimensions first and then multiplied with the stacked, sparse stiffness matrices in a single call.
+ *
+ * @paramt TL_T_REAL real type.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP order in space.
+ * @paramt TL_O_TI order in time.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_O_TI,
+          unsigned short TL_N_CRS >
+class edge::advection::kernels::TimePredFused {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! matrix kernels
+    edge::data::MmXsmmFused< TL_T_REAL > m_mm;
+
+    //! non-zeros of the stacked, transposed stiffness matrices
+    TL_T_REAL *m_stiffT = nullptr;
+
+  public:
+    /**
+     * Constructor of the optimized time prediction for fused forward runs.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    TimePredFused( data::Dynamic & io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get transposed stiffness matrices, which are stacked in the first dimension
+      TL_T_REAL l_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS];
+      l_basis.getStiffMm1Dense( TL_N_MDS,
+                                l_stiffT[0][0],
+                                true );
+
+      // multiply with (-1) for kernels with support for alpha==1 only
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+        for( unsigned short l_m0 = 0; l_m0 < TL_N_MDS; l_m0++ )
+          for( unsigned short l_m1 = 0; l_m1 < TL_N_MDS; l_m1++ )
+            l_stiffT[l_di][l_m0][l_m1] = -l_stiffT[l_di][l_m0][l_m1];
+
+      t_matCsc l_stiffTCsc;
+      edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_DIS * TL_N_MDS,
+                                                     TL_N_MDS,
+                                                     l_stiffT[0][0],
+                                                     l_stiffTCsc,
+                                                     TOL.BASIS,
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     edge::data::MmXsmmFused< TL_T_REAL >::getFillIns()[0] );
+
+      // copy the non-zeros, split w.r.t. the chunks of fused runs, to a permanent data structure
+      std::vector< TL_T_REAL > l_nzs;
+      edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( m_mm.getNChs(), l_stiffTCsc, l_nzs );
+      m_stiffT = (TL_T_REAL*) io_dynMem.allocate( l_nzs.size() * sizeof(TL_T_REAL),
+                                                  4096,
+                                                  true );
+      for( std::size_t l_nz = 0; l_nz < l_nzs.size(); l_nz++ ) m_stiffT[l_nz] = l_nzs[l_nz];
+
+      // stacked stiffness matrices
+      m_mm.add( 0,                           // group
+                false,                       // csc
+                &l_stiffTCsc.colPtr[0],      // column pointer
+                &l_stiffTCsc.rowIdx[0],      // row index
+                &l_stiffTCsc.val[0],         // values
+                1,                           // m
+                TL_N_MDS,                    // n
+                TL_N_DIS * TL_N_MDS,         // k
+                TL_N_DIS * TL_N_MDS,         // ldA
+                0,                           // ldB
+                TL_N_MDS,                    // ldC
+                TL_T_REAL(1.0),              // alpha
+                TL_T_REAL(0.0),              // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+    }
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure and computes time derivatives and time integrated DOFs.
+     *
+     * @param i_dT time step.
+     * @param i_star star matrices.
+     * @param i_dofs DOFs.
+     * @param o_der will be set to time derivatives.
+     * @param o_tInt will be set to time integrated DOFs.
+     **/
+    void ck( TL_T_REAL       i_dT,
+             TL_T_REAL const i_star[TL_N_DIS],
+             TL_T_REAL const i_dofs[TL_N_MDS][TL_N_CRS],
+             TL_T_REAL       o_der[TL_O_TI][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL       o_tInt[TL_N_MDS][TL_N_CRS] ) const {
+      // derivatives, scaled by the star matrices
+      TL_T_REAL l_scaled[TL_N_DIS][TL_N_MDS][TL_N_CRS];
+
+      // scalar coefficients in taylor expansion
+      TL_T_REAL l_scalar = i_dT;
+
+      // initialize zero derivatives, reset time integrated dofs
+      for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+        for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+          o_der[0][l_md][l_cr] = i_dofs[l_md][l_cr];
+          o_tInt[l_md][l_cr]   = l_scalar * i_dofs[l_md][l_cr];
+        }
+      }
+
+      // iterate over time derivatives
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // scale previous derivative
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              l_scaled[l_di][l_md][l_cr] = i_star[l_di] * o_der[l_de-1][l_md][l_cr];
+            }
+          }
+        }
+
+        // multiply with transposed stiffness matrices and inverse mass matrix
+        m_mm.m_kernels[0][0]( l_scaled[0][0],
+                              m_stiffT,
+                              o_der[l_de][0] );
+
+        // update scalar
+        l_scalar *= i_dT / (l_de+1);
+
+        // update time integrated dofs
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            o_tInt[l_md][l_cr] += l_scalar * o_der[l_de][l_md][l_cr];
+          }
+        }
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the optimized advection time prediction for single forward simulations.
+ **/
+#include <catch.hpp>
+#define private public
+#include "TimePred.hpp"
+#include "TimePredSingle.hpp"
+#undef private
+
+TEST_CASE( "Optimized advection ADER time prediction for single forward simulations.", "[advection][TimePredSingle]" ) {
+  static unsigned short const l_nDis = C_ENT[T_SDISC.ELEMENT].N_DIM;
+  static unsigned short const l_nMds = CE_N_ELEMENT_MODES( T_SDISC.ELEMENT, ORDER );
+
+  // set up kernels
+  edge::data::Dynamic l_dynMem;
+  edge::advection::kernels::TimePred< real_base,
+                                      T_SDISC.ELEMENT,
+                                      ORDER,
+                                      ORDER,
+                                      1 > l_ref( l_dynMem );
+  edge::advection::kernels::TimePredSingle< real_base,
+                                            T_SDISC.ELEMENT,
+                                            ORDER,
+                                            ORDER > l_pred( l_dynMem );
+
+  // star matrices and DOFs
+  real_base l_star[l_nDis];
+  for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) l_star[l_di] = real_base(0.3) - real_base(0.4) * l_di;
+
+  real_base l_dofs[l_nMds][1];
+  for( unsigned short l_md = 0; l_md < l_nMds; l_md++ ) l_dofs[l_md][0] = real_base( (l_md*7) % 11 ) / 10 - real_base(0.5);
+
+  // apply the vanilla and optimized kernels
+  real_base l_derRef[ORDER][l_nMds][1];
+  real_base l_tIntRef[l_nMds][1];
+  l_ref.ck( real_base(0.05), l_star, l_dofs, l_derRef, l_tIntRef );
+
+  real_base l_der[ORDER][l_nMds][1];
+  real_base l_tInt[l_nMds][1];
+  l_pred.ck( real_base(0.05), l_star, l_dofs, l_der, l_tInt );
+
+  // check the results
+  for( unsigned short l_md = 0; l_md < l_nMds; l_md++ ) {
+    REQUIRE( l_tInt[l_md][0] == Approx( l_tIntRef[l_md][0] ).margin(1E-5) );
+
+    for( unsigned short l_de = 0; l_de < ORDER; l_de++ ) {
+      REQUIRE( l_der[l_de][l_md][0] == Approx( l_derRef[l_de][l_md][0] ).margin(1E-5) );
+    }
+  }
+}
@@ -0,0 +1,152 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Optimized volume integration for fused advection forward runs.
+ **/
+#ifndef EDGE_ADVECTION_KERNELS_VOL_INT_FUSED_HPP
+#define EDGE_ADVECTION_KERNELS_VOL_INT_FUSED_HPP
+
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "dg/Basis.h"
+#include "linalg/Matrix.h"
+#include "data/Dynamic.h"
+#include "data/MmXsmmFused.hpp"
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_N_CRS >
+      class VolIntFused;
+    }
+  }
+}
+
+/**
+ * Optimized quadrature-free ADER-DG volume integration for fused advection forward runs.
+ *
+ * @paramt TL_T_REAL real type.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_N_CRS >
+class edge::advection::kernels::VolIntFused {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! matrix kernels
+    edge::data::MmXsmmFused< TL_T_REAL > m_mm;
+
+    //! non-zeros of the stacked stiffness matrices
+    TL_T_REAL *m_stiff = nullptr;
+
+  public:
+    /**
+     * Constructor of the optimized volume integration for fused forward runs.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    VolIntFused( data::Dynamic & io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get stiffness matrices, which are stacked in the first dimension
+      TL_T_REAL l_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS];
+      l_basis.getStiffMm1Dense( TL_N_MDS,
+                                l_stiff[0][0],
+                                false );
+
+      t_matCsc l_stiffCsc;
+      edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_DIS * TL_N_MDS,
+                                                     TL_N_MDS,
+                                                     l_stiff[0][0],
+                                                     l_stiffCsc,
+                                                     TOL.BASIS,
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     std::numeric_limits< unsigned int >::max(),
+                                                     edge::data::MmXsmmFused< TL_T_REAL >::getFillIns()[0] );
+
+      // copy the non-zeros, split w.r.t. the chunks of fused runs, to a permanent data structure
+      std::vector< TL_T_REAL > l_nzs;
+      edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( m_mm.getNChs(), l_stiffCsc, l_nzs );
+      m_stiff = (TL_T_REAL*) io_dynMem.allocate( l_nzs.size() * sizeof(TL_T_REAL),
+                                                 4096,
+                                                 true );
+      for( std::size_t l_nz = 0; l_nz < l_nzs.size(); l_nz++ ) m_stiff[l_nz] = l_nzs[l_nz];
+
+      // stacked stiffness matrices
+      m_mm.add( 0,                      // group
+                false,                  // csc
+                &l_stiffCsc.colPtr[0],  // column pointer
+                &l_stiffCsc.rowIdx[0],  // row index
+                &l_stiffCsc.val[0],     // values
+                1,                      // m
+                TL_N_MDS,               // n
+                TL_N_DIS * TL_N_MDS,    // k
+                TL_N_DIS * TL_N_MDS,    // ldA
+                0,                      // ldB
+                TL_N_MDS,               // ldC
+                TL_T_REAL(1.0),         // alpha
+                TL_T_REAL(1.0),         // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+    }
+
+    /**
+     * Applies the volume contribution.
+     *
+     * @param i_star star matrices.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be updated with the contribution of the volume integral.
+     **/
+    void apply( TL_T_REAL const i_star[TL_N_DIS],
+                TL_T_REAL const i_tDofs[1][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL       io_dofs[1][TL_N_MDS][TL_N_CRS] ) const {
+      // time integrated DOFs, scaled by the star matrices
+      TL_T_REAL l_scaled[TL_N_DIS][TL_N_MDS][TL_N_CRS];
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            l_scaled[l_di][l_md][l_cr] = i_star[l_di] * i_tDofs[0][l_md][l_cr];
+          }
+        }
+      }
+
+      // multiply with stiffness and inverse mass matrices
+      m_mm.m_kernels[0][0]( l_scaled[0][0],
+                            m_stiff,
+                            io_dofs[0][0] );
+    }
+};
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Optimized volume integration for single advection forward runs.
+ **/
+#ifndef EDGE_ADVECTION_KERNELS_VOL_INT_SINGLE_HPP
+#define EDGE_ADVECTION_KERNELS_VOL_INT_SINGLE_HPP
+
+#include "constants.hpp"
+#include "dg/VolInt.hpp"
+#include "data/MmXsmmSingle.hpp"
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP >
+      class VolIntSingle;
+    }
+  }
+}
+
+/**
+ * Optimized quadrature-free ADER-DG volume integration for single advection forward runs.
+ *
+ * @paramt TL_T_REAL real type.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP >
+class edge::advection::kernels::VolIntSingle {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! matrix kernels
+    edge::data::MmXsmmSingle< TL_T_REAL > m_mm;
+
+    //! pointers to the stiffness matrices, which are stored consecutively
+    TL_T_REAL *m_stiff[TL_N_DIS];
+
+  public:
+    /**
+     * Constructor of the optimized volume integration for single forward runs.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    VolIntSingle( data::Dynamic & io_dynMem ) {
+      // store stiffness matrices
+      dg::VolInt< TL_T_EL,
+                  TL_O_SP >::storeStiffDense( io_dynMem,
+                                              m_stiff );
+
+      // stacked stiffness matrices
+      m_mm.add( 0,                           // group
+                TL_N_MDS,                    // m
+                1,                           // n
+                TL_N_DIS * TL_N_MDS,         // k
+                TL_N_MDS,                    // ldA
+                TL_N_DIS * TL_N_MDS,         // ldB
+                TL_N_MDS,                    // ldC
+                static_cast<TL_T_REAL>(1.0), // alpha
+                static_cast<TL_T_REAL>(1.0), // beta
+                LIBXSMM_GEMM_PREFETCH_NONE );
+    }
+
+    /**
+     * Applies the volume contribution.
+     *
+     * @param i_star star matrices.
+     * @param i_tDofs time integrated degrees of freedom.
+     * @param io_dofs will be updated with the contribution of the volume integral.
+     **/
+    void apply( TL_T_REAL const i_star[TL_N_DIS],
+                TL_T_REAL const i_tDofs[1][TL_N_MDS][1],
+                TL_T_REAL       io_dofs[1][TL_N_MDS][1] ) const {
+      // time integrated DOFs, scaled by the star matrices
+      TL_T_REAL l_scaled[TL_N_DIS][TL_N_MDS];
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+#pragma omp simd
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+          l_scaled[l_di][l_md] = i_star[l_di] * i_tDofs[0][l_md][0];
+        }
+      }
+
+      // multiply with stiffness and inverse mass matrices
+      m_mm.m_kernels[0][0]( m_stiff[0],
+                            l_scaled[0],
+                            io_dofs[0][0] );
+    }
+};
+
+#endif
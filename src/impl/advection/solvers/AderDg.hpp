@@ -28,9 +28,7 @@
 #include "linalg/Matrix.h"
 #include "linalg/Mappings.hpp"
 #include "linalg/Matrix.h"
-#include "../kernels/TimePred.hpp"
-#include "../kernels/VolInt.hpp"
-#include "../kernels/SurfInt.hpp"
+#include "../kernels/Kernels.hpp"
 #include "sc/Kernels.hpp"
 #include "sc/Detections.hpp"
 
@@ -78,24 +76,12 @@ class edge::advection::solvers::AderDg {
     //! number of DG modes
     static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
 
-    //! time prediction kernel
-    kernels::TimePred< TL_T_REAL,
-                       TL_T_EL,
-                       TL_O_SP,
-                       TL_O_TI,
-                       TL_N_CRS > * m_time;
-
-    //! volume kernel
-    kernels::VolInt< TL_T_REAL,
-                     TL_T_EL,
-                     TL_O_SP,
-                     TL_N_CRS > * m_volInt;
-
-    //! surface kernel
-    kernels::SurfInt< TL_T_REAL,
+    //! time prediction, volume and surface kernels
+    kernels::Kernels< TL_T_REAL,
                       TL_T_EL,
                       TL_O_SP,
-                      TL_N_CRS > * m_surfInt;
+                      TL_O_TI,
+                      TL_N_CRS > * m_kernels;
 
   public:
     /**
@@ -105,20 +91,10 @@ class edge::advection::solvers::AderDg {
      **/
     AderDg( data::Dynamic & io_dynMem ) {
       // init kernels
-      m_time = new kernels::TimePred< TL_T_REAL,
-                                      TL_T_EL,
-                                      TL_O_SP,
-                                      TL_O_TI,
-                                      TL_N_CRS >( io_dynMem );
-
-      m_volInt = new kernels::VolInt< TL_T_REAL,
-                                      TL_T_EL,
-                                      TL_O_SP,
-                                      TL_N_CRS >( io_dynMem );
-
-      m_surfInt = new kernels::SurfInt< TL_T_REAL,
+      m_kernels = new kernels::Kernels< TL_T_REAL,
                                         TL_T_EL,
                                         TL_O_SP,
+                                        TL_O_TI,
                                         TL_N_CRS >( io_dynMem );
     }
 
@@ -127,9 +103,7 @@ class edge::advection::solvers::AderDg {
      **/
     ~AderDg() {
       // free memory
-      delete m_time;
-      delete m_volInt;
-      delete m_surfInt;
+      delete m_kernels;
     }
 
     /**
@@ -210,21 +184,21 @@ class edge::advection::solvers::AderDg {
       for( TL_T_LID l_el = i_first; l_el < i_first+i_nEls; l_el++ ) {
         // compute ader time prediction
         TL_T_REAL l_derBuffer[TL_O_TI][TL_N_MDS][TL_N_CRS];
-        m_time->ck( i_dt,
-                    i_starM[l_el],
-                    io_dofsDg[l_el][0],
-                    l_derBuffer,
-                    o_tDofsDg[0][l_el][0] );
+        m_kernels->m_time.ck( i_dt,
+                              i_starM[l_el],
+                              io_dofsDg[l_el][0],
+                              l_derBuffer,
+                              o_tDofsDg[0][l_el][0] );
 
         // compute volume contribution
-        m_volInt->apply( i_starM[l_el],
-                         o_tDofsDg[0][l_el],
-                         io_dofsDg[l_el] );
+        m_kernels->m_volInt.apply( i_starM[l_el],
+                                   o_tDofsDg[0][l_el],
+                                   io_dofsDg[l_el] );
 
         // compute local surface contribution
-        m_surfInt->local( i_fluxSolvers[l_el],
-                          o_tDofsDg[0][l_el],
-                          io_dofsDg[l_el] );
+        m_kernels->m_surfInt.local( i_fluxSolvers[l_el],
+                                    o_tDofsDg[0][l_el],
+                                    io_dofsDg[l_el] );
       }
     }
 
@@ -285,12 +259,12 @@ class edge::advection::solvers::AderDg {
             l_fId = i_fIdElFaEl[l_el][l_fa];
           }
 
-          m_surfInt->neigh( l_fa,
-                            l_vId,
-                            l_fId,
-                            i_fluxSolvers[l_el][TL_N_FAS+l_fa],
-                            i_tDofs[0][l_ne],
-                            io_dofs[l_el] );
+          m_kernels->m_surfInt.neigh( l_fa,
+                                      l_vId,
+                                      l_fId,
+                                      i_fluxSolvers[l_el][TL_N_FAS+l_fa],
+                                      i_tDofs[0][l_ne],
+                                      io_dofs[l_el] );
       }
     }
   }
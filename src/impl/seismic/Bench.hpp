@@ -0,0 +1,858 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmarks of the seismic kernels and the ADER-DG drivers on synthetic element batches.
+ **/
+#ifndef EDGE_SEISMIC_BENCH_HPP
+#define EDGE_SEISMIC_BENCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "parallel/global.h"
+#include "data/Dynamic.h"
+#include "monitor/Timer.hpp"
+#include "io/logging.h"
+#include "io/Receivers.h"
+#include "kernels/TimePredVanilla.hpp"
+#include "kernels/VolIntVanilla.hpp"
+#include "kernels/SurfIntVanilla.hpp"
+#if defined(PP_T_KERNELS_XSMM_DENSE_SINGLE)
+#include "kernels/TimePredSingle.hpp"
+#include "kernels/VolIntSingle.hpp"
+#include "kernels/SurfIntSingle.hpp"
+#elif defined(PP_T_KERNELS_XSMM)
+#include "kernels/TimePredFused.hpp"
+#include "kernels/VolIntFused.hpp"
+#include "kernels/SurfIntFused.hpp"
+#elif defined(PP_T_KERNELS_SIMD)
+#include "kernels/TimePredSimd.hpp"
+#include "kernels/VolIntSimd.hpp"
+#include "kernels/SurfIntSimd.hpp"
+#endif
+#include "solvers/AderDg.hpp"
+
+namespace edge {
+  namespace seismic {
+    template< typename       TL_T_REAL,
+              unsigned short TL_N_RMS,
+              t_entityType   TL_T_EL,
+              unsigned short TL_O_SP,
+              unsigned short TL_O_TI,
+              unsigned short TL_N_CRS >
+    class Bench;
+  }
+}
+
+/**
+ * Benchmarks the time prediction, volume and surface kernels of all available backends, and the ADER-DG drivers.
+ *
+ * All benchmarks operate on a synthetic batch of elements, which are not connected through a geometrically valid mesh.
+ * Instead, every element is a copy of the reference element and the face-neighbors are given by flipping one bit of the element id per face.
+ * This yields the memory access pattern of an ordered mesh, while the batch size can be chosen freely.
+ *
+ * Reported floating point operations are those of the dense formulation, as executed by the vanilla kernels.
+ * Backends exploiting sparsity perform fewer operations, the derived rates are dense-equivalent.
+ * Reported bytes are the compulsory element-local traffic, assuming that global matrices and per-thread scratch memory are cache-resident.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_RMS number of relaxation mechanisms.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP order in space.
+ * @paramt TL_O_TI order in time.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_RMS,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_O_TI,
+          unsigned short TL_N_CRS >
+class edge::seismic::Bench {
+  public:
+    //! result of a single benchmark
+    typedef struct {
+      //! name of the kernel
+      std::string kernel;
+      //! backend of the kernel
+      std::string backend;
+      //! number of element updates
+      double nUps;
+      //! duration in seconds
+      double time;
+      //! nominal number of floating point operations
+      double flops;
+      //! nominal number of bytes moved from and to memory
+      double bytes;
+    } t_result;
+
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of vertices per element
+    static unsigned short const TL_N_VES_EL = C_ENT[TL_T_EL].N_VERTICES;
+
+    //! number of faces
+    static unsigned short const TL_N_FAS = C_ENT[TL_T_EL].N_FACES;
+
+    //! number of DG element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of DG face modes
+    static unsigned short const TL_N_MDS_FA = CE_N_ELEMENT_MODES( C_ENT[TL_T_EL].TYPE_FACES, TL_O_SP );
+
+    //! number of elastic quantities
+    static unsigned short const TL_N_QTS_E = CE_N_QTS_E( TL_N_DIS );
+
+    //! number of quantities per relaxation mechanism
+    static unsigned short const TL_N_QTS_M = CE_N_QTS_M( TL_N_DIS );
+
+    //! number of entries in the elastic flux solvers
+    static unsigned short const TL_N_ENS_FS_E = CE_N_ENS_FS_E_DE( TL_N_DIS );
+
+    //! number of entries in the anelastic flux solvers
+    static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
+
+    //! per-thread scratch memory of the kernels
+    typedef struct {
+      TL_T_REAL tmp[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+      TL_T_REAL derE[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+      TL_T_REAL derA[CE_MAX(int(TL_N_RMS),1)][TL_O_TI][TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+      TL_T_REAL tmpFa[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS];
+      TL_T_REAL upA[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+    } t_scratch;
+
+    //! number of elements in the batch
+    int_el m_nEls;
+
+    //! number of faces in the batch
+    int_el m_nFas;
+
+    //! number of repetitions
+    unsigned int m_nReps;
+
+    //! vertex characteristics
+    std::vector< t_vertexChars > m_veChars;
+
+    //! face characteristics
+    std::vector< t_faceChars > m_faChars;
+
+    //! element characteristics
+    std::vector< t_elementChars > m_elChars;
+
+    //! background parameters
+    std::vector< t_bgPars > m_bgPars;
+
+    //! elements adjacent to the faces
+    std::vector< int_el > m_faEl;
+
+    //! vertices adjacent to the elements
+    std::vector< int_el > m_elVe;
+
+    //! faces adjacent to the elements
+    std::vector< int_el > m_elFa;
+
+    //! face-neighboring elements
+    std::vector< int_el > m_elFaEl;
+
+    //! identity mapping for mesh and data ids of the elements
+    std::vector< int_el > m_elMeDa;
+
+    //! local face ids of the face-neighboring elements
+    std::vector< unsigned short > m_fIdElFaEl;
+
+    //! local vertex ids of the face-neighboring elements
+    std::vector< unsigned short > m_vIdElFaEl;
+
+    //! results of the benchmarks
+    std::vector< t_result > m_res;
+
+    /**
+     * Nominal floating point operations of a matrix-matrix multiplication, including all fused simulations.
+     *
+     * @param i_m number of rows in A and C.
+     * @param i_n number of columns in B and C.
+     * @param i_k number of columns in A and rows in B.
+     * @return number of floating point operations.
+     **/
+    static double gemm( unsigned int i_m,
+                        unsigned int i_n,
+                        unsigned int i_k ) {
+      return 2.0 * i_m * i_n * i_k * TL_N_CRS;
+    }
+
+    /**
+     * Nominal floating point operations of the time prediction for a single element.
+     *
+     * @return number of floating point operations.
+     **/
+    static double flopsTimePred() {
+      // scaling of the zero-th derivative
+      double l_flops = double(TL_N_QTS_E + TL_N_RMS * TL_N_QTS_M) * TL_N_MDS * TL_N_CRS;
+
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // the viscoelastic kernels do not exploit the zero-blocks of the derivatives
+        unsigned short l_re = (TL_N_RMS == 0) ? l_de : 1;
+        unsigned int l_n = CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_re   );
+        unsigned int l_k = CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_re-1 );
+
+        l_flops += TL_N_DIS * (   gemm( TL_N_QTS_E, l_n, l_k )
+                                + gemm( TL_N_QTS_E, l_n, TL_N_QTS_E ) );
+        if( TL_N_RMS > 0 ) {
+          l_flops += TL_N_DIS * gemm( TL_N_QTS_M, l_n, TL_N_DIS );
+          l_flops += TL_N_RMS * (   gemm( TL_N_QTS_M, TL_N_MDS, TL_N_QTS_M )
+                                  + 4.0 * TL_N_QTS_M * TL_N_MDS * TL_N_CRS );
+        }
+
+        // update of the time integrated DOFs
+        unsigned int l_nCpMds = (TL_N_RMS == 0) ? l_n : TL_N_MDS;
+        l_flops += 2.0 * TL_N_QTS_E * l_nCpMds * TL_N_CRS;
+      }
+
+      return l_flops;
+    }
+
+    /**
+     * Nominal floating point operations of the volume integration for a single element.
+     *
+     * @return number of floating point operations.
+     **/
+    static double flopsVolInt() {
+      double l_flops = TL_N_DIS * (   gemm( TL_N_QTS_E, TL_N_MDS, CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, 1 ) )
+                                    + gemm( TL_N_QTS_E, TL_N_MDS, TL_N_QTS_E ) );
+      if( TL_N_RMS > 0 ) {
+        l_flops += TL_N_DIS * gemm( TL_N_QTS_M, TL_N_MDS, TL_N_DIS );
+        l_flops += TL_N_RMS * (   gemm( TL_N_QTS_M, TL_N_MDS, TL_N_QTS_M )
+                                + 3.0 * TL_N_QTS_M * TL_N_MDS * TL_N_CRS );
+      }
+      return l_flops;
+    }
+
+    /**
+     * Nominal floating point operations of the local or neighboring surface integration for a single element.
+     *
+     * @return number of floating point operations.
+     **/
+    static double flopsSurfInt() {
+      double l_flops = TL_N_FAS * (   gemm( TL_N_QTS_E, TL_N_MDS_FA, TL_N_MDS    )
+                                    + gemm( TL_N_QTS_E, TL_N_MDS_FA, TL_N_QTS_E  )
+                                    + gemm( TL_N_QTS_E, TL_N_MDS,    TL_N_MDS_FA ) );
+      if( TL_N_RMS > 0 ) {
+        l_flops += TL_N_FAS * (   gemm( TL_N_QTS_M, TL_N_MDS_FA, TL_N_QTS_E  )
+                                + gemm( TL_N_QTS_M, TL_N_MDS,    TL_N_MDS_FA ) );
+        l_flops += 2.0 * TL_N_RMS * TL_N_QTS_M * TL_N_MDS * TL_N_CRS;
+      }
+      return l_flops;
+    }
+
+    /**
+     * Fills the given array with deterministic, bounded values.
+     *
+     * @param i_nVals number of values.
+     * @param i_sca scaling of the values.
+     * @param o_vals will be set to the values.
+     **/
+    static void fill( std::size_t   i_nVals,
+                      double        i_sca,
+                      TL_T_REAL   * o_vals ) {
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+      for( std::size_t l_va = 0; l_va < i_nVals; l_va++ ) {
+        o_vals[l_va] = i_sca * std::sin( 0.37 * l_va + 0.1 );
+      }
+    }
+
+    /**
+     * Allocates an array and fills it with deterministic values.
+     *
+     * @param i_nVals number of values.
+     * @param i_sca scaling of the values.
+     * @param io_dynMem dynamic memory allocations.
+     * @return pointer to the array, nullptr if no values were requested.
+     **/
+    static TL_T_REAL * alloc( std::size_t     i_nVals,
+                              double          i_sca,
+                              data::Dynamic & io_dynMem ) {
+      TL_T_REAL * l_vals = (TL_T_REAL *) io_dynMem.allocate( i_nVals * sizeof(TL_T_REAL),
+                                                              ALIGNMENT.BASE.HEAP );
+      fill( i_nVals, i_sca, l_vals );
+      return l_vals;
+    }
+
+    /**
+     * Allocates per-thread scratch memory.
+     *
+     * @param io_dynMem dynamic memory allocations.
+     * @return scratch memory, one entry per thread.
+     **/
+    static std::vector< t_scratch * > scratch( data::Dynamic & io_dynMem ) {
+      std::vector< t_scratch * > l_scratch( parallel::g_nThreads );
+      for( int l_td = 0; l_td < parallel::g_nThreads; l_td++ ) {
+        l_scratch[l_td] = (t_scratch *) io_dynMem.allocate( sizeof(t_scratch),
+                                                             ALIGNMENT.BASE.HEAP );
+      }
+      return l_scratch;
+    }
+
+    /**
+     * Times the given function, which is called once per element (or chunk of elements) and repetition.
+     * A single warm-up repetition is excluded from the measurement.
+     *
+     * @param i_kernel name of the kernel.
+     * @param i_backend backend of the kernel.
+     * @param i_nIts number of iterations per repetition.
+     * @param i_flops nominal floating point operations per element.
+     * @param i_bytes nominal bytes moved per element.
+     * @param i_fun function, which is called for every iteration.
+     *
+     * @paramt TL_T_FUN type of the function.
+     **/
+    template< typename TL_T_FUN >
+    void measure( std::string const & i_kernel,
+                  std::string const & i_backend,
+                  int_el              i_nIts,
+                  double              i_flops,
+                  double              i_bytes,
+                  TL_T_FUN            i_fun ) {
+      monitor::Timer l_timer;
+
+      for( unsigned int l_re = 0; l_re < m_nReps+1; l_re++ ) {
+        // exclude the warm-up repetition
+        if( l_re == 1 ) l_timer.start();
+
+#ifdef PP_USE_OMP
+#pragma omp parallel for schedule(static)
+#endif
+        for( int_el l_it = 0; l_it < i_nIts; l_it++ ) {
+          i_fun( l_it );
+        }
+      }
+      l_timer.end();
+
+      t_result l_res;
+      l_res.kernel  = i_kernel;
+      l_res.backend = i_backend;
+      l_res.nUps    = double(m_nEls) * m_nReps;
+      l_res.time    = l_timer.elapsed();
+      l_res.flops   = i_flops * l_res.nUps;
+      l_res.bytes   = i_bytes * l_res.nUps;
+      m_res.push_back( l_res );
+
+      EDGE_LOG_INFO << "  " << i_kernel << " (" << i_backend << "): "
+                    << l_res.time << "s, "
+                    << l_res.flops / l_res.time * 1.0E-9 << " GFLOPS, "
+                    << l_res.bytes / l_res.time * 1.0E-9 << " GB/s";
+    }
+
+    /**
+     * Initializes the synthetic batch of elements.
+     **/
+    void initBatch() {
+      // flip one bit of the element id per face to get the neighbor
+      m_nFas = (m_nEls * TL_N_FAS) / 2;
+
+      m_veChars.resize( std::size_t(m_nEls) * TL_N_VES_EL );
+      m_faChars.resize( m_nFas );
+      m_elChars.resize( m_nEls );
+      m_bgPars.resize( m_nEls );
+      m_faEl.resize( std::size_t(m_nFas) * 2 );
+      m_elVe.resize( std::size_t(m_nEls) * TL_N_VES_EL );
+      m_elFa.resize( std::size_t(m_nEls) * TL_N_FAS );
+      m_elFaEl.resize( std::size_t(m_nEls) * TL_N_FAS );
+      m_elMeDa.resize( m_nEls );
+      m_fIdElFaEl.resize( std::size_t(m_nEls) * TL_N_FAS );
+      m_vIdElFaEl.resize( std::size_t(m_nEls) * TL_N_FAS );
+
+      int_el l_fa = 0;
+      for( int_el l_el = 0; l_el < m_nEls; l_el++ ) {
+        // copies of the reference element, shifted in x-direction
+        for( unsigned short l_ve = 0; l_ve < TL_N_VES_EL; l_ve++ ) {
+          std::size_t l_veId = std::size_t(l_el) * TL_N_VES_EL + l_ve;
+          m_elVe[l_veId] = l_veId;
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            m_veChars[l_veId].coords[l_di] = (l_di < TL_N_DIS) ? C_REF_ELEMENT.VE.ENT[TL_T_EL][l_di*TL_N_VES_EL + l_ve] : 0;
+          }
+          m_veChars[l_veId].coords[0] += l_el;
+          m_veChars[l_veId].spType = 0;
+        }
+
+        m_elChars[l_el].volume = C_REF_ELEMENT.VOL.ENT[TL_T_EL][0];
+        m_elChars[l_el].inDia  = 0.5;
+        m_elChars[l_el].spType = C_LTS_EL[EL_INT];
+
+        m_bgPars[l_el].rho = 1.0;
+        m_bgPars[l_el].lam = 2.0;
+        m_bgPars[l_el].mu  = 1.0;
+        m_bgPars[l_el].qp  = 50.0;
+        m_bgPars[l_el].qs  = 25.0;
+
+        m_elMeDa[l_el] = l_el;
+
+        for( unsigned short l_lf = 0; l_lf < TL_N_FAS; l_lf++ ) {
+          int_el l_ne = l_el ^ (int_el(1) << l_lf);
+          std::size_t l_id = std::size_t(l_el) * TL_N_FAS + l_lf;
+
+          m_elFaEl[l_id]    = l_ne;
+          m_fIdElFaEl[l_id] = l_lf;
+          m_vIdElFaEl[l_id] = 0;
+
+          // the element with the smaller id owns the face
+          if( l_el < l_ne ) {
+            m_faEl[std::size_t(l_fa)*2 + 0] = l_el;
+            m_faEl[std::size_t(l_fa)*2 + 1] = l_ne;
+            m_elFa[l_id] = l_fa;
+            m_elFa[std::size_t(l_ne) * TL_N_FAS + l_lf] = l_fa;
+
+            for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+              m_faChars[l_fa].outNormal[l_di] = (l_di == 0) ? 1 : 0;
+              m_faChars[l_fa].tangent0[l_di]  = (l_di == 1) ? 1 : 0;
+              m_faChars[l_fa].tangent1[l_di]  = (l_di == 2) ? 1 : 0;
+            }
+            m_faChars[l_fa].area   = 1;
+            m_faChars[l_fa].spType = MESH_TYPE_NONE;
+            l_fa++;
+          }
+        }
+      }
+      EDGE_CHECK_EQ( l_fa, m_nFas );
+    }
+
+    /**
+     * Benchmarks the time prediction, volume and surface kernels of a backend.
+     *
+     * @param i_backend name of the backend.
+     *
+     * @paramt TL_MATS_SP true if the backend expects sparse star matrices.
+     * @paramt TL_T_TIME type of the time prediction.
+     * @paramt TL_T_VOL type of the volume integration.
+     * @paramt TL_T_SURF type of the surface integration.
+     **/
+    template< bool     TL_MATS_SP,
+              typename TL_T_TIME,
+              typename TL_T_VOL,
+              typename TL_T_SURF >
+    void runKernels( std::string const & i_backend ) {
+      static unsigned short const TL_N_ENS_STAR_E = (TL_MATS_SP) ? CE_N_ENS_STAR_E_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_STAR_E_DE( TL_N_DIS );
+      static unsigned short const TL_N_ENS_STAR_A = (TL_MATS_SP) ? CE_N_ENS_STAR_A_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_STAR_A_DE( TL_N_DIS );
+      static unsigned short const TL_N_ENS_SRC_A  = (TL_MATS_SP) ? CE_N_ENS_SRC_A_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_SRC_A_DE( TL_N_DIS );
+
+      data::Dynamic l_dynMem;
+      std::size_t l_nEls = m_nEls;
+
+      // relaxation frequencies
+      TL_T_REAL l_rfs[CE_MAX(int(TL_N_RMS),1)];
+      for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) l_rfs[l_rm] = TL_T_REAL(1) / (l_rm+1);
+
+      // kernels
+      TL_T_TIME l_time( l_rfs, l_dynMem );
+      TL_T_VOL  l_vol(  l_rfs, l_dynMem );
+      TL_T_SURF l_surf( l_rfs, l_dynMem );
+
+      // element-local matrices
+      TL_T_REAL (*l_starE)[TL_N_DIS][TL_N_ENS_STAR_E] = (TL_T_REAL (*)[TL_N_DIS][TL_N_ENS_STAR_E]) alloc( l_nEls * TL_N_DIS * TL_N_ENS_STAR_E, 0.01, l_dynMem );
+      TL_T_REAL (*l_starA)[TL_N_DIS][TL_N_ENS_STAR_A] = (TL_T_REAL (*)[TL_N_DIS][TL_N_ENS_STAR_A]) alloc( (TL_N_RMS > 0) * l_nEls * TL_N_DIS * TL_N_ENS_STAR_A, 0.01, l_dynMem );
+      TL_T_REAL (*l_srcA)[TL_N_ENS_SRC_A] = (TL_T_REAL (*)[TL_N_ENS_SRC_A]) alloc( l_nEls * TL_N_RMS * TL_N_ENS_SRC_A, 0.01, l_dynMem );
+      TL_T_REAL (*l_fsE[2])[TL_N_FAS][TL_N_ENS_FS_E];
+      TL_T_REAL (*l_fsA[2])[TL_N_FAS][TL_N_ENS_FS_A];
+      for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
+        l_fsE[l_sd] = (TL_T_REAL (*)[TL_N_FAS][TL_N_ENS_FS_E]) alloc( l_nEls * TL_N_FAS * TL_N_ENS_FS_E, 0.01, l_dynMem );
+        l_fsA[l_sd] = (TL_T_REAL (*)[TL_N_FAS][TL_N_ENS_FS_A]) alloc( (TL_N_RMS > 0) * l_nEls * TL_N_FAS * TL_N_ENS_FS_A, 0.01, l_dynMem );
+      }
+
+      // DOFs and time integrated DOFs
+      typedef TL_T_REAL (*t_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+      typedef TL_T_REAL (*t_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+      t_dofsE l_dofsE  = (t_dofsE) alloc( l_nEls * TL_N_QTS_E * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+      t_dofsE l_tDofsE = (t_dofsE) alloc( l_nEls * TL_N_QTS_E * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+      t_dofsA l_dofsA  = (t_dofsA) alloc( l_nEls * TL_N_RMS * TL_N_QTS_M * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+      t_dofsA l_tDofsA = (t_dofsA) alloc( l_nEls * TL_N_RMS * TL_N_QTS_M * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+
+      std::vector< t_scratch * > l_scratch = scratch( l_dynMem );
+      int_el const (*l_elFaEl)[TL_N_FAS] = (int_el const (*)[TL_N_FAS]) m_elFaEl.data();
+
+      // bytes of the element-local data
+      double l_bDofsE = double(TL_N_QTS_E) * TL_N_MDS * TL_N_CRS * sizeof(TL_T_REAL);
+      double l_bDofsA = double(TL_N_RMS) * TL_N_QTS_M * TL_N_MDS * TL_N_CRS * sizeof(TL_T_REAL);
+      double l_bStar  = (   double(TL_N_DIS) * TL_N_ENS_STAR_E
+                          + (TL_N_RMS > 0) * double(TL_N_DIS) * TL_N_ENS_STAR_A
+                          + double(TL_N_RMS) * TL_N_ENS_SRC_A ) * sizeof(TL_T_REAL);
+      double l_bFs    = (   double(TL_N_FAS) * TL_N_ENS_FS_E
+                          + (TL_N_RMS > 0) * double(TL_N_FAS) * TL_N_ENS_FS_A ) * sizeof(TL_T_REAL);
+
+      // time prediction: read DOFs, write time integrated DOFs
+      measure( "TimePred",
+               i_backend,
+               m_nEls,
+               flopsTimePred(),
+               2 * (l_bDofsE + l_bDofsA) + l_bStar,
+               [&]( int_el i_el ) {
+                 t_scratch *l_sc = l_scratch[parallel::g_thread];
+                 l_time.ck( TL_T_REAL(1.0E-5),
+                            l_starE[i_el],
+                            (TL_N_RMS > 0) ? l_starA[i_el] : nullptr,
+                            l_srcA + std::size_t(i_el) * TL_N_RMS,
+                            l_dofsE[i_el],
+                            l_dofsA + std::size_t(i_el) * TL_N_RMS,
+                            l_sc->tmp,
+                            l_sc->derE,
+                            l_sc->derA,
+                            l_tDofsE[i_el],
+                            l_tDofsA + std::size_t(i_el) * TL_N_RMS );
+               } );
+
+      // volume integration: read time integrated DOFs, update DOFs
+      measure( "VolInt",
+               i_backend,
+               m_nEls,
+               flopsVolInt(),
+               3 * (l_bDofsE + l_bDofsA) + l_bStar,
+               [&]( int_el i_el ) {
+                 t_scratch *l_sc = l_scratch[parallel::g_thread];
+                 l_vol.apply( l_starE[i_el],
+                              (TL_N_RMS > 0) ? l_starA[i_el] : nullptr,
+                              l_srcA + std::size_t(i_el) * TL_N_RMS,
+                              l_tDofsE[i_el],
+                              l_tDofsA + std::size_t(i_el) * TL_N_RMS,
+                              l_dofsE[i_el],
+                              l_dofsA + std::size_t(i_el) * TL_N_RMS,
+                              l_sc->tmp );
+               } );
+
+      // local surface integration: read time integrated DOFs, update DOFs
+      measure( "SurfIntLocal",
+               i_backend,
+               m_nEls,
+               flopsSurfInt(),
+               3 * l_bDofsE + 2 * l_bDofsA + l_bFs / 2,
+               [&]( int_el i_el ) {
+                 t_scratch *l_sc = l_scratch[parallel::g_thread];
+                 int_el l_pre = (i_el < m_nEls-1) ? i_el+1 : i_el;
+                 l_surf.local( l_fsE[0][i_el],
+                               (TL_N_RMS > 0) ? l_fsA[0][i_el] : nullptr,
+                               l_tDofsE[i_el],
+                               l_dofsE[i_el],
+                               l_dofsA + std::size_t(i_el) * TL_N_RMS,
+                               l_sc->tmpFa,
+                               l_dofsE[l_pre],
+                               l_tDofsE[l_pre] );
+               } );
+
+      // neighboring surface integration: read time integrated DOFs of the neighbors, update DOFs
+      measure( "SurfIntNeigh",
+               i_backend,
+               m_nEls,
+               flopsSurfInt(),
+               (TL_N_FAS+2) * l_bDofsE + 2 * l_bDofsA + l_bFs / 2,
+               [&]( int_el i_el ) {
+                 t_scratch *l_sc = l_scratch[parallel::g_thread];
+                 if( TL_N_RMS > 0 ) {
+                   for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+                     for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                       for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                         l_sc->upA[l_qt][l_md][l_cr] = 0;
+                 }
+
+                 for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+                   int_el l_ne = l_elFaEl[i_el][l_fa];
+                   int_el l_pre = (l_fa < TL_N_FAS-1) ? l_elFaEl[i_el][l_fa+1] : l_ne;
+
+                   l_surf.neigh( l_fa,
+                                 m_vIdElFaEl[std::size_t(i_el) * TL_N_FAS + l_fa],
+                                 m_fIdElFaEl[std::size_t(i_el) * TL_N_FAS + l_fa],
+                                 l_fsE[1][i_el][l_fa],
+                                 (TL_N_RMS > 0) ? l_fsA[1][i_el][l_fa] : nullptr,
+                                 l_tDofsE[l_ne],
+                                 l_dofsE[i_el],
+                                 l_sc->upA,
+                                 l_sc->tmpFa,
+                                 l_tDofsE[l_pre] );
+                 }
+
+                 if( TL_N_RMS > 0 ) {
+                   l_surf.scatterUpdateA( l_sc->upA,
+                                          l_dofsA + std::size_t(i_el) * TL_N_RMS );
+                 }
+               } );
+    }
+
+    /**
+     * Benchmarks the local and neighboring drivers of the ADER-DG solver with the backend of the build.
+     * The drivers operate on chunks of elements, as done in the time stepping.
+     *
+     * @param i_backend name of the backend.
+     * @param i_recompFs true if the flux solvers are recomputed on the fly, instead of being stored.
+     * @param i_mm matrix-matrix multiplication kernels.
+     *
+     * @paramt TL_MATS_SP true if the element-local matrices are sparse.
+     * @paramt TL_T_MM type of the matrix-matrix multiplication kernels.
+     **/
+    template< bool     TL_MATS_SP,
+              typename TL_T_MM >
+    void runSolver( std::string const & i_backend,
+                    bool                i_recompFs,
+                    TL_T_MM     const & i_mm ) {
+      static unsigned short const TL_N_ENS_STAR_E = (TL_MATS_SP) ? CE_N_ENS_STAR_E_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_STAR_E_DE( TL_N_DIS );
+      static unsigned short const TL_N_ENS_STAR_A = (TL_MATS_SP) ? CE_N_ENS_STAR_A_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_STAR_A_DE( TL_N_DIS );
+      static unsigned short const TL_N_ENS_SRC_A  = (TL_MATS_SP) ? CE_N_ENS_SRC_A_SP( TL_N_DIS )
+                                                                 : CE_N_ENS_SRC_A_DE( TL_N_DIS );
+
+      // number of elements per chunk
+      int_el l_nElsCh = 64;
+      int_el l_nChs = (m_nEls + l_nElsCh - 1) / l_nElsCh;
+
+      data::Dynamic l_dynMem;
+      std::size_t l_nEls = m_nEls;
+
+      // the solver overwrites the background parameters in viscoelastic settings
+      std::vector< t_bgPars > l_bgPars = m_bgPars;
+
+      solvers::AderDg< TL_T_REAL,
+                       TL_N_RMS,
+                       TL_T_EL,
+                       TL_O_SP,
+                       TL_O_TI,
+                       TL_N_CRS,
+                       TL_MATS_SP > l_aderDg( m_nEls,
+                                              m_nFas,
+                     (int_el const (*)[2])           m_faEl.data(),
+                     (int_el const (*)[TL_N_VES_EL]) m_elVe.data(),
+                     (int_el const (*)[TL_N_FAS])    m_elFa.data(),
+                                                     m_elMeDa.data(),
+                                                     m_elMeDa.data(),
+                                                     m_veChars.data(),
+                                                     m_faChars.data(),
+                                                     m_elChars.data(),
+                                                     l_bgPars.data(),
+                                                     5.0,
+                                                     100.0,
+                                                     l_dynMem,
+                                                     nullptr,
+                                                     i_recompFs );
+
+      // DOFs and time integrated DOFs
+      TL_T_REAL (*l_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] = (TL_T_REAL (*)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS]) alloc( l_nEls * TL_N_QTS_E * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+      TL_T_REAL (*l_dofsA)[TL_N_MDS][TL_N_CRS] = (TL_T_REAL (*)[TL_N_MDS][TL_N_CRS]) alloc( l_nEls * TL_N_RMS * TL_N_QTS_M * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+      TL_T_REAL (*l_tDofsRaw)[TL_N_MDS][TL_N_CRS] = (TL_T_REAL (*)[TL_N_MDS][TL_N_CRS]) alloc( l_nEls * TL_N_QTS_E * TL_N_MDS * TL_N_CRS, 1.0, l_dynMem );
+
+      // only the time integrated DOFs are used in the absence of local time stepping
+      std::vector< TL_T_REAL (*)[TL_N_MDS][TL_N_CRS] > l_tDofsPtrs( l_nEls );
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_tDofsPtrs[l_el] = l_tDofsRaw + l_el * TL_N_QTS_E;
+      TL_T_REAL (**l_tDofsDg[4])[TL_N_MDS][TL_N_CRS] = { l_tDofsPtrs.data(),
+                                                         l_tDofsPtrs.data(),
+                                                         l_tDofsPtrs.data(),
+                                                         l_tDofsPtrs.data() };
+
+      // receivers are not used, since no element carries the receiver flag
+      io::Receivers l_recvs;
+
+      // connectivity info
+      int_el         const (*l_lpFaLp)[TL_N_FAS]    = nullptr;
+      int_el         const (*l_elFa)[TL_N_FAS]      = (int_el const (*)[TL_N_FAS]) m_elFa.data();
+      int_el         const (*l_elFaEl)[TL_N_FAS]    = (int_el const (*)[TL_N_FAS]) m_elFaEl.data();
+      unsigned short const (*l_fIdElFaEl)[TL_N_FAS] = (unsigned short const (*)[TL_N_FAS]) m_fIdElFaEl.data();
+      unsigned short const (*l_vIdElFaEl)[TL_N_FAS] = (unsigned short const (*)[TL_N_FAS]) m_vIdElFaEl.data();
+
+      // bytes of the element-local data
+      double l_bDofsE = double(TL_N_QTS_E) * TL_N_MDS * TL_N_CRS * sizeof(TL_T_REAL);
+      double l_bDofsA = double(TL_N_RMS) * TL_N_QTS_M * TL_N_MDS * TL_N_CRS * sizeof(TL_T_REAL);
+      double l_bStar  = (   double(TL_N_DIS) * TL_N_ENS_STAR_E
+                          + (TL_N_RMS > 0) * double(TL_N_DIS) * TL_N_ENS_STAR_A
+                          + double(TL_N_RMS) * TL_N_ENS_SRC_A ) * sizeof(TL_T_REAL);
+      // flux solvers: both steps read one side of the stored solvers or all recomputation parameters
+      double l_bFsEl  = l_aderDg.getFsBytes( i_recompFs );
+      double l_bFs    = (i_recompFs) ? l_bFsEl : l_bFsEl / 2;
+      // compensations of the elastic DOFs are read and written in both steps (mixed precision)
+#if defined(PP_USE_MIXED_PRECISION)
+      double l_bComp  = 2 * l_bDofsE;
+#else
+      double l_bComp  = 0;
+#endif
+
+      // the recomputed flux solvers and compensated accumulation are reported as separate backends
+      std::string l_backend = i_backend + ( (i_recompFs) ? "+fs_recomp" : "" ) + ( (l_bComp > 0) ? "+mixed" : "" );
+      EDGE_LOG_INFO << "  " << l_backend << ": flux solvers occupy " << l_bFsEl << " bytes per element, "
+                    << l_bFsEl * m_nEls / (1024.0*1024.0) << " MiB in total";
+
+      // local step: read and update DOFs, write time integrated DOFs
+      measure( "AderDgLocal",
+               l_backend,
+               l_nChs,
+               flopsTimePred() + flopsVolInt() + flopsSurfInt(),
+               3 * l_bDofsE + 2 * l_bDofsA + l_bStar + l_bFs + l_bComp,
+               [&]( int_el i_ch ) {
+                 int_el l_first = i_ch * l_nElsCh;
+                 int_el l_size = std::min( l_nElsCh, m_nEls - l_first );
+                 l_aderDg.local( l_first,
+                                 l_size,
+                                 0.0,
+                                 1.0E-5,
+                                 true,
+                                 int_el(0),
+                                 m_elChars.data(),
+                                 l_dofsE,
+                                 l_dofsA,
+                                 l_tDofsDg,
+                                 l_recvs );
+               } );
+
+      // neighboring step: read time integrated DOFs of the neighbors, update DOFs
+      measure( "AderDgNeigh",
+               l_backend,
+               l_nChs,
+               flopsSurfInt(),
+               (TL_N_FAS+2) * l_bDofsE + 2 * l_bDofsA + l_bFs + l_bComp,
+               [&]( int_el i_ch ) {
+                 int_el l_first = i_ch * l_nElsCh;
+                 int_el l_size = std::min( l_nElsCh, m_nEls - l_first );
+                 l_aderDg.neigh( l_first,
+                                 l_size,
+                                 TL_T_REAL(1.0E-5),
+                                 true,
+                                 int_el(0),
+                                 int_el(0),
+                                 int_el(0),
+                                 nullptr,
+                                 m_faChars.data(),
+                                 m_elChars.data(),
+                                 nullptr,
+                                 nullptr,
+                                 l_lpFaLp,
+                                 l_elFa,
+                                 l_elFaEl,
+                                 l_fIdElFaEl,
+                                 l_vIdElFaEl,
+                                 l_tDofsDg,
+                                 l_dofsE,
+                                 l_dofsA,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 i_mm );
+               } );
+    }
+
+  public:
+    /**
+     * Constructor, which sets up the synthetic batch of elements.
+     *
+     * @param i_nEls number of elements, rounded up to a multiple of 2^#faces; 0 derives the number from a DOF footprint of 32 MiB.
+     * @param i_nReps number of repetitions per benchmark.
+     **/
+    Bench( std::size_t  i_nEls,
+           unsigned int i_nReps ): m_nReps( i_nReps ) {
+      if( i_nEls == 0 ) {
+        i_nEls = (std::size_t(32) << 20) / ( std::size_t(TL_N_QTS_E) * TL_N_MDS * TL_N_CRS * sizeof(TL_T_REAL) );
+      }
+
+      // the bit-flipped neighbors require multiples of 2^#faces
+      std::size_t l_mult = std::size_t(1) << TL_N_FAS;
+      i_nEls = ( (i_nEls + l_mult - 1) / l_mult ) * l_mult;
+      EDGE_CHECK_LE( i_nEls, std::size_t( std::numeric_limits< int_el >::max() / TL_N_FAS ) );
+      m_nEls = i_nEls;
+
+      initBatch();
+    }
+
+    /**
+     * Gets the number of elements in the batch.
+     *
+     * @return number of elements.
+     **/
+    int_el getNEls() const { return m_nEls; }
+
+    /**
+     * Gets the results of the benchmarks.
+     *
+     * @return results.
+     **/
+    std::vector< t_result > const & getResults() const { return m_res; }
+
+    /**
+     * Gets the name of the backend used by the solver in this build.
+     *
+     * @return name of the backend.
+     **/
+    static std::string backend() {
+#if defined(PP_T_KERNELS_VANILLA)
+      return "vanilla";
+#elif defined(PP_T_KERNELS_XSMM_DENSE_SINGLE)
+      return "single";
+#elif defined(PP_T_KERNELS_XSMM)
+      return "fused";
+#elif defined(PP_T_KERNELS_SIMD)
+      if( TL_N_CRS == 1 && N_ELEMENT_BATCH > 1 ) return "simd+batch" + std::to_string( N_ELEMENT_BATCH );
+      return "simd";
+#else
+#error kernels not supported
+#endif
+    }
+
+    /**
+     * Runs the benchmarks.
+     * The vanilla kernels are always benchmarked, the LIBXSMM-kernels (single or fused) or the portable SIMD-kernels if available in the build.
+     * The ADER-DG drivers use the kernels of the build, once with stored and once with recomputed flux solvers.
+     *
+     * @param i_mm matrix-matrix multiplication kernels of the build (only used for the limiter's extrema).
+     *
+     * @paramt TL_T_MM type of the matrix-matrix multiplication kernels.
+     **/
+    template< typename TL_T_MM >
+    void run( TL_T_MM const & i_mm ) {
+      EDGE_LOG_INFO << "running kernel benchmarks with " << m_nEls << " elements and "
+                    << m_nReps << " repetitions";
+
+      runKernels< false,
+                  kernels::TimePredVanilla< TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP, TL_O_TI, TL_N_CRS >,
+                  kernels::VolIntVanilla<   TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS >,
+                  kernels::SurfIntVanilla<  TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS > >( "vanilla" );
+#if defined(PP_T_KERNELS_XSMM_DENSE_SINGLE)
+      runKernels< false,
+                  kernels::TimePredSingle< TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP, TL_O_TI >,
+                  kernels::VolIntSingle<   TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP          >,
+                  kernels::SurfIntSingle<  TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP          > >( "single" );
+#elif defined(PP_T_KERNELS_XSMM)
+      runKernels< true,
+                  kernels::TimePredFused< TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP, TL_O_TI, TL_N_CRS >,
+                  kernels::VolIntFused<   TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS >,
+                  kernels::SurfIntFused<  TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS > >( "fused" );
+#elif defined(PP_T_KERNELS_SIMD)
+      runKernels< true,
+                  kernels::TimePredSimd< TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP, TL_O_TI, TL_N_CRS >,
+                  kernels::VolIntSimd<   TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS >,
+                  kernels::SurfIntSimd<  TL_T_REAL, TL_N_RMS, TL_T_EL, TL_O_SP,          TL_N_CRS > >( "simd" );
+#endif
+
+      runSolver< MM_KERNELS_SPARSE >( backend(), false, i_mm );
+      runSolver< MM_KERNELS_SPARSE >( backend(), true,  i_mm );
+    }
+};
+
+#endif
@@ -105,13 +105,15 @@ class edge::seismic::common {
      * @param o_minDt minimum time step.
      * @param o_aveDt average time step.
      * @param o_maxDt maximum time step.
+     * @param i_elTgs time groups of the elements (LTS). If given, the minimum time step is the fundamental time step, i.e. an element's time step is divided by 2^tg.
      **/
     static void getTimeStepStatsCFL(       int_el           i_nElements,
                                      const t_elementChars (*i_elementChars),
                                      const t_bgPars       (*i_bgPars)[1],
                                            double          &o_minDt,
                                            double          &o_aveDt,
-                                           double          &o_maxDt ) {
+                                           double          &o_maxDt,
+                                     const int_tg          *i_elTgs = nullptr ) {
       PP_INSTR_FUN("cfl_stats")
 
       // initialize time steps
@@ -126,7 +128,8 @@ class edge::seismic::common {
                                       i_elementChars[l_el].inDia,
                                       SCALE_CFL );
 
-        o_minDt  = std::min( o_minDt, l_dt );
+        if( i_elTgs == nullptr ) o_minDt = std::min( o_minDt, l_dt );
+        else                     o_minDt = std::min( o_minDt, l_dt / (int_ts(1) << i_elTgs[l_el]) );
         o_maxDt  = std::max( o_maxDt, l_dt );
         o_aveDt += l_dt / i_nElements;
       }
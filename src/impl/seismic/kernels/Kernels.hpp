@@ -26,6 +26,7 @@
 
 #include "constants.hpp"
 #include "data/Dynamic.h"
+#include "data/Tuner.h"
 
 #if defined(PP_T_KERNELS_VANILLA)
 #include "TimePredVanilla.hpp"
@@ -39,6 +40,10 @@
 #include "TimePredFused.hpp"
 #include "VolIntFused.hpp"
 #include "SurfIntFused.hpp"
+#elif defined(PP_T_KERNELS_SIMD)
+#include "TimePredSimd.hpp"
+#include "VolIntSimd.hpp"
+#include "SurfIntSimd.hpp"
 #else
 #error kernels not supported
 #endif
@@ -126,6 +131,23 @@ static_assert( TL_N_CRS != 1, "trying to build fused kernels in single setting"
                   TL_T_EL,
                   TL_O_SP,
                   TL_N_CRS > m_surfInt;
+#elif defined(PP_T_KERNELS_SIMD)
+    TimePredSimd< TL_T_REAL,
+                  TL_N_RMS,
+                  TL_T_EL,
+                  TL_O_SP,
+                  TL_O_TI,
+                  TL_N_CRS > m_time;
+    VolIntSimd< TL_T_REAL,
+                TL_N_RMS,
+                TL_T_EL,
+                TL_O_SP,
+                TL_N_CRS > m_volInt;
+    SurfIntSimd< TL_T_REAL,
+                 TL_N_RMS,
+                 TL_T_EL,
+                 TL_O_SP,
+                 TL_N_CRS > m_surfInt;
 #else
 #error kernels not supported
 #endif
@@ -134,11 +156,20 @@ static_assert( TL_N_CRS != 1, "trying to build fused kernels in single setting"
      * Constructor, which initializes the kernels.
      *
      * @param io_dynMem dynamic memory allocations.
+     * @param io_tuner tuner for the selection of kernel variants, ignored by kernels without variants.
      **/
     Kernels( TL_T_REAL     const * i_rfs,
-             data::Dynamic        & io_dynMem ): m_time(    i_rfs, io_dynMem ),
+             data::Dynamic        & io_dynMem,
+             data::Tuner          * io_tuner = nullptr ):
+#if defined(PP_T_KERNELS_XSMM)
+                                                 m_time(    i_rfs, io_dynMem, io_tuner ),
+                                                 m_volInt(  i_rfs, io_dynMem, io_tuner ),
+                                                 m_surfInt( i_rfs, io_dynMem, io_tuner ) {};
+#else
+                                                 m_time(    i_rfs, io_dynMem ),
                                                  m_volInt(  i_rfs, io_dynMem ),
                                                  m_surfInt( i_rfs, io_dynMem ) {};
+#endif
 };
 
 #endif
\ No newline at end of file
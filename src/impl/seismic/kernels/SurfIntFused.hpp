@@ -26,9 +26,12 @@
 #ifndef EDGE_SEISMIC_KERNELS_SURF_INT_FUSED_HPP
 #define EDGE_SEISMIC_KERNELS_SURF_INT_FUSED_HPP
 
+#include <sstream>
 #include "SurfInt.hpp"
 #include "dg/Basis.h"
 #include "data/MmXsmmFused.hpp"
+#include "data/Tuner.h"
+#include "monitor/Timer.hpp"
 #include "FakeMats.hpp"
 
 namespace edge {
@@ -112,20 +115,17 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
      * @param o_offsets will be set to the offsets (counting non-zero entries) of the sparse matrices.
      * @param o_nonZeros will be set to the raw non-zero entries of the sparse matrices.
      * @param o_mats will be set to the CSC representation of the sparse matrices.
+     * @param i_nChs number of chunks of the fused simulations, the non-zero entries are split accordingly.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void getCscFlux( TL_T_REAL                const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
                             TL_T_REAL                const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
                             TL_T_REAL                const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL],
                             std::vector< size_t >          & o_offsets,
                             std::vector< TL_T_REAL >       & o_nonZeros,
-                            std::vector< t_matCsc >        & o_mats ) {
-      // determine CSC fill-in strategy
-      std::string l_cscFillIn = "none";
-
-      if ( libxsmm_get_target_archid() == LIBXSMM_X86_AVX512_KNM ) {
-        l_cscFillIn = "qfma";
-      }
-
+                            std::vector< t_matCsc >        & o_mats,
+                            unsigned short                   i_nChs,
+                            std::string              const & i_fillIn ) {
       // reset and init output
       o_offsets.resize( 0 );
       o_offsets.push_back( 0 );
@@ -143,13 +143,11 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                                                        TOL.BASIS,
                                                        std::numeric_limits< unsigned int >::max(),
                                                        std::numeric_limits< unsigned int >::max(),
-                                                       l_cscFillIn );
+                                                       i_fillIn );
         o_mats.push_back( l_fluxCsc );
 
-        for( unsigned short l_nz = 0; l_nz < l_fluxCsc.val.size(); l_nz++ ) {
-          o_nonZeros.push_back( l_fluxCsc.val[l_nz] );
-        }
-        o_offsets.push_back( o_offsets.back() + l_fluxCsc.val.size() );
+        edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( i_nChs, l_fluxCsc, o_nonZeros );
+        o_offsets.push_back( o_offsets.back() + i_nChs * l_fluxCsc.val.size() );
       }
 
       // neighboring contribution flux matrices
@@ -163,13 +161,11 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                                                        TOL.BASIS,
                                                        std::numeric_limits< unsigned int >::max(),
                                                        std::numeric_limits< unsigned int >::max(),
-                                                       l_cscFillIn );
+                                                       i_fillIn );
         o_mats.push_back( l_fluxCsc );
 
-        for( unsigned short l_nz = 0; l_nz < l_fluxCsc.val.size(); l_nz++ ) {
-          o_nonZeros.push_back( l_fluxCsc.val[l_nz] );
-        }
-        o_offsets.push_back( o_offsets.back() + l_fluxCsc.val.size() );
+        edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( i_nChs, l_fluxCsc, o_nonZeros );
+        o_offsets.push_back( o_offsets.back() + i_nChs * l_fluxCsc.val.size() );
       }
 
       // transposed flux matrices
@@ -183,13 +179,11 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                                                        TOL.BASIS,
                                                        std::numeric_limits< unsigned int >::max(),
                                                        std::numeric_limits< unsigned int >::max(),
-                                                       l_cscFillIn );
+                                                       i_fillIn );
         o_mats.push_back( l_fluxCsc );
 
-        for( unsigned short l_nz = 0; l_nz < l_fluxCsc.val.size(); l_nz++ ) {
-          o_nonZeros.push_back( l_fluxCsc.val[l_nz] );
-        }
-        o_offsets.push_back( o_offsets.back() + l_fluxCsc.val.size() );
+        edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( i_nChs, l_fluxCsc, o_nonZeros );
+        o_offsets.push_back( o_offsets.back() + i_nChs * l_fluxCsc.val.size() );
       }
     }
 
@@ -199,10 +193,14 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
      * @param i_fIntL local flux matrices.
      * @param i_fIntN neighboring flux matrices.
      * @param i_fIntT transposed flux matrices.
+     * @param i_fillIn CSC fill-in strategy of the flux matrices.
+     * @param io_mm matrix kernels to which the generated kernels are added.
      **/
-    void generateKernels( TL_T_REAL const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
-                          TL_T_REAL const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
-                          TL_T_REAL const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL] ) {
+    static void generateKernels( TL_T_REAL                    const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
+                                 TL_T_REAL                    const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
+                                 TL_T_REAL                    const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL],
+                                 std::string                  const & i_fillIn,
+                                 edge::data::MmXsmmFused< TL_T_REAL > & io_mm ) {
       // convert flux matrices to CSC (incl. possible fill-in)
       std::vector< size_t > l_offsets;
       std::vector< TL_T_REAL > l_nonZeros;
@@ -212,11 +210,13 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                   i_fIntT,
                   l_offsets,
                   l_nonZeros,
-                  l_fIntCsc );
+                  l_fIntCsc,
+                  io_mm.getNChs(),
+                  i_fillIn );
 
       // local contribution flux matrices
       for( unsigned short l_fl = 0; l_fl < TL_N_FAS; l_fl++ ) {
-        m_mm.add(  0,                         // group
+        io_mm.add(  0,                         // group
                    false,                     // csc
                   &l_fIntCsc[l_fl].colPtr[0], // column pointer
                   &l_fIntCsc[l_fl].rowIdx[0], // row index
@@ -236,7 +236,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       for( unsigned short l_fn = 0; l_fn < TL_N_FMNS; l_fn++ ) {
         unsigned short l_ma = TL_N_FAS + l_fn;
 
-        m_mm.add(  0,                         // group
+        io_mm.add(  0,                         // group
                    false,                     // csc
                   &l_fIntCsc[l_ma].colPtr[0], // column pointer
                   &l_fIntCsc[l_ma].rowIdx[0], // row index
@@ -256,7 +256,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       for( unsigned short l_ft = 0; l_ft < TL_N_FAS; l_ft++ ) {
         unsigned short l_ma = TL_N_FAS + TL_N_FMNS + l_ft;
 
-        m_mm.add(  2,                         // group
+        io_mm.add(  2,                         // group
                    false,                     // csc
                   &l_fIntCsc[l_ma].colPtr[0], // column pointer
                   &l_fIntCsc[l_ma].rowIdx[0], // row index
@@ -276,7 +276,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       for( unsigned short l_ft = 0; l_ft < TL_N_FAS; l_ft++ ) {
         unsigned short l_ma = TL_N_FAS + TL_N_FMNS + l_ft;
 
-        m_mm.add(  4,                         // group
+        io_mm.add(  4,                         // group
                    false,                     // csc
                   &l_fIntCsc[l_ma].colPtr[0], // column pointer
                   &l_fIntCsc[l_ma].rowIdx[0], // row index
@@ -297,7 +297,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       FakeMats< TL_N_DIS >::fsCsrE( l_fsCsrE );
       EDGE_CHECK_EQ( l_fsCsrE.val.size(), TL_N_QTS_E*TL_N_QTS_E );
 
-      m_mm.add(  1,                   // group
+      io_mm.add(  1,                   // group
                  true,                // csr
                  &l_fsCsrE.rowPtr[0], // row pointer
                  &l_fsCsrE.colIdx[0], // column index
@@ -318,7 +318,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
         FakeMats< TL_N_DIS >::fsCsrA( l_fsCsrA );
         EDGE_CHECK_EQ( l_fsCsrA.val.size(), TL_N_QTS_M*TL_N_QTS_E );
 
-        m_mm.add(  3,                   // group
+        io_mm.add(  3,                   // group
                    true,                // csr
                    &l_fsCsrA.rowPtr[0], // row pointer
                    &l_fsCsrA.colIdx[0], // column index
@@ -344,13 +344,17 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
      * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
      * @param o_fIntLN will contain pointers to memory for the local and neighboring flux matrices.
      * @param o_fIntT will contain pointers to memory for the transposed flux matrices.
+     * @param i_nChs number of chunks of the fused simulations.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void storeFluxSparse( TL_T_REAL     const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
                                  TL_T_REAL     const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
                                  TL_T_REAL     const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL],
                                  data::Dynamic       & io_dynMem,
                                  TL_T_REAL           * o_fIntLN[TL_N_FAS+TL_N_FMNS],
-                                 TL_T_REAL           * o_fIntT[TL_N_FAS] ) {
+                                 TL_T_REAL           * o_fIntT[TL_N_FAS],
+                                 unsigned short        i_nChs,
+                                 std::string   const & i_fillIn ) {
       // convert flux matrices to CSC (incl. possible fill-in)
       std::vector< size_t > l_offsets;
       std::vector< TL_T_REAL > l_nonZeros;
@@ -360,7 +364,9 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                   i_fIntT,
                   l_offsets,
                   l_nonZeros,
-                  l_fIntCsc );
+                  l_fIntCsc,
+                  i_nChs,
+                  i_fillIn );
 
       // copy sparse matrices to a permanent data structure
       TL_T_REAL * l_fIntRaw = (TL_T_REAL*) io_dynMem.allocate( l_nonZeros.size() * sizeof(TL_T_REAL),
@@ -382,15 +388,81 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       }
     }
 
+    /**
+     * Measures the multiplications with the flux matrices for the given fill-in strategy.
+     *
+     * @param i_fIntL local flux matrices.
+     * @param i_fIntN neighboring flux matrices.
+     * @param i_fIntT transposed flux matrices.
+     * @param i_fillIn CSC fill-in strategy.
+     * @return time in seconds.
+     **/
+    static double timeFlux( TL_T_REAL   const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
+                            TL_T_REAL   const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
+                            TL_T_REAL   const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL],
+                            std::string const & i_fillIn ) {
+      data::Dynamic l_dynMem;
+      edge::data::MmXsmmFused< TL_T_REAL > l_mm;
+
+      TL_T_REAL *l_fIntLN[TL_N_FAS+TL_N_FMNS] = {};
+      TL_T_REAL *l_fIntT[TL_N_FAS] = {};
+      storeFluxSparse( i_fIntL,
+                       i_fIntN,
+                       i_fIntT,
+                       l_dynMem,
+                       l_fIntLN,
+                       l_fIntT,
+                       l_mm.getNChs(),
+                       i_fillIn );
+      generateKernels( i_fIntL,
+                       i_fIntN,
+                       i_fIntT,
+                       i_fillIn,
+                       l_mm );
+
+      // dummy data
+      std::size_t l_size = std::size_t(TL_N_QTS_E) * TL_N_MDS_EL * TL_N_CRS;
+      TL_T_REAL *l_in  = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      TL_T_REAL *l_out = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      for( std::size_t l_en = 0; l_en < l_size; l_en++ ) {
+        l_in[l_en]  = 1;
+        l_out[l_en] = 0;
+      }
+
+      // first pass warms up, second pass is measured
+      edge::monitor::Timer l_timer;
+      for( unsigned short l_pa = 0; l_pa < 2; l_pa++ ) {
+        l_timer.reset();
+        l_timer.start();
+        for( unsigned short l_it = 0; l_it < 100; l_it++ ) {
+          for( unsigned short l_ma = 0; l_ma < TL_N_FAS+TL_N_FMNS; l_ma++ ) {
+            l_mm.m_kernels[0][l_ma]( l_in,
+                                     l_fIntLN[l_ma],
+                                     l_out );
+          }
+          for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+            l_mm.m_kernels[2][l_fa]( l_in,
+                                     l_fIntT[l_fa],
+                                     l_out );
+          }
+        }
+        l_timer.end();
+      }
+
+      return l_timer.elapsed();
+    }
+
   public:
     /**
      * Constructor of the fused surface integration.
      *
      * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
      * @param io_dynMem dynamic memory allocations.
+     * @param io_tuner if given, the fill-in of the flux matrices is selected through runtime measurements.
      **/
     SurfIntFused( TL_T_REAL     const * i_rfs,
-                  data::Dynamic       & io_dynMem ): SurfInt< TL_T_REAL,
+                  data::Dynamic       & io_dynMem,
+                  data::Tuner         * io_tuner = nullptr ): SurfInt< TL_T_REAL,
                                                               TL_N_RMS,
                                                               TL_T_EL,
                                                               TL_O_SP,
@@ -408,18 +480,37 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                             l_fIntN[0][0],
                             l_fIntT[0][0] );
 
+      // select the fill-in of the flux matrices
+      std::vector< std::string > l_fillIns = edge::data::MmXsmmFused< TL_T_REAL >::getFillIns();
+      std::string l_fillIn = l_fillIns[0];
+      if( io_tuner != nullptr ) {
+        std::ostringstream l_key;
+        l_key << "SurfIntFused/flux el=" << TL_T_EL << " o=" << TL_O_SP
+              << " cfr=" << TL_N_CRS << " prec=" << sizeof(TL_T_REAL)*8 << " arch=" << libxsmm_get_target_arch();
+
+        l_fillIn = io_tuner->select( l_key.str(),
+                                     l_fillIns,
+                                     [&l_fIntL, &l_fIntN, &l_fIntT]( std::string const & i_fillIn ) {
+                                       return timeFlux( l_fIntL, l_fIntN, l_fIntT, i_fillIn );
+                                     } );
+      }
+
       // store flux matrices sparse
       storeFluxSparse( l_fIntL,
                        l_fIntN,
                        l_fIntT,
                        io_dynMem,
                        m_fIntLN,
-                       m_fIntT );
+                       m_fIntT,
+                       m_mm.getNChs(),
+                       l_fillIn );
 
       // generate kernels
       generateKernels( l_fIntL,
                        l_fIntN,
-                       l_fIntT );
+                       l_fIntT,
+                       l_fillIn,
+                       m_mm );
     }
 
     /**
@@ -493,29 +584,22 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
     }
 
     /**
-     * Neighboring contribution of a single adjacent element for fused simulations.
+     * Projects the time integrated DOFs of a single adjacent element to the shared face for fused simulations.
+     * This is the first step of the neighboring contribution, which is performed by the adjacent element's rank for the faces of the MPI-halo.
      *
      * @param i_fa local face.
      * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
      * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
-     * @param i_fsE elastic flux solver.
-     * @param i_fsA anelastic flux solver
-     * @param i_tDofsE elastic time integrated DG-DOFs.
-     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
-     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
-     * @param o_scratch will be used as scratch space for the computations.
-     * @param i_pre DOFs or tDOFs for prefetching.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the adjacent element.
+     * @param o_tFaE will be set to the face-projected, elastic time integrated DG-DOFs.
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
      **/
-    void neigh( unsigned short       i_fa,
-                unsigned short       i_vId,
-                unsigned short       i_fId,
-                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
-                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
-                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
-                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+    void neighProj( unsigned short       i_fa,
+                    unsigned short       i_vId,
+                    unsigned short       i_fId,
+                    TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                    TL_T_REAL            o_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                    TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
       // derive the id of the neighboring flux matrix
       unsigned short l_fMatId = std::numeric_limits< unsigned short >::max();
       if( i_vId != std::numeric_limits< unsigned short >::max() ) {
@@ -528,11 +612,32 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       // local or neighboring flux matrix
       m_mm.m_kernels[0][l_fMatId]( i_tDofsE[0][0],
                                    m_fIntLN[l_fMatId],
-                                   o_scratch[0][0][0] );
+                                   o_tFaE[0][0] );
+    }
 
+    /**
+     * Neighboring contribution of a single adjacent element, given its face-projected time integrated DOFs, for fused simulations.
+     *
+     * @param i_fa local face.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tFaE face-projected, elastic time integrated DG-DOFs of the adjacent element.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations (second entry only).
+     * @param i_pre DOFs or tDOFs for prefetching.
+     **/
+    void neighFa( unsigned short       i_fa,
+                  TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                  TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                  TL_T_REAL      const i_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
       // flux solver
       m_mm.m_kernels[1][0]( i_fsE,
-                            o_scratch[0][0][0],
+                            i_tFaE[0][0],
                             o_scratch[1][0][0],
                             nullptr,
                             i_pre[0][0],
@@ -546,7 +651,7 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       if( TL_N_RMS > 0 ) {
         // anelastic flux solver
         m_mm.m_kernels[3][0]( i_fsA,
-                              o_scratch[0][0][0],
+                              i_tFaE[0][0],
                               o_scratch[1][0][0] );
 
         // transposed flux matrix
@@ -555,6 +660,49 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                                  io_dofsA[0][0] );
       }
     }
+
+    /**
+     * Neighboring contribution of a single adjacent element for fused simulations.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tDofsE elastic time integrated DG-DOFs.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_pre DOFs or tDOFs for prefetching.
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      // local or neighboring flux matrix
+      neighProj( i_fa,
+                 i_vId,
+                 i_fId,
+                 i_tDofsE,
+                 o_scratch[0],
+                 i_pre );
+
+      // flux solvers and transposed flux matrix
+      neighFa( i_fa,
+               i_fsE,
+               i_fsA,
+               o_scratch[0],
+               io_dofsE,
+               io_dofsA,
+               o_scratch,
+               i_pre );
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -36,17 +36,17 @@ TEST_CASE( "Local elastic surface integration for fused simulations.", "[elastic
                                         0,
                                         TET4,
                                         3,
-                                        16 > l_surf( nullptr,
+                                        N_CRUNS > l_surf( nullptr,
                                                      l_dynMem );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFused[9][10][16];
-  float l_tDofsFused[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFused[9][10][N_CRUNS];
+  float l_tDofsFused[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFused[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFused[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
       }
@@ -64,7 +64,7 @@ TEST_CASE( "Local elastic surface integration for fused simulations.", "[elastic
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFused[l_qt][l_md][l_cr] == Approx( l_refEdofs[l_qt][l_md] ) );
       }
     }
@@ -81,17 +81,17 @@ TEST_CASE( "Neighboring elastic surface integration for fused simulations.", "[e
                                         0,
                                         TET4,
                                         3,
-                                        16 > l_surf( nullptr,
+                                        N_CRUNS > l_surf( nullptr,
                                                      l_dynMem );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFused[9][10][16];
-  float l_tDofsFused[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFused[9][10][N_CRUNS];
+  float l_tDofsFused[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFused[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFused[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
       }
@@ -113,7 +113,7 @@ TEST_CASE( "Neighboring elastic surface integration for fused simulations.", "[e
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFused[l_qt][l_md][l_cr] == Approx( l_refEneighDofs[l_qt][l_md] ) );
       }
     }
@@ -131,17 +131,17 @@ TEST_CASE( "Neighboring elastic surface integration in the presence of a free su
                                         0,
                                         TET4,
                                         3,
-                                        16 > l_surf( nullptr,
+                                        N_CRUNS > l_surf( nullptr,
                                                      l_dynMem );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFused[9][10][16];
-  float l_tDofsFused[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFused[9][10][N_CRUNS];
+  float l_tDofsFused[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFused[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFused[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
       }
@@ -162,7 +162,7 @@ TEST_CASE( "Neighboring elastic surface integration in the presence of a free su
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFused[l_qt][l_md][l_cr] == Approx( l_refEneighFdofs[l_qt][l_md] ) );
       }
     }
@@ -175,22 +175,24 @@ TEST_CASE( "Local viscoelastic surface integration for fused simulations.", "[vi
 
   // kernel
   edge::data::Dynamic l_dynMem;
+  edge::data::Tuner l_tuner;
   edge::seismic::kernels::SurfIntFused< float,
                                         3,
                                         TET4,
                                         3,
-                                        16 > l_surf( l_rfs,
-                                                     l_dynMem );
+                                        N_CRUNS > l_surf( l_rfs,
+                                                     l_dynMem,
+                                                     &l_tuner );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFusedE[9][10][16];
-  float l_dofsFusedA[3][6][10][16];
-  float l_tDofsFusedE[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFusedE[9][10][N_CRUNS];
+  float l_dofsFusedA[3][6][10][N_CRUNS];
+  float l_tDofsFusedE[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFusedE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFusedE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
 
@@ -214,7 +216,7 @@ TEST_CASE( "Local viscoelastic surface integration for fused simulations.", "[vi
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFusedE[l_qt][l_md][l_cr] == Approx( l_refEdofs[l_qt][l_md] ) );
 
         if( l_qt < 6) {
@@ -237,18 +239,18 @@ TEST_CASE( "Neighboring viscoelastic surface integration for fused simulations."
                                         3,
                                         TET4,
                                         3,
-                                        16 > l_surf( l_rfs,
+                                        N_CRUNS > l_surf( l_rfs,
                                                      l_dynMem );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFusedE[9][10][16];
-  float l_upsFusedA[6][10][16];
-  float l_tDofsFusedE[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFusedE[9][10][N_CRUNS];
+  float l_upsFusedA[6][10][N_CRUNS];
+  float l_tDofsFusedE[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFusedE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFusedE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
 
@@ -273,7 +275,7 @@ TEST_CASE( "Neighboring viscoelastic surface integration for fused simulations."
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFusedE[l_qt][l_md][l_cr] == Approx( l_refEneighDofs[l_qt][l_md] ) );
       }
     }
@@ -282,7 +284,7 @@ TEST_CASE( "Neighboring viscoelastic surface integration for fused simulations."
   // check the results
   for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_upsFusedA[l_qt][l_md][l_cr] == Approx( l_refVneighDofsA[l_qt][l_md] ) );
       }
     }
@@ -299,18 +301,18 @@ TEST_CASE( "Neighboring viscoelastic surface integration in the presence of a fr
                                         3,
                                         TET4,
                                         3,
-                                        16 > l_surf( l_rfs,
+                                        N_CRUNS > l_surf( l_rfs,
                                                      l_dynMem );
 
-  float l_scratch[2][9][6][16];
-  float l_dofsFusedE[9][10][16];
-  float l_upsFusedA[6][10][16];
-  float l_tDofsFusedE[9][10][16];
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsFusedE[9][10][N_CRUNS];
+  float l_upsFusedA[6][10][N_CRUNS];
+  float l_tDofsFusedE[9][10][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFusedE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFusedE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
 
@@ -335,7 +337,7 @@ TEST_CASE( "Neighboring viscoelastic surface integration in the presence of a fr
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFusedE[l_qt][l_md][l_cr] == Approx( l_refEneighFdofs[l_qt][l_md] ) );
       }
     }
@@ -344,7 +346,7 @@ TEST_CASE( "Neighboring viscoelastic surface integration in the presence of a fr
   // check the results
   for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_upsFusedA[l_qt][l_md][l_cr] == Approx( l_refVneighFdofsA[l_qt][l_md] ) );
       }
     }
@@ -0,0 +1,602 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Quadrature-free ADER-DG surface integration for fused seismic forward simulations, using portable SIMD kernels.
+ **/
+#ifndef EDGE_SEISMIC_KERNELS_SURF_INT_SIMD_HPP
+#define EDGE_SEISMIC_KERNELS_SURF_INT_SIMD_HPP
+
+#include "SurfInt.hpp"
+#include "dg/Basis.h"
+#include "data/MmSimd.hpp"
+
+namespace edge {
+  namespace seismic {
+    namespace kernels { 
+      template< typename       TL_T_REAL,
+                unsigned short TL_N_RMS,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_N_CRS >
+      class SurfIntSimd;
+    }
+  }
+}
+
+/**
+ * Quadrature-free ADER-DG surface integration for fused seismic forward simulations using portable SIMD kernels.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_RMS number of relaxation mechanisms.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_RMS,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_N_CRS >
+class edge::seismic::kernels::SurfIntSimd: public edge::seismic::kernels::SurfInt< TL_T_REAL,
+                                                                                   TL_N_RMS,
+                                                                                   TL_T_EL,
+                                                                                   TL_O_SP,
+                                                                                   TL_N_CRS > {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of faces
+    static unsigned short const TL_N_FAS = C_ENT[TL_T_EL].N_FACES;
+
+    //! number of DG face modes
+    static unsigned short const TL_N_MDS_FA = CE_N_ELEMENT_MODES( C_ENT[TL_T_EL].TYPE_FACES, TL_O_SP );
+
+    //! number of DG element modes
+    static unsigned short const TL_N_MDS_EL = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of neigboring contribution flux matrices
+    static unsigned short const TL_N_FMNS = CE_N_FLUXN_MATRICES( TL_T_EL );
+
+    //! number of elastic quantities
+    static unsigned short const TL_N_QTS_E = CE_N_QTS_E( TL_N_DIS );
+
+    //! number of quantities per relaxation mechanism
+    static unsigned short const TL_N_QTS_M = CE_N_QTS_M( TL_N_DIS );
+
+    //! number of entries in the elastic flux solvers
+    static unsigned short const TL_N_ENS_FS_E = CE_N_ENS_FS_E_DE( TL_N_DIS );
+
+    //! number of entries in the anelastic flux solvers
+    static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
+
+    //! pointers to the non-zeros of the local and neighboring flux matrices
+    TL_T_REAL *m_fIntLN[TL_N_FAS+TL_N_FMNS] = {};
+
+    //! pointers to the non-zeros of the transposed flux matrices
+    TL_T_REAL *m_fIntT[TL_N_FAS] = {};
+
+    //! sparsity patterns and micro-kernels
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+
+    /**
+     * Stores the non-zeros of the flux matrices and adds the sparsity patterns of the kernels.
+     *
+     * @param i_fIntL local flux matrices.
+     * @param i_fIntN neighboring flux matrices.
+     * @param i_fIntT transposed flux matrices.
+     * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
+     **/
+    void init( TL_T_REAL     const   i_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA],
+               TL_T_REAL     const   i_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA],
+               TL_T_REAL     const   i_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL],
+               data::Dynamic       & io_dynMem ) {
+      // convert flux matrices to CSC
+      t_matCsc l_fIntCsc[TL_N_FAS+TL_N_FMNS+TL_N_FAS];
+      std::size_t l_nNzs = 0;
+
+      for( unsigned short l_ma = 0; l_ma < TL_N_FAS+TL_N_FMNS+TL_N_FAS; l_ma++ ) {
+        if( l_ma < TL_N_FAS ) {
+          edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS_EL,
+                                                         TL_N_MDS_FA,
+                                                         i_fIntL[l_ma][0],
+                                                         l_fIntCsc[l_ma],
+                                                         TOL.BASIS );
+        }
+        else if( l_ma < TL_N_FAS+TL_N_FMNS ) {
+          edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS_EL,
+                                                         TL_N_MDS_FA,
+                                                         i_fIntN[l_ma-TL_N_FAS][0],
+                                                         l_fIntCsc[l_ma],
+                                                         TOL.BASIS );
+        }
+        else {
+          edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS_FA,
+                                                         TL_N_MDS_EL,
+                                                         i_fIntT[l_ma-TL_N_FAS-TL_N_FMNS][0],
+                                                         l_fIntCsc[l_ma],
+                                                         TOL.BASIS );
+        }
+        l_nNzs += l_fIntCsc[l_ma].val.size();
+      }
+
+      // copy non-zeros to a permanent data structure
+      TL_T_REAL * l_fIntRaw = (TL_T_REAL*) io_dynMem.allocate( l_nNzs * sizeof(TL_T_REAL),
+                                                               4096,
+                                                               true );
+
+      std::size_t l_off = 0;
+      for( unsigned short l_ma = 0; l_ma < TL_N_FAS+TL_N_FMNS+TL_N_FAS; l_ma++ ) {
+        // local and neighboring flux matrices: group 0, transposed flux matrices: group 1
+        bool l_lN = l_ma < TL_N_FAS+TL_N_FMNS;
+
+        if( l_lN ) m_fIntLN[l_ma] = l_fIntRaw + l_off;
+        else       m_fIntT[l_ma-TL_N_FAS-TL_N_FMNS] = l_fIntRaw + l_off;
+
+        for( std::size_t l_nz = 0; l_nz < l_fIntCsc[l_ma].val.size(); l_nz++ ) {
+          l_fIntRaw[l_off + l_nz] = l_fIntCsc[l_ma].val[l_nz];
+        }
+        l_off += l_fIntCsc[l_ma].val.size();
+
+        m_mm.add( l_lN ? 0 : 1,                       // group
+                  false,                              // csc
+                  l_fIntCsc[l_ma].colPtr.size(),      // #ptrs
+                  &l_fIntCsc[l_ma].colPtr[0],         // ptr
+                  &l_fIntCsc[l_ma].rowIdx[0],         // ids
+                  l_lN ? TL_N_MDS_FA : TL_N_MDS_EL ); // n
+      }
+    }
+
+    /**
+     * Element local contribution (SIMD version) for flux solvers, which are either shared by all fused simulations or lane-local.
+     *
+     * @param i_fsE elastic flux solvers, [TL_N_FAS][TL_N_ENS_FS_E][TL_N_LAS].
+     * @param i_fsA anelastic flux solvers, [TL_N_FAS][TL_N_ENS_FS_A][TL_N_LAS], use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE elastic time integerated DG-DOFs.
+     * @param io_dofsE will be updated with local elastic contribution of the element to the surface integral.
+     * @param io_dofsA will be updated with local anelastic contribution of the element to the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     *
+     * @paramt TL_N_LAS number of lanes of the flux solvers, 1 or TL_N_CRS.
+     **/
+    template< unsigned short TL_N_LAS >
+    void localLas( TL_T_REAL const * i_fsE,
+                   TL_T_REAL const * i_fsA,
+                   TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                   TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                   TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                   TL_T_REAL         o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      // anelastic update
+      TL_T_REAL l_upAn[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS];
+      if( TL_N_RMS > 0 ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
+          for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              l_upAn[l_qt][l_md][l_cr] = 0;
+            }
+          }
+        }
+      }
+
+      // iterate over faces
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        // local flux matrix
+        m_mm.template cscB< TL_N_QTS_E,
+                            TL_N_MDS_EL,
+                            TL_N_MDS_FA,
+                            true >( m_mm.m_pats[0][l_fa],
+                                    i_tDofsE[0][0],
+                                    m_fIntLN[l_fa],
+                                    o_scratch[0][0][0] );
+
+        // flux solver
+        m_mm.template denseA< TL_N_QTS_E,
+                              TL_N_MDS_FA,
+                              TL_N_QTS_E,
+                              TL_N_MDS_FA,
+                              TL_N_MDS_FA,
+                              true,
+                              TL_N_LAS >( i_fsE + l_fa * TL_N_ENS_FS_E * TL_N_LAS,
+                                          o_scratch[0][0][0],
+                                          o_scratch[1][0][0] );
+
+        // transposed flux matrix
+        m_mm.template cscB< TL_N_QTS_E,
+                            TL_N_MDS_FA,
+                            TL_N_MDS_EL,
+                            false >( m_mm.m_pats[1][l_fa],
+                                     o_scratch[1][0][0],
+                                     m_fIntT[l_fa],
+                                     io_dofsE[0][0] );
+
+        if( TL_N_RMS > 0 ) {
+          // anelastic flux solver
+          m_mm.template denseA< TL_N_QTS_M,
+                                TL_N_MDS_FA,
+                                TL_N_QTS_E,
+                                TL_N_MDS_FA,
+                                TL_N_MDS_FA,
+                                true,
+                                TL_N_LAS >( i_fsA + l_fa * TL_N_ENS_FS_A * TL_N_LAS,
+                                            o_scratch[0][0][0],
+                                            o_scratch[1][0][0] );
+
+          // transposed flux matrix
+          m_mm.template cscB< TL_N_QTS_M,
+                              TL_N_MDS_FA,
+                              TL_N_MDS_EL,
+                              false >( m_mm.m_pats[1][l_fa],
+                                       o_scratch[1][0][0],
+                                       m_fIntT[l_fa],
+                                       l_upAn[0][0] );
+        }
+      }
+
+      // scatter to anelastic DOFs
+      if( TL_N_RMS > 0) this->scatterUpdateA( l_upAn, io_dofsA );
+    }
+
+    /**
+     * Derives the id of the local or neighboring flux matrix for a neighboring contribution.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @return id of the flux matrix in m_fIntLN.
+     **/
+    unsigned short fMatIdLN( unsigned short i_fa,
+                             unsigned short i_vId,
+                             unsigned short i_fId ) const {
+      if( i_vId != std::numeric_limits< unsigned short >::max() ) {
+        return TL_N_FAS + this->fMatId( i_vId, i_fId );
+      }
+      return i_fa;
+    }
+
+    /**
+     * Applies the flux solvers and transposed flux matrix to the face-projected, time integrated DOFs of the neighbors (SIMD version).
+     *
+     * @param i_fa local face.
+     * @param i_fsE elastic flux solver, [TL_N_ENS_FS_E][TL_N_LAS].
+     * @param i_fsA anelastic flux solver, [TL_N_ENS_FS_A][TL_N_LAS].
+     * @param i_tFaE face-projected DOFs, [TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS].
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param io_scratch the second entry will be used as scratch space.
+     *
+     * @paramt TL_N_LAS number of lanes of the flux solvers, 1 or TL_N_CRS.
+     **/
+    template< unsigned short TL_N_LAS >
+    void neighFsLas( unsigned short         i_fa,
+                     TL_T_REAL      const * i_fsE,
+                     TL_T_REAL      const * i_fsA,
+                     TL_T_REAL      const * i_tFaE,
+                     TL_T_REAL              io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL              io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL              io_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      // flux solver
+      m_mm.template denseA< TL_N_QTS_E,
+                            TL_N_MDS_FA,
+                            TL_N_QTS_E,
+                            TL_N_MDS_FA,
+                            TL_N_MDS_FA,
+                            true,
+                            TL_N_LAS >( i_fsE,
+                                        i_tFaE,
+                                        io_scratch[1][0][0] );
+
+      // transposed flux matrix
+      m_mm.template cscB< TL_N_QTS_E,
+                          TL_N_MDS_FA,
+                          TL_N_MDS_EL,
+                          false >( m_mm.m_pats[1][i_fa],
+                                   io_scratch[1][0][0],
+                                   m_fIntT[i_fa],
+                                   io_dofsE[0][0] );
+
+      if( TL_N_RMS > 0 ) {
+        // anelastic flux solver
+        m_mm.template denseA< TL_N_QTS_M,
+                              TL_N_MDS_FA,
+                              TL_N_QTS_E,
+                              TL_N_MDS_FA,
+                              TL_N_MDS_FA,
+                              true,
+                              TL_N_LAS >( i_fsA,
+                                          i_tFaE,
+                                          io_scratch[1][0][0] );
+
+        // transposed flux matrix
+        m_mm.template cscB< TL_N_QTS_M,
+                            TL_N_MDS_FA,
+                            TL_N_MDS_EL,
+                            false >( m_mm.m_pats[1][i_fa],
+                                     io_scratch[1][0][0],
+                                     m_fIntT[i_fa],
+                                     io_dofsA[0][0] );
+      }
+    }
+
+  public:
+    /**
+     * Constructor of the SIMD surface integration.
+     *
+     * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    SurfIntSimd( TL_T_REAL     const * i_rfs,
+                 data::Dynamic       & io_dynMem ): SurfInt< TL_T_REAL,
+                                                             TL_N_RMS,
+                                                             TL_T_EL,
+                                                             TL_O_SP,
+                                                             TL_N_CRS >( i_rfs,
+                                                                         io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get flux matrices
+      TL_T_REAL l_fIntL[TL_N_FAS][TL_N_MDS_EL][TL_N_MDS_FA];
+      TL_T_REAL l_fIntN[TL_N_FMNS][TL_N_MDS_EL][TL_N_MDS_FA];
+      TL_T_REAL l_fIntT[TL_N_FAS][TL_N_MDS_FA][TL_N_MDS_EL];
+      l_basis.getFluxDense( l_fIntL[0][0],
+                            l_fIntN[0][0],
+                            l_fIntT[0][0] );
+
+      // store flux matrices sparse and set up the patterns
+      init( l_fIntL,
+            l_fIntN,
+            l_fIntT,
+            io_dynMem );
+    }
+
+    /**
+     * Element local contribution for fused seismic simulations (SIMD version).
+     *
+     * @param i_fsE elastic flux solvers.
+     * @param i_fsA anelastic flux solvers, use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE elastic time integerated DG-DOFs.
+     * @param io_dofsE will be updated with local elastic contribution of the element to the surface integral.
+     * @param io_dofsA will be updated with local anelastic contribution of the element to the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_dofsP DOFs for prefetching (not used).
+     * @param i_tDofsP time integrated DOFs for prefetching (not used).
+     **/
+    void local( TL_T_REAL const   i_fsE[TL_N_FAS][TL_N_ENS_FS_E],
+                TL_T_REAL const (*i_fsA)[TL_N_ENS_FS_A],
+                TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL         o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                TL_T_REAL const   i_dofsP[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr,
+                TL_T_REAL const   i_tDofsP[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      localLas< 1 >( i_fsE[0],
+                     (TL_T_REAL const *) i_fsA,
+                     i_tDofsE,
+                     io_dofsE,
+                     io_dofsA,
+                     o_scratch );
+    }
+
+    /**
+     * Element local contribution (SIMD version) for a batch of TL_N_CRS interleaved elements.
+     * The flux solvers are interleaved as well, lane i belongs to the i-th element of the batch.
+     *
+     * @param i_fsE interleaved elastic flux solvers.
+     * @param i_fsA interleaved anelastic flux solvers, use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE interleaved elastic time integerated DG-DOFs.
+     * @param io_dofsE will be updated with the elements' local elastic contribution to the surface integral.
+     * @param io_dofsA will be updated with the elements' local anelastic contribution to the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void localBatch( TL_T_REAL const   i_fsE[TL_N_FAS][TL_N_ENS_FS_E][TL_N_CRS],
+                     TL_T_REAL const (*i_fsA)[TL_N_ENS_FS_A][TL_N_CRS],
+                     TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL         o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      localLas< TL_N_CRS >( i_fsE[0][0],
+                            (TL_T_REAL const *) i_fsA,
+                            i_tDofsE,
+                            io_dofsE,
+                            io_dofsA,
+                            o_scratch );
+    }
+
+    /**
+     * Projects the time integrated DOFs of a single adjacent element to the shared face (SIMD version).
+     * This is the first step of the neighboring contribution, which is performed by the adjacent element's rank for the faces of the MPI-halo.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the adjacent element.
+     * @param o_tFaE will be set to the face-projected, elastic time integrated DG-DOFs.
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
+     **/
+    void neighProj( unsigned short       i_fa,
+                    unsigned short       i_vId,
+                    unsigned short       i_fId,
+                    TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                    TL_T_REAL            o_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                    TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      // local or neighboring flux matrix
+      unsigned short l_fMatId = fMatIdLN( i_fa, i_vId, i_fId );
+
+      m_mm.template cscB< TL_N_QTS_E,
+                          TL_N_MDS_EL,
+                          TL_N_MDS_FA,
+                          true >( m_mm.m_pats[0][l_fMatId],
+                                  i_tDofsE[0][0],
+                                  m_fIntLN[l_fMatId],
+                                  o_tFaE[0][0] );
+    }
+
+    /**
+     * Neighboring contribution of a single adjacent element, given its face-projected time integrated DOFs (SIMD version).
+     *
+     * @param i_fa local face.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tFaE face-projected, elastic time integrated DG-DOFs of the adjacent element.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations (second entry only).
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
+     **/
+    void neighFa( unsigned short       i_fa,
+                  TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                  TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                  TL_T_REAL      const i_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      // flux solver and transposed flux matrix
+      neighFsLas< 1 >( i_fa,
+                       i_fsE,
+                       i_fsA,
+                       i_tFaE[0][0],
+                       io_dofsE,
+                       io_dofsA,
+                       o_scratch );
+    }
+
+    /**
+     * Neighboring contribution of a single adjacent element for fused simulations (SIMD version).
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tDofsE elastic time integrated DG-DOFs.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      // local or neighboring flux matrix
+      neighProj( i_fa,
+                 i_vId,
+                 i_fId,
+                 i_tDofsE,
+                 o_scratch[0] );
+
+      // flux solver and transposed flux matrix
+      neighFa( i_fa,
+               i_fsE,
+               i_fsA,
+               o_scratch[0],
+               io_dofsE,
+               io_dofsA,
+               o_scratch );
+    }
+
+    /**
+     * Projects the time integrated DOFs of a single adjacent element to the shared face and stores the result in the given lane of the batch (SIMD version).
+     * This is the first step of the neighboring contribution for a batch of TL_N_CRS interleaved elements, since the flux matrices differ per lane.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_lane lane of the element in the batch.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the adjacent element without fused simulations, [TL_N_QTS_E][TL_N_MDS_EL]; nullptr zeroes the lane (no contribution).
+     * @param o_scratch first entry will be set to the face-projected DOFs in the given lane.
+     **/
+    void neighLane( unsigned short         i_fa,
+                    unsigned short         i_vId,
+                    unsigned short         i_fId,
+                    unsigned short         i_lane,
+                    TL_T_REAL      const * i_tDofsE,
+                    TL_T_REAL              o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      if( i_tDofsE == nullptr ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ )
+            o_scratch[0][l_qt][l_md][i_lane] = 0;
+        return;
+      }
+
+      unsigned short l_fMatId = fMatIdLN( i_fa, i_vId, i_fId );
+
+      m_mm.template cscBLane< TL_N_QTS_E,
+                              TL_N_MDS_EL,
+                              TL_N_MDS_FA >( m_mm.m_pats[0][l_fMatId],
+                                             i_lane,
+                                             i_tDofsE,
+                                             m_fIntLN[l_fMatId],
+                                             o_scratch[0][0][0] );
+    }
+
+    /**
+     * Stores the face-projected time integrated DOFs of a single adjacent element in the given lane of the batch (SIMD version).
+     * This replaces neighLane for adjacent elements whose projection was performed by their own rank (faces of the MPI-halo).
+     *
+     * @param i_lane lane of the element in the batch.
+     * @param i_tFaE face-projected, elastic time integrated DG-DOFs of the adjacent element without fused simulations, [TL_N_QTS_E][TL_N_MDS_FA].
+     * @param o_scratch first entry will be set to the face-projected DOFs in the given lane.
+     **/
+    void neighLaneFa( unsigned short         i_lane,
+                      TL_T_REAL      const * i_tFaE,
+                      TL_T_REAL              o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ )
+          o_scratch[0][l_qt][l_md][i_lane] = i_tFaE[l_qt*TL_N_MDS_FA + l_md];
+    }
+
+    /**
+     * Neighboring contribution for a batch of TL_N_CRS interleaved elements (SIMD version).
+     * The face-projected DOFs of the adjacent elements have to be set through neighLane before.
+     *
+     * @param i_fa local face.
+     * @param i_fsE interleaved elastic flux solvers.
+     * @param i_fsA interleaved anelastic flux solvers.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent elements to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent elements tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param io_scratch face-projected DOFs in the first entry, the second entry will be used as scratch space.
+     **/
+    void neighBatch( unsigned short       i_fa,
+                     TL_T_REAL      const i_fsE[TL_N_ENS_FS_E][TL_N_CRS],
+                     TL_T_REAL      const i_fsA[TL_N_ENS_FS_A][TL_N_CRS],
+                     TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL            io_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      neighFsLas< TL_N_CRS >( i_fa,
+                              i_fsE[0],
+                              (TL_T_REAL const *) i_fsA,
+                              io_scratch[0][0][0],
+                              io_dofsE,
+                              io_dofsA,
+                              io_scratch );
+    }
+};
+
+#endif
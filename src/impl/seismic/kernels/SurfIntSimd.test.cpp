@@ -0,0 +1,434 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the fused surface integration using SIMD kernels.
+ **/
+#include <catch.hpp>
+#define private public
+#include "SurfIntSimd.hpp"
+#undef private
+
+
+TEST_CASE( "Local elastic surface integration for fused simulations using SIMD kernels.", "[elastic][SurfIntLocalSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       0,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( nullptr,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimd[9][10][N_CRUNS];
+  float l_tDofsSimd[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimd[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimd[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+      }
+    }
+  }
+
+  // compute local surface integration
+  l_surf.local( (float (*)[9*9]) l_fSolvE,
+                                 nullptr,
+                                 l_tDofsSimd,
+                                 l_dofsSimd,
+                                 nullptr,
+                                 l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimd[l_qt][l_md][l_cr] == Approx( l_refEdofs[l_qt][l_md] ) );
+      }
+    }
+  }
+}
+
+TEST_CASE( "Neighboring elastic surface integration for fused simulations using SIMD kernels.", "[elastic][SurfIntNeighSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       0,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( nullptr,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimd[9][10][N_CRUNS];
+  float l_tDofsSimd[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimd[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimd[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+      }
+    }
+  }
+
+
+  // compute neighboring surface integration
+  l_surf.neigh( 3,
+                1,
+                2,
+                l_fSolvE[0][0],
+                nullptr,
+                l_tDofsSimd,
+                l_dofsSimd,
+                nullptr,
+                l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimd[l_qt][l_md][l_cr] == Approx( l_refEneighDofs[l_qt][l_md] ) );
+      }
+    }
+  }
+}
+
+
+TEST_CASE( "Neighboring elastic surface integration in the presence of a free surface for fused simulations using SIMD kernels.", "[elastic][SurfIntNeighFsSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       0,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( nullptr,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimd[9][10][N_CRUNS];
+  float l_tDofsSimd[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimd[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimd[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+      }
+    }
+  }
+
+  // compute neighboring surface integration with at a free-surface
+  l_surf.neigh( 2,
+                std::numeric_limits< unsigned short >::max(),
+                std::numeric_limits< unsigned short >::max(),
+                l_fSolvE[0][0],
+                nullptr,
+                l_tDofsSimd,
+                l_dofsSimd,
+                nullptr,
+                l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimd[l_qt][l_md][l_cr] == Approx( l_refEneighFdofs[l_qt][l_md] ) );
+      }
+    }
+  }
+}
+
+TEST_CASE( "Local viscoelastic surface integration for fused simulations using SIMD kernels.", "[visco][SurfIntLocalSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       3,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( l_rfs,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimdE[9][10][N_CRUNS];
+  float l_dofsSimdA[3][6][10][N_CRUNS];
+  float l_tDofsSimdE[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimdE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimdE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+
+        if( l_qt < 6 ) {
+          for( unsigned short l_rm = 0; l_rm < 3; l_rm++ ) {
+            l_dofsSimdA[l_rm][l_qt][l_md][l_cr] = l_dofsA[l_rm][l_qt][l_md];
+          }
+        }
+      }
+    }
+  }
+
+  // compute local surface integration
+  l_surf.local( (float (*) [9*9]) l_fSolvE,
+                (float (*) [6*9]) l_fSolvA,
+                                  l_tDofsSimdE,
+                                  l_dofsSimdE,
+                                  l_dofsSimdA,
+                                  l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimdE[l_qt][l_md][l_cr] == Approx( l_refEdofs[l_qt][l_md] ) );
+
+        if( l_qt < 6) {
+          for( unsigned short l_rm = 0; l_rm < 3; l_rm++ ) {
+            REQUIRE( l_dofsSimdA[l_rm][l_qt][l_md][l_cr] == Approx( l_refVdofsA[l_rm][l_qt][l_md] ) );
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE( "Neighboring viscoelastic surface integration for fused simulations using SIMD kernels.", "[visco][SurfIntNeighSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       3,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( l_rfs,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimdE[9][10][N_CRUNS];
+  float l_upsSimdA[6][10][N_CRUNS];
+  float l_tDofsSimdE[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimdE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimdE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+
+        if( l_qt < 6 ) {
+          l_upsSimdA[l_qt][l_md][l_cr] = 0;
+        }
+      }
+    }
+  }
+
+  // compute neighboring surface integration
+  l_surf.neigh( 3,
+                1,
+                2,
+                l_fSolvE[0][0],
+                l_fSolvA[0][0],
+                l_tDofsSimdE,
+                l_dofsSimdE,
+                l_upsSimdA,
+                l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimdE[l_qt][l_md][l_cr] == Approx( l_refEneighDofs[l_qt][l_md] ) );
+      }
+    }
+  }
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_upsSimdA[l_qt][l_md][l_cr] == Approx( l_refVneighDofsA[l_qt][l_md] ) );
+      }
+    }
+  }
+}
+
+TEST_CASE( "Neighboring viscoelastic surface integration in the presence of a free surface for fused simulations using SIMD kernels.", "[visco][SurfIntNeighFsSimd]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       3,
+                                       TET4,
+                                       3,
+                                       N_CRUNS > l_surf( l_rfs,
+                                                    l_dynMem );
+
+  float l_scratch[2][9][6][N_CRUNS];
+  float l_dofsSimdE[9][10][N_CRUNS];
+  float l_upsSimdA[6][10][N_CRUNS];
+  float l_tDofsSimdE[9][10][N_CRUNS];
+
+  // duplicate DOFs and tDofs for fused config
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        l_tDofsSimdE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
+        l_dofsSimdE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
+
+        if( l_qt < 6 ) {
+          l_upsSimdA[l_qt][l_md][l_cr] = 0;
+        }
+      }
+    }
+  }
+
+  // compute neighboring surface integration
+  l_surf.neigh( 2,
+                std::numeric_limits< unsigned short >::max(),
+                std::numeric_limits< unsigned short >::max(),
+                l_fSolvE[0][0],
+                l_fSolvA[0][0],
+                l_tDofsSimdE,
+                l_dofsSimdE,
+                l_upsSimdA,
+                l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_dofsSimdE[l_qt][l_md][l_cr] == Approx( l_refEneighFdofs[l_qt][l_md] ) );
+      }
+    }
+  }
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+        REQUIRE( l_upsSimdA[l_qt][l_md][l_cr] == Approx( l_refVneighFdofsA[l_qt][l_md] ) );
+      }
+    }
+  }
+}
+TEST_CASE( "Neighboring elastic surface integration for element batches using SIMD kernels.", "[elastic][SurfIntNeighSimdBatch]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // kernel for batches of four elements
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       0,
+                                       TET4,
+                                       3,
+                                       4 > l_surf( nullptr,
+                                                   l_dynMem );
+
+  float l_scratch[2][9][6][4];
+  float l_fSolvBt[81][4];
+  float l_dofsBt[9][10][4];
+
+  // interleave flux solvers and DOFs
+  for( unsigned short l_en = 0; l_en < 81; l_en++ )
+    for( unsigned short l_la = 0; l_la < 4; l_la++ )
+      l_fSolvBt[l_en][l_la] = l_fSolvE[0][0][l_en];
+
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ )
+    for( unsigned short l_md = 0; l_md < 10; l_md++ )
+      for( unsigned short l_la = 0; l_la < 4; l_la++ )
+        l_dofsBt[l_qt][l_md][l_la] = l_dofsE[l_qt][l_md];
+
+  // project the neighbors' DOFs: lanes 0 and 2 have a neighbor, lane 1 is at the free surface, lane 3 has no contribution
+  l_surf.neighLane( 3, 1, 2, 0, l_tDofsE[0], l_scratch );
+  l_surf.neighLane( 3,
+                    std::numeric_limits< unsigned short >::max(),
+                    std::numeric_limits< unsigned short >::max(),
+                    1,
+                    l_tDofsE[0],
+                    l_scratch );
+  l_surf.neighLane( 3, 1, 2, 2, l_tDofsE[0], l_scratch );
+  l_surf.neighLane( 3, 0, 0, 3, nullptr, l_scratch );
+
+  // compute neighboring surface integration
+  l_surf.neighBatch( 3,
+                     l_fSolvBt,
+                     nullptr,
+                     l_dofsBt,
+                     nullptr,
+                     l_scratch );
+
+  // compute the reference of the free-surface lane through the scalar kernel on the same face
+  edge::seismic::kernels::SurfIntSimd< float,
+                                       0,
+                                       TET4,
+                                       3,
+                                       1 > l_surf1( nullptr,
+                                                    l_dynMem );
+  float l_scratch1[2][9][6][1];
+  float l_tDofs1[9][10][1];
+  float l_dofs1[9][10][1];
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      l_tDofs1[l_qt][l_md][0] = l_tDofsE[l_qt][l_md];
+      l_dofs1[l_qt][l_md][0] = l_dofsE[l_qt][l_md];
+    }
+  }
+  l_surf1.neigh( 3,
+                 std::numeric_limits< unsigned short >::max(),
+                 std::numeric_limits< unsigned short >::max(),
+                 l_fSolvE[0][0],
+                 nullptr,
+                 l_tDofs1,
+                 l_dofs1,
+                 nullptr,
+                 l_scratch1 );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      REQUIRE( l_dofsBt[l_qt][l_md][0] == Approx( l_refEneighDofs[l_qt][l_md] ) );
+      REQUIRE( l_dofsBt[l_qt][l_md][1] == Approx( l_dofs1[l_qt][l_md][0] ) );
+      REQUIRE( l_dofsBt[l_qt][l_md][2] == Approx( l_refEneighDofs[l_qt][l_md] ) );
+      REQUIRE( l_dofsBt[l_qt][l_md][3] == Approx( l_dofsE[l_qt][l_md] ) );
+    }
+  }
+}
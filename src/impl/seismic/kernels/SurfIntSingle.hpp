@@ -255,29 +255,22 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
     }
 
     /**
-     * Neighboring contribution of a single adjacent element for single forward simulations.
+     * Projects the time integrated DOFs of a single adjacent element to the shared face for single forward simulations.
+     * This is the first step of the neighboring contribution, which is performed by the adjacent element's rank for the faces of the MPI-halo.
      *
      * @param i_fa local face.
      * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
      * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
-     * @param i_fsE elastic flux solver.
-     * @param i_fsA anelastic flux solver
-     * @param i_tDofsE elastic time integrated DG-DOFs.
-     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
-     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
-     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the adjacent element.
+     * @param o_tFaE will be set to the face-projected, elastic time integrated DG-DOFs.
      * @param i_pre DOFs or tDOFs for prefetching.
      **/
-    void neigh( unsigned short       i_fa,
-                unsigned short       i_vId,
-                unsigned short       i_fId,
-                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
-                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
-                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
-                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
-                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][1],
-                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][1],
-                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][1] = nullptr ) const {
+    void neighProj( unsigned short       i_fa,
+                    unsigned short       i_vId,
+                    unsigned short       i_fId,
+                    TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
+                    TL_T_REAL            o_tFaE[TL_N_QTS_E][TL_N_MDS_FA][1],
+                    TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][1] = nullptr ) const {
       // derive the id of the neighboring flux matrix
       unsigned short l_fMatId = std::numeric_limits< unsigned short >::max();
       if( i_vId != std::numeric_limits< unsigned short >::max() ) {
@@ -290,13 +283,34 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       // multiply with first face integration matrix
       m_mm.m_kernels[0][0]( m_fIntLN[l_fMatId],
                             i_tDofsE[0][0],
-                            o_scratch[0][0][0],
+                            o_tFaE[0][0],
                             nullptr,
                             i_pre[0][0],
                             nullptr );
+    }
 
+    /**
+     * Neighboring contribution of a single adjacent element, given its face-projected time integrated DOFs, for single forward simulations.
+     *
+     * @param i_fa local face.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tFaE face-projected, elastic time integrated DG-DOFs of the adjacent element.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations (second entry only).
+     * @param i_pre DOFs or tDOFs for prefetching.
+     **/
+    void neighFa( unsigned short       i_fa,
+                  TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                  TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                  TL_T_REAL      const i_tFaE[TL_N_QTS_E][TL_N_MDS_FA][1],
+                  TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
+                  TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][1],
+                  TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][1],
+                  TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][1] = nullptr ) const {
       // multiply with flux solver
-      m_mm.m_kernels[0][1]( o_scratch[0][0][0],
+      m_mm.m_kernels[0][1]( i_tFaE[0][0],
                             i_fsE,
                             o_scratch[1][0][0] );
 
@@ -310,7 +324,7 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
 
       if( TL_N_RMS > 0 ) {
         // multiply with anelastic flux solver
-        m_mm.m_kernels[1][0]( o_scratch[0][0][0],
+        m_mm.m_kernels[1][0]( i_tFaE[0][0],
                               i_fsA,
                               o_scratch[1][0][0] );
 
@@ -320,6 +334,49 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
                               io_dofsA[0][0] );
       }
     }
+
+    /**
+     * Neighboring contribution of a single adjacent element for single forward simulations.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tDofsE elastic time integrated DG-DOFs.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_pre DOFs or tDOFs for prefetching.
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
+                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][1],
+                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][1],
+                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][1],
+                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][1] = nullptr ) const {
+      // multiply with first face integration matrix
+      neighProj( i_fa,
+                 i_vId,
+                 i_fId,
+                 i_tDofsE,
+                 o_scratch[0],
+                 i_pre );
+
+      // multiply with the flux solvers and second face integration matrix
+      neighFa( i_fa,
+               i_fsE,
+               i_fsA,
+               o_scratch[0],
+               io_dofsE,
+               io_dofsA,
+               o_scratch,
+               i_pre );
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
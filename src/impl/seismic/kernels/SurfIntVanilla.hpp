@@ -262,29 +262,22 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
     }
 
     /**
-     * Neighboring contribution of a single adjacent element using vanilla kernels.
+     * Projects the time integrated DOFs of a single adjacent element to the shared face using vanilla kernels.
+     * This is the first step of the neighboring contribution, which is performed by the adjacent element's rank for the faces of the MPI-halo.
      *
      * @param i_fa local face.
      * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
      * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
-     * @param i_fsE elastic flux solver.
-     * @param i_fsA anelastic flux solver
-     * @param i_tDofsE elastic time integrated DG-DOFs.
-     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
-     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
-     * @param o_scratch will be used as scratch space for the computations.
-     * @param i_pre DOFs or tDOFs for prefetching.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the adjacent element.
+     * @param o_tFaE will be set to the face-projected, elastic time integrated DG-DOFs.
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
      **/
-    void neigh( unsigned short       i_fa,
-                unsigned short       i_vId,
-                unsigned short       i_fId,
-                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
-                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
-                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
-                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+    void neighProj( unsigned short       i_fa,
+                    unsigned short       i_vId,
+                    unsigned short       i_fId,
+                    TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                    TL_T_REAL            o_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                    TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
       // derive the id of the neighboring flux matrix
       unsigned short l_fMatId = std::numeric_limits< unsigned short >::max();
       if( i_vId != std::numeric_limits< unsigned short >::max() ) {
@@ -297,11 +290,32 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
       // local/neighbor face integration matrix
       m_mm.m_kernels[0][0]( i_tDofsE[0][0],
                             m_fIntLN[l_fMatId],
-                            o_scratch[0][0][0] );
+                            o_tFaE[0][0] );
+    }
 
+    /**
+     * Neighboring contribution of a single adjacent element, given its face-projected time integrated DOFs, using vanilla kernels.
+     *
+     * @param i_fa local face.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tFaE face-projected, elastic time integrated DG-DOFs of the adjacent element.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations (second entry only).
+     * @param i_pre DOFs or tDOFs for prefetching (not used).
+     **/
+    void neighFa( unsigned short       i_fa,
+                  TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                  TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                  TL_T_REAL      const i_tFaE[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                  TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                  TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
       // elastic flux solver
       m_mm.m_kernels[0][1]( i_fsE,
-                            o_scratch[0][0][0],
+                            i_tFaE[0][0],
                             o_scratch[1][0][0] );
 
       // transposed face integration matrix
@@ -312,7 +326,7 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
       if( TL_N_RMS > 0 ) {
         // anelastic flux solver
         m_mm.m_kernels[1][0]( i_fsA,
-                              o_scratch[0][0][0],
+                              i_tFaE[0][0],
                               o_scratch[1][0][0] );
 
         // transposed face integration matrix
@@ -321,6 +335,49 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
                               io_dofsA[0][0] );
       }
     }
+
+    /**
+     * Neighboring contribution of a single adjacent element using vanilla kernels.
+     *
+     * @param i_fa local face.
+     * @param i_vId id of the vertex, matching the element's vertex 0, from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fId id of the face from the perspective of the adjacent element w.r.t. to the reference element.
+     * @param i_fsE elastic flux solver.
+     * @param i_fsA anelastic flux solver
+     * @param i_tDofsE elastic time integrated DG-DOFs.
+     * @param io_dofsE will be updated with the elastic contribution of the adjacent element to the surface integral.
+     * @param io_dofsA will be updated with the unscaled (w.r.t. frequencies) anelastic contribution of the adjacent element tot the surface integral, use nullptr for TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     * @param i_pre DOFs or tDOFs for prefetching.
+     **/
+    void neigh( unsigned short       i_fa,
+                unsigned short       i_vId,
+                unsigned short       i_fId,
+                TL_T_REAL      const i_fsE[TL_N_ENS_FS_E],
+                TL_T_REAL      const i_fsA[TL_N_ENS_FS_A],
+                TL_T_REAL      const i_tDofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsE[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            io_dofsA[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS],
+                TL_T_REAL            o_scratch[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS],
+                TL_T_REAL      const i_pre[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = nullptr ) const {
+      // local/neighbor face integration matrix
+      neighProj( i_fa,
+                 i_vId,
+                 i_fId,
+                 i_tDofsE,
+                 o_scratch[0],
+                 i_pre );
+
+      // flux solvers and transposed face integration matrix
+      neighFa( i_fa,
+               i_fsE,
+               i_fsA,
+               o_scratch[0],
+               io_dofsE,
+               io_dofsA,
+               o_scratch,
+               i_pre );
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -91,6 +91,46 @@ TEST_CASE( "Elastic neighboring surface integration using vanilla kernels.", "[e
 }
 
 
+TEST_CASE( "Elastic neighboring surface integration of face-projected DOFs using vanilla kernels.", "[elastic][SurfIntNeighFaVanilla]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // set up kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntVanilla< float,
+                                          0,
+                                          TET4,
+                                          3,
+                                          1 > l_surf( nullptr, l_dynMem );
+
+  float l_tFaE[9][6][1];
+  float l_scratch[2][9][6][1];
+
+  // project the neighbor's time integrated DOFs to the face, as done by the neighbor's rank
+  l_surf.neighProj(                    3,
+                                       1,
+                                       2,
+                    (float (*)[10][1]) l_tDofsE,
+                                       l_tFaE );
+
+  // compute neighboring surface integration from the face-projected DOFs
+  l_surf.neighFa(                    3,
+                  (float (*))        l_fSolvE[0],
+                                     nullptr,
+                                     l_tFaE,
+                  (float (*)[10][1]) l_dofsE,
+                                     nullptr,
+                                     l_scratch );
+
+  // check the results
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+      REQUIRE( l_dofsE[l_qt][l_md] == Approx( l_refEneighDofs[l_qt][l_md] ) );
+    }
+  }
+}
+
+
 TEST_CASE( "Elastic neighboring surface integration in the presence of a free surface using vanilla kernels.", "[elastic][SurfIntNeighFsVanilla]" ) {
   // set up matrix structures
 #include "SurfInt.test.inc"
@@ -154,6 +154,48 @@ class edge::seismic::kernels::TimePred {
       }
     }
 
+    /**
+     * Integrates the time prediction, given by the time derivatives, over the given interval.
+     * The interval is relative to the time at which the time prediction was obtained.
+     * Example (local time stepping, second sub-step of a neighbor with a two times smaller time step):
+     *   0    1.5      2.5       3.5 absolute time
+     *   |-----|--------|=========|--------->
+     *         0       1.0       2.0 relative time (expected as input)
+     *
+     * @param i_t0 relative start of the interval.
+     * @param i_t1 relative end of the interval.
+     * @param i_der time prediction given through the time derivatives.
+     * @param o_tInt will be set to the time integrated DOFs.
+     **/
+    static void inline integrateTimePrediction( TL_T_REAL        i_t0,
+                                                TL_T_REAL        i_t1,
+                                                TL_T_REAL const  i_der[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                                                TL_T_REAL        o_tInt[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) {
+      // scalars of the antiderivative at the two points in time
+      TL_T_REAL l_sc0 = i_t0;
+      TL_T_REAL l_sc1 = i_t1;
+
+      // init with the zeroth derivative
+      for( int_qt l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+        for( int_md l_md = 0; l_md < TL_N_MDS; l_md++ )
+          for( int_cfr l_ru = 0; l_ru < TL_N_CRS; l_ru++ )
+            o_tInt[l_qt][l_md][l_ru] = (l_sc1 - l_sc0) * i_der[0][l_qt][l_md][l_ru];
+
+      // iterate over derivatives
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // update scalars
+        l_sc0 *= i_t0 / (l_de+1);
+        l_sc1 *= i_t1 / (l_de+1);
+
+        for( int_qt l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+          for( int_md l_md = 0; l_md < CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de ); l_md++ ) {
+            for( int_cfr l_ru = 0; l_ru < TL_N_CRS; l_ru++ )
+              o_tInt[l_qt][l_md][l_ru] += (l_sc1 - l_sc0) * i_der[l_de][l_qt][l_md][l_ru];
+          }
+        }
+      }
+    }
+
 };
 
 #endif
@@ -26,8 +26,11 @@
 #ifndef EDGE_SEISMIC_KERNELS_TIME_PRED_FUSED_HPP
 #define EDGE_SEISMIC_KERNELS_TIME_PRED_FUSED_HPP
 
+#include <sstream>
 #include "TimePred.hpp"
 #include "data/MmXsmmFused.hpp"
+#include "data/Tuner.h"
+#include "monitor/Timer.hpp"
 #include "FakeMats.hpp"
 
 namespace edge {
@@ -118,19 +121,16 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
      * @param o_offsets will be set to the offsets (counting non-zero entries) of the sparse matrices.
      * @param o_nonZeros will be set to the raw non-zero entries of the sparse matrices.
      * @param o_mats will be set to the CSC representation of the sparse matrices.
+     * @param i_nChs number of chunks of the fused simulations, the non-zero entries are split accordingly.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void getCscStiffT( TL_T_REAL               const   i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
                               std::vector< size_t >         & o_maxNzCols,
                               std::vector< size_t >         & o_offsets,
                               std::vector< TL_T_REAL >      & o_nonZeros,
-                              std::vector< t_matCsc >       & o_mats ) {
-      // determine CSC fill-in strategy
-      std::string l_cscFillIn = "none";
-
-      if ( libxsmm_get_target_archid() == LIBXSMM_X86_AVX512_KNM ) {
-        l_cscFillIn = "qfma";
-      }
-
+                              std::vector< t_matCsc >       & o_mats,
+                              unsigned short                  i_nChs,
+                              std::string             const & i_fillIn ) {
       // reset and init output
       o_maxNzCols.resize( 0 );
       o_offsets.resize( 0 );
@@ -173,17 +173,15 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                                                          TOL.BASIS,
                                                          l_nzBl[0][0][1]+1,
                                                          l_maxNzCol+1,
-                                                         l_cscFillIn );
+                                                         i_fillIn );
           o_mats.push_back( l_stiffTCsc[l_di] );
         }
 
         // add data for the first CK-stiff matrix or shrinking stiff matrices
         if( l_de == 1 || l_maxNzCol < l_nzBl[0][0][1] ) {
           for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
-            for( unsigned int l_nz = 0; l_nz < l_stiffTCsc[l_di].val.size(); l_nz++ ) {
-              o_nonZeros.push_back( l_stiffTCsc[l_di].val[l_nz] );
-            }
-            o_offsets.push_back( o_offsets.back() + l_stiffTCsc[l_di].val.size() );
+            edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( i_nChs, l_stiffTCsc[l_di], o_nonZeros );
+            o_offsets.push_back( o_offsets.back() + i_nChs * l_stiffTCsc[l_di].val.size() );
           }
         }
         else {
@@ -206,8 +204,12 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
      * Generates the matrix kernels for the transposed stiffness matrices and star matrices.
      * 
      * @param i_stiffT dense representation of the transposed matrices.
+     * @param i_fillIn CSC fill-in strategy of the stiffness matrices.
+     * @param io_mm matrix kernels to which the generated kernels are added.
      **/
-    void generateKernels( TL_T_REAL const i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS] ) {
+    static void generateKernels( TL_T_REAL                    const   i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+                                 std::string                  const & i_fillIn,
+                                 edge::data::MmXsmmFused< TL_T_REAL > & io_mm ) {
       // convert stiffness matrices to CSC (incl. possible fill-in)
       std::vector< size_t > l_maxNzCols;
       std::vector< size_t > l_offsets;
@@ -217,7 +219,9 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                     l_maxNzCols,
                     l_offsets,
                     l_nonZeros,
-                    l_cscStiffT );
+                    l_cscStiffT,
+                    io_mm.getNChs(),
+                    i_fillIn );
 
       // get csr star matrices
       t_matCsr l_starCsrE;
@@ -228,7 +232,7 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
       for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
         // transposed stiffness matrices
         for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
-          m_mm.add( 0,                                                // group
+          io_mm.add( 0,                                                // group
                     false,                                            // csc
                     &l_cscStiffT[(l_de-1)*TL_N_DIS + l_di].colPtr[0], // ptr
                     &l_cscStiffT[(l_de-1)*TL_N_DIS + l_di].rowIdx[0], // ids
@@ -244,7 +248,7 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                     LIBXSMM_GEMM_PREFETCH_NONE );
         }
         // elastic star matrix
-        m_mm.add( 1,                     // group
+        io_mm.add( 1,                     // group
                   true,                  // csr
                   &l_starCsrE.rowPtr[0], // ptr
                   &l_starCsrE.colIdx[0], // ids
@@ -272,7 +276,7 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
         EDGE_CHECK_EQ( l_srcCsrA.val.size(), TL_N_NZS_SRC_A );
 
         // anelastic star matrix
-        m_mm.add( 2,                     // group
+        io_mm.add( 2,                     // group
                   true,                  // csr
                   &l_starCsrA.rowPtr[0], // ptr
                   &l_starCsrA.colIdx[0], // ids
@@ -288,7 +292,7 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                   LIBXSMM_GEMM_PREFETCH_NONE );
 
         // anelastic source matrix
-        m_mm.add( 2,                    // group
+        io_mm.add( 2,                    // group
                   true,                 // csr
                   &l_srcCsrA.rowPtr[0], // ptr
                   &l_srcCsrA.colIdx[0], // ids
@@ -312,10 +316,14 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
      * @param i_stiffT dense stiffness matrices.
      * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
      * @param o_stiffT will contain pointers to memory for the individual matrices.
+     * @param i_nChs number of chunks of the fused simulations.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void storeStiffTSparse( TL_T_REAL     const     i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
                                    data::Dynamic       &   io_dynMem,
-                                   TL_T_REAL           *   o_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS]  ) {
+                                   TL_T_REAL           *   o_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS],
+                                   unsigned short          i_nChs,
+                                   std::string   const &   i_fillIn ) {
       // convert stiffness matrices to CSC (incl. possible fill-in)
       std::vector< size_t > l_maxNzCols;
       std::vector< size_t > l_offsets;
@@ -325,7 +333,9 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                     l_maxNzCols,
                     l_offsets,
                     l_nonZeros,
-                    l_cscStiffT );
+                    l_cscStiffT,
+                    i_nChs,
+                    i_fillIn );
 
       // copy sparse matrices to a permanent data structure
       TL_T_REAL * l_stiffTRaw = (TL_T_REAL*) io_dynMem.allocate( l_nonZeros.size() * sizeof(TL_T_REAL),
@@ -348,15 +358,69 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
       }
     }
 
+    /**
+     * Measures the multiplications with the transposed stiffness matrices of the CK procedure for the given fill-in strategy.
+     *
+     * @param i_stiffT dense representation of the transposed stiffness matrices.
+     * @param i_fillIn CSC fill-in strategy.
+     * @return time in seconds.
+     **/
+    static double timeStiffT( TL_T_REAL   const   i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+                              std::string const & i_fillIn ) {
+      data::Dynamic l_dynMem;
+      edge::data::MmXsmmFused< TL_T_REAL > l_mm;
+
+      TL_T_REAL *l_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS] = {};
+      storeStiffTSparse( i_stiffT,
+                         l_dynMem,
+                         l_stiffT,
+                         l_mm.getNChs(),
+                         i_fillIn );
+      generateKernels( i_stiffT,
+                       i_fillIn,
+                       l_mm );
+
+      // dummy data
+      std::size_t l_size = std::size_t(TL_N_QTS_E) * TL_N_MDS * TL_N_CRS;
+      TL_T_REAL *l_in  = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      TL_T_REAL *l_out = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      for( std::size_t l_en = 0; l_en < l_size; l_en++ ) {
+        l_in[l_en]  = 1;
+        l_out[l_en] = 0;
+      }
+
+      // first pass warms up, second pass is measured
+      edge::monitor::Timer l_timer;
+      for( unsigned short l_pa = 0; l_pa < 2; l_pa++ ) {
+        l_timer.reset();
+        l_timer.start();
+        for( unsigned short l_it = 0; l_it < 100; l_it++ ) {
+          for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+            unsigned short l_re = (TL_N_RMS == 0) ? l_de : 1;
+            for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+              l_mm.m_kernels[0][(l_re-1)*(TL_N_DIS)+l_di]( l_in,
+                                                           l_stiffT[l_re-1][l_di],
+                                                           l_out );
+            }
+          }
+        }
+        l_timer.end();
+      }
+
+      return l_timer.elapsed();
+    }
+
   public:
     /**
      * Constructor of the fused time prediction.
      *
      * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
      * @param io_dynMem dynamic memory allocations.
+     * @param io_tuner if given, the fill-in of the stiffness matrices is selected through runtime measurements.
      **/
     TimePredFused( TL_T_REAL     const * i_rfs,
-                   data::Dynamic       & io_dynMem ): TimePred < TL_T_REAL,
+                   data::Dynamic       & io_dynMem,
+                   data::Tuner         * io_tuner = nullptr ): TimePred < TL_T_REAL,
                                                                  TL_N_RMS,
                                                                  TL_T_EL,
                                                                  TL_O_SP,
@@ -373,14 +437,32 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
                                 l_stiffT[0][0],
                                 true );
 
+      // select the fill-in of the stiffness matrices
+      std::vector< std::string > l_fillIns = edge::data::MmXsmmFused< TL_T_REAL >::getFillIns();
+      std::string l_fillIn = l_fillIns[0];
+      if( io_tuner != nullptr ) {
+        std::ostringstream l_key;
+        l_key << "TimePredFused/stiffT el=" << TL_T_EL << " o=" << TL_O_SP << " rms=" << TL_N_RMS
+              << " cfr=" << TL_N_CRS << " prec=" << sizeof(TL_T_REAL)*8 << " arch=" << libxsmm_get_target_arch();
+
+        l_fillIn = io_tuner->select( l_key.str(),
+                                     l_fillIns,
+                                     [&l_stiffT]( std::string const & i_fillIn ) {
+                                       return timeStiffT( l_stiffT, i_fillIn );
+                                     } );
+      }
 
-      // store stiffness matrices dense
+      // store stiffness matrices sparse
       this->storeStiffTSparse( l_stiffT,
                                io_dynMem,
-                               m_stiffT );
+                               m_stiffT,
+                               m_mm.getNChs(),
+                               l_fillIn );
 
       // generate kernels
-      generateKernels( l_stiffT );
+      generateKernels( l_stiffT,
+                       l_fillIn,
+                       m_mm );
     };
 
     /**
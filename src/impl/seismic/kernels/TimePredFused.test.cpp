@@ -37,18 +37,18 @@ TEST_CASE( "Optimized elastic ADER time prediction for fused forward simulations
                                          TET4,
                                          4,
                                          4,
-                                         16 > l_pred( nullptr,
+                                         N_CRUNS > l_pred( nullptr,
                                                       l_dynMem );
 
-  float l_scratch[9][20][16];
-  float l_ders[4][9][20][16];
-  float l_dofsFused[9][20][16];
-  float l_tDofs[9][20][16];
+  float l_scratch[9][20][N_CRUNS];
+  float l_ders[4][9][20][N_CRUNS];
+  float l_dofsFused[9][20][N_CRUNS];
+  float l_tDofs[9][20][N_CRUNS];
 
   // duplicate DOFs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_dofsFused[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
       }
     }
@@ -70,7 +70,7 @@ TEST_CASE( "Optimized elastic ADER time prediction for fused forward simulations
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_tDofs[l_qt][l_md][l_cr] == Approx( l_refEtDofs[l_qt][l_md] ) );
       }
     }
@@ -81,18 +81,18 @@ TEST_CASE( "Optimized viscoelastic ADER time prediction for fused forward simula
   // set up matrix structures
 #include "TimePred.test.inc"
 
-  float l_scratch[9][20][16];
-  float l_dersE[4][9][20][16];
-  float l_dersA[2][4][6][20][16];
-  float l_dofsFusedE[9][20][16];
-  float l_dofsFusedA[2][6][20][16];
-  float l_tDofsE[9][20][16];
-  float l_tDofsA[2][6][20][16];
+  float l_scratch[9][20][N_CRUNS];
+  float l_dersE[4][9][20][N_CRUNS];
+  float l_dersA[2][4][6][20][N_CRUNS];
+  float l_dofsFusedE[9][20][N_CRUNS];
+  float l_dofsFusedA[2][6][20][N_CRUNS];
+  float l_tDofsE[9][20][N_CRUNS];
+  float l_tDofsA[2][6][20][N_CRUNS];
 
   // duplicate DOFs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_dofsFusedE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
 
         if( l_qt < 6) {
@@ -106,13 +106,15 @@ TEST_CASE( "Optimized viscoelastic ADER time prediction for fused forward simula
 
   // kernel
   edge::data::Dynamic l_dynMem;
+  edge::data::Tuner l_tuner;
   edge::seismic::kernels::TimePredFused< float,
                                          2,
                                          TET4,
                                          4,
                                          4,
-                                         16 > l_pred( l_rfs,
-                                                      l_dynMem );
+                                         N_CRUNS > l_pred( l_rfs,
+                                                      l_dynMem,
+                                                      &l_tuner );
 
   // compute time prediction
   l_pred.ck( 0.017,
@@ -130,7 +132,7 @@ TEST_CASE( "Optimized viscoelastic ADER time prediction for fused forward simula
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_tDofsE[l_qt][l_md][l_cr] == Approx( l_refVtDofsE[l_qt][l_md] ) );
       }
     }
@@ -139,7 +141,7 @@ TEST_CASE( "Optimized viscoelastic ADER time prediction for fused forward simula
   for( unsigned short l_rm = 0; l_rm < 2; l_rm++ ) {
     for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
       for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-        for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+        for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
           REQUIRE( l_tDofsA[l_rm][l_qt][l_md][l_cr] == Approx( l_refVtDofsA[l_rm][l_qt][l_md] ) );
         }
       }
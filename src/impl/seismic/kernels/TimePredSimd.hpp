@@ -0,0 +1,505 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Time predictions through the ADER scheme for seismic setups with fused forward simulations, using portable SIMD kernels.
+ **/
+#ifndef EDGE_SEISMIC_KERNELS_TIME_PRED_SIMD_HPP
+#define EDGE_SEISMIC_KERNELS_TIME_PRED_SIMD_HPP
+
+#include "TimePred.hpp"
+#include "dg/Basis.h"
+#include "data/MmSimd.hpp"
+#include "FakeMats.hpp"
+
+namespace edge {
+  namespace seismic {
+    namespace kernels {
+      template< typename       TL_T_REAL,
+                unsigned short TL_N_RMS,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_O_TI,
+                unsigned short TL_N_CRS >
+      class TimePredSimd;
+    }
+  }
+}
+
+/**
+ * ADER time prediction for fused seismic forward simulations using portable SIMD kernels.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_RMS number of relaxation mechanisms.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP order in space.
+ * @paramt TL_O_TI order in time.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_RMS,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_O_TI,
+          unsigned short TL_N_CRS >
+class edge::seismic::kernels::TimePredSimd: public edge::seismic::kernels::TimePred < TL_T_REAL,
+                                                                                      TL_N_RMS,
+                                                                                      TL_T_EL,
+                                                                                      TL_O_SP,
+                                                                                      TL_O_TI,
+                                                                                      TL_N_CRS > {
+  private:
+    //! dimension of the element
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of elastic quantities
+    static unsigned short const TL_N_QTS_E = CE_N_QTS_E( TL_N_DIS );
+
+    //! number of quantities per relaxation mechanism
+    static unsigned short const TL_N_QTS_M = CE_N_QTS_M( TL_N_DIS );
+
+    //! number of non-zeros in the elastic star matrices
+    static unsigned short const TL_N_NZS_STAR_E = CE_N_ENS_STAR_E_SP( TL_N_DIS );
+
+    //! number of non-zeros in the anelastic star matrices
+    static unsigned short const TL_N_NZS_STAR_A = CE_N_ENS_STAR_A_SP( TL_N_DIS );
+
+    //! number of non-zeros in the anelastic source matrices
+    static unsigned short const TL_N_NZS_SRC_A = CE_N_ENS_SRC_A_SP( TL_N_DIS );
+
+    //! pointers to the non-zeros of the (possibly recursive) stiffness matrices
+    TL_T_REAL *m_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS] = {};
+
+    //! sparsity patterns and micro-kernels
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+
+    /**
+     * Gets the recursive sparse matrix structures of the dense input matrices.
+     * 
+     * @param i_stiffT transposed stiffness matrices.
+     * @param o_maxNzCols will be set to maximum non-zero column of the three stiffness matrices for every recursion.
+     * @param o_mats will be set to the CSC representation of the sparse matrices.
+     **/
+    static void getCscStiffT( TL_T_REAL               const   i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+                              std::vector< size_t >         & o_maxNzCols,
+                              std::vector< t_matCsc >       & o_mats ) {
+      // reset output
+      o_maxNzCols.resize( 0 );
+      o_mats.resize( 0 );
+
+      // derive the non-zeros of the recursive ADER scheme.
+      t_matCrd l_stiffTCrd[TL_N_DIS];
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        edge::linalg::Matrix::denseToCrd< TL_T_REAL >( TL_N_MDS,
+                                                       TL_N_MDS,
+                                                       i_stiffT[l_di][0],
+                                                       l_stiffTCrd[l_di],
+                                                       TOL.BASIS );
+      }
+
+      // nz-blocks
+      unsigned int l_nzBl[2][2][2];
+      // init with matrix dim
+      l_nzBl[0][0][0] = l_nzBl[0][1][0] = 0;
+      l_nzBl[0][0][1] = l_nzBl[0][1][1] = TL_N_MDS-1;
+
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // determine non-zero block for the next iteration
+        unsigned int l_maxNzCol = 0;
+
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          edge::linalg::Matrix::getBlockNz( l_stiffTCrd[l_di], l_nzBl[0], l_nzBl[1] );
+          l_maxNzCol = std::max( l_maxNzCol, l_nzBl[1][1][1] );
+        }
+        o_maxNzCols.push_back( l_maxNzCol );
+
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          t_matCsc l_stiffTCsc;
+          edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS,
+                                                         TL_N_MDS,
+                                                         i_stiffT[l_di][0],
+                                                         l_stiffTCsc,
+                                                         TOL.BASIS,
+                                                         l_nzBl[0][0][1]+1,
+                                                         l_maxNzCol+1 );
+          o_mats.push_back( l_stiffTCsc );
+        }
+
+#ifdef PP_T_BASIS_HIERARCHICAL
+      // check that size goes down with the number of derivatives
+      EDGE_CHECK_EQ( l_maxNzCol+1, CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP-l_de ) );
+#endif
+
+        // reduce relevant rows due to generated zero block
+        l_nzBl[0][0][1] = l_maxNzCol;
+      }
+    }
+
+    /**
+     * Stores the non-zeros of the transposed stiffness matrices and adds the sparsity patterns of the kernels.
+     * This includes multiplications of the stiffness matrices with (-1).
+     * 
+     * @param i_stiffT dense transposed stiffness matrices.
+     * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
+     **/
+    void init( TL_T_REAL     const   i_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+               data::Dynamic       & io_dynMem ) {
+      // convert stiffness matrices to CSC
+      std::vector< size_t > l_maxNzCols;
+      std::vector< t_matCsc > l_cscStiffT;
+      getCscStiffT( i_stiffT,
+                    l_maxNzCols,
+                    l_cscStiffT );
+      EDGE_CHECK_EQ( l_cscStiffT.size(), (TL_O_TI-1)*TL_N_DIS );
+
+      // copy non-zeros to a permanent data structure
+      std::size_t l_nNzs = 0;
+      for( std::size_t l_ma = 0; l_ma < l_cscStiffT.size(); l_ma++ ) l_nNzs += l_cscStiffT[l_ma].val.size();
+
+      TL_T_REAL * l_stiffTRaw = (TL_T_REAL*) io_dynMem.allocate( l_nNzs * sizeof(TL_T_REAL),
+                                                                 4096,
+                                                                 true );
+
+      std::size_t l_off = 0;
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          t_matCsc const & l_csc = l_cscStiffT[(l_de-1)*TL_N_DIS + l_di];
+
+          m_stiffT[l_de-1][l_di] = l_stiffTRaw + l_off;
+          for( std::size_t l_nz = 0; l_nz < l_csc.val.size(); l_nz++ ) {
+            l_stiffTRaw[l_off + l_nz] = -l_csc.val[l_nz];
+          }
+          l_off += l_csc.val.size();
+
+          // transposed stiffness matrix
+          m_mm.add( 0,                       // group
+                    false,                   // csc
+                    l_csc.colPtr.size(),     // #ptrs
+                    &l_csc.colPtr[0],        // ptr
+                    &l_csc.rowIdx[0],        // ids
+                    l_maxNzCols[l_de-1]+1 ); // n
+        }
+      }
+
+      // elastic star matrices
+      t_matCsr l_starCsrE;
+      FakeMats< TL_N_DIS >::starCsrE( l_starCsrE );
+      EDGE_CHECK_EQ( l_starCsrE.val.size(), TL_N_NZS_STAR_E );
+
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        m_mm.add( 1,                        // group
+                  true,                     // csr
+                  l_starCsrE.rowPtr.size(), // #ptrs
+                  &l_starCsrE.rowPtr[0],    // ptr
+                  &l_starCsrE.colIdx[0],    // ids
+                  l_maxNzCols[l_de-1]+1 );  // n
+      }
+
+      // anelastic star and source matrices
+      if( TL_N_RMS > 0 ) {
+        t_matCsr l_starCsrA;
+        FakeMats< TL_N_DIS >::starCsrA( l_starCsrA );
+        EDGE_CHECK_EQ( l_starCsrA.val.size(), TL_N_NZS_STAR_A );
+
+        t_matCsr l_srcCsrA;
+        FakeMats< TL_N_DIS >::srcCsrA( l_srcCsrA );
+        EDGE_CHECK_EQ( l_srcCsrA.val.size(), TL_N_NZS_SRC_A );
+
+        m_mm.add( 2,                        // group
+                  true,                     // csr
+                  l_starCsrA.rowPtr.size(), // #ptrs
+                  &l_starCsrA.rowPtr[0],    // ptr
+                  &l_starCsrA.colIdx[0],    // ids
+                  l_maxNzCols[0]+1 );       // n
+
+        m_mm.add( 2,                        // group
+                  true,                     // csr
+                  l_srcCsrA.rowPtr.size(),  // #ptrs
+                  &l_srcCsrA.rowPtr[0],     // ptr
+                  &l_srcCsrA.colIdx[0],     // ids
+                  TL_N_MDS );               // n
+      }
+    }
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure (SIMD version) for element-local matrices, which are either shared by all fused simulations or lane-local.
+     *
+     * @param i_dT time step.
+     * @param i_starE elastic star matrices, [TL_N_DIS][TL_N_NZS_STAR_E][TL_N_LAS].
+     * @param i_starA anelastic star matrices, [TL_N_DIS][TL_N_NZS_STAR_A][TL_N_LAS], use nullptr if TL_N_RMS==0.
+     * @param i_srcA anelastic source matrices, [TL_N_RMS][TL_N_NZS_SRC_A][TL_N_LAS], use nullptr if TL_N_RMS==0.
+     * @param i_dofsE elastic DOFs.
+     * @param i_dofsA anelastic DOFs, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch memory.
+     * @param o_derE will be set to elastic time derivatives.
+     * @param o_derA will be set to anelastic time derivatives (ignored if TL_N_RMS==0, use nullptr).
+     * @param o_tIntE will be set to elastic time integrated DOFs.
+     * @param o_tIntA will be set to anelastic time integrated DOFS (ignored if TL_N_RMS==0, use nullptr).
+     *
+     * @paramt TL_N_LAS number of lanes of the element-local matrices, 1 or TL_N_CRS.
+     **/
+    template< unsigned short TL_N_LAS >
+    void ckLas( TL_T_REAL         i_dT,
+                TL_T_REAL const * i_starE,
+                TL_T_REAL const * i_starA,
+                TL_T_REAL const * i_srcA,
+                TL_T_REAL const   i_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL const (*i_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL         o_derE[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL       (*o_derA)[TL_O_TI][TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL         o_tIntE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL       (*o_tIntA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] ) const {
+      // relaxation frequencies
+      TL_T_REAL const *l_rfs = this->m_rfs;
+
+      // scalar for the time integration
+      TL_T_REAL l_scalar = i_dT;
+
+      // elastic initialize zero-derivative, reset time integrated dofs
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            o_derE[0][l_qt][l_md][l_cr] = i_dofsE[l_qt][l_md][l_cr];
+            o_tIntE[l_qt][l_md][l_cr]   = l_scalar * i_dofsE[l_qt][l_md][l_cr];
+          }
+        }
+      }
+
+      // anelastic: init zero-derivative, reset tDofs
+      for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              o_derA[l_rm][0][l_qt][l_md][l_cr] = i_dofsA[l_rm][l_qt][l_md][l_cr];
+              o_tIntA[l_rm][l_qt][l_md][l_cr] = l_scalar * i_dofsA[l_rm][l_qt][l_md][l_cr];
+            }
+          }
+        }
+      }
+
+      // iterate over time derivatives
+      for( unsigned int l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // recursive id for the non-zero blocks
+        unsigned short l_re = (TL_N_RMS == 0) ? l_de : 1;
+
+        // elastic: reset this derivative
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) o_derE[l_de][l_qt][l_md][l_cr] = 0;
+
+        // scratch memory for viscoelastic part
+        TL_T_REAL l_scratch[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_scratch[l_qt][l_md][l_cr] = 0;
+
+        // compute the derivatives
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          // multiply with transposed stiffness matrices and inverse mass matrix
+          m_mm.template cscB< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              true >( m_mm.m_pats[0][(l_re-1)*TL_N_DIS+l_di],
+                                      o_derE[l_de-1][0][0],
+                                      m_stiffT[l_re-1][l_di],
+                                      o_scratch[0][0] );
+
+          // multiply with star matrices
+          m_mm.template csrA< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              false,
+                              TL_N_LAS >( m_mm.m_pats[1][l_re-1],
+                                          i_starE + l_di * TL_N_NZS_STAR_E * TL_N_LAS,
+                                          o_scratch[0][0],
+                                          o_derE[l_de][0][0] );
+
+          if( TL_N_RMS > 0 ) {
+            // multiply with anelastic star matrices
+            m_mm.template csrA< TL_N_QTS_M,
+                                TL_N_MDS,
+                                TL_N_MDS,
+                                false,
+                                TL_N_LAS >( m_mm.m_pats[2][0],
+                                            i_starA + l_di * TL_N_NZS_STAR_A * TL_N_LAS,
+                                            o_scratch[0][0],
+                                            l_scratch[0][0] );
+          }
+        }
+
+        // update scalar
+        l_scalar *= i_dT / (l_de+1);
+
+        // anelastic: update derivatives and time integrated DOFs
+        for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
+          // add contribution of source matrix
+          m_mm.template csrA< TL_N_QTS_M,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              false,
+                              TL_N_LAS >( m_mm.m_pats[2][1],
+                                          i_srcA + l_rm * TL_N_NZS_SRC_A * TL_N_LAS,
+                                          o_derA[l_rm][l_de-1][0][0],
+                                          o_derE[l_de][0][0] );
+
+          // multiply with relaxation frequency and add
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                o_derA[l_rm][l_de][l_qt][l_md][l_cr] = l_rfs[l_rm] * ( l_scratch[l_qt][l_md][l_cr] + o_derA[l_rm][l_de-1][l_qt][l_md][l_cr] );
+                o_tIntA[l_rm][l_qt][l_md][l_cr] += l_scalar * o_derA[l_rm][l_de][l_qt][l_md][l_cr];
+              }
+            }
+          }
+        }
+
+        // elastic: update time integrated DOFs
+        unsigned short l_nCpMds = (TL_N_RMS == 0) ? CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de ) : TL_N_MDS;
+
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+          for( unsigned short l_md = 0; l_md < l_nCpMds; l_md++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              o_tIntE[l_qt][l_md][l_cr] += l_scalar * o_derE[l_de][l_qt][l_md][l_cr];
+            }
+          }
+        }
+      }
+    }
+
+  public:
+    /**
+     * Constructor of the SIMD time prediction.
+     *
+     * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    TimePredSimd( TL_T_REAL     const * i_rfs,
+                  data::Dynamic       & io_dynMem ): TimePred < TL_T_REAL,
+                                                                TL_N_RMS,
+                                                                TL_T_EL,
+                                                                TL_O_SP,
+                                                                TL_O_TI,
+                                                                TL_N_CRS >( i_rfs,
+                                                                            io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get stiffness matrices
+      TL_T_REAL l_stiffT[TL_N_DIS][TL_N_MDS][TL_N_MDS];
+      l_basis.getStiffMm1Dense( TL_N_MDS,
+                                l_stiffT[0][0],
+                                true );
+
+      // store stiffness matrices sparse and set up the patterns
+      init( l_stiffT,
+            io_dynMem );
+    };
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure (SIMD version) and computes time derivatives and time integrated DOFs.
+     *
+     * @param i_dT time step.
+     * @param i_starE elastic star matrices.
+     * @param i_starA anelastic star matrices, use nullptr if TL_N_RMS==0.
+     * @param i_srcA anelastic source matrices, use nullptr if TL_N_RMS==0.
+     * @param i_dofsE elastic DOFs.
+     * @param i_dofsA anelastic DOFs, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch memory.
+     * @param o_derE will be set to elastic time derivatives.
+     * @param o_derA will be set to anelastic time derivatives (ignored if TL_N_RMS==0, use nullptr).
+     * @param o_tIntE will be set to elastic time integrated DOFs.
+     * @param o_tIntA will be set to anelastic time integrated DOFS (ignored if TL_N_RMS==0, use nullptr).
+     **/
+    void ck( TL_T_REAL         i_dT,
+             TL_T_REAL const   i_starE[TL_N_DIS][TL_N_NZS_STAR_E],
+             TL_T_REAL const (*i_starA)[TL_N_NZS_STAR_A],
+             TL_T_REAL const (*i_srcA)[TL_N_NZS_SRC_A],
+             TL_T_REAL const   i_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL const (*i_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL         o_derE[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL       (*o_derA)[TL_O_TI][TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL         o_tIntE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+             TL_T_REAL       (*o_tIntA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] ) const {
+      ckLas< 1 >( i_dT,
+                  i_starE[0],
+                  (TL_T_REAL const *) i_starA,
+                  (TL_T_REAL const *) i_srcA,
+                  i_dofsE,
+                  i_dofsA,
+                  o_scratch,
+                  o_derE,
+                  o_derA,
+                  o_tIntE,
+                  o_tIntA );
+    }
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure (SIMD version) to a batch of TL_N_CRS interleaved elements.
+     * The element-local matrices are interleaved as well, lane i belongs to the i-th element of the batch.
+     *
+     * @param i_dT time step.
+     * @param i_starE interleaved elastic star matrices.
+     * @param i_starA interleaved anelastic star matrices, use nullptr if TL_N_RMS==0.
+     * @param i_srcA interleaved anelastic source matrices, use nullptr if TL_N_RMS==0.
+     * @param i_dofsE interleaved elastic DOFs.
+     * @param i_dofsA interleaved anelastic DOFs, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch memory.
+     * @param o_derE will be set to interleaved elastic time derivatives.
+     * @param o_derA will be set to interleaved anelastic time derivatives (ignored if TL_N_RMS==0, use nullptr).
+     * @param o_tIntE will be set to interleaved elastic time integrated DOFs.
+     * @param o_tIntA will be set to interleaved anelastic time integrated DOFS (ignored if TL_N_RMS==0, use nullptr).
+     **/
+    void ckBatch( TL_T_REAL         i_dT,
+                  TL_T_REAL const   i_starE[TL_N_DIS][TL_N_NZS_STAR_E][TL_N_CRS],
+                  TL_T_REAL const (*i_starA)[TL_N_NZS_STAR_A][TL_N_CRS],
+                  TL_T_REAL const (*i_srcA)[TL_N_NZS_SRC_A][TL_N_CRS],
+                  TL_T_REAL const   i_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL const (*i_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL         o_derE[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL       (*o_derA)[TL_O_TI][TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL         o_tIntE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL       (*o_tIntA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] ) const {
+      ckLas< TL_N_CRS >( i_dT,
+                         i_starE[0][0],
+                         (TL_T_REAL const *) i_starA,
+                         (TL_T_REAL const *) i_srcA,
+                         i_dofsE,
+                         i_dofsA,
+                         o_scratch,
+                         o_derE,
+                         o_derA,
+                         o_tIntE,
+                         o_tIntA );
+    }
+};
+
+#endif
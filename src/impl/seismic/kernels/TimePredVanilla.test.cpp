@@ -76,6 +76,24 @@ TEST_CASE( "Elastic ADER time prediction using vanilla kernels.", "[elastic][Tim
       REQUIRE( l_tDofsE[l_qt][l_md][0] == Approx( l_refEtDofs[l_qt][l_md] ) );
     }
   }
+
+  // integrate the time prediction in two sub-steps (LTS)
+  float l_tInt0[9][20][1];
+  float l_tInt1[9][20][1];
+  l_predElastic.integrateTimePrediction( 0,
+                                         0.0085,
+                                         l_dersE,
+                                         l_tInt0 );
+  l_predElastic.integrateTimePrediction( 0.0085,
+                                         0.017,
+                                         l_dersE,
+                                         l_tInt1 );
+
+  for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+    for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
+      REQUIRE( l_tInt0[l_qt][l_md][0] + l_tInt1[l_qt][l_md][0] == Approx( l_refEtDofs[l_qt][l_md] ) );
+    }
+  }
 }
 
 TEST_CASE( "Viscoelastic ADER time prediction using vanilla kernels.", "[visco][TimePredVanilla]" ) {
@@ -26,9 +26,12 @@
 #ifndef EDGE_SEISMIC_KERNELS_VOL_INT_FUSED_HPP
 #define EDGE_SEISMIC_KERNELS_VOL_INT_FUSED_HPP
 
+#include <sstream>
 #include "VolInt.hpp"
 #include "dg/Basis.h"
 #include "data/MmXsmmFused.hpp"
+#include "data/Tuner.h"
+#include "monitor/Timer.hpp"
 #include "FakeMats.hpp"
 
 namespace edge {
@@ -99,19 +102,16 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
      * @param o_offsets will be set to the offsets (counting non-zero entries) of the sparse matrices.
      * @param o_nonZeros will be set to the raw non-zero entries of the sparse matrices.
      * @param o_mats will be set to the CSC representation of the sparse matrices.
+     * @param i_nChs number of chunks of the fused simulations, the non-zero entries are split accordingly.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void getCscStiff( TL_T_REAL               const   i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS],
                              unsigned int                  & o_maxNzRow,
                              std::vector< size_t >         & o_offsets,
                              std::vector< TL_T_REAL >      & o_nonZeros,
-                             std::vector< t_matCsc >       & o_mats ) {
-      // determine CSC fill-in strategy
-      std::string l_cscFillIn = "none";
-
-      if ( libxsmm_get_target_archid() == LIBXSMM_X86_AVX512_KNM ) {
-        l_cscFillIn = "qfma";
-      }
-
+                             std::vector< t_matCsc >       & o_mats,
+                             unsigned short                  i_nChs,
+                             std::string             const & i_fillIn ) {
       // reset and init output
       o_maxNzRow = 0;
       o_offsets.resize( 0 );
@@ -146,7 +146,7 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
       EDGE_CHECK_EQ( o_maxNzRow+1, CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP-1 ) );
 #endif
 
-      // convert to CSC
+      // convert to CSC, rows beyond the non-zero block are not accessed by the kernels
       t_matCsc l_stiffCsc[TL_N_DIS];
       for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
         edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS,
@@ -154,18 +154,16 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
                                                        i_stiff[l_di][0],
                                                        l_stiffCsc[l_di],
                                                        TOL.BASIS,
+                                                       o_maxNzRow+1,
                                                        std::numeric_limits< unsigned int >::max(),
-                                                       std::numeric_limits< unsigned int >::max(),
-                                                       l_cscFillIn );
+                                                       i_fillIn );
         o_mats.push_back( l_stiffCsc[l_di] );
       }
 
       // add data for the non-zero entries and sparse offsets
       for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
-        for( unsigned int l_nz = 0; l_nz < l_stiffCsc[l_di].val.size(); l_nz++ ) {
-          o_nonZeros.push_back( l_stiffCsc[l_di].val[l_nz] );
-        }
-        o_offsets.push_back( o_offsets.back() + l_stiffCsc[l_di].val.size() );
+        edge::data::MmXsmmFused< TL_T_REAL >::appendCscVals( i_nChs, l_stiffCsc[l_di], o_nonZeros );
+        o_offsets.push_back( o_offsets.back() + i_nChs * l_stiffCsc[l_di].val.size() );
       }
     }
 
@@ -173,8 +171,12 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
      * Generates the matrix kernels for the stiffness matrices and star matrices.
      *
      * @param i_stiff dense stiffness matrices.
+     * @param i_fillIn CSC fill-in strategy of the stiffness matrices.
+     * @param io_mm matrix kernels to which the generated kernels are added.
      **/
-    void generateKernels( TL_T_REAL const i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS] ) {
+    static void generateKernels( TL_T_REAL                    const   i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+                                 std::string                  const & i_fillIn,
+                                 edge::data::MmXsmmFused< TL_T_REAL > & io_mm ) {
       // convert stiffness matrices to CSC (incl. possible fill-ins)
       unsigned int l_maxNzRow;
       std::vector< size_t > l_offsets;
@@ -184,7 +186,9 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
                    l_maxNzRow,
                    l_offsets,
                    l_nonZeros,
-                   l_stiffCsc );
+                   l_stiffCsc,
+                   io_mm.getNChs(),
+                   i_fillIn );
 
       // get csr elastic star matrix
       t_matCsr l_starCsrE;
@@ -193,7 +197,7 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
 
       // stiffness matrices
       for( unsigned short l_di = 0; l_di < N_DIM; l_di++ ) {
-        m_mm.add(  0,                                                 // group
+        io_mm.add(  0,                                                 // group
                    false,                                             // csc
                   &l_stiffCsc[l_di].colPtr[0],                        // column pointer
                   &l_stiffCsc[l_di].rowIdx[0],                        // row index
@@ -210,7 +214,7 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
       }
 
       // elastic star matrix
-      m_mm.add(  1,                                                 // group
+      io_mm.add(  1,                                                 // group
                  true,                                              // csr
                 &l_starCsrE.rowPtr[0],                              // row pointer
                 &l_starCsrE.colIdx[0],                              // column index
@@ -237,7 +241,7 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
         EDGE_CHECK_EQ( l_srcCsrA.val.size(), TL_N_NZS_SRC_A );
 
         // multiplication with anelastic star matrix
-        m_mm.add( 2,                     // group
+        io_mm.add( 2,                     // group
                   true,                  // csr
                   &l_starCsrA.rowPtr[0], // ptr
                   &l_starCsrA.colIdx[0], // ids
@@ -253,7 +257,7 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
                   LIBXSMM_GEMM_PREFETCH_NONE );
 
         // multiplication with anelastic source matrices
-        m_mm.add( 2,                    // group
+        io_mm.add( 2,                    // group
                   true,                 // csr
                   &l_srcCsrA.rowPtr[0], // ptr
                   &l_srcCsrA.colIdx[0], // ids
@@ -276,10 +280,14 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
      * @param i_stiff dense stiffness matrices.
      * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
      * @param o_stiff will contain pointers to memory for the individual matrices.
+     * @param i_nChs number of chunks of the fused simulations.
+     * @param i_fillIn CSC fill-in strategy.
      **/
     static void storeStiffSparse( TL_T_REAL     const     i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS],
                                   data::Dynamic       &   io_dynMem,
-                                  TL_T_REAL           *   o_stiff[TL_N_DIS]  ) {
+                                  TL_T_REAL           *   o_stiff[TL_N_DIS],
+                                  unsigned short          i_nChs,
+                                  std::string   const &   i_fillIn ) {
       // convert stiffness matrices to CSC (incl. possible fill-in)
       unsigned int l_maxNzRow;
       std::vector< size_t > l_offsets;
@@ -289,7 +297,9 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
                    l_maxNzRow,
                    l_offsets,
                    l_nonZeros,
-                   l_cscStiff );
+                   l_cscStiff,
+                   i_nChs,
+                   i_fillIn );
 
       // copy sparse matrices to a permanent data structure
       TL_T_REAL * l_stiffRaw = (TL_T_REAL*) io_dynMem.allocate( l_nonZeros.size() * sizeof(TL_T_REAL),
@@ -308,6 +318,54 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
       }
     }
 
+    /**
+     * Measures the multiplications with the stiffness matrices for the given fill-in strategy.
+     *
+     * @param i_stiff dense stiffness matrices.
+     * @param i_fillIn CSC fill-in strategy.
+     * @return time in seconds.
+     **/
+    static double timeStiff( TL_T_REAL   const   i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+                             std::string const & i_fillIn ) {
+      data::Dynamic l_dynMem;
+      edge::data::MmXsmmFused< TL_T_REAL > l_mm;
+
+      TL_T_REAL *l_stiff[TL_N_DIS] = {};
+      storeStiffSparse( i_stiff,
+                        l_dynMem,
+                        l_stiff,
+                        l_mm.getNChs(),
+                        i_fillIn );
+      generateKernels( i_stiff,
+                       i_fillIn,
+                       l_mm );
+
+      // dummy data
+      std::size_t l_size = std::size_t(TL_N_QTS_E) * TL_N_MDS * TL_N_CRS;
+      TL_T_REAL *l_in  = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      TL_T_REAL *l_out = (TL_T_REAL*) l_dynMem.allocate( l_size * sizeof(TL_T_REAL) );
+      for( std::size_t l_en = 0; l_en < l_size; l_en++ ) {
+        l_in[l_en]  = 1;
+        l_out[l_en] = 0;
+      }
+
+      // first pass warms up, second pass is measured
+      edge::monitor::Timer l_timer;
+      for( unsigned short l_pa = 0; l_pa < 2; l_pa++ ) {
+        l_timer.reset();
+        l_timer.start();
+        for( unsigned short l_it = 0; l_it < 100; l_it++ ) {
+          for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+            l_mm.m_kernels[0][l_di]( l_in,
+                                     l_stiff[l_di],
+                                     l_out );
+          }
+        }
+        l_timer.end();
+      }
+
+      return l_timer.elapsed();
+    }
 
   public:
     /**
@@ -315,9 +373,11 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
      *
      * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
      * @param io_dynMem dynamic memory allocations.
+     * @param io_tuner if given, the fill-in of the stiffness matrices is selected through runtime measurements.
      **/
     VolIntFused( TL_T_REAL     const * i_rfs,
-                 data::Dynamic       & io_dynMem ): VolInt< TL_T_REAL,
+                 data::Dynamic       & io_dynMem,
+                 data::Tuner         * io_tuner = nullptr ): VolInt< TL_T_REAL,
                                                             TL_N_RMS,
                                                             TL_T_EL,
                                                             TL_O_SP,
@@ -333,12 +393,31 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
                                 l_stiff[0][0],
                                 false );
 
-      // store stiffness matrices dense
+      // select the fill-in of the stiffness matrices
+      std::vector< std::string > l_fillIns = edge::data::MmXsmmFused< TL_T_REAL >::getFillIns();
+      std::string l_fillIn = l_fillIns[0];
+      if( io_tuner != nullptr ) {
+        std::ostringstream l_key;
+        l_key << "VolIntFused/stiff el=" << TL_T_EL << " o=" << TL_O_SP << " rms=" << TL_N_RMS
+              << " cfr=" << TL_N_CRS << " prec=" << sizeof(TL_T_REAL)*8 << " arch=" << libxsmm_get_target_arch();
+
+        l_fillIn = io_tuner->select( l_key.str(),
+                                     l_fillIns,
+                                     [&l_stiff]( std::string const & i_fillIn ) {
+                                       return timeStiff( l_stiff, i_fillIn );
+                                     } );
+      }
+
+      // store stiffness matrices sparse
       this->storeStiffSparse( l_stiff,
                               io_dynMem,
-                              m_stiff );
+                              m_stiff,
+                              m_mm.getNChs(),
+                              l_fillIn );
 
-      generateKernels( l_stiff );
+      generateKernels( l_stiff,
+                       l_fillIn,
+                       m_mm );
     }
 
     /**
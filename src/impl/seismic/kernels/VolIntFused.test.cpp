@@ -36,17 +36,17 @@ TEST_CASE( "Optimized elastic volume integration for fused simulations.", "[elas
                                        0,
                                        TET4,
                                        4,
-                                       16 > l_vol( nullptr,
+                                       N_CRUNS > l_vol( nullptr,
                                                    l_dynMem );
 
-  float l_scratch[9][20][16];
-  float l_dofsFused[9][20][16];
-  float l_tDofsFused[9][20][16];
+  float l_scratch[9][20][N_CRUNS];
+  float l_dofsFused[9][20][N_CRUNS];
+  float l_tDofsFused[9][20][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFused[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFused[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
       }
@@ -66,7 +66,7 @@ TEST_CASE( "Optimized elastic volume integration for fused simulations.", "[elas
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFused[l_qt][l_md][l_cr] == Approx( l_refEdofs[l_qt][l_md] ) );
       }
     }
@@ -77,18 +77,18 @@ TEST_CASE( "Optimized viscoelastic volume integration for fused simulations.", "
   // set up matrix structures
 #include "VolInt.test.inc"
 
-  float l_scratch[9][20][16];
-  float l_dersE[4][9][20][16];
-  float l_dersA[2][4][6][20][16];
-  float l_dofsFusedE[9][20][16];
-  float l_dofsFusedA[2][6][20][16];
-  float l_tDofsFusedE[9][20][16];
-  float l_tDofsFusedA[2][6][20][16];
+  float l_scratch[9][20][N_CRUNS];
+  float l_dersE[4][9][20][N_CRUNS];
+  float l_dersA[2][4][6][20][N_CRUNS];
+  float l_dofsFusedE[9][20][N_CRUNS];
+  float l_dofsFusedA[2][6][20][N_CRUNS];
+  float l_tDofsFusedE[9][20][N_CRUNS];
+  float l_tDofsFusedA[2][6][20][N_CRUNS];
 
   // duplicate DOFs and tDofs for fused config
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         l_tDofsFusedE[l_qt][l_md][l_cr] = l_tDofsE[l_qt][l_md];
         l_dofsFusedE[l_qt][l_md][l_cr] = l_dofsE[l_qt][l_md];
 
@@ -104,12 +104,14 @@ TEST_CASE( "Optimized viscoelastic volume integration for fused simulations.", "
 
   // set up kernel
   edge::data::Dynamic l_dynMem;
+  edge::data::Tuner l_tuner;
   edge::seismic::kernels::VolIntFused< float,
                                        2,
                                        TET4,
                                        4,
-                                       16 > l_vol( l_rfs,
-                                                   l_dynMem );
+                                       N_CRUNS > l_vol( l_rfs,
+                                                   l_dynMem,
+                                                   &l_tuner );
 
   // apply volume kernel
   l_vol.apply( l_starSpE,
@@ -124,7 +126,7 @@ TEST_CASE( "Optimized viscoelastic volume integration for fused simulations.", "
   // check the results
   for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
     for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-      for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
         REQUIRE( l_dofsFusedE[l_qt][l_md][l_cr] == Approx( l_refVdofsE[l_qt][l_md] ) );
       }
     }
@@ -133,7 +135,7 @@ TEST_CASE( "Optimized viscoelastic volume integration for fused simulations.", "
   for( unsigned short l_rm = 0; l_rm < 2; l_rm++ ) {
     for( unsigned short l_qt = 0; l_qt < 6; l_qt++ ) {
       for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
-        for( unsigned short l_cr = 0; l_cr < 16; l_cr++ ) {
+        for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
           REQUIRE( l_dofsFusedA[l_rm][l_qt][l_md][l_cr] == Approx( l_refVdofsA[l_rm][l_qt][l_md] ) );
         }
       }
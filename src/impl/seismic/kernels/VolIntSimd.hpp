@@ -0,0 +1,403 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Quadrature-free ADER-DG volume integration for fused seismic forward simulations, using portable SIMD kernels.
+ **/
+#ifndef EDGE_SEISMIC_KERNELS_VOL_INT_SIMD_HPP
+#define EDGE_SEISMIC_KERNELS_VOL_INT_SIMD_HPP
+
+#include "VolInt.hpp"
+#include "dg/Basis.h"
+#include "data/MmSimd.hpp"
+#include "FakeMats.hpp"
+
+namespace edge {
+  namespace seismic {
+    namespace kernels { 
+      template< typename       TL_T_REAL,
+                unsigned short TL_N_RMS,
+                t_entityType   TL_T_EL,
+                unsigned short TL_O_SP,
+                unsigned short TL_N_CRS >
+      class VolIntSimd;
+    }
+  }
+}
+
+/**
+ * Quadrature-free ADER-DG volume integration for fused seismic simulations using portable SIMD kernels.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_RMS number of relaxation mechanisms.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP spatial order.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_RMS,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_N_CRS >
+class edge::seismic::kernels::VolIntSimd: edge::seismic::kernels::VolInt< TL_T_REAL,
+                                                                          TL_N_RMS,
+                                                                          TL_T_EL,
+                                                                          TL_O_SP,
+                                                                          TL_N_CRS > {
+  private:
+    //! dimension of the element
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of elastic quantities
+    static unsigned short const TL_N_QTS_E = CE_N_QTS_E( TL_N_DIS );
+
+    //! number of quantities per relaxation mechanism
+    static unsigned short const TL_N_QTS_M = CE_N_QTS_M( TL_N_DIS );
+
+    //! number of non-zeros in the star matrices
+    static unsigned short const TL_N_NZS_STAR_E = CE_N_ENS_STAR_E_SP( TL_N_DIS );
+
+    //! number of non-zeros in the anelastic star matrices
+    static unsigned short const TL_N_NZS_STAR_A = CE_N_ENS_STAR_A_SP( TL_N_DIS );
+
+    //! number of non-zeros in the anelastic source matrices
+    static unsigned short const TL_N_NZS_SRC_A = CE_N_ENS_SRC_A_SP( TL_N_DIS );
+
+    //! sparsity patterns and micro-kernels
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+
+    //! pointers to the non-zeros of the stiffness matrices
+    TL_T_REAL *m_stiff[TL_N_DIS] = {};
+
+    /**
+     * Stores the non-zeros of the stiffness matrices and adds the sparsity patterns of the kernels.
+     *
+     * @param i_stiff dense stiffness matrices.
+     * @param io_dynMem dynamic memory management, which will be used for the respective allocations.
+     **/
+    void init( TL_T_REAL     const   i_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS],
+               data::Dynamic       & io_dynMem ) {
+      // derive the non-zeros of the volume integration
+      t_matCrd l_stiffCrd[TL_N_DIS];
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        edge::linalg::Matrix::denseToCrd< TL_T_REAL >( TL_N_MDS,
+                                                       TL_N_MDS,
+                                                       i_stiff[l_di][0],
+                                                       l_stiffCrd[l_di],
+                                                       TOL.BASIS );
+      }
+
+      // nz-blocks
+      unsigned int l_nzBl[2][2][2];
+      // init with matrix dim
+      l_nzBl[0][0][0] = l_nzBl[0][1][0] = 0;
+      l_nzBl[0][0][1] = l_nzBl[0][1][1] = TL_N_MDS-1;
+
+      // get max #nz-rows
+      unsigned int l_maxNzRow = 0;
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        edge::linalg::Matrix::getBlockNz( l_stiffCrd[l_di], l_nzBl[0], l_nzBl[1] );
+        l_maxNzRow = std::max( l_maxNzRow, l_nzBl[1][0][1] );
+      }
+
+#ifdef PP_T_BASIS_HIERARCHICAL
+      // check that size is one "order" less
+      EDGE_CHECK_EQ( l_maxNzRow+1, CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP-1 ) );
+#endif
+
+      // convert to CSC
+      t_matCsc l_stiffCsc[TL_N_DIS];
+      std::size_t l_nNzs = 0;
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        edge::linalg::Matrix::denseToCsc< TL_T_REAL >( TL_N_MDS,
+                                                       TL_N_MDS,
+                                                       i_stiff[l_di][0],
+                                                       l_stiffCsc[l_di],
+                                                       TOL.BASIS );
+        l_nNzs += l_stiffCsc[l_di].val.size();
+      }
+
+      // copy non-zeros to a permanent data structure
+      TL_T_REAL * l_stiffRaw = (TL_T_REAL*) io_dynMem.allocate( l_nNzs * sizeof(TL_T_REAL),
+                                                                4096,
+                                                                true );
+
+      std::size_t l_off = 0;
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        m_stiff[l_di] = l_stiffRaw + l_off;
+        for( std::size_t l_nz = 0; l_nz < l_stiffCsc[l_di].val.size(); l_nz++ ) {
+          l_stiffRaw[l_off + l_nz] = l_stiffCsc[l_di].val[l_nz];
+        }
+        l_off += l_stiffCsc[l_di].val.size();
+
+        // stiffness matrix
+        m_mm.add( 0,                              // group
+                  false,                          // csc
+                  l_stiffCsc[l_di].colPtr.size(), // #ptrs
+                  &l_stiffCsc[l_di].colPtr[0],    // ptr
+                  &l_stiffCsc[l_di].rowIdx[0],    // ids
+                  TL_N_MDS );                     // n
+      }
+
+      // elastic star matrix, remark: star matrix is multiplied first in the elastic solver
+      t_matCsr l_starCsrE;
+      FakeMats< TL_N_DIS >::starCsrE( l_starCsrE );
+      EDGE_CHECK_EQ( l_starCsrE.val.size(), TL_N_NZS_STAR_E );
+
+      m_mm.add( 1,                                            // group
+                true,                                         // csr
+                l_starCsrE.rowPtr.size(),                     // #ptrs
+                &l_starCsrE.rowPtr[0],                        // ptr
+                &l_starCsrE.colIdx[0],                        // ids
+                (TL_N_RMS == 0) ? l_maxNzRow+1 : TL_N_MDS );  // n
+
+      if( TL_N_RMS > 0 ) {
+        t_matCsr l_starCsrA;
+        FakeMats< TL_N_DIS >::starCsrA( l_starCsrA );
+        EDGE_CHECK_EQ( l_starCsrA.val.size(), TL_N_NZS_STAR_A );
+
+        t_matCsr l_srcCsrA;
+        FakeMats< TL_N_DIS >::srcCsrA( l_srcCsrA );
+        EDGE_CHECK_EQ( l_srcCsrA.val.size(), TL_N_NZS_SRC_A );
+
+        m_mm.add( 2,                        // group
+                  true,                     // csr
+                  l_starCsrA.rowPtr.size(), // #ptrs
+                  &l_starCsrA.rowPtr[0],    // ptr
+                  &l_starCsrA.colIdx[0],    // ids
+                  TL_N_MDS );               // n
+
+        m_mm.add( 2,                        // group
+                  true,                     // csr
+                  l_srcCsrA.rowPtr.size(),  // #ptrs
+                  &l_srcCsrA.rowPtr[0],     // ptr
+                  &l_srcCsrA.colIdx[0],     // ids
+                  TL_N_MDS );               // n
+      }
+    }
+
+    /**
+     * Volume contribution (SIMD version) for element-local matrices, which are either shared by all fused simulations or lane-local.
+     *
+     * @param i_starE elastic star matrices, [TL_N_DIS][TL_N_NZS_STAR_E][TL_N_LAS].
+     * @param i_starA anelastic star matrices, [TL_N_DIS][TL_N_NZS_STAR_A][TL_N_LAS], use nullptr if TL_N_RMS==0.
+     * @param i_srcA anelastic source matrices, [TL_N_RMS][TL_N_NZS_SRC_A][TL_N_LAS], use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE time integrated elastic DOFs.
+     * @param i_tDofsA time integrated anelastic DOFs.
+     * @param io_dofsE will be updated with local elastic contribution of the element to the volume integral.
+     * @param io_dofsA will be updated with local anelastic contribution of the element to the volume integral, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     *
+     * @paramt TL_N_LAS number of lanes of the element-local matrices, 1 or TL_N_CRS.
+     **/
+    template< unsigned short TL_N_LAS >
+    void applyLas( TL_T_REAL const * i_starE,
+                   TL_T_REAL const * i_starA,
+                   TL_T_REAL const * i_srcA,
+                   TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                   TL_T_REAL const (*i_tDofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                   TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                   TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                   TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) const {
+      // relaxation frequencies
+      TL_T_REAL const *l_rfs = this->m_rfs;
+
+      // buffer for the anelastic part
+      TL_T_REAL l_scratch[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+      if( TL_N_RMS > 0 ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_scratch[l_qt][l_md][l_cr] = 0;
+      }
+
+      // iterate over dimensions
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        // elastic: utilize zero-block in star matrix multiplication
+        if( TL_N_RMS == 0 ) {
+          // multiply with star matrix
+          m_mm.template csrA< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              true,
+                              TL_N_LAS >( m_mm.m_pats[1][0],
+                                          i_starE + l_di * TL_N_NZS_STAR_E * TL_N_LAS,
+                                          i_tDofsE[0][0],
+                                          o_scratch[0][0] );
+
+          // multiply with stiffness and inverse mass matrix
+          m_mm.template cscB< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              false >( m_mm.m_pats[0][l_di],
+                                       o_scratch[0][0],
+                                       m_stiff[l_di],
+                                       io_dofsE[0][0] );
+        }
+        // viscoelastic: re-use stiffness matrix multiplication
+        else {
+          // multiply with stiffness and inverse mass matrix
+          m_mm.template cscB< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              true >( m_mm.m_pats[0][l_di],
+                                      i_tDofsE[0][0],
+                                      m_stiff[l_di],
+                                      o_scratch[0][0] );
+
+          // multiply with elastic star matrix
+          m_mm.template csrA< TL_N_QTS_E,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              false,
+                              TL_N_LAS >( m_mm.m_pats[1][0],
+                                          i_starE + l_di * TL_N_NZS_STAR_E * TL_N_LAS,
+                                          o_scratch[0][0],
+                                          io_dofsE[0][0] );
+
+          // multiply with anelastic star matrices
+          m_mm.template csrA< TL_N_QTS_M,
+                              TL_N_MDS,
+                              TL_N_MDS,
+                              false,
+                              TL_N_LAS >( m_mm.m_pats[2][0],
+                                          i_starA + l_di * TL_N_NZS_STAR_A * TL_N_LAS,
+                                          o_scratch[0][0],
+                                          l_scratch[0][0] );
+        }
+      }
+
+      for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
+        // add contribution of source matrix
+        m_mm.template csrA< TL_N_QTS_M,
+                            TL_N_MDS,
+                            TL_N_MDS,
+                            false,
+                            TL_N_LAS >( m_mm.m_pats[2][1],
+                                        i_srcA + l_rm * TL_N_NZS_SRC_A * TL_N_LAS,
+                                        i_tDofsA[l_rm][0][0],
+                                        io_dofsE[0][0] );
+
+        // multiply with relaxation frequency and add
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              io_dofsA[l_rm][l_qt][l_md][l_cr] += l_rfs[l_rm] * ( l_scratch[l_qt][l_md][l_cr] - i_tDofsA[l_rm][l_qt][l_md][l_cr] );
+            }
+          }
+        }
+      }
+    }
+
+  public:
+    /**
+     * Constructor of the SIMD volume integration for fused forward simulations.
+     *
+     * @param i_rfs relaxation frequencies, use nullptr if TL_N_RMS==0.
+     * @param io_dynMem dynamic memory allocations.
+     **/
+    VolIntSimd( TL_T_REAL     const * i_rfs,
+                data::Dynamic       & io_dynMem ): VolInt< TL_T_REAL,
+                                                           TL_N_RMS,
+                                                           TL_T_EL,
+                                                           TL_O_SP,
+                                                           TL_N_CRS >( i_rfs,
+                                                                       io_dynMem ) {
+      // formulation of the basis in terms of the reference element
+      dg::Basis l_basis( TL_T_EL,
+                         TL_O_SP );
+
+      // get stiffness matrices
+      TL_T_REAL l_stiff[TL_N_DIS][TL_N_MDS][TL_N_MDS];
+      l_basis.getStiffMm1Dense( TL_N_MDS,
+                                l_stiff[0][0],
+                                false );
+
+      // store stiffness matrices sparse and set up the patterns
+      init( l_stiff,
+            io_dynMem );
+    }
+
+    /**
+     * Volume contribution for fused seismic forward simulations (SIMD version).
+     *
+     * @param i_starE elastic star matrices.
+     * @param i_starA anelastic star matrices, use nullptr if TL_N_RMS==0.
+     * @param i_srcA anelastic source matrices, use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE time integrated elastic DOFs.
+     * @param i_tDofsA time integrated anelastic DOFs.
+     * @param io_dofsE will be updated with local elastic contribution of the element to the volume integral.
+     * @param io_dofsA will be updated with local anelastic contribution of the element to the volume integral, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void apply( TL_T_REAL const   i_starE[TL_N_DIS][TL_N_NZS_STAR_E],
+                TL_T_REAL const (*i_starA)[TL_N_NZS_STAR_A],
+                TL_T_REAL const (*i_srcA)[TL_N_NZS_SRC_A],
+                TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL const (*i_tDofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) const {
+      applyLas< 1 >( i_starE[0],
+                     (TL_T_REAL const *) i_starA,
+                     (TL_T_REAL const *) i_srcA,
+                     i_tDofsE,
+                     i_tDofsA,
+                     io_dofsE,
+                     io_dofsA,
+                     o_scratch );
+    }
+
+    /**
+     * Volume contribution (SIMD version) for a batch of TL_N_CRS interleaved elements.
+     * The element-local matrices are interleaved as well, lane i belongs to the i-th element of the batch.
+     *
+     * @param i_starE interleaved elastic star matrices.
+     * @param i_starA interleaved anelastic star matrices, use nullptr if TL_N_RMS==0.
+     * @param i_srcA interleaved anelastic source matrices, use nullptr if TL_N_RMS==0.
+     * @param i_tDofsE interleaved time integrated elastic DOFs.
+     * @param i_tDofsA interleaved time integrated anelastic DOFs.
+     * @param io_dofsE will be updated with the elements' local elastic contribution to the volume integral.
+     * @param io_dofsA will be updated with the elements' local anelastic contribution to the volume integral, use nullptr if TL_N_RMS==0.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void applyBatch( TL_T_REAL const   i_starE[TL_N_DIS][TL_N_NZS_STAR_E][TL_N_CRS],
+                     TL_T_REAL const (*i_starA)[TL_N_NZS_STAR_A][TL_N_CRS],
+                     TL_T_REAL const (*i_srcA)[TL_N_NZS_SRC_A][TL_N_CRS],
+                     TL_T_REAL const   i_tDofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL const (*i_tDofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL         io_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL       (*io_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL         o_scratch[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) const {
+      applyLas< TL_N_CRS >( i_starE[0][0],
+                            (TL_T_REAL const *) i_starA,
+                            (TL_T_REAL const *) i_srcA,
+                            i_tDofsE,
+                            i_tDofsA,
+                            io_dofsE,
+                            io_dofsA,
+                            o_scratch );
+    }
+};
+
+#endif
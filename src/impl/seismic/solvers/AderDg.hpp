@@ -26,7 +26,11 @@
 #ifndef EDGE_SEISMIC_SOLVERS_ADER_DG_HPP
 #define EDGE_SEISMIC_SOLVERS_ADER_DG_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <limits>
+#include <vector>
 #include "constants.hpp"
 #include "mesh/common.hpp"
 #include "impl/seismic/common.hpp"
@@ -102,6 +106,23 @@ class edge::seismic::solvers::AderDg {
     //! number of subcells per DG-element
     static unsigned short const TL_N_SCS = CE_N_SUB_CELLS( TL_T_EL, TL_O_SP );
 
+    //! number of DG face modes
+    static unsigned short const TL_N_MDS_FA = CE_N_ELEMENT_MODES( C_ENT[TL_T_EL].TYPE_FACES, TL_O_SP );
+
+    //! number of elements per batch of element-interleaved kernels (single forward runs only), 1 if not batched
+#if defined(PP_T_KERNELS_SIMD)
+    static unsigned short const TL_N_BAT = (TL_N_CRS == 1) ? N_ELEMENT_BATCH : 1;
+#else
+    static unsigned short const TL_N_BAT = 1;
+#endif
+
+    //! true if the updates of the elastic DOFs are accumulated through compensated summation (mixed precision)
+#if defined(PP_USE_MIXED_PRECISION)
+    static bool const TL_COMP = true;
+#else
+    static bool const TL_COMP = false;
+#endif
+
     //! elastic star matrices
     static unsigned short const TL_N_ENS_STAR_E = (TL_MATS_SP) ? CE_N_ENS_STAR_E_SP( TL_N_DIS )
                                                                : CE_N_ENS_STAR_E_DE( TL_N_DIS );
@@ -125,6 +146,53 @@ class edge::seismic::solvers::AderDg {
     static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
     TL_T_REAL (*m_fsA[2])[TL_N_FAS][TL_N_ENS_FS_A] = { nullptr, nullptr };
 
+    //! parameters of the flux solvers, if recomputed on the fly (replacing the elastic and anelastic flux solvers)
+    static unsigned short const TL_N_PARS_FS = FluxSolvers< TL_T_EL >::N_PARS;
+    TL_T_REAL (*m_fsPars)[TL_N_FAS][TL_N_PARS_FS] = nullptr;
+
+    //! running compensations of the elastic DOFs (mixed precision), nullptr if not used
+    TL_T_REAL (*m_dofsC)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] = nullptr;
+
+    //! activity of the elements' runs (a run is active once it or a face-neighbor has DOFs above the tolerance), nullptr if quiescent elements are computed
+    bool (*m_act)[TL_N_CRS] = nullptr;
+
+    //! tolerance of the DOFs, below which runs are considered quiescent
+    TL_T_REAL m_actTol = 0;
+
+    //! true if the fused run is active, false if deactivated (e.g., converged, finished or not of interest)
+    bool m_runAct[TL_N_CRS];
+
+    //! number of deactivated runs
+    unsigned short m_nRunsOff = 0;
+
+    //! work-weights of the elements for the load balancing: 1 if any run is active, m_wgtQui otherwise; nullptr if quiescent elements are computed
+    float * m_wgts = nullptr;
+
+    //! work-weight of quiescent elements (activity checks and reset of the buffers) relative to active ones
+    constexpr static const float m_wgtQui = 0.05f;
+
+    //! number of element updates while skipping quiescent elements: [0]: local, [1]: neigh, [2]: skipped local, [3]: skipped neigh
+    mutable std::atomic< std::size_t > m_nUpsQui[4];
+
+  public:
+    //! face halo: face-projected, elastic time integrated DOFs at the MPI-boundary, replacing the full DOFs of the send elements
+    typedef struct {
+      //! face-projected DOFs, send entries followed by receive entries
+      TL_T_REAL (*fa)[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS];
+      //! number of send entries
+      std::size_t nSe;
+      //! first send entry of the elements, [i_el+1] is the end
+      std::size_t *seEl;
+      //! send entries: [0]: local face of the sending element, [1]: local vertex id w.r.t. the shared face from the sending element's perspective (provided by the adjacent rank)
+      unsigned short (*seFa)[2];
+      //! receive entries of the elements' faces, max if the adjacent element's DOFs are not face-projected
+      std::size_t (*reElFa)[TL_N_FAS];
+    } t_haloFa;
+
+  private:
+    //! face halo, nullptr pointers if the full DOFs of the send elements are communicated
+    t_haloFa m_halo = { nullptr, 0, nullptr, nullptr, nullptr };
+
     //! kernels
     kernels::Kernels< TL_T_REAL,
                       TL_N_RMS,
@@ -133,15 +201,25 @@ class edge::seismic::solvers::AderDg {
                       TL_O_TI,
                       TL_N_CRS > * m_kernels;
 
+    //! kernels for batches of TL_N_BAT interleaved elements, nullptr if not batched
+    kernels::Kernels< TL_T_REAL,
+                      TL_N_RMS,
+                      TL_T_EL,
+                      TL_O_SP,
+                      TL_O_TI,
+                      TL_N_BAT > * m_kernelsBt = nullptr;
+
     /**
      * Allocates the constant data of the ADER-DG solver.
      *
      * @param i_nEls number of elements.
      * @parma i_align alignment of the individual arrays.
+     * @param i_recompFs true if the flux solvers are recomputed on the fly.
      * @param io_dynMem dynmic memory allocations.
      **/
     void alloc( std::size_t     i_nEls,
                 std::size_t     i_align,
+                bool            i_recompFs,
                 data::Dynamic & io_dynMem ) {
       // size of the allocs in byte
       std::size_t l_size = std::numeric_limits< size_t >::max();
@@ -155,15 +233,26 @@ class edge::seismic::solvers::AderDg {
                                                                                   false,
                                                                                   true );
 
-      // elastic flux solvers
-      l_size = i_nEls * std::size_t(TL_N_FAS) * TL_N_ENS_FS_E;
-      l_size *= sizeof(TL_T_REAL);
+      // elastic flux solvers or their parameters
+      if( !i_recompFs ) {
+        l_size = i_nEls * std::size_t(TL_N_FAS) * TL_N_ENS_FS_E;
+        l_size *= sizeof(TL_T_REAL);
 
-      for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
-        m_fsE[l_sd] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_E] ) io_dynMem.allocate( l_size,
-                                                                                      i_align,
-                                                                                      false,
-                                                                                      true );
+        for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
+          m_fsE[l_sd] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_E] ) io_dynMem.allocate( l_size,
+                                                                                        i_align,
+                                                                                        false,
+                                                                                        true );
+        }
+      }
+      else {
+        l_size = i_nEls * std::size_t(TL_N_FAS) * TL_N_PARS_FS;
+        l_size *= sizeof(TL_T_REAL);
+
+        m_fsPars = ( TL_T_REAL (*) [TL_N_FAS][TL_N_PARS_FS] ) io_dynMem.allocate( l_size,
+                                                                                  i_align,
+                                                                                  false,
+                                                                                  true );
       }
 
       // anelastic part
@@ -187,17 +276,897 @@ class edge::seismic::solvers::AderDg {
                                                                                     true );
 
         // anelastic flux solvers
-        l_size = i_nEls * std::size_t(TL_N_FAS) * TL_N_ENS_FS_A;
-        l_size *= sizeof(TL_T_REAL);
+        if( !i_recompFs ) {
+          l_size = i_nEls * std::size_t(TL_N_FAS) * TL_N_ENS_FS_A;
+          l_size *= sizeof(TL_T_REAL);
+
+          for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
+            m_fsA[l_sd] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_A] ) io_dynMem.allocate( l_size,
+                                                                                          i_align,
+                                                                                          false,
+                                                                                          true );
+          }
+        }
+      }
+    }
 
-        for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
-          m_fsA[l_sd] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_A] ) io_dynMem.allocate( l_size,
-                                                                                        i_align,
-                                                                                        false,
-                                                                                        true );
+    /**
+     * Adds an update to the elastic DOFs of an element through compensated (Kahan) summation.
+     * The compensation carries the low-order bits, which are lost when adding the small update to the DOFs.
+     *
+     * @param i_up update of the DOFs.
+     * @param io_dofsE elastic DOFs, which will be updated.
+     * @param io_comp running compensation of the DOFs, which will be updated.
+     **/
+    static void addComp( TL_T_REAL const i_up[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                         TL_T_REAL       io_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                         TL_T_REAL       io_comp[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) {
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            TL_T_REAL l_up  = i_up[l_qt][l_md][l_cr] - io_comp[l_qt][l_md][l_cr];
+            TL_T_REAL l_sum = io_dofsE[l_qt][l_md][l_cr] + l_up;
+            io_comp[l_qt][l_md][l_cr]  = (l_sum - io_dofsE[l_qt][l_md][l_cr]) - l_up;
+            io_dofsE[l_qt][l_md][l_cr] = l_sum;
+          }
+        }
+      }
+    }
+
+    /**
+     * Evaluates the time prediction at a point in time in double precision.
+     * The running compensation of the elastic DOFs is applied to the zeroth derivative.
+     *
+     * @param i_pt point in time, relative to the time of the time prediction.
+     * @param i_der time derivatives, the zeroth derivative holds the uncompensated elastic DOFs.
+     * @param i_comp running compensation of the elastic DOFs.
+     * @param o_preDofs will be set to the predicted elastic DOFs.
+     **/
+    static void evalTimePredComp( double          i_pt,
+                                  TL_T_REAL const i_der[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                                  TL_T_REAL const i_comp[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                                  double          o_preDofs[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) {
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            o_preDofs[l_qt][l_md][l_cr] = double( i_der[0][l_qt][l_md][l_cr] ) - i_comp[l_qt][l_md][l_cr];
+
+      double l_scalar = 1;
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        l_scalar *= i_pt / l_de;
+
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de ); l_md++ )
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+              o_preDofs[l_qt][l_md][l_cr] += l_scalar * i_der[l_de][l_qt][l_md][l_cr];
+      }
+    }
+
+    /**
+     * Updates the activity of an element's runs.
+     * A run becomes active once one of its elastic or anelastic DOFs exceeds the tolerance and stays active afterwards.
+     *
+     * @param i_el element.
+     * @param i_dofsE elastic DOFs of the element.
+     * @param i_dofsA anelastic DOFs of the element.
+     * @return true if at least one of the element's runs is active and not deactivated.
+     **/
+    bool updateAct( std::size_t       i_el,
+                    TL_T_REAL const   i_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                    TL_T_REAL const (*i_dofsA)[TL_N_MDS][TL_N_CRS] ) const {
+      bool *l_act = m_act[i_el];
+
+      // nothing to do if all runs are active already
+      bool l_all = true;
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_all = l_all && l_act[l_cr];
+      if( l_all ) return m_nRunsOff < TL_N_CRS;
+
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            l_act[l_cr] = l_act[l_cr] || (std::abs( i_dofsE[l_qt][l_md][l_cr] ) > m_actTol);
+
+      for( unsigned short l_qt = 0; l_qt < TL_N_RMS*TL_N_QTS_M; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            l_act[l_cr] = l_act[l_cr] || (std::abs( i_dofsA[l_qt][l_md][l_cr] ) > m_actTol);
+
+      bool l_any = false;
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_any = l_any || (l_act[l_cr] && m_runAct[l_cr]);
+      if( l_any ) m_wgts[i_el] = 1;
+      return l_any;
+    }
+
+    /**
+     * Activates the runs of an element, in which the time integrated DOFs of a face-neighbor exceed the tolerance.
+     * The tolerance of the DOFs is scaled by the time step to match the time integrated DOFs.
+     *
+     * @param i_el element.
+     * @param i_dt time step.
+     * @param i_tIntNe time integrated DOFs of the face-neighbor, or their projection to the shared face (face halo).
+     * @return true if the neighbor exceeds the tolerance in at least one run which is not deactivated, false if its contribution is skipped.
+     *
+     * @paramt TL_N_MDS_NE number of modes of the neighbor's DOFs.
+     **/
+    template< unsigned short TL_N_MDS_NE >
+    bool updateActNe( std::size_t     i_el,
+                      TL_T_REAL       i_dt,
+                      TL_T_REAL const i_tIntNe[TL_N_QTS_E][TL_N_MDS_NE][TL_N_CRS] ) const {
+      TL_T_REAL l_tol = m_actTol * i_dt;
+
+      bool l_actNe[TL_N_CRS];
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_actNe[l_cr] = false;
+
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS_NE; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            l_actNe[l_cr] = l_actNe[l_cr] || (std::abs( i_tIntNe[l_qt][l_md][l_cr] ) > l_tol);
+
+      bool l_any = false;
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+        m_act[i_el][l_cr] = m_act[i_el][l_cr] || l_actNe[l_cr];
+        l_any = l_any || (l_actNe[l_cr] && m_runAct[l_cr]);
+      }
+      if( l_any ) m_wgts[i_el] = 1;
+      return l_any;
+    }
+
+    /**
+     * Checks if all runs of an element are inactive.
+     *
+     * @param i_el element.
+     * @return true if no run of the element is active or all active runs are deactivated, false otherwise.
+     **/
+    bool isQui( std::size_t i_el ) const {
+      bool l_qui = true;
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) l_qui = l_qui && !(m_act[i_el][l_cr] && m_runAct[l_cr]);
+      return l_qui;
+    }
+
+    /**
+     * Masks the deactivated runs: their entries are set to zero.
+     * Applied to the time integrated DOFs, all updates of deactivated runs are zero and their DOFs remain unchanged.
+     *
+     * @param i_nRows number of rows, i.e., quantities (times derivatives).
+     * @param io_vals values which are masked.
+     **/
+    void maskRuns( unsigned short           i_nRows,
+                   TL_T_REAL      (* const io_vals)[TL_N_MDS][TL_N_CRS] ) const {
+      for( unsigned short l_rw = 0; l_rw < i_nRows; l_rw++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            io_vals[l_rw][l_md][l_cr] = (m_runAct[l_cr]) ? io_vals[l_rw][l_md][l_cr] : 0;
+    }
+
+    /**
+     * Skips the local step of a quiescent element: resets the time integrated DOFs and, if present, the LTS buffers.
+     *
+     * @param i_el element.
+     * @param i_firstSub true if this is the first of two sub-steps w.r.t. to the next-higher time group (LTS).
+     * @param i_elChars element characteristics.
+     * @param o_tDofsDg temporary DOFs of the DG solution, [0]: time integrated, [2]: buffer of time integrated DOFs (LTS, if required), [3]: time derivatives (LTS, if required).
+     **/
+    static void localQui( std::size_t                               i_el,
+                          bool                                      i_firstSub,
+                          t_elementChars     const                * i_elChars,
+                          TL_T_REAL           (* const * const      o_tDofsDg[4])[TL_N_MDS][TL_N_CRS] ) {
+      bool l_sBuf = i_firstSub && (i_elChars[i_el].spType & C_LTS_EL[EL_SBUF]) == C_LTS_EL[EL_SBUF];
+
+      for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+        for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+            o_tDofsDg[0][i_el][l_qt][l_md][l_cr] = 0;
+            if( l_sBuf ) o_tDofsDg[2][i_el][l_qt][l_md][l_cr] = 0;
+          }
+        }
+      }
+
+      if( (i_elChars[i_el].spType & C_LTS_EL[EL_DBUF]) != C_LTS_EL[EL_DBUF] ) {}
+      else {
+        for( unsigned short l_qt = 0; l_qt < TL_O_TI*TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+              o_tDofsDg[3][i_el][l_qt][l_md][l_cr] = 0;
+      }
+    }
+
+    /**
+     * Projects the time integrated DOFs of the given elements to their faces in the face halo.
+     *
+     * @param i_first first element.
+     * @param i_nEls number of elements.
+     * @param i_tDofs time integrated DOFs.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     **/
+    template< typename TL_T_LID >
+    void haloProj( TL_T_LID                           i_first,
+                   TL_T_LID                           i_nEls,
+                   TL_T_REAL (* const * const         i_tDofs)[TL_N_MDS][TL_N_CRS] ) const {
+      if( m_halo.fa == nullptr ) return;
+
+      for( TL_T_LID l_el = i_first; l_el < i_first+i_nEls; l_el++ ) {
+        for( std::size_t l_en = m_halo.seEl[l_el]; l_en < m_halo.seEl[l_el+1]; l_en++ ) {
+          // the local face of the sending element is the face from the adjacent element's perspective
+          m_kernels->m_surfInt.neighProj( m_halo.seFa[l_en][0],
+                                          m_halo.seFa[l_en][1],
+                                          m_halo.seFa[l_en][0],
+                                          i_tDofs[l_el],
+                                          m_halo.fa[l_en] );
+        }
+      }
+    }
+
+    /**
+     * Converts element-local data to the layout of the element batches: [el][en] -> [el/TL_N_BAT][en][el%TL_N_BAT].
+     * The lanes of the padding elements (last batch) are set to zero.
+     *
+     * @param i_nEls number of elements; the data has to be allocated for a multiple of TL_N_BAT elements.
+     * @param i_nEns number of entries per element.
+     * @param io_data data, which is converted in place.
+     **/
+    static void interleave( std::size_t   i_nEls,
+                            std::size_t   i_nEns,
+                            TL_T_REAL   * io_data ) {
+      std::vector< TL_T_REAL > l_tmp( io_data, io_data + i_nEls * i_nEns );
+      std::size_t l_nBts = (i_nEls + TL_N_BAT - 1) / TL_N_BAT;
+
+      for( std::size_t l_bt = 0; l_bt < l_nBts; l_bt++ ) {
+        for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+          for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ ) {
+            std::size_t l_el = l_bt * TL_N_BAT + l_la;
+            io_data[ (l_bt * i_nEns + l_en) * TL_N_BAT + l_la ] = (l_el < i_nEls) ? l_tmp[ l_el * i_nEns + l_en ] : 0;
+          }
+        }
+      }
+    }
+
+#if defined(PP_T_KERNELS_SIMD)
+    /**
+     * Local step for batches of TL_N_BAT interleaved elements: ADER + volume + local surface.
+     * The DOFs are packed into the interleaved layout of the batches and unpacked afterwards;
+     * batches are aligned to multiples of TL_N_BAT, lanes outside of the given elements are zero and discarded.
+     *
+     * @param i_first first element considered.
+     * @param i_nElements number of elements.
+     * @param i_time time of the initial DOFs.
+     * @param i_dt time step.
+     * @param i_firstSub true if this is the first of two sub-steps w.r.t. to the next-higher time group (LTS). Buffers are reset in the first and accumulated in the second sub-step.
+     * @param i_firstSpRe first sparse receiver entity.
+     * @param i_elChars element characteristics.
+     * @param io_dofsE elastic DOFs.
+     * @param io_dofsA anelastic DOFs.
+     * @param o_tDofsDg will be set to temporary DOFs of the DG solution, [0]: time integrated, [1]: DOFs of previous time step (if required), [2]: buffer of time integrated DOFs (LTS, if required), [3]: time derivatives (LTS, if required).
+     * @param io_recvs will be updated with receiver info.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     **/
+    template < typename TL_T_LID >
+    void localBatch( TL_T_LID                             i_first,
+                     TL_T_LID                             i_nElements,
+                     double                               i_time,
+                     double                               i_dt,
+                     bool                                 i_firstSub,
+                     TL_T_LID                             i_firstSpRe,
+                     t_elementChars              const  * i_elChars,
+                     TL_T_REAL                         (* io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL                         (* io_dofsA)[TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL        (* const * const    o_tDofsDg[4])[TL_N_MDS][TL_N_CRS],
+                     edge::io::Receivers                & io_recvs ) const {
+      // counter for receivers
+      unsigned int l_enRe = i_firstSpRe;
+
+      // temporary data structure for receivers
+      TL_T_REAL (*l_tmp)[TL_N_MDS][TL_N_CRS] = parallel::g_scratchMem->tRes[0];
+
+      // buffer for the derivatives of a single element (receivers)
+      TL_T_REAL (*l_derBuffer)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] = parallel::g_scratchMem->dBuf;
+
+      // interleaved element-local matrices
+      TL_T_REAL const (*l_starE)[TL_N_DIS][TL_N_ENS_STAR_E][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_DIS][TL_N_ENS_STAR_E][TL_N_BAT]) m_starE;
+      TL_T_REAL const (*l_starA)[TL_N_DIS][TL_N_ENS_STAR_A][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_DIS][TL_N_ENS_STAR_A][TL_N_BAT]) m_starA;
+      TL_T_REAL const (*l_srcA)[CE_MAX(int(TL_N_RMS),1)][TL_N_ENS_SRC_A][TL_N_BAT] = (TL_T_REAL const (*)[CE_MAX(int(TL_N_RMS),1)][TL_N_ENS_SRC_A][TL_N_BAT]) m_srcA;
+      TL_T_REAL const (*l_fsEBt)[TL_N_FAS][TL_N_ENS_FS_E][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_FAS][TL_N_ENS_FS_E][TL_N_BAT]) m_fsE[0];
+      TL_T_REAL const (*l_fsABt)[TL_N_FAS][TL_N_ENS_FS_A][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_FAS][TL_N_ENS_FS_A][TL_N_BAT]) m_fsA[0];
+
+      // interleaved DOFs, derivatives and time integrated DOFs
+      TL_T_REAL l_dofsE[TL_N_QTS_E][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_dofsA[CE_MAX(int(TL_N_RMS),1)][TL_N_QTS_M][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_derE[TL_O_TI][TL_N_QTS_E][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_derA[CE_MAX(int(TL_N_RMS),1)][TL_O_TI][TL_N_QTS_M][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_tDofsE[TL_N_QTS_E][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_tDofsA[CE_MAX(int(TL_N_RMS),1)][TL_N_QTS_M][TL_N_MDS][TL_N_BAT];
+
+      // interleaved scratch memory and recomputed flux solvers
+      TL_T_REAL l_tmpBt[TL_N_QTS_E][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_tmpFa[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_BAT];
+      TL_T_REAL l_fsE[TL_N_FAS][TL_N_ENS_FS_E][TL_N_BAT];
+      TL_T_REAL l_fsA[TL_N_FAS][TL_N_ENS_FS_A][TL_N_BAT];
+
+      // number of skipped quiescent elements
+      TL_T_LID l_nQui = 0;
+
+      // iterate over the batches
+      TL_T_LID l_last = i_first + i_nElements;
+      for( TL_T_LID l_bt = i_first / TL_N_BAT; l_bt * TL_N_BAT < l_last; l_bt++ ) {
+        TL_T_LID l_el0 = l_bt * TL_N_BAT;
+
+        // lanes of the batch covered by the given elements
+        unsigned short l_la0 = (l_el0 < i_first) ? i_first - l_el0 : 0;
+        unsigned short l_la1 = std::min( TL_T_LID(TL_N_BAT), l_last - l_el0 );
+
+        // skip batches of quiescent elements (not hosting receivers): the time integrated DOFs and all updates are zero
+        if( m_act != nullptr ) {
+          bool l_qui = true;
+          for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) {
+            TL_T_LID l_el = l_el0 + l_la;
+            // the activity of all lanes is updated, a single active lane requires the computation of the entire batch
+            bool l_actLa = updateAct( l_el,
+                                      io_dofsE[l_el],
+                                      io_dofsA + l_el*std::size_t(TL_N_RMS)*std::size_t(TL_N_QTS_M) );
+            l_qui = l_qui && !l_actLa && (i_elChars[l_el].spType & RECEIVER) != RECEIVER;
+          }
+
+          if( l_qui ) {
+            for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) {
+              TL_T_LID l_el = l_el0 + l_la;
+
+              if( (i_elChars[l_el].spType & C_LTS_EL[EL_DOFS]) != C_LTS_EL[EL_DOFS] ) {}
+              else {
+                for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+                  for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                    o_tDofsDg[1][l_el][l_qt][l_md][0] = io_dofsE[l_el][l_qt][l_md][0];
+              }
+
+              localQui( l_el, i_firstSub, i_elChars, o_tDofsDg );
+            }
+            l_nQui += l_la1 - l_la0;
+            continue;
+          }
+
+          // all lanes of computed batches carry the full work
+          for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) m_wgts[l_el0 + l_la] = 1;
+        }
+
+        // pack the DOFs
+        for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ ) {
+          TL_T_LID l_el = l_el0 + l_la;
+          bool l_act = (l_la >= l_la0 && l_la < l_la1);
+
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              l_dofsE[l_qt][l_md][l_la] = (l_act) ? io_dofsE[l_el][l_qt][l_md][0] : 0;
+
+          for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ )
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                l_dofsA[l_rm][l_qt][l_md][l_la] = (l_act) ? io_dofsA[ (l_el*std::size_t(TL_N_RMS) + l_rm)*TL_N_QTS_M + l_qt ][l_md][0] : 0;
+
+          // store DOFs where required
+          if( !l_act || (i_elChars[l_el].spType & C_LTS_EL[EL_DOFS]) != C_LTS_EL[EL_DOFS] ) {}
+          else {
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                o_tDofsDg[1][l_el][l_qt][l_md][0] = io_dofsE[l_el][l_qt][l_md][0];
+          }
+        }
+
+        // compute ADER time integration
+        m_kernelsBt->m_time.ckBatch( i_dt,
+                                     l_starE[l_bt],
+                                     l_starA[l_bt],
+                                     l_srcA[l_bt],
+                                     l_dofsE,
+                                     l_dofsA,
+                                     l_tmpBt,
+                                     l_derE,
+                                     l_derA,
+                                     l_tDofsE,
+                                     l_tDofsA );
+
+        // accumulate only the update of the elastic DOFs if compensated
+        if( TL_COMP ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ )
+                l_dofsE[l_qt][l_md][l_la] = 0;
+        }
+
+        // unpack the time integrated DOFs and handle LTS-buffers and receivers
+        for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) {
+          TL_T_LID l_el = l_el0 + l_la;
+
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              o_tDofsDg[0][l_el][l_qt][l_md][0] = l_tDofsE[l_qt][l_md][l_la];
+
+          // LTS: reset or accumulate the buffer of time integrated DOFs
+          if( (i_elChars[l_el].spType & C_LTS_EL[EL_SBUF]) != C_LTS_EL[EL_SBUF] ) {}
+          else {
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                o_tDofsDg[2][l_el][l_qt][l_md][0] = ( i_firstSub ? 0 : o_tDofsDg[2][l_el][l_qt][l_md][0] )
+                                                    + l_tDofsE[l_qt][l_md][l_la];
+          }
+
+          // LTS: store the time derivatives
+          if( (i_elChars[l_el].spType & C_LTS_EL[EL_DBUF]) != C_LTS_EL[EL_DBUF] ) {}
+          else {
+            for( unsigned short l_de = 0; l_de < TL_O_TI; l_de++ )
+              for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+                for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                  o_tDofsDg[3][l_el][l_de*TL_N_QTS_E + l_qt][l_md][0] = l_derE[l_de][l_qt][l_md][l_la];
+          }
+
+          // write receivers (if required)
+          if( !( (i_elChars[l_el].spType & RECEIVER) == RECEIVER) ) {} // no receivers in the current element
+          else { // we have receivers in the current element
+            for( unsigned short l_de = 0; l_de < TL_O_TI; l_de++ )
+              for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+                for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                  l_derBuffer[l_de][l_qt][l_md][0] = l_derE[l_de][l_qt][l_md][l_la];
+
+            while( true ) { // iterate of possible multiple receiver-ouput per time step
+              double l_rePt = io_recvs.getRecvTimeRel( l_enRe, i_time, i_dt );
+              if( !(l_rePt >= 0) ) break;
+              // evaluate the compensated DOFs in double precision
+              else if( TL_COMP ) {
+                double l_preC[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = {};
+                evalTimePredComp( l_rePt,
+                                  l_derBuffer,
+                                  m_dofsC[l_el],
+                                  (double (*)[TL_N_MDS][TL_N_CRS]) l_preC );
+                io_recvs.writeRecvAll( l_enRe, l_preC );
+              }
+              else {
+                TL_T_REAL l_rePts = l_rePt;
+                // eval time prediction at the given point
+                m_kernels->m_time.evalTimePrediction(  1,
+                                                     & l_rePts,
+                                                       l_derBuffer,
+                            (TL_T_REAL (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS])l_tmp );
+
+                // write this time prediction
+                io_recvs.writeRecvAll( l_enRe, l_tmp );
+              }
+            }
+            l_enRe++;
+          }
+        }
+
+        // compute volume integral
+        m_kernelsBt->m_volInt.applyBatch( l_starE[l_bt],
+                                          l_starA[l_bt],
+                                          l_srcA[l_bt],
+                                          l_tDofsE,
+                                          l_tDofsA,
+                                          l_dofsE,
+                                          l_dofsA,
+                                          l_tmpBt );
+
+        // recompute the flux solvers if only their parameters are stored
+        if( m_fsPars != nullptr ) {
+          for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ ) {
+            TL_T_LID l_el = l_el0 + l_la;
+            bool l_act = (l_la >= l_la0 && l_la < l_la1);
+
+            for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+              TL_T_REAL l_fsELa[TL_N_ENS_FS_E] = {};
+              TL_T_REAL l_fsALa[TL_N_ENS_FS_A] = {};
+              if( l_act ) {
+                FluxSolvers< TL_T_EL >::recompute( m_fsPars[l_el][l_fa],
+                                                   0,
+                                                   l_fsELa,
+                                                   (TL_N_RMS > 0) ? l_fsALa : nullptr );
+              }
+              for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_E; l_en++ ) l_fsE[l_fa][l_en][l_la] = l_fsELa[l_en];
+              for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_A; l_en++ ) l_fsA[l_fa][l_en][l_la] = l_fsALa[l_en];
+            }
+          }
+        }
+
+        // compute local surface contribution
+        m_kernelsBt->m_surfInt.localBatch( (m_fsPars == nullptr) ? l_fsEBt[l_bt] : l_fsE,
+                                           (m_fsPars == nullptr) ? l_fsABt[l_bt] : l_fsA,
+                                           l_tDofsE,
+                                           l_dofsE,
+                                           l_dofsA,
+                                           l_tmpFa );
+
+        // unpack the DOFs
+        for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) {
+          TL_T_LID l_el = l_el0 + l_la;
+
+          if( TL_COMP ) {
+            TL_T_REAL l_upLa[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                l_upLa[l_qt][l_md][0] = l_dofsE[l_qt][l_md][l_la];
+            addComp( l_upLa, io_dofsE[l_el], m_dofsC[l_el] );
+          }
+          else {
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                io_dofsE[l_el][l_qt][l_md][0] = l_dofsE[l_qt][l_md][l_la];
+          }
+
+          for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ )
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                io_dofsA[ (l_el*std::size_t(TL_N_RMS) + l_rm)*TL_N_QTS_M + l_qt ][l_md][0] = l_dofsA[l_rm][l_qt][l_md][l_la];
+        }
+      }
+
+      if( m_act != nullptr ) {
+        m_nUpsQui[0] += i_nElements;
+        m_nUpsQui[2] += l_nQui;
+      }
+    }
+#endif
+
+    /**
+     * Finishes the neighboring update of an element: scatters the anelastic update and computes the extrema (if required).
+     *
+     * @param i_el element.
+     * @param i_upA unscaled (w.r.t. frequencies) anelastic update of the element.
+     * @param i_scatter scatter opterators (DG -> sub-cells).
+     * @param i_elChars element characteristics.
+     * @param i_lpFaLp limited plus elements adjacent to limited plus (faces as bridge).
+     * @param io_dofsE elastic DOFs.
+     * @param io_dofsA anelastic DOFs, which will be updated.
+     * @param io_admC will be updated with the admissibility of the candidate solution.
+     * @param i_extP extreme of the previous solution.
+     * @param o_extC will be set to extreme of the candidate solution.
+     * @param i_mm matrix-matrix multiplication kernels.
+     * @param io_ex counter for elements computing extrema, will be incremented if required.
+     * @param io_lp counter for limited plus elements, will be incremented if required.
+     * @param io_li counter for limited elements, will be incremented if required.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     * @paramt TL_T_MM type of the matrix-matrix multiplication kernels.
+     **/
+    template< typename TL_T_LID,
+              typename TL_T_MM >
+    void neighFinish( TL_T_LID                              i_el,
+                      TL_T_REAL                             i_upA[TL_N_QTS_M][TL_N_MDS][TL_N_CRS],
+                      TL_T_REAL      const                  i_scatter[TL_N_MDS][TL_N_SCS],
+                      t_elementChars const                * i_elChars,
+                      TL_T_LID       const               (* i_lpFaLp)[TL_N_FAS],
+                      TL_T_REAL                          (* io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                      TL_T_REAL                          (* io_dofsA)[TL_N_MDS][TL_N_CRS],
+                      bool                               (* io_admC)[TL_N_CRS],
+                      TL_T_REAL      const               (* i_extP)[2][TL_N_QTS_E][TL_N_CRS],
+                      TL_T_REAL                          (* o_extC)[2][TL_N_QTS_E][TL_N_CRS],
+                      TL_T_MM        const                & i_mm,
+                      TL_T_LID                            & io_ex,
+                      TL_T_LID                            & io_lp,
+                      TL_T_LID                            & io_li ) const {
+      // update anelastic DOFs
+      if( TL_N_RMS > 0 ) {
+        TL_T_REAL (*l_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] =
+          (TL_T_REAL (*) [TL_N_QTS_M][TL_N_MDS][TL_N_CRS]) (io_dofsA+i_el*std::size_t(TL_N_RMS)*std::size_t(TL_N_QTS_M));
+
+        m_kernels->m_surfInt.scatterUpdateA( i_upA, l_dofsA );
+      }
+
+      // compute extrema (if required)
+      if( (i_elChars[i_el].spType & EXTREMA) != EXTREMA ) {}
+      else {
+        //! TODO: Use dedicated scratch memory for this
+        TL_T_REAL (*l_sg)[TL_N_SCS][TL_N_CRS] = parallel::g_scratchMem->sg;
+
+        // compute DG extrema
+        edge::sc::Kernels< TL_T_EL,
+                           TL_O_SP,
+                           TL_N_QTS_E,
+                           TL_N_CRS >::dgExtrema(  i_mm,
+                                                   io_dofsE[i_el],
+                                                   i_scatter,
+                                                   l_sg,
+                                                   o_extC[io_ex][0],
+                                                   o_extC[io_ex][1] );
+
+        // store the surface sub-cells
+        if( ( i_elChars[i_el].spType & LIMIT_PLUS ) == LIMIT_PLUS ) {
+          // set admissibility
+          if( ( i_elChars[i_el].spType & LIMIT ) == LIMIT ) {
+            if( ( i_elChars[i_el].spType & RUPTURE ) != RUPTURE ) {
+              bool l_adm[TL_N_CRS];
+              edge::sc::Detections< TL_T_EL,
+                                    TL_N_QTS_E,
+                                    TL_N_CRS >::dmpFa( i_extP[io_ex],
+                                                       i_extP,
+                                                       o_extC[io_ex],
+                                                       i_lpFaLp[io_lp],
+                                                       l_adm );
+
+              // update admissibility
+#pragma omp simd
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                // only write "false" to memory, not "true" (avoids conflicts with rupture-admissibility in shared memory parallelization)
+                if( l_adm[l_cr] == false )
+                  io_admC[io_li][l_cr] = false;
+              }
+            }
+
+            // increase counter of limited elements
+            io_li++;
+          }
+          // increase counter of limited plus elements
+          io_lp++;
+        }
+
+        // increase counter of extrema elements
+        io_ex++;
+      }
+    }
+
+#if defined(PP_T_KERNELS_SIMD)
+    /**
+     * Neighboring updates for batches of TL_N_BAT interleaved elements.
+     * The products with the neighboring flux matrices differ per element and are computed per lane,
+     * the multiplications with the flux solvers and the transposed flux matrices are batched.
+     *
+     * @param i_first first element considered.
+     * @param i_nElements number of elements.
+     * @param i_dt time step.
+     * @param i_firstSub true if this is the first of two sub-steps w.r.t. to the next-higher time group (LTS).
+     * @param i_firstLi first limited element.
+     * @param i_firstLp first limited plus element.
+     * @param i_firstEx first element computing extrema.
+     * @param i_scatter scatter opterators (DG -> sub-cells).
+     * @param i_faChars face characteristics.
+     * @param i_elChars element characteristics.
+     * @param i_lpFaLp limited plus elements adjacent to limited plus (faces as bridge).
+     * @param i_elFa elements' adjacent faces.
+     * @param i_elFaEl face-neighboring elements.
+     * @param i_fIdElFaEl local face ids of face-neighboring elememts.
+     * @param i_vIdElFaEl local vertex ids w.r.t. the shared face from the neighboring elements' perspsective.
+     * @param i_tDofsDg temporarary DG DOFs ([0]: time integrated, [1]: DOFs of previous time step, [2]: buffer of time integrated DOFs, [3]: time derivatives).
+     * @param io_dofsE elastic DOFs which will be updated with neighboring elements' contribution.
+     * @param io_dofsA anelastic DOFs which will be updated with neighboring elements' contribution.
+     * @param io_admC will be updated with the admissibility of the candidate solution.
+     * @param i_extP extreme of the previous solution.
+     * @param o_extC will be set to extreme of the candidate solution.
+     * @param i_mm matrix-matrix multiplication kernels.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     * @paramt TL_T_MM type of the matrix-matrix multiplication kernels.
+     **/
+    template< typename TL_T_LID,
+              typename TL_T_MM >
+    void neighBatch( TL_T_LID                              i_first,
+                     TL_T_LID                              i_nElements,
+                     TL_T_REAL                             i_dt,
+                     bool                                  i_firstSub,
+                     TL_T_LID                              i_firstLi,
+                     TL_T_LID                              i_firstLp,
+                     TL_T_LID                              i_firstEx,
+                     TL_T_REAL      const                  i_scatter[TL_N_MDS][TL_N_SCS],
+                     t_faceChars    const                * i_faChars,
+                     t_elementChars const                * i_elChars,
+                     TL_T_LID       const               (* i_lpFaLp)[TL_N_FAS],
+                     TL_T_LID       const               (* i_elFa)[TL_N_FAS],
+                     TL_T_LID       const               (* i_elFaEl)[TL_N_FAS],
+                     unsigned short const               (* i_fIdElFaEl)[TL_N_FAS],
+                     unsigned short const               (* i_vIdElFaEl)[TL_N_FAS],
+                     TL_T_REAL            (* const * const i_tDofsDg[4])[TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL                          (* io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL                          (* io_dofsA)[TL_N_MDS][TL_N_CRS],
+                     bool                               (* io_admC)[TL_N_CRS],
+                     TL_T_REAL      const               (* i_extP)[2][TL_N_QTS_E][TL_N_CRS],
+                     TL_T_REAL                          (* o_extC)[2][TL_N_QTS_E][TL_N_CRS],
+                     TL_T_MM        const                & i_mm ) const {
+      // counter for elements computing extrema
+      TL_T_LID l_ex = i_firstEx;
+
+      // counter for limited plus elements
+      TL_T_LID l_lp = i_firstLp;
+
+      // counter for limited elements
+      TL_T_LID l_li = i_firstLi;
+
+      // time integrated DOFs of neighbors in the next-higher time group (LTS)
+      TL_T_REAL (*l_tIntGt)[TL_N_MDS][TL_N_CRS] = parallel::g_scratchMem->tRes[1];
+
+      // interleaved flux solvers of the neighboring side
+      TL_T_REAL const (*l_fsEBt)[TL_N_FAS][TL_N_ENS_FS_E][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_FAS][TL_N_ENS_FS_E][TL_N_BAT]) m_fsE[1];
+      TL_T_REAL const (*l_fsABt)[TL_N_FAS][TL_N_ENS_FS_A][TL_N_BAT] = (TL_T_REAL const (*)[TL_N_FAS][TL_N_ENS_FS_A][TL_N_BAT]) m_fsA[1];
+
+      // interleaved updates, scratch memory and recomputed flux solvers
+      TL_T_REAL l_upE[TL_N_QTS_E][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_upA[TL_N_QTS_M][TL_N_MDS][TL_N_BAT];
+      TL_T_REAL l_tmpFa[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_BAT];
+      TL_T_REAL l_fsE[TL_N_ENS_FS_E][TL_N_BAT];
+      TL_T_REAL l_fsA[TL_N_ENS_FS_A][TL_N_BAT];
+
+      // number of skipped quiescent elements
+      TL_T_LID l_nQui = 0;
+
+      // iterate over the batches
+      TL_T_LID l_last = i_first + i_nElements;
+      for( TL_T_LID l_bt = i_first / TL_N_BAT; l_bt * TL_N_BAT < l_last; l_bt++ ) {
+        TL_T_LID l_el0 = l_bt * TL_N_BAT;
+
+        // lanes of the batch covered by the given elements
+        unsigned short l_la0 = (l_el0 < i_first) ? i_first - l_el0 : 0;
+        unsigned short l_la1 = std::min( TL_T_LID(TL_N_BAT), l_last - l_el0 );
+
+        // lanes with quiescent elements, contributions of neighbors below the tolerance are skipped
+        bool l_quiLa[TL_N_BAT];
+        bool l_skipLa[TL_N_BAT];
+        for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ ) {
+          l_quiLa[l_la] = (m_act != nullptr) && l_la >= l_la0 && l_la < l_la1 && isQui( l_el0 + l_la );
+          l_skipLa[l_la] = l_quiLa[l_la];
+        }
+
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+            for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ )
+              l_upE[l_qt][l_md][l_la] = 0;
+
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+            for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ )
+              l_upA[l_qt][l_md][l_la] = 0;
+
+        // add neighboring contribution
+        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+          // true if at least one lane receives a contribution through the face
+          bool l_anyLa = false;
+
+          // per-lane products with the neighboring flux matrices
+          for( unsigned short l_la = 0; l_la < TL_N_BAT; l_la++ ) {
+            TL_T_LID l_el = l_el0 + l_la;
+            bool l_act = (l_la >= l_la0 && l_la < l_la1);
+
+            // inactive lanes and outflow boundaries do not contribute
+            TL_T_LID l_faId = 0;
+            if( l_act ) {
+              l_faId = i_elFa[l_el][l_fa];
+              l_act = (i_faChars[l_faId].spType & OUTFLOW) != OUTFLOW;
+            }
+
+            // derive neighbor and mesh-ids, default are free-surface boundaries
+            TL_T_LID l_ne = l_el;
+            unsigned short l_vId = std::numeric_limits< unsigned short >::max();
+            unsigned short l_fId = std::numeric_limits< unsigned short >::max();
+            TL_T_REAL const (*l_tIntNe)[TL_N_MDS][TL_N_CRS] = nullptr;
+            std::size_t l_haRe = std::numeric_limits< std::size_t >::max();
+            if( l_act && m_halo.reElFa != nullptr ) l_haRe = m_halo.reElFa[l_el][l_fa];
+
+            // face halo: the neighbor's rank provided the projection of its time integrated DOFs to the shared face
+            if( l_haRe != std::numeric_limits< std::size_t >::max() ) {
+              if( l_quiLa[l_la] && !updateActNe( l_el, i_dt, m_halo.fa[l_haRe] ) ) l_act = false;
+            }
+            else if( l_act ) {
+              if( (i_faChars[l_faId].spType & FREE_SURFACE) != FREE_SURFACE ) {
+                l_ne  = i_elFaEl[l_el][l_fa];
+                l_vId = i_vIdElFaEl[l_el][l_fa];
+                l_fId = i_fIdElFaEl[l_el][l_fa];
+              }
+
+              /*
+               * LTS: time integrated DOFs of the neighbor
+               */
+              l_tIntNe = i_tDofsDg[0][l_ne];
+              // neighbor in the next-lower time group: accumulated sub-steps
+              if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
+                l_tIntNe = i_tDofsDg[2][l_ne];
+              }
+              // neighbor in the next-higher time group: integrate the neighbor's time prediction over our sub-step
+              else if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_GT]) == C_LTS_AD[l_fa][AD_GT] ) {
+                TL_T_REAL l_t0 = (i_firstSub) ? 0 : i_dt;
+                m_kernels->m_time.integrateTimePrediction( l_t0,
+                                                           l_t0 + i_dt,
+                    (TL_T_REAL (*)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS]) i_tDofsDg[3][l_ne],
+                                                           l_tIntGt );
+                l_tIntNe = l_tIntGt;
+              }
+
+              // skip contributions of neighbors below the tolerance
+              if( l_quiLa[l_la] && !updateActNe( l_el, i_dt, l_tIntNe ) ) l_act = false;
+            }
+
+            if( !l_act ) {
+              m_kernelsBt->m_surfInt.neighLane( l_fa, 0, 0, l_la, nullptr, l_tmpFa );
+              if( m_fsPars != nullptr ) {
+                for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_E; l_en++ ) l_fsE[l_en][l_la] = 0;
+                for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_A; l_en++ ) l_fsA[l_en][l_la] = 0;
+              }
+              continue;
+            }
+            l_anyLa = true;
+            l_skipLa[l_la] = false;
+
+            if( l_haRe != std::numeric_limits< std::size_t >::max() ) {
+              m_kernelsBt->m_surfInt.neighLaneFa( l_la,
+                                                  m_halo.fa[l_haRe][0][0],
+                                                  l_tmpFa );
+            }
+            else {
+              m_kernelsBt->m_surfInt.neighLane( l_fa,
+                                                l_vId,
+                                                l_fId,
+                                                l_la,
+                                                l_tIntNe[0][0],
+                                                l_tmpFa );
+            }
+
+            // recompute the flux solvers if only their parameters are stored
+            if( m_fsPars != nullptr ) {
+              TL_T_REAL l_fsELa[TL_N_ENS_FS_E] = {};
+              TL_T_REAL l_fsALa[TL_N_ENS_FS_A] = {};
+              FluxSolvers< TL_T_EL >::recompute( m_fsPars[l_el][l_fa],
+                                                 1,
+                                                 l_fsELa,
+                                                 (TL_N_RMS > 0) ? l_fsALa : nullptr );
+              for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_E; l_en++ ) l_fsE[l_en][l_la] = l_fsELa[l_en];
+              for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_A; l_en++ ) l_fsA[l_en][l_la] = l_fsALa[l_en];
+            }
+          }
+
+          // no contribution through the face
+          if( !l_anyLa ) continue;
+
+          // batched flux solvers and transposed flux matrices
+          m_kernelsBt->m_surfInt.neighBatch( l_fa,
+                                             (m_fsPars == nullptr) ? l_fsEBt[l_bt][l_fa] : l_fsE,
+                                             (m_fsPars == nullptr) ? l_fsABt[l_bt][l_fa] : l_fsA,
+                                             l_upE,
+                                             l_upA,
+                                             l_tmpFa );
+        }
+
+        // unpack the updates
+        for( unsigned short l_la = l_la0; l_la < l_la1; l_la++ ) {
+          TL_T_LID l_el = l_el0 + l_la;
+
+          if( TL_COMP ) {
+            TL_T_REAL l_upELa[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                l_upELa[l_qt][l_md][0] = l_upE[l_qt][l_md][l_la];
+            addComp( l_upELa, io_dofsE[l_el], m_dofsC[l_el] );
+          }
+          else {
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                io_dofsE[l_el][l_qt][l_md][0] += l_upE[l_qt][l_md][l_la];
+          }
+
+          TL_T_REAL l_upALa[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              l_upALa[l_qt][l_md][0] = l_upA[l_qt][l_md][l_la];
+
+          if( l_skipLa[l_la] ) l_nQui++;
+
+          // scatter anelastic update and compute extrema
+          neighFinish( l_el,
+                       l_upALa,
+                       i_scatter,
+                       i_elChars,
+                       i_lpFaLp,
+                       io_dofsE,
+                       io_dofsA,
+                       io_admC,
+                       i_extP,
+                       o_extC,
+                       i_mm,
+                       l_ex,
+                       l_lp,
+                       l_li );
         }
       }
+
+      if( m_act != nullptr ) {
+        m_nUpsQui[1] += i_nElements;
+        m_nUpsQui[3] += l_nQui;
+      }
     }
+#endif
 
   public:
     /**
@@ -217,6 +1186,10 @@ class edge::seismic::solvers::AderDg {
      * @param i_freqCen central frequency for attenuation.
      * @param i_freqRat frequency ratio between upper and lower frequencies for attenuation.
      * @param io_dynMem dynamic memory management.
+     * @param io_tuner tuner for the selection of kernel variants, nullptr for default variants.
+     * @param i_recompFs if true, only the parameters of the flux solvers are stored and the solvers are recomputed on the fly.
+     * @param i_skipQui if true, the updates of quiescent elements (all DOFs and incoming fluxes below the tolerance in all runs) are skipped.
+     * @param i_quiTol tolerance of the DOFs and incoming fluxes, below which elements are considered quiescent.
      *
      * @paramt TL_T_LID integral type of local ids.
      */
@@ -234,7 +1207,11 @@ class edge::seismic::solvers::AderDg {
            t_bgPars              * io_bgPars,
            double                  i_freqCen,
            double                  i_freqRat,
-           data::Dynamic         & io_dynMem ) {
+           data::Dynamic         & io_dynMem,
+           data::Tuner           * io_tuner = nullptr,
+           bool                    i_recompFs = false,
+           bool                    i_skipQui = false,
+           double                  i_quiTol = 0 ) {
       // alloc and init kernels
       TL_T_REAL *l_rfs = nullptr;
       if( TL_N_RMS > 0 ) {
@@ -253,16 +1230,63 @@ class edge::seismic::solvers::AderDg {
                                         TL_T_EL,
                                         TL_O_SP,
                                         TL_O_TI,
-                                        TL_N_CRS >( l_rfs, io_dynMem );
+                                        TL_N_CRS >( l_rfs, io_dynMem, io_tuner );
+      if( TL_N_BAT > 1 ) {
+        EDGE_LOG_INFO << "  using element batches of " << TL_N_BAT << " interleaved elements";
+        m_kernelsBt = new kernels::Kernels< TL_T_REAL,
+                                            TL_N_RMS,
+                                            TL_T_EL,
+                                            TL_O_SP,
+                                            TL_O_TI,
+                                            TL_N_BAT >( l_rfs, io_dynMem, io_tuner );
+      }
       if( TL_N_RMS > 0 ) {
         delete[] l_rfs;
       }
 
-      // allocate constant data
-      alloc( i_nEls,
+      // allocate constant data, padded to full element batches
+      alloc( ( (std::size_t(i_nEls) + TL_N_BAT - 1) / TL_N_BAT ) * TL_N_BAT,
              ALIGNMENT.BASE.HEAP,
+             i_recompFs,
              io_dynMem );
 
+      // allocate and reset the compensations of the elastic DOFs
+      if( TL_COMP ) {
+        EDGE_LOG_INFO << "  using compensated accumulation of the elastic DOF updates";
+        std::size_t l_nEns = std::size_t(i_nEls) * TL_N_QTS_E * TL_N_MDS * TL_N_CRS;
+        m_dofsC = ( TL_T_REAL (*) [TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) io_dynMem.allocate( l_nEns * sizeof(TL_T_REAL),
+                                                                                         ALIGNMENT.BASE.HEAP,
+                                                                                         false,
+                                                                                         true );
+        TL_T_REAL *l_dofsC = m_dofsC[0][0][0];
+        for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) l_dofsC[l_en] = 0;
+      }
+
+      // all fused runs are active initially
+      for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) m_runAct[l_cr] = true;
+
+      // allocate and reset the activity of the elements' runs
+      for( unsigned short l_id = 0; l_id < 4; l_id++ ) m_nUpsQui[l_id] = 0;
+      if( i_skipQui ) {
+        EDGE_LOG_INFO << "  skipping the updates of quiescent elements, tolerance: " << i_quiTol;
+        m_actTol = i_quiTol;
+        std::size_t l_nEns = std::size_t(i_nEls) * TL_N_CRS;
+        m_act = ( bool (*) [TL_N_CRS] ) io_dynMem.allocate( l_nEns * sizeof(bool),
+                                                            ALIGNMENT.BASE.HEAP,
+                                                            false,
+                                                            true );
+        bool *l_act = m_act[0];
+        for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) l_act[l_en] = false;
+
+        // elements hosting receivers are always computed
+        m_wgts = (float *) io_dynMem.allocate( std::size_t(i_nEls) * sizeof(float),
+                                               ALIGNMENT.BASE.HEAP,
+                                               false,
+                                               true );
+        for( TL_T_LID l_el = 0; l_el < i_nEls; l_el++ )
+          m_wgts[l_el] = ( (i_elChars[l_el].spType & RECEIVER) == RECEIVER ) ? 1 : m_wgtQui;
+      }
+
       // init anelastic source matrices and compute elastic Lame parameters in viscoelastic settings
       if( TL_N_RMS > 0 ) {
         AderDgInit< TL_T_EL,
@@ -284,20 +1308,66 @@ class edge::seismic::solvers::AderDg {
                                           m_starA );
 
       // init flux solvers
-      AderDgInit< TL_T_EL,
-                  TL_MATS_SP >::initFs( i_nEls,
-                                        i_nFas,
-                                        i_faEl,
-                                        i_elVe,
-                                        i_elFa,
-                                        i_elMeDa,
-                                        i_elDaMe,
-                                        i_veChars,
-                                        i_faChars,
-                                        i_elChars,
-                                        io_bgPars,
-                                        m_fsE,
-                                        m_fsA );
+      if( !i_recompFs ) {
+        AderDgInit< TL_T_EL,
+                    TL_MATS_SP >::initFs( i_nEls,
+                                          i_nFas,
+                                          i_faEl,
+                                          i_elVe,
+                                          i_elFa,
+                                          i_elMeDa,
+                                          i_elDaMe,
+                                          i_veChars,
+                                          i_faChars,
+                                          i_elChars,
+                                          io_bgPars,
+                                          m_fsE,
+                                          m_fsA );
+      }
+      else {
+        AderDgInit< TL_T_EL,
+                    TL_MATS_SP >::initFsPars( i_nEls,
+                                              i_faEl,
+                                              i_elVe,
+                                              i_elFa,
+                                              i_elMeDa,
+                                              i_elDaMe,
+                                              i_veChars,
+                                              i_faChars,
+                                              io_bgPars,
+                                              m_fsPars );
+      }
+
+      // interleave the element-local matrices of the batches
+      if( TL_N_BAT > 1 ) {
+        interleave( i_nEls, std::size_t(TL_N_DIS) * TL_N_ENS_STAR_E, m_starE[0][0] );
+        if( m_fsPars == nullptr ) {
+          for( unsigned short l_sd = 0; l_sd < 2; l_sd++ )
+            interleave( i_nEls, std::size_t(TL_N_FAS) * TL_N_ENS_FS_E, m_fsE[l_sd][0][0] );
+        }
+
+        if( TL_N_RMS > 0 ) {
+          interleave( i_nEls, std::size_t(TL_N_RMS) * TL_N_ENS_SRC_A, m_srcA[0] );
+          interleave( i_nEls, std::size_t(TL_N_DIS) * TL_N_ENS_STAR_A, m_starA[0][0] );
+          if( m_fsPars == nullptr ) {
+            for( unsigned short l_sd = 0; l_sd < 2; l_sd++ )
+              interleave( i_nEls, std::size_t(TL_N_FAS) * TL_N_ENS_FS_A, m_fsA[l_sd][0][0] );
+          }
+        }
+      }
+    }
+
+    /**
+     * Gets the number of bytes of the flux solvers' storage per element.
+     *
+     * @param i_recompFs true if the flux solvers are recomputed on the fly.
+     * @return number of bytes.
+     **/
+    static std::size_t getFsBytes( bool i_recompFs ) {
+      if( i_recompFs ) return std::size_t(TL_N_FAS) * TL_N_PARS_FS * sizeof(TL_T_REAL);
+
+      return std::size_t(2) * TL_N_FAS * (   TL_N_ENS_FS_E
+                                           + (TL_N_RMS > 0) * TL_N_ENS_FS_A ) * sizeof(TL_T_REAL);
     }
 
     /**
@@ -305,6 +1375,7 @@ class edge::seismic::solvers::AderDg {
      **/
     ~AderDg() {
       delete m_kernels;
+      delete m_kernelsBt;
     }
 
     /**
@@ -314,11 +1385,12 @@ class edge::seismic::solvers::AderDg {
      * @param i_nElements number of elements.
      * @param i_time time of the initial DOFs.
      * @param i_dt time step.
+     * @param i_firstSub true if this is the first of two sub-steps w.r.t. to the next-higher time group (LTS). Buffers are reset in the first and accumulated in the second sub-step.
      * @param i_firstSpRe first sparse receiver entity.
      * @param i_elChars element characteristics.
      * @param io_dofsE elastic DOFs.
      * @param io_dofsA anelastic DOFs.
-     * @param o_tDofsDg will be set to temporary DOFs of the DG solution, [0]: time integrated, [1]: DOFs of previous time step (if required).
+     * @param o_tDofsDg will be set to temporary DOFs of the DG solution, [0]: time integrated, [1]: DOFs of previous time step (if required), [2]: buffer of time integrated DOFs (LTS, if required), [3]: time derivatives (LTS, if required).
      * @param io_recvs will be updated with receiver info.
      *
      * @paramt TL_T_LID integer type of local entity ids.
@@ -328,12 +1400,32 @@ class edge::seismic::solvers::AderDg {
                 TL_T_LID                             i_nElements,
                 double                               i_time,
                 double                               i_dt,
+                bool                                 i_firstSub,
                 TL_T_LID                             i_firstSpRe,
                 t_elementChars              const  * i_elChars,
                 TL_T_REAL                         (* io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
                 TL_T_REAL                         (* io_dofsA)[TL_N_MDS][TL_N_CRS],
-                TL_T_REAL        (* const * const    o_tDofsDg[2])[TL_N_MDS][TL_N_CRS],
+                TL_T_REAL        (* const * const    o_tDofsDg[4])[TL_N_MDS][TL_N_CRS],
                 edge::io::Receivers                & io_recvs ) const {
+#if defined(PP_T_KERNELS_SIMD)
+      // element-interleaved batches of single forward runs
+      if( TL_N_BAT > 1 ) {
+        localBatch( i_first,
+                    i_nElements,
+                    i_time,
+                    i_dt,
+                    i_firstSub,
+                    i_firstSpRe,
+                    i_elChars,
+                    io_dofsE,
+                    io_dofsA,
+                    o_tDofsDg,
+                    io_recvs );
+        haloProj( i_first, i_nElements, o_tDofsDg[0] );
+        return;
+      }
+#endif
+
       // counter for receivers
       unsigned int l_enRe = i_firstSpRe;
 
@@ -343,6 +1435,9 @@ class edge::seismic::solvers::AderDg {
       // buffer for derivatives
       TL_T_REAL (*l_derBuffer)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] = parallel::g_scratchMem->dBuf;
 
+      // number of skipped quiescent elements
+      TL_T_LID l_nQui = 0;
+
       // iterate over all elements
       for( TL_T_LID l_el = i_first; l_el < i_first+i_nElements; l_el++ ) {
         // store DOFs where required
@@ -358,6 +1453,18 @@ class edge::seismic::solvers::AderDg {
         TL_T_REAL (*l_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] =
           (TL_T_REAL (*) [TL_N_QTS_M][TL_N_MDS][TL_N_CRS]) (io_dofsA+l_el*std::size_t(TL_N_RMS)*std::size_t(TL_N_QTS_M));
 
+        // skip quiescent elements (not hosting receivers) and elements of deactivated runs: the time integrated DOFs and all updates are zero
+        if(    m_nRunsOff == TL_N_CRS
+            || (    m_act != nullptr
+                 && (i_elChars[l_el].spType & RECEIVER) != RECEIVER
+                 && !updateAct( l_el,
+                                io_dofsE[l_el],
+                                (TL_T_REAL const (*)[TL_N_MDS][TL_N_CRS]) l_dofsA ) ) ) {
+          localQui( l_el, i_firstSub, i_elChars, o_tDofsDg );
+          l_nQui++;
+          continue;
+        }
+
         TL_T_REAL l_tDofsA[CE_MAX(int(TL_N_RMS),1)][TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
         TL_T_REAL l_derA[CE_MAX(int(TL_N_RMS),1)][TL_O_SP][TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
 
@@ -374,12 +1481,48 @@ class edge::seismic::solvers::AderDg {
                               o_tDofsDg[0][l_el],
                               l_tDofsA );
 
+        // mask deactivated runs
+        if( m_nRunsOff > 0 ) {
+          maskRuns( TL_N_QTS_E, o_tDofsDg[0][l_el] );
+          maskRuns( TL_N_RMS*TL_N_QTS_M, l_tDofsA[0] );
+        }
+
+        // LTS: reset or accumulate the buffer of time integrated DOFs
+        if( (i_elChars[l_el].spType & C_LTS_EL[EL_SBUF]) != C_LTS_EL[EL_SBUF] ) {}
+        else {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                o_tDofsDg[2][l_el][l_qt][l_md][l_cr] = ( i_firstSub ? 0 : o_tDofsDg[2][l_el][l_qt][l_md][l_cr] )
+                                                       + o_tDofsDg[0][l_el][l_qt][l_md][l_cr];
+        }
+
+        // LTS: store the time derivatives
+        if( (i_elChars[l_el].spType & C_LTS_EL[EL_DBUF]) != C_LTS_EL[EL_DBUF] ) {}
+        else {
+          for( unsigned short l_de = 0; l_de < TL_O_TI; l_de++ )
+            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+              for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+                for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                  o_tDofsDg[3][l_el][l_de*TL_N_QTS_E + l_qt][l_md][l_cr] = l_derBuffer[l_de][l_qt][l_md][l_cr];
+          if( m_nRunsOff > 0 ) maskRuns( TL_O_TI*TL_N_QTS_E, o_tDofsDg[3][l_el] );
+        }
+
         // write receivers (if required)
         if( !( (i_elChars[l_el].spType & RECEIVER) == RECEIVER) ) {} // no receivers in the current element
         else { // we have receivers in the current element
           while( true ) { // iterate of possible multiple receiver-ouput per time step
             double l_rePt = io_recvs.getRecvTimeRel( l_enRe, i_time, i_dt );
             if( !(l_rePt >= 0) ) break;
+            // evaluate the compensated DOFs in double precision
+            else if( TL_COMP ) {
+              double l_preC[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = {};
+              evalTimePredComp( l_rePt,
+                                l_derBuffer,
+                                m_dofsC[l_el],
+                                (double (*)[TL_N_MDS][TL_N_CRS]) l_preC );
+              io_recvs.writeRecvAll( l_enRe, l_preC );
+            }
             else {
               TL_T_REAL l_rePts = l_rePt;
               // eval time prediction at the given point
@@ -395,13 +1538,24 @@ class edge::seismic::solvers::AderDg {
           l_enRe++;
         }
 
+        // elastic DOFs or, if accumulated through compensated summation, their update
+        TL_T_REAL l_upC[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+        TL_T_REAL (*l_upE)[TL_N_MDS][TL_N_CRS] = io_dofsE[l_el];
+        if( TL_COMP ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                l_upC[l_qt][l_md][l_cr] = 0;
+          l_upE = l_upC;
+        }
+
         // compute volume integral
         m_kernels->m_volInt.apply( m_starE[l_el],
                                    m_starA[l_el],
                                    m_srcA+l_el*std::size_t(TL_N_RMS),
                                    o_tDofsDg[0][l_el],
                                    l_tDofsA,
-                                   io_dofsE[l_el],
+                                   l_upE,
                                    l_dofsA,
                                    l_tmp );
 
@@ -423,16 +1577,39 @@ class edge::seismic::solvers::AderDg {
           */
         // reuse derivative buffer
         TL_T_REAL (*l_tmpFa)[N_QUANTITIES][N_FACE_MODES][N_CRUNS] = parallel::g_scratchMem->tResSurf;
+        // recompute the flux solvers if only their parameters are stored
+        TL_T_REAL l_fsE[TL_N_FAS][TL_N_ENS_FS_E];
+        TL_T_REAL l_fsA[TL_N_FAS][TL_N_ENS_FS_A];
+        if( m_fsPars != nullptr ) {
+          for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+            FluxSolvers< TL_T_EL >::recompute( m_fsPars[l_el][l_fa],
+                                               0,
+                                               l_fsE[l_fa],
+                                               (TL_N_RMS > 0) ? l_fsA[l_fa] : nullptr );
+          }
+        }
+
         // call kernel
-        m_kernels->m_surfInt.local( m_fsE[0][l_el],
-                                    m_fsA[0][l_el],
+        m_kernels->m_surfInt.local( (m_fsPars == nullptr) ? m_fsE[0][l_el] : l_fsE,
+                                    (m_fsPars == nullptr) ? m_fsA[0][l_el] : l_fsA,
                                     o_tDofsDg[0][l_el],
-                                    io_dofsE[l_el],
+                                    l_upE,
                                     l_dofsA,
                                     l_tmpFa,
                                     l_preDofs,
                                     l_preTint );
+
+        // add the update to the DOFs
+        if( TL_COMP ) addComp( l_upE, io_dofsE[l_el], m_dofsC[l_el] );
+      }
+
+      if( m_act != nullptr || m_nRunsOff > 0 ) {
+        m_nUpsQui[0] += i_nElements;
+        m_nUpsQui[2] += l_nQui;
       }
+
+      // face-projected DOFs of the send elements
+      haloProj( i_first, i_nElements, o_tDofsDg[0] );
     }
 
     /**
@@ -656,6 +1833,8 @@ class edge::seismic::solvers::AderDg {
      *
      * @param i_first first element considered.
      * @param i_nElements number of elements.
+     * @param i_dt time step.
+     * @param i_firstSub true if this is the first of two sub-steps w.r.t. to the next-higher time group (LTS).
      * @param i_firstLi first limited element.
      * @param i_firstLp first limited plus element.
      * @param i_firstEx first element computing extrema.
@@ -667,7 +1846,7 @@ class edge::seismic::solvers::AderDg {
      * @param i_elFaEl face-neighboring elements.
      * @param i_fIdElFaEl local face ids of face-neighboring elememts.
      * @param i_vIdElFaEl local vertex ids w.r.t. the shared face from the neighboring elements' perspsective.
-     * @param i_tDofsDg temporarary DG DOFs ([0]: time integrated, [1]: DOFs of previous time step).
+     * @param i_tDofsDg temporarary DG DOFs ([0]: time integrated, [1]: DOFs of previous time step, [2]: buffer of time integrated DOFs, [3]: time derivatives).
      * @param io_dofs DOFs which will be updated with neighboring elements' contribution.
      * @param io_admC will be updated with the admissibility of the candidate solution.
      * @param i_extP extreme of the previous solution.
@@ -681,6 +1860,8 @@ class edge::seismic::solvers::AderDg {
               typename TL_T_MM >
     void neigh( TL_T_LID                              i_first,
                 TL_T_LID                              i_nElements,
+                TL_T_REAL                             i_dt,
+                bool                                  i_firstSub,
                 TL_T_LID                              i_firstLi,
                 TL_T_LID                              i_firstLp,
                 TL_T_LID                              i_firstEx,
@@ -694,7 +1875,7 @@ class edge::seismic::solvers::AderDg {
                 TL_T_LID       const               (* i_elFaEl)[TL_N_FAS],
                 unsigned short const               (* i_fIdElFaEl)[TL_N_FAS],
                 unsigned short const               (* i_vIdElFaEl)[TL_N_FAS],
-                TL_T_REAL            (* const * const i_tDofsDg[2])[TL_N_MDS][TL_N_CRS],
+                TL_T_REAL            (* const * const i_tDofsDg[4])[TL_N_MDS][TL_N_CRS],
                 TL_T_REAL                          (* io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
                 TL_T_REAL                          (* io_dofsA)[TL_N_MDS][TL_N_CRS],
                 bool                               (* io_admC)[TL_N_CRS],
@@ -702,6 +1883,35 @@ class edge::seismic::solvers::AderDg {
                 TL_T_REAL                          (* o_extC)[2][TL_N_QTS_E][TL_N_CRS],
                 TL_T_REAL                        (* (*o_tDofsSc) [TL_N_FAS])[TL_N_QTS_E][TL_N_SFS][TL_N_CRS],
                 TL_T_MM        const                & i_mm ) const {
+#if defined(PP_T_KERNELS_SIMD)
+      // element-interleaved batches of single forward runs
+      if( TL_N_BAT > 1 ) {
+        neighBatch( i_first,
+                    i_nElements,
+                    i_dt,
+                    i_firstSub,
+                    i_firstLi,
+                    i_firstLp,
+                    i_firstEx,
+                    i_scatter,
+                    i_faChars,
+                    i_elChars,
+                    i_lpFaLp,
+                    i_elFa,
+                    i_elFaEl,
+                    i_fIdElFaEl,
+                    i_vIdElFaEl,
+                    i_tDofsDg,
+                    io_dofsE,
+                    io_dofsA,
+                    io_admC,
+                    i_extP,
+                    o_extC,
+                    i_mm );
+        return;
+      }
+#endif
+
       // counter for elements computing extrema
       TL_T_LID l_ex = i_firstEx;
 
@@ -714,8 +1924,20 @@ class edge::seismic::solvers::AderDg {
       // temporary product for three-way mult
       TL_T_REAL (*l_tmpFa)[N_QUANTITIES][N_FACE_MODES][N_CRUNS] = parallel::g_scratchMem->tResSurf;
 
+      // time integrated DOFs of neighbors in the next-higher time group (LTS)
+      TL_T_REAL (*l_tIntGt)[TL_N_MDS][TL_N_CRS] = parallel::g_scratchMem->tRes[1];
+
+      // number of skipped quiescent elements
+      TL_T_LID l_nQui = 0;
+
       // iterate over elements
       for( TL_T_LID l_el = i_first; l_el < i_first+i_nElements; l_el++ ) {
+        // true if all runs are deactivated, then all contributions are zero
+        bool l_off = (m_nRunsOff == TL_N_CRS);
+        // true if all runs of the element are inactive, then contributions of neighbors below the tolerance are skipped
+        bool l_qui = l_off || ( (m_act != nullptr) && isQui( l_el ) );
+        bool l_skip = l_qui;
+
         // anelastic updates (excluding frequency scaling)
         TL_T_REAL l_upA[TL_N_QTS_M][TL_N_MDS][TL_N_CRS];
         if( TL_N_RMS > 0) {
@@ -725,12 +1947,23 @@ class edge::seismic::solvers::AderDg {
                 l_upA[l_qt][l_md][l_cr] = 0;
         }
 
+        // elastic DOFs or, if accumulated through compensated summation, their update
+        TL_T_REAL l_upC[TL_N_QTS_E][TL_N_MDS][TL_N_CRS];
+        TL_T_REAL (*l_upE)[TL_N_MDS][TL_N_CRS] = io_dofsE[l_el];
+        if( TL_COMP ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                l_upC[l_qt][l_md][l_cr] = 0;
+          l_upE = l_upC;
+        }
+
         // add neighboring contribution
         for( TL_T_LID l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
           TL_T_LID l_faId = i_elFa[l_el][l_fa];
           TL_T_LID l_ne;
 
-          if( (i_faChars[l_faId].spType & OUTFLOW) != OUTFLOW ) {
+          if( !l_off && (i_faChars[l_faId].spType & OUTFLOW) != OUTFLOW ) {
             // derive neighbor
             if( (i_faChars[l_faId].spType & FREE_SURFACE) != FREE_SURFACE )
               l_ne = i_elFaEl[l_el][l_fa];
@@ -754,6 +1987,61 @@ class edge::seismic::solvers::AderDg {
             // default to element data to avoid performance penality
             else                                                 l_pre = io_dofsE[l_el];
 
+            // recompute the flux solvers if only their parameters are stored
+            TL_T_REAL l_fsE[TL_N_ENS_FS_E];
+            TL_T_REAL l_fsA[TL_N_ENS_FS_A];
+
+            /*
+             * face halo: the neighbor's rank provided the projection of its time integrated DOFs to the shared face
+             */
+            std::size_t l_haRe = std::numeric_limits< std::size_t >::max();
+            if( m_halo.reElFa != nullptr ) l_haRe = m_halo.reElFa[l_el][l_fa];
+
+            if( l_haRe != std::numeric_limits< std::size_t >::max() ) {
+              // skip contributions of the neighbor below the tolerance
+              if( l_qui && !updateActNe( l_el, i_dt, m_halo.fa[l_haRe] ) ) continue;
+              l_skip = false;
+
+              if( m_fsPars != nullptr ) {
+                FluxSolvers< TL_T_EL >::recompute( m_fsPars[l_el][l_fa],
+                                                   1,
+                                                   l_fsE,
+                                                   (TL_N_RMS > 0) ? l_fsA : nullptr );
+              }
+
+              m_kernels->m_surfInt.neighFa( l_fa,
+                                            (m_fsPars == nullptr) ? m_fsE[1][l_el][l_fa] : l_fsE,
+                                            (m_fsPars == nullptr) ? m_fsA[1][l_el][l_fa] : l_fsA,
+                                            m_halo.fa[l_haRe],
+                                            l_upE,
+                                            l_upA,
+                                            l_tmpFa,
+                                            l_pre );
+              continue;
+            }
+
+            /*
+             * LTS: time integrated DOFs of the neighbor
+             */
+            TL_T_REAL const (*l_tIntNe)[TL_N_MDS][TL_N_CRS] = i_tDofsDg[0][l_ne];
+            // neighbor in the next-lower time group: accumulated sub-steps
+            if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
+              l_tIntNe = i_tDofsDg[2][l_ne];
+            }
+            // neighbor in the next-higher time group: integrate the neighbor's time prediction over our sub-step
+            else if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_GT]) == C_LTS_AD[l_fa][AD_GT] ) {
+              TL_T_REAL l_t0 = (i_firstSub) ? 0 : i_dt;
+              m_kernels->m_time.integrateTimePrediction( l_t0,
+                                                         l_t0 + i_dt,
+                  (TL_T_REAL (*)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS]) i_tDofsDg[3][l_ne],
+                                                         l_tIntGt );
+              l_tIntNe = l_tIntGt;
+            }
+
+            // skip contributions of the neighbor below the tolerance
+            if( l_qui && !updateActNe( l_el, i_dt, l_tIntNe ) ) continue;
+            l_skip = false;
+
             /*
              * solve
              */
@@ -766,77 +2054,235 @@ class edge::seismic::solvers::AderDg {
               l_fId = i_fIdElFaEl[l_el][l_fa];
             }
 
+            if( m_fsPars != nullptr ) {
+              FluxSolvers< TL_T_EL >::recompute( m_fsPars[l_el][l_fa],
+                                                 1,
+                                                 l_fsE,
+                                                 (TL_N_RMS > 0) ? l_fsA : nullptr );
+            }
+
             m_kernels->m_surfInt.neigh( l_fa,
                                         l_vId,
                                         l_fId,
-                                        m_fsE[1][l_el][l_fa],
-                                        m_fsA[1][l_el][l_fa],
-                                        i_tDofsDg[0][l_ne],
-                                        io_dofsE[l_el],
+                                        (m_fsPars == nullptr) ? m_fsE[1][l_el][l_fa] : l_fsE,
+                                        (m_fsPars == nullptr) ? m_fsA[1][l_el][l_fa] : l_fsA,
+                                        l_tIntNe,
+                                        l_upE,
                                         l_upA,
                                         l_tmpFa,
                                         l_pre );
           }
         }
 
-        // update anelastic DOFs
-        if( TL_N_RMS > 0 ) {
-          TL_T_REAL (*l_dofsA)[TL_N_QTS_M][TL_N_MDS][TL_N_CRS] =
-            (TL_T_REAL (*) [TL_N_QTS_M][TL_N_MDS][TL_N_CRS]) (io_dofsA+l_el*std::size_t(TL_N_RMS)*std::size_t(TL_N_QTS_M));
+        // add the update to the DOFs
+        if( TL_COMP ) addComp( l_upE, io_dofsE[l_el], m_dofsC[l_el] );
+        if( l_skip ) l_nQui++;
+
+        // scatter anelastic update and compute extrema
+        neighFinish( l_el,
+                     l_upA,
+                     i_scatter,
+                     i_elChars,
+                     i_lpFaLp,
+                     io_dofsE,
+                     io_dofsA,
+                     io_admC,
+                     i_extP,
+                     o_extC,
+                     i_mm,
+                     l_ex,
+                     l_lp,
+                     l_li );
+      }
 
-          m_kernels->m_surfInt.scatterUpdateA( l_upA, l_dofsA );
-        }
+      if( m_act != nullptr || m_nRunsOff > 0 ) {
+        m_nUpsQui[1] += i_nElements;
+        m_nUpsQui[3] += l_nQui;
+      }
+    }
 
-        // compute extrema (if required)
-        if( (i_elChars[l_el].spType & EXTREMA) != EXTREMA ) {}
-        else {
-          //! TODO: Use dedicated scratch memory for this
-          TL_T_REAL (*l_sg)[TL_N_SCS][TL_N_CRS] = parallel::g_scratchMem->sg;
-
-          // compute DG extrema
-          edge::sc::Kernels< TL_T_EL,
-                             TL_O_SP,
-                             TL_N_QTS_E,
-                             TL_N_CRS >::dgExtrema(  i_mm,
-                                                     io_dofsE[l_el],
-                                                     i_scatter,
-                                                     l_sg,
-                                                     o_extC[l_ex][0],
-                                                     o_extC[l_ex][1] );
-
-          // store the surface sub-cells
-          if( ( i_elChars[l_el].spType & LIMIT_PLUS ) == LIMIT_PLUS ) {
-            // set admissibility
-            if( ( i_elChars[l_el].spType & LIMIT ) == LIMIT ) {
-              if( ( i_elChars[l_el].spType & RUPTURE ) != RUPTURE ) {
-                bool l_adm[TL_N_CRS];
-                edge::sc::Detections< TL_T_EL,
-                                      TL_N_QTS_E,
-                                      TL_N_CRS >::dmpFa( i_extP[l_ex],
-                                                         i_extP,
-                                                         o_extC[l_ex],
-                                                         i_lpFaLp[l_lp],
-                                                         l_adm );
-
-                // update admissibility
-#pragma omp simd
-                for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
-                  // only write "false" to memory, not "true" (avoids conflicts with rupture-admissibility in shared memory parallelization)
-                  if( l_adm[l_cr] == false )
-                    io_admC[l_li][l_cr] = false;
-                }
-              }
+    /**
+     * Gets the work-weights of the elements, which grow with the set of active elements.
+     *
+     * @return work-weights of the elements, nullptr if quiescent elements are computed.
+     **/
+    float const * getWgts() const {
+      return m_wgts;
+    }
 
-              // increase counter of limited elements
-              l_li++;
-            }
-            // increase counter of limited plus elements
-            l_lp++;
-          }
+    /**
+     * Initializes the face halo: instead of their full time integrated DOFs, the send elements provide the projections to their faces at the MPI-boundary.
+     * Within each send-/receive-region the entries are ordered by the index of the send element and then by the index of the adjacent receive element.
+     * The adjacent rank enumerates the same pairs with swapped roles (receive element, send element) and thus derives the same order without communication.
+     * Only the vertex ids of the shared faces are unknown to the sending rank; these have to be communicated once before the first exchange (see setHaloFaVIds).
+     *
+     * @param i_enLayout entity layout of the elements, a single time group (GTS) is supported.
+     * @param i_elFaEl face-neighboring elements.
+     * @param i_vIdElFaEl local vertex ids w.r.t. the shared face from the neighboring elements' perspective.
+     * @param o_rgnsSe will be set to the send entries of the send-regions.
+     * @param o_rgnsRe will be set to the receive entries of the receive-regions.
+     * @param o_vIdsRe will be set to the vertex ids of the receive entries, which the adjacent ranks require for the projections.
+     * @param io_dynMem dynamic memory allocations.
+     * @param o_halo will be set to the face halo.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     **/
+    template< typename TL_T_LID >
+    static void initHaloFa( t_enLayout                      const & i_enLayout,
+                            TL_T_LID                        const (*i_elFaEl)[TL_N_FAS],
+                            unsigned short                  const (*i_vIdElFaEl)[TL_N_FAS],
+                            std::vector< t_timeRegion >           & o_rgnsSe,
+                            std::vector< t_timeRegion >           & o_rgnsRe,
+                            std::vector< unsigned short >         & o_vIdsRe,
+                            data::Dynamic                         & io_dynMem,
+                            t_haloFa                              & o_halo ) {
+      EDGE_CHECK_EQ( i_enLayout.timeGroups.size(), 1 ) << "the face halo is GTS-only";
+      t_timeGroup const & l_tg = i_enLayout.timeGroups[0];
+      std::size_t l_nEls = i_enLayout.nEnts;
+
+      // pairs of the regions: [0]: first sort key, [1]: second sort key, [2]: owned element, [3]: face
+      std::vector< std::array< std::size_t, 4 > > l_pairs[2];
+
+      o_rgnsSe.resize( l_tg.send.size() );
+      o_rgnsRe.resize( l_tg.send.size() );
+
+      for( std::size_t l_rg = 0; l_rg < l_tg.send.size(); l_rg++ ) {
+        std::size_t l_first[2] = { l_pairs[0].size(), l_pairs[1].size() };
+
+        for( std::size_t l_se = 0; l_se < std::size_t(l_tg.send[l_rg].size); l_se++ ) {
+          TL_T_LID l_el = l_tg.send[l_rg].first + l_se;
 
-          // increase counter of extrema elements
-          l_ex++;
+          for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+            TL_T_LID l_ne = i_elFaEl[l_el][l_fa];
+            if(    l_ne == std::numeric_limits< TL_T_LID >::max()
+                || l_ne <  l_tg.receive[l_rg].first
+                || l_ne >= l_tg.receive[l_rg].first + l_tg.receive[l_rg].size ) continue;
+            std::size_t l_re = l_ne - l_tg.receive[l_rg].first;
+
+            // send: ordered by our send element, receive: ordered by the adjacent rank's send element
+            l_pairs[0].push_back( { l_se, l_re, std::size_t(l_el), l_fa } );
+            l_pairs[1].push_back( { l_re, l_se, std::size_t(l_el), l_fa } );
+          }
         }
+
+        for( unsigned short l_sr = 0; l_sr < 2; l_sr++ )
+          std::sort( l_pairs[l_sr].begin() + l_first[l_sr], l_pairs[l_sr].end() );
+
+        o_rgnsSe[l_rg].first = l_first[0];
+        o_rgnsSe[l_rg].size  = l_pairs[0].size() - l_first[0];
+        o_rgnsRe[l_rg].first = l_first[1];
+        o_rgnsRe[l_rg].size  = l_pairs[1].size() - l_first[1];
+      }
+
+      // allocate the memory of the face halo
+      o_halo.nSe = l_pairs[0].size();
+      std::size_t l_nEns = o_halo.nSe + l_pairs[1].size();
+
+      o_halo.fa = ( TL_T_REAL (*)[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) io_dynMem.allocate( CE_MAX( l_nEns, std::size_t(1) ) * TL_N_QTS_E * TL_N_MDS_FA * TL_N_CRS * sizeof(TL_T_REAL),
+                                                                                       ALIGNMENT.BASE.HEAP,
+                                                                                       false,
+                                                                                       true );
+      o_halo.seEl = (std::size_t *) io_dynMem.allocate( (l_nEls+1) * sizeof(std::size_t),
+                                                     ALIGNMENT.BASE.HEAP,
+                                                     false,
+                                                     true );
+      o_halo.seFa = ( unsigned short (*)[2] ) io_dynMem.allocate( CE_MAX( o_halo.nSe, std::size_t(1) ) * 2 * sizeof(unsigned short),
+                                                               ALIGNMENT.BASE.HEAP,
+                                                               false,
+                                                               true );
+      o_halo.reElFa = ( std::size_t (*)[TL_N_FAS] ) io_dynMem.allocate( CE_MAX( l_nEls, std::size_t(1) ) * TL_N_FAS * sizeof(std::size_t),
+                                                                     ALIGNMENT.BASE.HEAP,
+                                                                     false,
+                                                                     true );
+
+      TL_T_REAL *l_fa = o_halo.fa[0][0][0];
+      for( std::size_t l_en = 0; l_en < l_nEns * TL_N_QTS_E * TL_N_MDS_FA * TL_N_CRS; l_en++ ) l_fa[l_en] = 0;
+
+      // send entries, the send elements are contiguous since the regions are sorted by element
+      for( std::size_t l_el = 0; l_el < l_nEls+1; l_el++ ) o_halo.seEl[l_el] = 0;
+      for( std::size_t l_en = 0; l_en < o_halo.nSe; l_en++ ) {
+        EDGE_CHECK( l_en == 0 || l_pairs[0][l_en][2] >= l_pairs[0][l_en-1][2] );
+        o_halo.seEl[ l_pairs[0][l_en][2]+1 ]++;
+        o_halo.seFa[l_en][0] = l_pairs[0][l_en][3];
+        o_halo.seFa[l_en][1] = std::numeric_limits< unsigned short >::max();
+      }
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) o_halo.seEl[l_el+1] += o_halo.seEl[l_el];
+
+      // receive entries
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ )
+        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ )
+          o_halo.reElFa[l_el][l_fa] = std::numeric_limits< std::size_t >::max();
+
+      o_vIdsRe.resize( l_pairs[1].size() );
+      for( std::size_t l_en = 0; l_en < l_pairs[1].size(); l_en++ ) {
+        std::size_t l_el = l_pairs[1][l_en][2];
+        unsigned short l_fa = l_pairs[1][l_en][3];
+        o_halo.reElFa[l_el][l_fa] = o_halo.nSe + l_en;
+        o_vIdsRe[l_en] = i_vIdElFaEl[l_el][l_fa];
+      }
+    }
+
+    /**
+     * Sets the vertex ids of the send entries in the face halo, as provided by the adjacent ranks.
+     *
+     * @param i_vIdsSe vertex ids of the send entries w.r.t. the shared faces from the sending elements' perspective.
+     * @param io_halo face halo, which is updated.
+     **/
+    static void setHaloFaVIds( unsigned short const * i_vIdsSe,
+                               t_haloFa             & io_halo ) {
+      for( std::size_t l_en = 0; l_en < io_halo.nSe; l_en++ ) io_halo.seFa[l_en][1] = i_vIdsSe[l_en];
+    }
+
+    /**
+     * Sets the face halo, used in the local step (send elements) and the neighboring updates (receive entries).
+     *
+     * @param i_halo face halo.
+     **/
+    void setHaloFa( t_haloFa const & i_halo ) {
+      m_halo = i_halo;
+    }
+
+    /**
+     * Activates or deactivates a fused run, e.g., once it converged, finished or is not of interest.
+     * The DOFs of a deactivated run remain unchanged: its time integrated DOFs are masked to zero, such that all of its
+     * volume and surface contributions vanish; point sources and rupture physics are not masked.
+     * Elements whose active runs are all deactivated are skipped as quiescent, all elements are skipped once all runs are deactivated.
+     *
+     * @param i_cr fused run.
+     * @param i_act true if the run is activated, false if deactivated.
+     **/
+    void setRunAct( unsigned short i_cr,
+                    bool           i_act ) {
+      EDGE_CHECK_LT( i_cr, TL_N_CRS ) << "run does not exist";
+      EDGE_CHECK_GT( TL_N_CRS, 1 ) << "deactivation of runs requires fused runs";
+
+      if( m_runAct[i_cr] != i_act ) {
+        m_runAct[i_cr] = i_act;
+        m_nRunsOff = (i_act) ? m_nRunsOff - 1 : m_nRunsOff + 1;
+      }
+    }
+
+    /**
+     * Gets the activity of a fused run.
+     *
+     * @param i_cr fused run.
+     * @return true if the run is active, false if deactivated.
+     **/
+    bool getRunAct( unsigned short i_cr ) const {
+      return m_runAct[i_cr];
+    }
+
+    /**
+     * Gets the statistics of skipping quiescent elements.
+     *
+     * @param o_nUps will be set to the number of element updates, [0]: local, [1]: neigh.
+     * @param o_nSkip will be set to the number of skipped element updates, [0]: local, [1]: neigh.
+     **/
+    void getQuiStats( std::size_t o_nUps[2],
+                      std::size_t o_nSkip[2] ) const {
+      for( unsigned short l_st = 0; l_st < 2; l_st++ ) {
+        o_nUps[l_st]  = m_nUpsQui[l_st];
+        o_nSkip[l_st] = m_nUpsQui[2+l_st];
       }
     }
 };
@@ -0,0 +1,512 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the ADER-DG solver.
+ **/
+#include <catch.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#define private public
+#include "data/Internal.hpp"
+#include "AderDg.hpp"
+#include "../Bench.hpp"
+#undef private
+
+typedef edge::seismic::solvers::AderDg< real_base,
+                                        N_RELAXATION_MECHANISMS,
+                                        T_SDISC.ELEMENT,
+                                        ORDER,
+                                        ORDER,
+                                        N_CRUNS,
+                                        MM_KERNELS_SPARSE > t_aderDg;
+
+// compensated accumulation is compared to plain accumulation in FP32
+#if PP_PRECISION == 32
+TEST_CASE( "ADER-DG: Compensated accumulation of DOF updates.", "[AderDg][addComp]" ) {
+  static unsigned short const l_nQts = t_aderDg::TL_N_QTS_E;
+  static unsigned short const l_nMds = t_aderDg::TL_N_MDS;
+  static unsigned short const l_nCrs = N_CRUNS;
+
+  // DOFs of plain and compensated accumulation, compensation and reference
+  real_base l_dofsP[l_nQts][l_nMds][l_nCrs];
+  real_base l_dofsC[l_nQts][l_nMds][l_nCrs];
+  real_base l_comp[l_nQts][l_nMds][l_nCrs];
+  double    l_ref[l_nQts][l_nMds][l_nCrs];
+
+  for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+    for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+      for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ ) {
+        l_dofsP[l_qt][l_md][l_cr] = real_base(1) + real_base(l_qt) / 8 + real_base(l_md) / 64;
+        l_dofsC[l_qt][l_md][l_cr] = l_dofsP[l_qt][l_md][l_cr];
+        l_comp[l_qt][l_md][l_cr]  = 0;
+        l_ref[l_qt][l_md][l_cr]   = l_dofsP[l_qt][l_md][l_cr];
+      }
+
+  // many small updates, as obtained by small time steps
+  std::mt19937 l_gen( 2323 );
+  std::uniform_real_distribution< real_base > l_dist( -1.0E-4, 1.0E-3 );
+  real_base l_up[l_nQts][l_nMds][l_nCrs];
+
+  for( unsigned int l_ts = 0; l_ts < 20000; l_ts++ ) {
+    for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+      for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+        for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ ) {
+          l_up[l_qt][l_md][l_cr] = l_dist( l_gen );
+          l_dofsP[l_qt][l_md][l_cr] += l_up[l_qt][l_md][l_cr];
+          l_ref[l_qt][l_md][l_cr]   += l_up[l_qt][l_md][l_cr];
+        }
+
+    t_aderDg::addComp( l_up, l_dofsC, l_comp );
+  }
+
+  // maximum errors of the plain and compensated DOFs, and of the compensation applied in double precision
+  double l_errP = 0;
+  double l_errC = 0;
+  double l_errD = 0;
+  for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+    for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+      for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ ) {
+        double l_ref0 = l_ref[l_qt][l_md][l_cr];
+        l_errP = std::max( l_errP, std::abs( l_dofsP[l_qt][l_md][l_cr] - l_ref0 ) / l_ref0 );
+        l_errC = std::max( l_errC, std::abs( l_dofsC[l_qt][l_md][l_cr] - l_ref0 ) / l_ref0 );
+        l_errD = std::max( l_errD, std::abs( double(l_dofsC[l_qt][l_md][l_cr]) - l_comp[l_qt][l_md][l_cr] - l_ref0 ) / l_ref0 );
+      }
+
+  double l_eps = std::numeric_limits< real_base >::epsilon();
+
+  // the compensated DOFs are within rounding of the exact sums, applying the compensation in double precision recovers more digits
+  REQUIRE( l_errC <= l_eps );
+  REQUIRE( l_errD < l_errC / 10 );
+
+  // plain accumulation in 32-bit precision drifts by orders of magnitude more
+  REQUIRE( l_errP > 50 * l_errC );
+}
+#endif
+
+TEST_CASE( "ADER-DG: Evaluation of the compensated time prediction.", "[AderDg][evalTimePredComp]" ) {
+  static unsigned short const l_nQts = t_aderDg::TL_N_QTS_E;
+  static unsigned short const l_nMds = t_aderDg::TL_N_MDS;
+  static unsigned short const l_nCrs = N_CRUNS;
+  static unsigned short const l_oTi  = ORDER;
+
+  real_base l_der[l_oTi][l_nQts][l_nMds][l_nCrs];
+  real_base l_comp[l_nQts][l_nMds][l_nCrs];
+  real_base l_pre[1][l_nQts][l_nMds][l_nCrs];
+  double    l_preC[l_nQts][l_nMds][l_nCrs];
+
+  for( unsigned short l_de = 0; l_de < l_oTi; l_de++ )
+    for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+      for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+        for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ ) {
+          l_der[l_de][l_qt][l_md][l_cr] = real_base(1) / (1 + l_de + l_qt + l_md + l_cr);
+          if( l_de == 0 ) l_comp[l_qt][l_md][l_cr] = real_base(1.0E-9) * (l_qt+1);
+        }
+
+  // without compensation, the evaluation matches the one of the kernels
+  real_base l_pt = real_base(0.25);
+  edge::seismic::kernels::TimePred< real_base,
+                                    N_RELAXATION_MECHANISMS,
+                                    T_SDISC.ELEMENT,
+                                    ORDER,
+                                    ORDER,
+                                    N_CRUNS >::evalTimePrediction( 1, &l_pt, l_der, l_pre );
+
+  real_base l_zero[l_nQts][l_nMds][l_nCrs] = {};
+  t_aderDg::evalTimePredComp( l_pt, l_der, l_zero, l_preC );
+
+  for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+    for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+      for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ )
+        REQUIRE( l_preC[l_qt][l_md][l_cr] == Approx( l_pre[0][l_qt][l_md][l_cr] ) );
+
+  // the compensation is subtracted from the zeroth derivative
+  double l_preNoComp = l_preC[0][0][0];
+  t_aderDg::evalTimePredComp( l_pt, l_der, l_comp, l_preC );
+  REQUIRE( l_preNoComp - l_preC[0][0][0] == Approx( double(l_comp[0][0][0]) ) );
+}
+
+typedef edge::seismic::Bench< real_base,
+                              N_RELAXATION_MECHANISMS,
+                              T_SDISC.ELEMENT,
+                              ORDER,
+                              ORDER,
+                              N_CRUNS > t_bench;
+
+/**
+ * Runs time steps on the synthetic batch of the benchmarks.
+ *
+ * @param i_bench synthetic batch.
+ * @param i_skipQui true if quiescent elements are skipped.
+ * @param i_runsOff runs which are deactivated.
+ * @param i_mm matrix kernels.
+ * @param io_dofsE elastic DOFs, initial ones as input, final ones as output.
+ * @param o_nUps will be set to the number of element updates, [0]: local, [1]: neigh.
+ * @param o_nSkip will be set to the number of skipped element updates, [0]: local, [1]: neigh.
+ *
+ * @paramt TL_T_MM type of the matrix kernels.
+ **/
+template< typename TL_T_MM >
+static void runBench( t_bench                     const & i_bench,
+                      bool                                i_skipQui,
+                      std::vector< unsigned short > const & i_runsOff,
+                      TL_T_MM                     const & i_mm,
+                      std::vector< real_base >          & io_dofsE,
+                      std::size_t                         o_nUps[2],
+                      std::size_t                         o_nSkip[2] ) {
+  static unsigned short const l_nQts = t_aderDg::TL_N_QTS_E;
+  static unsigned short const l_nMds = t_aderDg::TL_N_MDS;
+  static unsigned short const l_nCrs = N_CRUNS;
+  static unsigned short const l_nFas = t_aderDg::TL_N_FAS;
+  int_el l_nEls = i_bench.getNEls();
+
+  edge::data::Dynamic l_dynMem;
+  std::vector< t_bgPars > l_bgPars = i_bench.m_bgPars;
+  t_aderDg l_aderDg( l_nEls,
+                     i_bench.m_nFas,
+                     (int_el const (*)[2]) i_bench.m_faEl.data(),
+                     (int_el const (*)[t_bench::TL_N_VES_EL]) i_bench.m_elVe.data(),
+                     (int_el const (*)[l_nFas]) i_bench.m_elFa.data(),
+                     i_bench.m_elMeDa.data(),
+                     i_bench.m_elMeDa.data(),
+                     i_bench.m_veChars.data(),
+                     i_bench.m_faChars.data(),
+                     i_bench.m_elChars.data(),
+                     l_bgPars.data(),
+                     5.0,
+                     100.0,
+                     l_dynMem,
+                     nullptr,
+                     false,
+                     i_skipQui,
+                     0 );
+  for( std::size_t l_ru = 0; l_ru < i_runsOff.size(); l_ru++ ) l_aderDg.setRunAct( i_runsOff[l_ru], false );
+
+  // time integrated DOFs, the synthetic batch has no LTS buffers
+  std::vector< real_base > l_tDofs( std::size_t(l_nEls) * l_nQts * l_nMds * l_nCrs, 0 );
+  std::vector< real_base (*)[l_nMds][l_nCrs] > l_tDofsPtrs( l_nEls );
+  for( int_el l_el = 0; l_el < l_nEls; l_el++ )
+    l_tDofsPtrs[l_el] = (real_base (*)[l_nMds][l_nCrs]) ( l_tDofs.data() + std::size_t(l_el) * l_nQts * l_nMds * l_nCrs );
+  real_base (**l_tDofsDg[4])[l_nMds][l_nCrs] = { l_tDofsPtrs.data(), l_tDofsPtrs.data(), l_tDofsPtrs.data(), l_tDofsPtrs.data() };
+
+  std::vector< real_base > l_dofsA( std::size_t(l_nEls) * N_RELAXATION_MECHANISMS * t_aderDg::TL_N_QTS_M * l_nMds * l_nCrs + 1, 0 );
+  edge::io::Receivers l_recvs;
+
+  for( unsigned short l_st = 0; l_st < 6; l_st++ ) {
+    l_aderDg.local( int_el(0),
+                    l_nEls,
+                    0.0,
+                    real_base(1.0E-4),
+                    true,
+                    int_el(0),
+                    i_bench.m_elChars.data(),
+                    (real_base (*)[l_nQts][l_nMds][l_nCrs]) io_dofsE.data(),
+                    (real_base (*)[l_nMds][l_nCrs]) l_dofsA.data(),
+                    l_tDofsDg,
+                    l_recvs );
+
+    l_aderDg.neigh( int_el(0),
+                    l_nEls,
+                    real_base(1.0E-4),
+                    true,
+                    int_el(0),
+                    int_el(0),
+                    int_el(0),
+                    nullptr,
+                    i_bench.m_faChars.data(),
+                    i_bench.m_elChars.data(),
+                    nullptr,
+                    nullptr,
+                    (int_el const (*)[l_nFas]) nullptr,
+                    (int_el const (*)[l_nFas]) i_bench.m_elFa.data(),
+                    (int_el const (*)[l_nFas]) i_bench.m_elFaEl.data(),
+                    (unsigned short const (*)[l_nFas]) i_bench.m_fIdElFaEl.data(),
+                    (unsigned short const (*)[l_nFas]) i_bench.m_vIdElFaEl.data(),
+                    l_tDofsDg,
+                    (real_base (*)[l_nQts][l_nMds][l_nCrs]) io_dofsE.data(),
+                    (real_base (*)[l_nMds][l_nCrs]) l_dofsA.data(),
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    i_mm );
+  }
+
+  l_aderDg.getQuiStats( o_nUps, o_nSkip );
+}
+
+TEST_CASE( "ADER-DG: Skipping of quiescent elements and deactivated runs.", "[AderDg][skip]" ) {
+  static unsigned short const l_nQts = t_aderDg::TL_N_QTS_E;
+  static unsigned short const l_nMds = t_aderDg::TL_N_MDS;
+  static unsigned short const l_nCrs = N_CRUNS;
+
+  edge::data::Internal l_internal;
+  l_internal.initScratch();
+
+  t_bench l_bench( 256, 1 );
+  std::size_t l_nEls = l_bench.getNEls();
+
+  // initial DOFs: non-zero in a single element, scaled per run
+  std::vector< real_base > l_dofs0( l_nEls * l_nQts * l_nMds * l_nCrs, 0 );
+  for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+    for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+      for( unsigned short l_cr = 0; l_cr < l_nCrs; l_cr++ )
+        l_dofs0[ ( (5*l_nQts + l_qt) * l_nMds + l_md ) * l_nCrs + l_cr ] = real_base(0.1) * (l_qt+1) * (l_cr+1) + real_base(0.01) * l_md;
+
+  std::size_t l_nUps[2], l_nSkip[2];
+
+  // reference: all elements and runs are computed
+  std::vector< real_base > l_dofsRef = l_dofs0;
+  std::vector< unsigned short > l_runsOff;
+  runBench( l_bench, false, l_runsOff, l_internal.m_mm, l_dofsRef, l_nUps, l_nSkip );
+
+  // skipping quiescent elements yields the same DOFs
+  std::vector< real_base > l_dofs = l_dofs0;
+  runBench( l_bench, true, l_runsOff, l_internal.m_mm, l_dofs, l_nUps, l_nSkip );
+  REQUIRE( l_dofs == l_dofsRef );
+  REQUIRE( l_nUps[0] == 6 * l_nEls );
+  REQUIRE( l_nSkip[0] > l_nEls );
+  REQUIRE( l_nSkip[1] > l_nEls );
+
+  // the DOFs of a deactivated run remain unchanged, the other runs are not affected
+  if( l_nCrs > 1 ) {
+    l_runsOff.push_back( 0 );
+    std::vector< real_base > l_dofsOff = l_dofsRef;
+    for( std::size_t l_en = 0; l_en < l_dofs0.size(); l_en += l_nCrs ) l_dofsOff[l_en] = l_dofs0[l_en];
+
+    for( unsigned short l_sq = 0; l_sq < 2; l_sq++ ) {
+      l_dofs = l_dofs0;
+      runBench( l_bench, l_sq == 1, l_runsOff, l_internal.m_mm, l_dofs, l_nUps, l_nSkip );
+      REQUIRE( l_dofs == l_dofsOff );
+    }
+
+    // deactivating all active runs skips all elements
+    std::vector< real_base > l_dofsRun( l_dofs0.size(), 0 );
+    for( std::size_t l_en = 0; l_en < l_dofs0.size(); l_en += l_nCrs ) l_dofsRun[l_en] = l_dofs0[l_en];
+
+    l_dofs = l_dofsRun;
+    runBench( l_bench, true, l_runsOff, l_internal.m_mm, l_dofs, l_nUps, l_nSkip );
+    REQUIRE( l_dofs == l_dofsRun );
+    REQUIRE( l_nSkip[0] == l_nUps[0] );
+    REQUIRE( l_nSkip[1] == l_nUps[1] );
+  }
+
+  l_internal.finalize();
+}
+
+TEST_CASE( "ADER-DG: Face halo compared to the element halo.", "[AderDg][haloFa]" ) {
+  static unsigned short const l_nQts = t_aderDg::TL_N_QTS_E;
+  static unsigned short const l_nMds = t_aderDg::TL_N_MDS;
+  static unsigned short const l_nCrs = N_CRUNS;
+  static unsigned short const l_nFas = t_aderDg::TL_N_FAS;
+  static std::size_t    const l_nEnsEl = std::size_t(l_nQts) * l_nMds * l_nCrs;
+  static std::size_t    const l_nEnsFa = std::size_t(l_nQts) * t_aderDg::TL_N_MDS_FA * l_nCrs;
+
+  edge::data::Internal l_internal;
+  l_internal.initScratch();
+
+  // smallest synthetic batch: the last face connects the two halves [0, l_nHa) and [l_nHa, 2*l_nHa)
+  t_bench l_bench( 1, 1 );
+  int_el l_nEls = l_bench.getNEls();
+  int_el l_nHa = l_nEls / 2;
+  REQUIRE( l_nHa == (int_el(1) << (l_nFas-1)) );
+
+  int_el         const (*l_elFaEl)[l_nFas]   = (int_el         const (*)[l_nFas]) l_bench.m_elFaEl.data();
+  unsigned short const (*l_vIdElFaEl)[l_nFas] = (unsigned short const (*)[l_nFas]) l_bench.m_vIdElFaEl.data();
+
+  // initial DOFs of all elements and runs
+  std::vector< real_base > l_dofs0( std::size_t(l_nEls) * l_nEnsEl, 0 );
+  for( std::size_t l_en = 0; l_en < l_dofs0.size(); l_en++ )
+    l_dofs0[l_en] = real_base(0.1) * ( (l_en * 7) % 13 ) - real_base(0.5);
+
+  for( unsigned short l_sq = 0; l_sq < 2; l_sq++ ) {
+    // reference: element halo, all time integrated DOFs are available
+    std::vector< real_base > l_dofsRef = l_dofs0;
+    std::vector< unsigned short > l_runsOff;
+    std::size_t l_nUps[2], l_nSkip[2];
+    runBench( l_bench, l_sq == 1, l_runsOff, l_internal.m_mm, l_dofsRef, l_nUps, l_nSkip );
+
+    // emulated ranks: rank 0 owns the first half and receives the second, rank 1 vice versa
+    edge::data::Dynamic l_dynMem;
+    t_enLayout l_enLayouts[2];
+    std::vector< t_timeRegion > l_rgns[2][2];
+    std::vector< unsigned short > l_vIdsRe[2];
+    t_aderDg::t_haloFa l_halos[2];
+
+    for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+      l_enLayouts[l_ra].nEnts = l_nEls;
+      l_enLayouts[l_ra].timeGroups.resize( 1 );
+      t_timeGroup & l_tg = l_enLayouts[l_ra].timeGroups[0];
+      l_tg.nEntsOwn    = l_nHa;
+      l_tg.nEntsNotOwn = l_nHa;
+      l_tg.inner.first = 0;
+      l_tg.inner.size  = 0;
+      l_tg.send.resize( 1 );
+      l_tg.send[0].first = l_ra * l_nHa;
+      l_tg.send[0].size  = l_nHa;
+      l_tg.receive.resize( 1 );
+      l_tg.receive[0].first = (1-l_ra) * l_nHa;
+      l_tg.receive[0].size  = l_nHa;
+      l_tg.neRanks.push_back( 1-l_ra );
+      l_tg.neTgs.push_back( 0 );
+
+      t_aderDg::initHaloFa( l_enLayouts[l_ra],
+                            l_elFaEl,
+                            l_vIdElFaEl,
+                            l_rgns[l_ra][0],
+                            l_rgns[l_ra][1],
+                            l_vIdsRe[l_ra],
+                            l_dynMem,
+                            l_halos[l_ra] );
+
+      // every element of the half has a single face at the boundary
+      REQUIRE( l_halos[l_ra].nSe == std::size_t(l_nHa) );
+      REQUIRE( l_rgns[l_ra][0].size() == 1 );
+      REQUIRE( l_rgns[l_ra][0][0].size == l_nHa );
+      REQUIRE( l_rgns[l_ra][1][0].size == l_nHa );
+      REQUIRE( l_vIdsRe[l_ra].size() == std::size_t(l_nHa) );
+    }
+
+    // the adjacent rank derives the same order of the entries, both ranks enumerate the faces consistently
+    for( unsigned short l_ra = 0; l_ra < 2; l_ra++ )
+      t_aderDg::setHaloFaVIds( l_vIdsRe[1-l_ra].data(), l_halos[l_ra] );
+
+    for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+      for( int_el l_el = 0; l_el < l_nEls; l_el++ ) {
+        bool l_se = l_el >= l_ra * l_nHa && l_el < (l_ra+1) * l_nHa;
+        REQUIRE( l_halos[l_ra].seEl[l_el+1] - l_halos[l_ra].seEl[l_el] == (l_se ? 1u : 0u) );
+
+        for( unsigned short l_fa = 0; l_fa < l_nFas; l_fa++ ) {
+          std::size_t l_re = l_halos[l_ra].reElFa[l_el][l_fa];
+          if( !l_se || l_fa != l_nFas-1 ) {
+            REQUIRE( l_re == std::numeric_limits< std::size_t >::max() );
+            continue;
+          }
+          int_el l_ne = l_elFaEl[l_el][l_fa];
+          std::size_t l_enSe = l_re - l_halos[l_ra].nSe;
+          REQUIRE( l_halos[1-l_ra].seEl[l_ne] == l_enSe );
+          REQUIRE( l_halos[1-l_ra].seFa[l_enSe][0] == l_bench.m_fIdElFaEl[ std::size_t(l_el)*l_nFas + l_fa ] );
+          REQUIRE( l_halos[1-l_ra].seFa[l_enSe][1] == l_vIdElFaEl[l_el][l_fa] );
+        }
+      }
+    }
+
+    // per rank: solver, DOFs and time integrated DOFs; the receive elements' time integrated DOFs must not be used
+    // the background parameters are per rank as well, since anelastic solvers replace the phase parameters
+    std::vector< t_bgPars > l_bgPars[2] = { l_bench.m_bgPars, l_bench.m_bgPars };
+    std::vector< real_base > l_dofs[2] = { l_dofs0, l_dofs0 };
+    std::vector< real_base > l_dofsA[2];
+    std::vector< real_base > l_tDofs[2];
+    std::vector< real_base (*)[l_nMds][l_nCrs] > l_tDofsPtrs[2];
+    t_aderDg *l_aderDgs[2];
+
+    for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+      l_aderDgs[l_ra] = new t_aderDg( l_nEls,
+                                      l_bench.m_nFas,
+                                      (int_el const (*)[2]) l_bench.m_faEl.data(),
+                                      (int_el const (*)[t_bench::TL_N_VES_EL]) l_bench.m_elVe.data(),
+                                      (int_el const (*)[l_nFas]) l_bench.m_elFa.data(),
+                                      l_bench.m_elMeDa.data(),
+                                      l_bench.m_elMeDa.data(),
+                                      l_bench.m_veChars.data(),
+                                      l_bench.m_faChars.data(),
+                                      l_bench.m_elChars.data(),
+                                      l_bgPars[l_ra].data(),
+                                      5.0,
+                                      100.0,
+                                      l_dynMem,
+                                      nullptr,
+                                      false,
+                                      l_sq == 1,
+                                      0 );
+      l_aderDgs[l_ra]->setHaloFa( l_halos[l_ra] );
+
+      l_dofsA[l_ra].resize( std::size_t(l_nEls) * N_RELAXATION_MECHANISMS * t_aderDg::TL_N_QTS_M * l_nMds * l_nCrs + 1, 0 );
+      l_tDofs[l_ra].resize( std::size_t(l_nEls) * l_nEnsEl, real_base(1.0E3) );
+      l_tDofsPtrs[l_ra].resize( l_nEls );
+      for( int_el l_el = 0; l_el < l_nEls; l_el++ )
+        l_tDofsPtrs[l_ra][l_el] = (real_base (*)[l_nMds][l_nCrs]) ( l_tDofs[l_ra].data() + std::size_t(l_el) * l_nEnsEl );
+    }
+
+    edge::io::Receivers l_recvs;
+    for( unsigned short l_st = 0; l_st < 6; l_st++ ) {
+      for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+        real_base (**l_tDofsDg[4])[l_nMds][l_nCrs] = { l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data() };
+        l_aderDgs[l_ra]->local( l_ra * l_nHa,
+                                l_nHa,
+                                0.0,
+                                real_base(1.0E-4),
+                                true,
+                                int_el(0),
+                                l_bench.m_elChars.data(),
+                                (real_base (*)[l_nQts][l_nMds][l_nCrs]) l_dofs[l_ra].data(),
+                                (real_base (*)[l_nMds][l_nCrs]) l_dofsA[l_ra].data(),
+                                l_tDofsDg,
+                                l_recvs );
+      }
+
+      // exchange: the send entries of a rank are the receive entries of the other
+      for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+        real_base const *l_se = l_halos[1-l_ra].fa[0][0][0];
+        real_base       *l_re = l_halos[l_ra].fa[ l_halos[l_ra].nSe ][0][0];
+        for( std::size_t l_en = 0; l_en < l_halos[1-l_ra].nSe * l_nEnsFa; l_en++ ) l_re[l_en] = l_se[l_en];
+      }
+
+      for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+        real_base (**l_tDofsDg[4])[l_nMds][l_nCrs] = { l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data(), l_tDofsPtrs[l_ra].data() };
+        l_aderDgs[l_ra]->neigh( l_ra * l_nHa,
+                                l_nHa,
+                                real_base(1.0E-4),
+                                true,
+                                int_el(0),
+                                int_el(0),
+                                int_el(0),
+                                nullptr,
+                                l_bench.m_faChars.data(),
+                                l_bench.m_elChars.data(),
+                                nullptr,
+                                nullptr,
+                                (int_el const (*)[l_nFas]) nullptr,
+                                (int_el const (*)[l_nFas]) l_bench.m_elFa.data(),
+                                l_elFaEl,
+                                (unsigned short const (*)[l_nFas]) l_bench.m_fIdElFaEl.data(),
+                                l_vIdElFaEl,
+                                l_tDofsDg,
+                                (real_base (*)[l_nQts][l_nMds][l_nCrs]) l_dofs[l_ra].data(),
+                                (real_base (*)[l_nMds][l_nCrs]) l_dofsA[l_ra].data(),
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                l_internal.m_mm );
+      }
+    }
+
+    // the owned elements match the element halo
+    for( unsigned short l_ra = 0; l_ra < 2; l_ra++ ) {
+      for( std::size_t l_en = std::size_t(l_ra) * l_nHa * l_nEnsEl; l_en < std::size_t(l_ra+1) * l_nHa * l_nEnsEl; l_en++ )
+        REQUIRE( l_dofs[l_ra][l_en] == Approx( l_dofsRef[l_en] ).margin( 1E-5 ) );
+      delete l_aderDgs[l_ra];
+    }
+  }
+
+  l_internal.finalize();
+}
@@ -25,6 +25,7 @@
 
 #include "../setups/Elasticity.h"
 #include "../setups/ViscoElasticity.h"
+#include "FluxSolvers.hpp"
 #include "mesh/common.hpp"
 
 namespace edge {
@@ -650,6 +651,106 @@ class edge::seismic::solvers::AderDgInit {
       }
     }
 
+    /**
+     * Initializes the compressed flux solvers, which are recomputed on the fly.
+     *
+     * @param i_nEls number of elements.
+     * @param i_faEl elements adjacent to faces.
+     * @param i_elVe vertices adjacent to elements.
+     * @param i_elFa faces adjacent to elements.
+     * @param i_elMeDa mapping of element ids: mesh-to-data.
+     * @param i_elDaMe mapping of element ids: data-to-mesh.
+     * @param i_veChars vertex characteristics.
+     * @param i_faChars face characteristics.
+     * @param i_bgPars background parameters.
+     * @param o_fsPars will be set to the parameters of the flux solvers.
+     *
+     * @paramt TL_T_LID local integral type.
+     * @paramt TL_T_REAL floating point type.
+     **/
+    template< typename TL_T_LID,
+              typename TL_T_REAL >
+    static void initFsPars( TL_T_LID                i_nEls,
+                            TL_T_LID       const (* i_faEl)[2],
+                            TL_T_LID       const (* i_elVe)[TL_N_VES_EL],
+                            TL_T_LID       const (* i_elFa)[TL_N_FAS],
+                            TL_T_LID       const  * i_elMeDa,
+                            TL_T_LID       const  * i_elDaMe,
+                            t_vertexChars  const  * i_veChars,
+                            t_faceChars    const  * i_faChars,
+                            t_bgPars       const  * i_bgPars,
+                            TL_T_REAL            (* o_fsPars)[TL_N_FAS][FluxSolvers< TL_T_EL >::N_PARS] ) {
+      PP_INSTR_FUN("flux_solvers_pars")
+
+      typedef FluxSolvers< TL_T_EL > t_fs;
+
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+      for( TL_T_LID l_el = 0; l_el < i_nEls; l_el++ ) {
+        // duplicated elements use the connectivity of the dominant element
+        TL_T_LID l_elDo = i_elMeDa[ i_elDaMe[l_el] ];
+
+        // compute determinant of the mapping's jacobian
+        TL_T_REAL l_veCrds[TL_N_DIS][TL_N_VES_EL];
+        mesh::common< TL_T_EL >::getElVeCrds( l_elDo,
+                                              i_elVe,
+                                              i_veChars,
+                                              l_veCrds );
+        TL_T_REAL l_jac[TL_N_DIS][TL_N_DIS];
+        linalg::Mappings::evalJac( TL_T_EL, l_veCrds[0], l_jac[0] );
+        TL_T_REAL l_jDet = linalg::Matrix::det( l_jac );
+        EDGE_CHECK( l_jDet > 0 );
+
+        for( unsigned short l_fi = 0; l_fi < TL_N_FAS; l_fi++ ) {
+          TL_T_LID l_fa = i_elFa[l_elDo][l_fi];
+
+          // the element is either left or right of the face
+          unsigned short l_sd = (i_faEl[l_fa][0] == l_elDo) ? 0 : 1;
+          EDGE_CHECK_EQ( i_faEl[l_fa][l_sd], l_elDo ) << l_fa;
+
+          // boundary conditions have the element on the left-side per definition
+          bool l_frSu = (i_faChars[l_fa].spType & FREE_SURFACE) == FREE_SURFACE;
+          EDGE_CHECK( l_sd == 0 || !l_frSu );
+
+          // mirror own parameters for non-existing neighbors
+          TL_T_LID l_elNe = i_faEl[l_fa][1-l_sd];
+          if( l_elNe == std::numeric_limits< TL_T_LID >::max() ) l_elNe = l_elDo;
+
+          TL_T_REAL *l_pars = o_fsPars[l_el][l_fi];
+          l_pars[t_fs::MAT_OWN+0] = i_bgPars[l_elDo].rho;
+          l_pars[t_fs::MAT_OWN+1] = i_bgPars[l_elDo].lam;
+          l_pars[t_fs::MAT_OWN+2] = i_bgPars[l_elDo].mu;
+          l_pars[t_fs::MAT_NE+0]  = i_bgPars[l_elNe].rho;
+          l_pars[t_fs::MAT_NE+1]  = i_bgPars[l_elNe].lam;
+          l_pars[t_fs::MAT_NE+2]  = i_bgPars[l_elNe].mu;
+
+          // elastic and acoustic elements can't be mixed in 2D
+          EDGE_CHECK( TL_N_DIS == 3 || (l_pars[t_fs::MAT_OWN+2] > 0) == (l_pars[t_fs::MAT_NE+2] > 0) ) << l_fa;
+
+          // face-aligned coordinate system, the normal points outward of the element
+          TL_T_REAL l_dir = (l_sd == 0) ? 1 : -1;
+          for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+            l_pars[t_fs::FRAME + l_di] = l_dir * i_faChars[l_fa].outNormal[l_di];
+          }
+          if( TL_N_DIS == 3 ) {
+            for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+              l_pars[t_fs::FRAME + 3 + l_di] = i_faChars[l_fa].tangent0[l_di];
+              l_pars[t_fs::FRAME + 6 + l_di] = i_faChars[l_fa].tangent1[l_di];
+            }
+          }
+
+          // scalar scaling of the solvers
+          EDGE_CHECK( i_faChars[l_fa].area > 0 );
+          TL_T_REAL l_sca = -i_faChars[l_fa].area / l_jDet;
+          if( TL_T_EL == TET4 ) l_sca *= 2;
+          l_pars[t_fs::SCA] = l_sca;
+
+          l_pars[t_fs::FREE_SURF] = (l_frSu) ? 1 : 0;
+        }
+      }
+    }
+
 };
 
 #endif
\ No newline at end of file
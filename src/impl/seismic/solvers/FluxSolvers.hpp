@@ -0,0 +1,264 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Recomputation of the flux solvers from compressed per-face data.
+ **/
+#ifndef EDGE_SEISMIC_SOLVERS_FLUX_SOLVERS_HPP
+#define EDGE_SEISMIC_SOLVERS_FLUX_SOLVERS_HPP
+
+#include <cmath>
+#include "constants.hpp"
+#include "../common.hpp"
+
+namespace edge {
+  namespace seismic {
+    namespace solvers {
+      template< t_entityType TL_T_EL >
+      class FluxSolvers;
+    }
+  }
+}
+
+/**
+ * Compressed flux solvers.
+ * Instead of the rotated Godunov flux solvers, only the material parameters of the two adjacent elements,
+ * the face-aligned coordinate system, the scaling and the free surface flag are stored per face of an element.
+ * The solvers are rebuilt from these parameters on the fly.
+ *
+ * The mid parts of the solvers are given in terms of the impedances Z=rho*c, which is equivalent to the generated
+ * expressions in impl/seismic/generated but requires only four square roots per face.
+ *
+ * @paramt TL_T_EL element type.
+ **/
+template< t_entityType TL_T_EL >
+class edge::seismic::solvers::FluxSolvers {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of elastic quantities
+    static unsigned short const TL_N_QTS_E = CE_N_QTS_E( TL_N_DIS );
+
+    //! number of anelastic quantities (stresses only)
+    static unsigned short const TL_N_QTS_A = CE_N_QTS_M( TL_N_DIS );
+
+    //! number of entries in the face-aligned coordinate system: normal in 2D, normal and two tangents in 3D
+    static unsigned short const TL_N_ENS_FRAME = (TL_N_DIS == 2) ? 2 : 9;
+
+  public:
+    //! offset of the own material parameters: rho, lambda, mu
+    static unsigned short const MAT_OWN = 0;
+
+    //! offset of the neighboring material parameters: rho, lambda, mu
+    static unsigned short const MAT_NE = 3;
+
+    //! offset of the face-aligned coordinate system, pointing outward of the own element
+    static unsigned short const FRAME = 6;
+
+    //! offset of the scaling
+    static unsigned short const SCA = FRAME + TL_N_ENS_FRAME;
+
+    //! offset of the free surface flag (1 if free surface boundary conditions are applied, 0 otherwise)
+    static unsigned short const FREE_SURF = SCA + 1;
+
+    //! number of parameters per face
+    static unsigned short const N_PARS = FREE_SURF + 1;
+
+    /**
+     * Rebuilds the flux solvers of a single face of an element.
+     *
+     * @param i_pars parameters of the face.
+     * @param i_sd side of the solvers: 0 for the element's own contribution, 1 for the neighboring contribution.
+     * @param o_fsE will be set to the elastic flux solver.
+     * @param o_fsA will be set to the anelastic flux solver, nullptr if not required.
+     *
+     * @paramt TL_T_REAL floating point type.
+     **/
+    template< typename TL_T_REAL >
+    static void recompute( TL_T_REAL      const i_pars[N_PARS],
+                           unsigned short       i_sd,
+                           TL_T_REAL            o_fsE[TL_N_QTS_E*TL_N_QTS_E],
+                           TL_T_REAL            o_fsA[TL_N_QTS_A*TL_N_QTS_E] ) {
+      // first normal velocity
+      unsigned short const l_u = TL_N_QTS_A;
+
+      // material parameters
+      TL_T_REAL l_rho[2] = { i_pars[MAT_OWN+0], i_pars[MAT_NE+0] };
+      TL_T_REAL l_lam[2] = { i_pars[MAT_OWN+1], i_pars[MAT_NE+1] };
+      TL_T_REAL l_mu[2]  = { i_pars[MAT_OWN+2], i_pars[MAT_NE+2] };
+
+      // wave speeds and impedances
+      TL_T_REAL l_cp[2], l_cs[2], l_zp[2], l_zs[2];
+      for( unsigned short l_si = 0; l_si < 2; l_si++ ) {
+        l_cp[l_si] = std::sqrt( (l_lam[l_si] + 2 * l_mu[l_si]) / l_rho[l_si] );
+        l_cs[l_si] = std::sqrt( l_mu[l_si] / l_rho[l_si] );
+        l_zp[l_si] = l_rho[l_si] * l_cp[l_si];
+        l_zs[l_si] = l_rho[l_si] * l_cs[l_si];
+      }
+      bool l_ac = (l_mu[0] == 0 && l_mu[1] == 0);
+
+      // sign of the solver and impedances (first: multiplied with the velocity, second: with the stress)
+      TL_T_REAL l_sgn = (i_sd == 0) ? 1 : -1;
+      TL_T_REAL l_zp0 = l_zp[i_sd];
+      TL_T_REAL l_zp1 = l_zp[1-i_sd];
+      TL_T_REAL l_zs0 = l_zs[i_sd];
+      TL_T_REAL l_zs1 = l_zs[1-i_sd];
+      TL_T_REAL l_zpSum = l_zp[0] + l_zp[1];
+      TL_T_REAL l_zsSum = l_zs[0] + l_zs[1];
+
+      // mid parts of the solvers in face-aligned coordinates
+      TL_T_REAL l_midE[TL_N_QTS_E][TL_N_QTS_E];
+      TL_T_REAL l_midA[TL_N_QTS_A][TL_N_QTS_E];
+      for( unsigned short l_ro = 0; l_ro < TL_N_QTS_E; l_ro++ )
+        for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ )
+          l_midE[l_ro][l_co] = 0;
+      for( unsigned short l_ro = 0; l_ro < TL_N_QTS_A; l_ro++ )
+        for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ )
+          l_midA[l_ro][l_co] = 0;
+
+      // p-waves: normal stresses and normal velocity
+      for( unsigned short l_ro = 0; l_ro < TL_N_DIS; l_ro++ ) {
+        TL_T_REAL l_lm = l_lam[0] + ( (l_ro == 0) ? 2 * l_mu[0] : 0 );
+        l_midE[l_ro][0]   =  l_sgn * l_lm / l_zpSum;
+        l_midE[l_ro][l_u] = -l_lm * l_zp0 / l_zpSum;
+      }
+      l_midE[l_u][0]   = -l_zp1 / ( l_rho[0] * l_zpSum );
+      l_midE[l_u][l_u] =  l_sgn * l_cp[0] * l_zp[1] / l_zpSum;
+
+      l_midA[0][0]   =  l_sgn / l_zpSum;
+      l_midA[0][l_u] = -l_zp0 / l_zpSum;
+
+      // s-waves: shear stresses and tangential velocities
+      for( unsigned short l_sh = 0; l_sh < TL_N_DIS-1; l_sh++ ) {
+        unsigned short l_st = (TL_N_DIS == 2) ? 2 : 3 + 2*l_sh;
+        unsigned short l_ve = l_u + 1 + l_sh;
+
+        if( l_ac ) {
+          if( i_sd == 0 ) l_midE[l_ve][l_st] = -1 / l_rho[0];
+          continue;
+        }
+
+        l_midE[l_st][l_st] =  l_sgn * l_mu[0] / l_zsSum;
+        l_midE[l_st][l_ve] = -l_mu[0] * l_zs0 / l_zsSum;
+        l_midE[l_ve][l_st] = -l_zs1 / ( l_rho[0] * l_zsSum );
+        l_midE[l_ve][l_ve] =  l_sgn * l_cs[0] * l_zs[1] / l_zsSum;
+
+        l_midA[l_st][l_st] =  l_sgn / ( 2 * l_zsSum );
+        l_midA[l_st][l_ve] = -l_zs0 / ( 2 * l_zsSum );
+      }
+
+      // transformations
+      TL_T_REAL l_t[TL_N_QTS_E][TL_N_QTS_E];
+      TL_T_REAL l_tm1[TL_N_QTS_E][TL_N_QTS_E];
+      TL_T_REAL const *l_fr = i_pars+FRAME;
+      if( TL_N_DIS == 2 ) {
+        common::setupTrafo2d(    l_fr[0], l_fr[1], (TL_T_REAL (*)[5]) l_t );
+        common::setupTrafoInv2d( l_fr[0], l_fr[1], (TL_T_REAL (*)[5]) l_tm1 );
+      }
+      else {
+        common::setupTrafo3d(    l_fr[0], l_fr[1], l_fr[2],
+                                 l_fr[3], l_fr[4], l_fr[5],
+                                 l_fr[6], l_fr[7], l_fr[8],
+                                 (TL_T_REAL (*)[9]) l_t );
+        common::setupTrafoInv3d( l_fr[0], l_fr[1], l_fr[2],
+                                 l_fr[3], l_fr[4], l_fr[5],
+                                 l_fr[6], l_fr[7], l_fr[8],
+                                 (TL_T_REAL (*)[9]) l_tm1 );
+      }
+
+      // free surface boundary conditions mirror the (rotated) normal and shear stresses
+      bool l_frSu = (i_sd == 1) && (i_pars[FREE_SURF] != 0);
+
+      // elastic solver
+      rotate( TL_N_QTS_E, l_t, l_midE, l_tm1, i_pars[SCA], l_frSu, o_fsE );
+
+      // anelastic solver (back-rotation of the stresses only)
+      if( o_fsA != nullptr ) {
+        rotate( TL_N_QTS_A, l_t, l_midA, l_tm1, i_pars[SCA], l_frSu, o_fsA );
+      }
+    }
+
+  private:
+    /**
+     * Rotates the mid part of a flux solver: o_fs = i_sca * T * mid * T^{-1}.
+     *
+     * @param i_nRos number of rows in the mid part and the solver.
+     * @param i_t back-rotation T, only the upper-left i_nRos x i_nRos block is used.
+     * @param i_mid mid part of the solver.
+     * @param i_tm1 rotation T^{-1}.
+     * @param i_sca scaling of the solver.
+     * @param i_frSu true if free surface boundary conditions are applied.
+     * @param o_fs will be set to the solver.
+     *
+     * @paramt TL_T_REAL floating point type.
+     **/
+    template< typename TL_T_REAL >
+    static void rotate( unsigned short       i_nRos,
+                        TL_T_REAL      const i_t[TL_N_QTS_E][TL_N_QTS_E],
+                        TL_T_REAL      const i_mid[][TL_N_QTS_E],
+                        TL_T_REAL      const i_tm1[TL_N_QTS_E][TL_N_QTS_E],
+                        TL_T_REAL            i_sca,
+                        bool                 i_frSu,
+                        TL_T_REAL            o_fs[] ) {
+      TL_T_REAL l_tmp[TL_N_QTS_E][TL_N_QTS_E];
+
+      // back-rotation to physical coordinates
+      for( unsigned short l_ro = 0; l_ro < i_nRos; l_ro++ ) {
+#pragma omp simd
+        for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ ) l_tmp[l_ro][l_co] = 0;
+
+        for( unsigned short l_k = 0; l_k < i_nRos; l_k++ ) {
+#pragma omp simd
+          for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ )
+            l_tmp[l_ro][l_co] += i_t[l_ro][l_k] * i_mid[l_k][l_co];
+        }
+      }
+
+      // mirror normal and shear stresses at the free surface
+      if( i_frSu ) {
+        for( unsigned short l_ro = 0; l_ro < i_nRos; l_ro++ ) {
+          l_tmp[l_ro][0] = -l_tmp[l_ro][0];
+          for( unsigned short l_sh = 0; l_sh < TL_N_DIS-1; l_sh++ ) {
+            unsigned short l_st = (TL_N_DIS == 2) ? 2 : 3 + 2*l_sh;
+            l_tmp[l_ro][l_st] = -l_tmp[l_ro][l_st];
+          }
+        }
+      }
+
+      // rotation to face-aligned coordinates and scaling
+      for( unsigned short l_ro = 0; l_ro < i_nRos; l_ro++ ) {
+        TL_T_REAL l_row[TL_N_QTS_E];
+#pragma omp simd
+        for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ ) l_row[l_co] = 0;
+
+        for( unsigned short l_k = 0; l_k < TL_N_QTS_E; l_k++ ) {
+          TL_T_REAL l_val = i_sca * l_tmp[l_ro][l_k];
+#pragma omp simd
+          for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ )
+            l_row[l_co] += l_val * i_tm1[l_k][l_co];
+        }
+
+        for( unsigned short l_co = 0; l_co < TL_N_QTS_E; l_co++ )
+          o_fs[l_ro*TL_N_QTS_E + l_co] = l_row[l_co];
+      }
+    }
+};
+
+#endif
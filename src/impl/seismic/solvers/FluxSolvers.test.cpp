@@ -0,0 +1,147 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the recomputation of the flux solvers.
+ **/
+
+#include <catch.hpp>
+#define private public
+#include "AderDgInit.hpp"
+#undef private
+
+TEST_CASE( "Recomputation of the two-dimensional flux solvers.", "[FluxSolvers][recompute2d]" ) {
+  typedef edge::seismic::solvers::FluxSolvers< TRIA3 > t_fs;
+
+  // material parameters: elastic and acoustic
+  double l_mats[2][6] = { { 1.2, 0.8, 2.0, 3.5, 1.0, 1.5 },
+                          { 1.0, 1.3, 2.0, 2.4, 0.0, 0.0 } };
+
+  // normals
+  double l_nx = -0.2;
+  double l_ny = std::sqrt(1-0.04);
+
+  for( unsigned short l_ma = 0; l_ma < 2; l_ma++ ) {
+    for( unsigned short l_fr = 0; l_fr < 2; l_fr++ ) {
+      // acoustic setting is not defined for anelasticity
+      bool l_ane = (l_ma == 0);
+
+      double l_fsRef[2][5*5];
+      double l_fsRefA[2][3*5];
+      edge::seismic::solvers::AderDgInit< TRIA3,
+                                          false >::setUpFs( l_mats[l_ma][0], l_mats[l_ma][1],
+                                                            l_mats[l_ma][2], l_mats[l_ma][3],
+                                                            l_mats[l_ma][4], l_mats[l_ma][5],
+                                                            l_nx, l_ny,
+                                                            l_fsRef[0],
+                                                            l_fsRef[1],
+                                                            (l_ane) ? l_fsRefA[0] : nullptr,
+                                                            (l_ane) ? l_fsRefA[1] : nullptr,
+                                                            l_fr == 1 );
+
+      double l_pars[t_fs::N_PARS];
+      l_pars[t_fs::MAT_OWN+0] = l_mats[l_ma][0];
+      l_pars[t_fs::MAT_NE+0]  = l_mats[l_ma][1];
+      l_pars[t_fs::MAT_OWN+1] = l_mats[l_ma][2];
+      l_pars[t_fs::MAT_NE+1]  = l_mats[l_ma][3];
+      l_pars[t_fs::MAT_OWN+2] = l_mats[l_ma][4];
+      l_pars[t_fs::MAT_NE+2]  = l_mats[l_ma][5];
+      l_pars[t_fs::FRAME+0]   = l_nx;
+      l_pars[t_fs::FRAME+1]   = l_ny;
+      l_pars[t_fs::SCA]       = -0.5;
+      l_pars[t_fs::FREE_SURF] = l_fr;
+
+      for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
+        double l_fsE[5*5];
+        double l_fsA[3*5];
+        t_fs::recompute( l_pars,
+                         l_sd,
+                         l_fsE,
+                         (l_ane) ? l_fsA : nullptr );
+
+        for( unsigned short l_en = 0; l_en < 5*5; l_en++ ) {
+          REQUIRE( l_fsE[l_en] == Approx( -0.5 * l_fsRef[l_sd][l_en] ).margin(1E-12) );
+        }
+        for( unsigned short l_en = 0; l_en < 3*5 && l_ane; l_en++ ) {
+          REQUIRE( l_fsA[l_en] == Approx( -0.5 * l_fsRefA[l_sd][l_en] ).margin(1E-12) );
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE( "Recomputation of the three-dimensional flux solvers.", "[FluxSolvers][recompute3d]" ) {
+  typedef edge::seismic::solvers::FluxSolvers< TET4 > t_fs;
+
+  // material parameters
+  double l_mats[6] = { 2.7, 2.2, 3.1, 5.5, 1.4, 2.9 };
+
+  // face-aligned coordinate system
+  double l_n[3] = { 1/std::sqrt(3.0),  1/std::sqrt(3.0), 1/std::sqrt(3.0) };
+  double l_s[3] = { 1/std::sqrt(2.0), -1/std::sqrt(2.0), 0                };
+  double l_t[3] = { 1/std::sqrt(6.0),  1/std::sqrt(6.0), -2/std::sqrt(6.0) };
+
+  for( unsigned short l_fr = 0; l_fr < 2; l_fr++ ) {
+    double l_fsRef[2][9*9];
+    double l_fsRefA[2][6*9];
+    edge::seismic::solvers::AderDgInit< TET4,
+                                        false >::setUpFs( l_mats[0], l_mats[1],
+                                                          l_mats[2], l_mats[3],
+                                                          l_mats[4], l_mats[5],
+                                                          l_n[0], l_n[1], l_n[2],
+                                                          l_s[0], l_s[1], l_s[2],
+                                                          l_t[0], l_t[1], l_t[2],
+                                                          l_fsRef[0],
+                                                          l_fsRef[1],
+                                                          l_fsRefA[0],
+                                                          l_fsRefA[1],
+                                                          l_fr == 1 );
+
+    double l_pars[t_fs::N_PARS];
+    l_pars[t_fs::MAT_OWN+0] = l_mats[0];
+    l_pars[t_fs::MAT_NE+0]  = l_mats[1];
+    l_pars[t_fs::MAT_OWN+1] = l_mats[2];
+    l_pars[t_fs::MAT_NE+1]  = l_mats[3];
+    l_pars[t_fs::MAT_OWN+2] = l_mats[4];
+    l_pars[t_fs::MAT_NE+2]  = l_mats[5];
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_pars[t_fs::FRAME+0+l_di] = l_n[l_di];
+      l_pars[t_fs::FRAME+3+l_di] = l_s[l_di];
+      l_pars[t_fs::FRAME+6+l_di] = l_t[l_di];
+    }
+    l_pars[t_fs::SCA]       = 2.0;
+    l_pars[t_fs::FREE_SURF] = l_fr;
+
+    for( unsigned short l_sd = 0; l_sd < 2; l_sd++ ) {
+      double l_fsE[9*9];
+      double l_fsA[6*9];
+      t_fs::recompute( l_pars,
+                       l_sd,
+                       l_fsE,
+                       l_fsA );
+
+      for( unsigned short l_en = 0; l_en < 9*9; l_en++ ) {
+        REQUIRE( l_fsE[l_en] == Approx( 2.0 * l_fsRef[l_sd][l_en] ).margin(1E-12) );
+      }
+      for( unsigned short l_en = 0; l_en < 6*9; l_en++ ) {
+        REQUIRE( l_fsA[l_en] == Approx( 2.0 * l_fsRefA[l_sd][l_en] ).margin(1E-12) );
+      }
+    }
+  }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous execution of I/O jobs.
+ **/
+#include "AsyncIo.h"
+#include <algorithm>
+#include "logging.h"
+#include "monitor/Timer.hpp"
+
+edge::io::AsyncIo::~AsyncIo() {
+  finish();
+}
+
+void edge::io::AsyncIo::run() {
+  while( true ) {
+    std::pair< unsigned short, std::function< void() > > l_job;
+    {
+      std::unique_lock< std::mutex > l_lock( m_mutex );
+      m_cv.wait( l_lock, [this]{ return m_stop || !m_jobs.empty(); } );
+      if( m_jobs.empty() ) return;
+
+      l_job = std::move( m_jobs.front() );
+      m_jobs.pop_front();
+    }
+
+    monitor::Timer l_timer;
+    l_timer.start();
+    l_job.second();
+    l_timer.end();
+
+    {
+      std::lock_guard< std::mutex > l_lock( m_mutex );
+      m_timeJobs += l_timer.elapsed();
+      m_nJobs++;
+      m_free[l_job.first] = true;
+    }
+    m_cv.notify_all();
+  }
+}
+
+void edge::io::AsyncIo::start( unsigned short i_nSlots ) {
+  EDGE_CHECK( !m_thread.joinable() );
+  EDGE_CHECK_GT( i_nSlots, 0 );
+
+  m_free.assign( i_nSlots, true );
+  m_stop = false;
+  m_thread = std::thread( &AsyncIo::run, this );
+}
+
+unsigned short edge::io::AsyncIo::acquire() {
+  EDGE_CHECK( m_thread.joinable() );
+
+  monitor::Timer l_timer;
+  l_timer.start();
+
+  std::unique_lock< std::mutex > l_lock( m_mutex );
+  m_cv.wait( l_lock, [this]{ return std::find( m_free.begin(), m_free.end(), true ) != m_free.end(); } );
+
+  unsigned short l_slot = std::find( m_free.begin(), m_free.end(), true ) - m_free.begin();
+  m_free[l_slot] = false;
+
+  l_timer.end();
+  m_timeWait += l_timer.elapsed();
+
+  return l_slot;
+}
+
+void edge::io::AsyncIo::submit( unsigned short          i_slot,
+                                std::function< void() > i_job ) {
+  {
+    std::lock_guard< std::mutex > l_lock( m_mutex );
+    EDGE_CHECK_LT( i_slot, m_free.size() );
+    EDGE_CHECK( !m_free[i_slot] );
+    m_jobs.push_back( std::make_pair( i_slot, std::move(i_job) ) );
+  }
+  m_cv.notify_all();
+}
+
+void edge::io::AsyncIo::finish() {
+  if( !m_thread.joinable() ) return;
+
+  monitor::Timer l_timer;
+  l_timer.start();
+  {
+    std::lock_guard< std::mutex > l_lock( m_mutex );
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+  l_timer.end();
+
+  m_timeWait += l_timer.elapsed();
+}
+
+void edge::io::AsyncIo::logStats( std::string const & i_prefix ) const {
+  double l_hidden = std::max( 0.0, m_timeJobs - m_timeWait );
+
+  EDGE_LOG_INFO << i_prefix << "#jobs: " << m_nJobs
+                << ", time of the jobs: " << m_timeJobs
+                << " s, waited: " << m_timeWait
+                << " s, hidden: " << l_hidden << " s";
+}
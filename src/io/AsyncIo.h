@@ -0,0 +1,143 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous execution of I/O jobs.
+ **/
+#ifndef EDGE_IO_ASYNC_IO_H
+#define EDGE_IO_ASYNC_IO_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace edge {
+  namespace io {
+    class AsyncIo;
+  }
+}
+
+/**
+ * Executes I/O jobs on a dedicated thread.
+ * The caller acquires one of a fixed number of slots, e.g., staging buffers, for every job.
+ * A slot is released once the job finished, bounding the number of jobs in flight.
+ **/
+class edge::io::AsyncIo {
+  private:
+    //! I/O thread
+    std::thread m_thread;
+
+    //! mutex protecting the queue and the slots
+    std::mutex m_mutex;
+
+    //! condition variable for changes in the queue or the slots
+    std::condition_variable m_cv;
+
+    //! queued jobs and their slots
+    std::deque< std::pair< unsigned short, std::function< void() > > > m_jobs;
+
+    //! true if a slot is free
+    std::vector< bool > m_free;
+
+    //! true if the I/O thread is supposed to stop
+    bool m_stop = false;
+
+    //! number of executed jobs
+    std::size_t m_nJobs = 0;
+
+    //! time spent in the jobs on the I/O thread
+    double m_timeJobs = 0;
+
+    //! time the caller waited for free slots or for the completion of the jobs
+    double m_timeWait = 0;
+
+    /**
+     * Loop of the I/O thread, executes the jobs in order of submission.
+     **/
+    void run();
+
+  public:
+    /**
+     * Destructor, waits for the completion of all jobs.
+     **/
+    ~AsyncIo();
+
+    /**
+     * Starts the I/O thread.
+     *
+     * @param i_nSlots number of slots, i.e., maximum number of jobs in flight.
+     **/
+    void start( unsigned short i_nSlots );
+
+    /**
+     * Gets the number of slots.
+     *
+     * @return number of slots, 0 if not started.
+     **/
+    unsigned short getNSlots() const { return m_free.size(); }
+
+    /**
+     * Acquires a free slot, blocks if all slots are in use.
+     *
+     * @return id of the slot.
+     **/
+    unsigned short acquire();
+
+    /**
+     * Submits a job, which releases the slot on completion.
+     *
+     * @param i_slot slot of the job, obtained through acquire().
+     * @param i_job job.
+     **/
+    void submit( unsigned short          i_slot,
+                 std::function< void() > i_job );
+
+    /**
+     * Waits for the completion of all jobs and stops the I/O thread.
+     **/
+    void finish();
+
+    /**
+     * Gets the time spent in jobs on the I/O thread.
+     *
+     * @return time in seconds.
+     **/
+    double getTimeJobs() const { return m_timeJobs; }
+
+    /**
+     * Gets the time the caller waited for slots or for the completion of jobs.
+     *
+     * @return time in seconds.
+     **/
+    double getTimeWait() const { return m_timeWait; }
+
+    /**
+     * Logs the statistics of the jobs.
+     *
+     * @param i_prefix prefix of the log message.
+     **/
+    void logStats( std::string const & i_prefix ) const;
+};
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the asynchronous execution of I/O jobs.
+ **/
+#include <catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "AsyncIo.h"
+
+TEST_CASE( "AsyncIo: Bounded execution of jobs.", "[AsyncIo]" ) {
+  edge::io::AsyncIo l_async;
+  REQUIRE( l_async.getNSlots() == 0 );
+
+  l_async.start( 2 );
+  REQUIRE( l_async.getNSlots() == 2 );
+
+  // jobs record their order and check the number of jobs in flight
+  std::vector< int > l_order;
+  std::atomic< int > l_inFlight( 0 );
+  int l_maxInFlight = 0;
+
+  for( int l_jo = 0; l_jo < 6; l_jo++ ) {
+    unsigned short l_sl = l_async.acquire();
+    REQUIRE( l_sl < 2 );
+
+    l_inFlight++;
+    l_maxInFlight = std::max( l_maxInFlight, l_inFlight.load() );
+
+    l_async.submit( l_sl,
+                    [&l_order, &l_inFlight, l_jo]() {
+                      std::this_thread::sleep_for( std::chrono::milliseconds(5) );
+                      l_order.push_back( l_jo );
+                      l_inFlight--;
+                    } );
+  }
+
+  l_async.finish();
+
+  REQUIRE( l_maxInFlight <= 2 );
+  REQUIRE( l_order.size() == 6 );
+  for( int l_jo = 0; l_jo < 6; l_jo++ ) REQUIRE( l_order[l_jo] == l_jo );
+
+  REQUIRE( l_async.getTimeJobs() > 0 );
+  REQUIRE( l_async.getTimeWait() > 0 );
+
+  // finishing twice is fine
+  l_async.finish();
+}
@@ -138,6 +138,35 @@ void edge::io::Config::printConfig() {
 
   EDGE_LOG_INFO << "  synchronization:";
   EDGE_LOG_INFO << "    max_int (possibly using default settings): " << m_syncMaxInt;
+  EDGE_LOG_INFO << "  shared memory (possibly using default settings):";
+  EDGE_LOG_INFO << "    spin_iters: " << m_sharedSpinIters;
+  EDGE_LOG_INFO << "    chunk_size: " << m_sharedChunkSize;
+  EDGE_LOG_INFO << "  mpi (possibly using default settings):";
+  EDGE_LOG_INFO << "    halo: " << ( (m_mpiHaloFa) ? "face" : "element" );
+  EDGE_LOG_INFO << "    messages: " << ( (m_mpiAggregate) ? "aggregate" : "separate" );
+  EDGE_LOG_INFO << "    node_local: " << ( (m_mpiShm) ? "window" : "messages" );
+  if( m_mpiCodec ) {
+    std::string l_orders;
+    for( std::size_t l_or = 0; l_or < m_mpiCodecOrders.size(); l_or++ )
+      l_orders += ( (l_or == 0) ? "" : " " ) + std::to_string( m_mpiCodecOrders[l_or] );
+    EDGE_LOG_INFO << "    codec: " << ( (m_mpiCodecBf16) ? "bf16" : "fp32" )
+                  << ", full orders: " << ( (l_orders == "") ? "default" : l_orders )
+                  << ", test: " << ( (m_mpiCodecTest) ? "yes" : "no" );
+  }
+  else {
+    EDGE_LOG_INFO << "    codec: none";
+  }
+  EDGE_LOG_INFO << "  kernels (possibly using default settings):";
+  EDGE_LOG_INFO << "    tune_cache: " << m_kernelsTuneCache;
+  EDGE_LOG_INFO << "    flux_solvers: " << ( (m_kernelsFsRecomp) ? "recompute" : "store" );
+  EDGE_LOG_INFO << "    quiescent: " << ( (m_kernelsSkipQui) ? "skip" : "compute" );
+  EDGE_LOG_INFO << "    quiescent_tol: " << m_kernelsQuiTol;
+  if( m_kernelsRunsOff.size() > 0 ) {
+    std::string l_runs = "";
+    for( std::size_t l_ru = 0; l_ru < m_kernelsRunsOff.size(); l_ru++ )
+      l_runs += ( (l_ru == 0) ? "" : " " ) + std::to_string( m_kernelsRunsOff[l_ru] );
+    EDGE_LOG_INFO << "    inactive_runs: " << l_runs;
+  }
   EDGE_LOG_INFO << "  here's the mesh:";
 #ifdef PP_T_MESH_REGULAR
   EDGE_LOG_INFO << "    n_elements: ";
@@ -151,6 +180,7 @@ void edge::io::Config::printConfig() {
   EDGE_LOG_INFO << "      z: " << m_sizeZ;
 #elif defined PP_T_MESH_UNSTRUCTURED
   EDGE_LOG_INFO << "    read options: " << m_meshOptRead;
+  EDGE_LOG_INFO << "    reordering: " << ( (m_meshReorder != "") ? m_meshReorder : "none" );
   EDGE_LOG_INFO << "    files:";
   EDGE_LOG_INFO << "      in: " << m_meshFileIn;
   EDGE_LOG_INFO << "      out: " << m_meshFileOut;
@@ -195,6 +225,10 @@ void edge::io::Config::printConfig() {
       EDGE_LOG_INFO << "    sparse_type: " << m_waveFieldSpType;
     EDGE_LOG_INFO << "    file: " << m_waveFieldFile;
     EDGE_LOG_INFO << "    int: "  << m_waveFieldInt;
+    if( m_waveFieldInFlight > 0 )
+      EDGE_LOG_INFO << "    in_flight: " << m_waveFieldInFlight;
+    if( m_waveFieldRefine > 0 )
+      EDGE_LOG_INFO << "    refine: " << m_waveFieldRefine;
   }
 
   if( m_iBndType != "" ) {
@@ -214,6 +248,7 @@ void edge::io::Config::printConfig() {
       EDGE_LOG_INFO << "  we have " << m_recvNames[l_rt].size() << " " << l_type << " receivers in the config: ";
       EDGE_LOG_INFO << "    sampling frequency: " << m_recvFreq[l_rt];
       EDGE_LOG_INFO << "    path to out-directory: "<< m_recvPath[l_rt];
+      EDGE_LOG_INFO << "    format: "<< m_recvFormat[l_rt];
     }
   }
 
@@ -274,6 +309,8 @@ edge::io::Config::Config( std::string i_xmlPath ):
 #endif
   }
 
+  m_meshReorder = l_mesh.child("options").child("reorder").text().as_string();
+
   m_meshFileIn = l_mesh.child("files").child("in").text().as_string();
   m_meshFileOut = l_mesh.child("files").child("out").text().as_string();
 
@@ -356,6 +393,12 @@ edge::io::Config::Config( std::string i_xmlPath ):
 
     if( l_output.child("wave_field").find_child([]( pugi::xml_node i_node ){ return std::string(i_node.name()) == "sparse_type";}) )
       m_waveFieldSpType = l_output.child("wave_field").child("sparse_type").text().as_uint();
+
+    if( l_output.child("wave_field").child("in_flight") )
+      m_waveFieldInFlight = l_output.child("wave_field").child("in_flight").text().as_uint();
+
+    if( l_output.child("wave_field").child("refine") )
+      m_waveFieldRefine = l_output.child("wave_field").child("refine").text().as_uint();
   }
   EDGE_CHECK_GT( m_waveFieldInt, TOL.TIME );
 
@@ -394,6 +437,10 @@ edge::io::Config::Config( std::string i_xmlPath ):
     }
     else m_recvFreq[l_rt] = -std::numeric_limits< double >::max();
     m_recvPath[l_rt] = l_output.child(l_type.c_str()).child("path_to_dir").text().as_string();
+    if( l_output.child(l_type.c_str()).child("format") ) {
+      m_recvFormat[l_rt] = l_output.child(l_type.c_str()).child("format").text().as_string();
+      EDGE_CHECK( m_recvFormat[l_rt] == "csv" || m_recvFormat[l_rt] == "binary" ) << "unknown receiver format: " << m_recvFormat[l_rt];
+    }
     // clear invalid input
     if( m_recvFreq[l_rt] < TOL.TIME || m_recvPath[l_rt] == "" ) {
       m_recvCrds[l_rt].clear();
@@ -430,6 +477,70 @@ edge::io::Config::Config( std::string i_xmlPath ):
   }
   EDGE_CHECK_GT( m_syncMaxInt, TOL.TIME );
 
+  /*
+   * read shared memory parallelization
+   */
+  pugi::xml_node l_shared = m_doc.child("edge").child("shared_memory");
+  if( l_shared.child("spin_iters") ) m_sharedSpinIters = l_shared.child("spin_iters").text().as_uint();
+  if( l_shared.child("chunk_size") ) m_sharedChunkSize = l_shared.child("chunk_size").text().as_ullong();
+
+  /*
+   * read MPI settings
+   */
+  pugi::xml_node l_mpi = m_doc.child("edge").child("mpi");
+  if( l_mpi.child("halo") ) {
+    std::string l_halo = l_mpi.child("halo").text().as_string();
+    EDGE_CHECK( l_halo == "element" || l_halo == "face" ) << "unknown MPI halo mode: " << l_halo;
+    m_mpiHaloFa = (l_halo == "face");
+  }
+  if( l_mpi.child("messages") ) {
+    std::string l_msgs = l_mpi.child("messages").text().as_string();
+    EDGE_CHECK( l_msgs == "separate" || l_msgs == "aggregate" ) << "unknown MPI message mode: " << l_msgs;
+    m_mpiAggregate = (l_msgs == "aggregate");
+  }
+  if( l_mpi.child("node_local") ) {
+    std::string l_nl = l_mpi.child("node_local").text().as_string();
+    EDGE_CHECK( l_nl == "messages" || l_nl == "window" ) << "unknown MPI node-local mode: " << l_nl;
+    m_mpiShm = (l_nl == "window");
+  }
+  if( l_mpi.child("codec") ) {
+    pugi::xml_node l_codec = l_mpi.child("codec");
+    m_mpiCodec = true;
+    if( l_codec.child("low") ) {
+      std::string l_low = l_codec.child("low").text().as_string();
+      EDGE_CHECK( l_low == "fp32" || l_low == "bf16" ) << "unknown precision of the MPI codec: " << l_low;
+      m_mpiCodecBf16 = (l_low == "bf16");
+    }
+    for( pugi::xml_node l_or = l_codec.child("full_order"); l_or; l_or = l_or.next_sibling("full_order") ) {
+      m_mpiCodecOrders.push_back( l_or.text().as_uint() );
+    }
+    m_mpiCodecTest = l_codec.child("test").text().as_bool();
+  }
+
+  /*
+   * read kernel settings
+   */
+  pugi::xml_node l_kernels = m_doc.child("edge").child("kernels");
+  if( l_kernels.child("tune_cache") ) m_kernelsTuneCache = l_kernels.child("tune_cache").text().as_string();
+  if( l_kernels.child("flux_solvers") ) {
+    std::string l_fs = l_kernels.child("flux_solvers").text().as_string();
+    EDGE_CHECK( l_fs == "store" || l_fs == "recompute" ) << "unknown flux solver mode: " << l_fs;
+    m_kernelsFsRecomp = (l_fs == "recompute");
+  }
+  if( l_kernels.child("quiescent") ) {
+    std::string l_qui = l_kernels.child("quiescent").text().as_string();
+    EDGE_CHECK( l_qui == "compute" || l_qui == "skip" ) << "unknown mode for quiescent elements: " << l_qui;
+    m_kernelsSkipQui = (l_qui == "skip");
+  }
+  if( l_kernels.child("quiescent_tol") ) {
+    m_kernelsQuiTol = l_kernels.child("quiescent_tol").text().as_double();
+    EDGE_CHECK_GE( m_kernelsQuiTol, 0 ) << "tolerance of quiescent elements has to be non-negative";
+  }
+  for( pugi::xml_node l_ru = l_kernels.child("inactive_run"); l_ru; l_ru = l_ru.next_sibling("inactive_run") ) {
+    m_kernelsRunsOff.push_back( l_ru.text().as_uint() );
+    EDGE_CHECK_LT( m_kernelsRunsOff.back(), N_CRUNS ) << "inactive run does not exist";
+  }
+
   // print config
   printConfig();
 }
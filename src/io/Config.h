@@ -206,6 +206,9 @@ class edge::io::Config {
     //! mesh read options
     std::string m_meshOptRead;
 
+    //! space-filling curve for the reordering of inner entities: "", "none", "morton" or "hilbert"
+    std::string m_meshReorder;
+
     //! mesh input file
     std::string m_meshFileIn;
 
@@ -236,9 +239,57 @@ class edge::io::Config {
     //! interval of wave field output (max/2 to prevent inf when used in comparisons)
     double m_waveFieldInt =  std::numeric_limits< double >::max()/2;
 
+    //! number of wave field snapshots, which are written asynchronously; 0 for synchronous writes
+    unsigned short m_waveFieldInFlight = 0;
+
+    //! number of sub-divisions per reference edge for sub-sampled wave field output; 0 for cell averages
+    unsigned short m_waveFieldRefine = 0;
+
     //! maximum synchronization interval (if sync point is reached otherwise before, this is ignored)
     double m_syncMaxInt = std::numeric_limits< double >::max()/2;
 
+    //! number of spin iterations of idle workers before sleeping
+    unsigned int m_sharedSpinIters = 4096;
+
+    //! number of entities, which are claimed at once by a worker; 0 disables work stealing
+    std::size_t m_sharedChunkSize = 256;
+
+    //! true if the face-projected time integrated DOFs are exchanged at the MPI-boundary, false if the full DOFs of the send elements
+    bool m_mpiHaloFa = false;
+
+    //! true if the messages of MPI groups, which begin together, are aggregated to one message per neighbor
+    bool m_mpiAggregate = false;
+
+    //! true if messages to ranks on the same node are exchanged through shared-memory windows
+    bool m_mpiShm = false;
+
+    //! true if the halo data is sent through the precision-reduced codec
+    bool m_mpiCodec = false;
+
+    //! codec: true if the higher modes are sent as bfloat16, false for fp32
+    bool m_mpiCodecBf16 = false;
+
+    //! codec: polynomial orders, below which the modes are sent in fp64; one for all quantities or one per quantity, empty: all but the highest order
+    std::vector< unsigned short > m_mpiCodecOrders;
+
+    //! codec: true if the errors of the encoding are tracked and reported
+    bool m_mpiCodecTest = false;
+
+    //! path of the cache file for the kernel tuning decisions; empty if decisions are not cached
+    std::string m_kernelsTuneCache = "";
+
+    //! true if only the parameters of the flux solvers are stored and the solvers are recomputed on the fly
+    bool m_kernelsFsRecomp = false;
+
+    //! true if the updates of quiescent elements (all DOFs and incoming fluxes below the tolerance in all runs) are skipped
+    bool m_kernelsSkipQui = false;
+
+    //! tolerance of the DOFs, below which elements are considered quiescent
+    double m_kernelsQuiTol = 0;
+
+    //! fused runs which are deactivated, i.e., their DOFs remain unchanged
+    std::vector< unsigned short > m_kernelsRunsOff;
+
     //! type of the internal boundary output
     std::string m_iBndType;
 
@@ -266,6 +317,9 @@ class edge::io::Config {
     //! path to receiver directory
     std::string m_recvPath[2];
 
+    //! output format of the receivers: csv (one file per receiver) or binary (one file per rank)
+    std::string m_recvFormat[2] = { "csv", "csv" };
+
     //! domains for sparse entity types, [0]: vertices, [1]: faces, [2]: elements
     std::vector< linalg::Domain< real_mesh, N_DIM, edge::linalg::HalfSpace > > m_spTypesDoms[3];
 
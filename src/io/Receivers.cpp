@@ -23,6 +23,7 @@
 #include "parallel/Mpi.h"
 #include "Receivers.h"
 #include "data/SparseEntities.hpp"
+#include "data/Sort.hpp"
 #include "FileSystem.hpp"
 #include "linalg/Geom.hpp"
 #include "dg/Basis.h"
@@ -30,6 +31,9 @@
 #include <set>
 #include <fstream>
 #include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
 
 void edge::io::Receivers::init(       t_entityType    i_enType,
                                       unsigned int    i_nRecvs,
@@ -60,6 +64,13 @@ void edge::io::Receivers::init(       t_entityType    i_enType,
                                       i_veChars,
                                       l_deIds );
 
+  // receivers ordered by their dense ids
+  std::vector< int_el > l_reOrd( i_nRecvs );
+  edge::data::Sort::perm( int_el(i_nRecvs),
+                          l_deIds,
+                          l_reOrd.data() );
+  int_el l_nx = 0;
+
   // add the receivers
   int_el l_first = 0;
   for( int_tg l_tg = 0; l_tg < i_enLayout.timeGroups.size(); l_tg++ ) {
@@ -67,65 +78,65 @@ void edge::io::Receivers::init(       t_entityType    i_enType,
 
     // iterate over the owned entities
     for( int_el l_en = l_first; l_en < l_first+l_size; l_en++ ) {
-      // iterate over the receivers
-      for( unsigned int l_re = 0; l_re < i_nRecvs; l_re++ ) {
-        // only continue if the receiver is owned and matches the element
-        if( l_en == l_deIds[l_re] ) {
-          // get the vertices of the entity
-          real_mesh l_tmpVe[ 3 * 8];
-          for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
-            int_el l_veId = i_enVe[l_en*l_nVe+l_ve];
-
-            for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
-              l_tmpVe[l_di*l_nVe + l_ve] = i_veChars[l_veId].coords[l_di];
-            }
+      // iterate over the receivers of the entity
+      for( ; l_nx < int_el(i_nRecvs) && l_deIds[ l_reOrd[l_nx] ] == l_en; l_nx++ ) {
+        unsigned int l_re = l_reOrd[l_nx];
+
+        // get the vertices of the entity
+        real_mesh l_tmpVe[ 3 * 8];
+        for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
+          int_el l_veId = i_enVe[l_en*l_nVe+l_ve];
+
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            l_tmpVe[l_di*l_nVe + l_ve] = i_veChars[l_veId].coords[l_di];
           }
+        }
 
-          // init the receiver coordinates
-          real_mesh l_recvCrds[3];
-          for( unsigned short l_di = 0; l_di < 3; l_di++ )
-            l_recvCrds[l_di] = i_recvCrds[l_re][l_di];
+        // init the receiver coordinates
+        real_mesh l_recvCrds[3];
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_recvCrds[l_di] = i_recvCrds[l_re][l_di];
 
-          // project receiver to the element's surface if required
-          edge::linalg::Geom::closestPoint( i_enType,
-                                            l_tmpVe,
-                                            l_recvCrds );
+        // project receiver to the element's surface if required
+        edge::linalg::Geom::closestPoint( i_enType,
+                                          l_tmpVe,
+                                          l_recvCrds );
 
-          // set info
-          if( m_recvs.size() > 0 && m_recvs.back().en < l_en ) {
-            m_spEnToRecv.push_back( m_recvs.size() );
-          }
-          else if( m_recvs.size() == 0 ) m_spEnToRecv.push_back( 0 );
-
-          // add a new receiver
-          m_recvs.resize( m_recvs.size()+1 );
-          m_recvs.back().id = l_re;
-          for( unsigned short l_di = 0; l_di < 3; l_di++ )
-            m_recvs.back().coords[l_di] = l_recvCrds[l_di];
-          m_recvs.back().buffer.resize( N_QUANTITIES*N_CRUNS*m_buffSize );
-          m_recvs.back().buffTime.resize( m_buffSize );
-          m_recvs.back().nBuff = 0;
-          m_recvs.back().time  = i_time;
-          m_recvs.back().tg    = l_tg;
-          m_recvs.back().en    = l_en;
-          m_recvs.back().enTg  = l_en-l_first;
-          std::string l_dir = i_outDir + "/" + std::to_string(parallel::g_rank);
-          m_recvs.back().path  = l_dir + "/" + i_recvNames[l_re]+".csv";
-
-          // determine the location in reference coordinates
-          real_mesh l_ref[3] = {0,0,0};
-          linalg::Mappings::phyToRef( i_enType, l_tmpVe, l_recvCrds, l_ref );
-
-          // check for reasonable coords
-          for( unsigned short l_di = 0; l_di < C_ENT[i_enType].N_DIM; l_di++ ) {
-            EDGE_CHECK_GT( l_ref[l_di], -TOL.MESH );
-            EDGE_CHECK_LT( l_ref[l_di], 1+TOL.MESH );
-          }
+        // set info
+        if( m_recvs.size() > 0 && m_recvs.back().en < l_en ) {
+          m_spEnToRecv.push_back( m_recvs.size() );
+        }
+        else if( m_recvs.size() == 0 ) m_spEnToRecv.push_back( 0 );
+
+        // add a new receiver
+        m_recvs.resize( m_recvs.size()+1 );
+        m_recvs.back().id = l_re;
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          m_recvs.back().coords[l_di] = l_recvCrds[l_di];
+        m_recvs.back().buffer.resize( N_QUANTITIES*N_CRUNS*m_buffSize );
+        m_recvs.back().buffTime.resize( m_buffSize );
+        m_recvs.back().nBuff = 0;
+        m_recvs.back().time  = i_time;
+        m_recvs.back().tg    = l_tg;
+        m_recvs.back().en    = l_en;
+        m_recvs.back().enTg  = l_en-l_first;
+        std::string l_dir = i_outDir + "/" + std::to_string(parallel::g_rank);
+        m_recvs.back().path  = l_dir + "/" + i_recvNames[l_re]+".csv";
+        m_recvs.back().name  = i_recvNames[l_re];
+
+        // determine the location in reference coordinates
+        real_mesh l_ref[3] = {0,0,0};
+        linalg::Mappings::phyToRef( i_enType, l_tmpVe, l_recvCrds, l_ref );
+
+        // check for reasonable coords
+        for( unsigned short l_di = 0; l_di < C_ENT[i_enType].N_DIM; l_di++ ) {
+          EDGE_CHECK_GT( l_ref[l_di], -TOL.MESH );
+          EDGE_CHECK_LT( l_ref[l_di], 1+TOL.MESH );
+        }
 
-          // evaluate the basis at the given locations
-          for( int_md l_md = 0; l_md < N_ELEMENT_MODES; l_md++ ) {
-            dg::Basis::evalBasis( l_md, T_SDISC.ELEMENT, m_recvs.back().evaBasis[l_md], l_ref[0], l_ref[1], l_ref[2] );
-          }
+        // evaluate the basis at the given locations
+        for( int_md l_md = 0; l_md < N_ELEMENT_MODES; l_md++ ) {
+          dg::Basis::evalBasis( l_md, T_SDISC.ELEMENT, m_recvs.back().evaBasis[l_md], l_ref[0], l_ref[1], l_ref[2] );
         }
       }
     }
@@ -137,6 +148,7 @@ void edge::io::Receivers::init(       t_entityType    i_enType,
   if( m_recvs.size() > 0 ) {
     std::string l_dirCreate = i_outDir + "/" + std::to_string(parallel::g_rank);
     FileSystem::createDir( l_dirCreate );
+    m_binPath = l_dirCreate + "/recvs.bin";
 
     touchOutput( i_recvNames,
                  i_recvCrds );
@@ -153,6 +165,13 @@ void edge::io::Receivers::touchOutput( std::string const (*i_recvNames),
               l_headerSh += "# code version: " + std::string(PP_EDGE_VERSION) + "\n";
               l_headerSh += "# build date / time: " + std::string(__DATE__) + " / " + std::string(__TIME__) + "\n";
 
+  if( m_binary ) {
+    touchOutputBin( l_headerSh,
+                    i_recvNames,
+                    i_recvCrds );
+    return;
+  }
+
   // define column names
   std::string l_colNames = "time";
   for( int_qt l_qt = 0; l_qt < m_nQts; l_qt++ ) {
@@ -188,6 +207,40 @@ void edge::io::Receivers::touchOutput( std::string const (*i_recvNames),
   }
 }
 
+void edge::io::Receivers::touchOutputBin( std::string const  &i_header,
+                                          std::string const (*i_recvNames),
+                                          real_mesh   const (*i_recvCrds)[3] ) {
+  std::ofstream l_file( m_binPath, std::ios::binary | std::ios::trunc );
+  if( !l_file.is_open() ) EDGE_LOG_FATAL << "could not open the binary recv-file: " << m_binPath;
+
+  std::uint32_t l_meta[5] = { 1,
+                              std::uint32_t( m_recvs.size() ),
+                              m_nQts,
+                              N_CRUNS,
+                              std::uint32_t( i_header.size() ) };
+  l_file.write( "EDGERECV", 8 );
+  l_file.write( (char const *) l_meta, 5*sizeof(std::uint32_t) );
+  l_file.write( i_header.data(), i_header.size() );
+
+  // receiver index
+  for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
+    std::string const & l_name = m_recvs[l_re].name;
+    std::uint32_t l_size = l_name.size();
+    l_file.write( (char const *) &l_size, sizeof(std::uint32_t) );
+    l_file.write( l_name.data(), l_size );
+
+    double l_crds[6];
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_crds[l_di]   = ( i_recvNames != nullptr && i_recvCrds != nullptr ) ? i_recvCrds[ m_recvs[l_re].id ][l_di]
+                                                                           : std::nan("");
+      l_crds[3+l_di] = m_recvs[l_re].coords[l_di];
+    }
+    l_file.write( (char const *) l_crds, 6*sizeof(double) );
+  }
+
+  if( !l_file.good() ) EDGE_LOG_FATAL << "failed writing the header of the binary recv-file: " << m_binPath;
+}
+
 void edge::io::Receivers::getEnRecv( std::vector< int_el > & o_en ) {
   o_en.resize( m_spEnToRecv.size() );
   for( std::size_t l_en = 0; l_en < m_spEnToRecv.size(); l_en++ ) {
@@ -214,8 +267,9 @@ double edge::io::Receivers::getRecvTimeRel( int_el i_spEn,
   return -std::numeric_limits< double >::max();
 }
 
+template< typename TL_T_REAL >
 void edge::io::Receivers::writeRecvAll(       int_el    i_spEn,
-                                        const real_base i_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] ) {
+                                        const TL_T_REAL i_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] ) {
   EDGE_CHECK_LT( (std::size_t) i_spEn, m_spEnToRecv.size() );
 
   // get id and entity of first receiver
@@ -230,19 +284,22 @@ void edge::io::Receivers::writeRecvAll(       int_el    i_spEn,
 
       // iterate over quantities
       for( int_qt l_qt = 0; l_qt < N_QUANTITIES; l_qt++ ) {
-        // reset buffer
-        for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
-          m_recvs[l_re].buffer[ m_recvs[l_re].nBuff*N_QUANTITIES*N_CRUNS + l_qt*N_CRUNS + l_cr ] = 0;
-        }
+        // accumulate in double precision: 32-bit sums absorb the small contributions of the higher modes
+        double l_val[N_CRUNS];
+        for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ ) l_val[l_cr] = 0;
 
         // iterate over modes
         for( int_md l_md = 0; l_md < N_ELEMENT_MODES; l_md++ ) {
-          // eval the DOFS and store values
+          // eval the DOFS
           for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
-            m_recvs[l_re].buffer[ m_recvs[l_re].nBuff*N_QUANTITIES*N_CRUNS + l_qt*N_CRUNS + l_cr ] +=
-              m_recvs[l_re].evaBasis[l_md] * i_dofs[l_qt][l_md][l_cr];
+            l_val[l_cr] += double( m_recvs[l_re].evaBasis[l_md] ) * i_dofs[l_qt][l_md][l_cr];
           }
         }
+
+        // store values
+        for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+          m_recvs[l_re].buffer[ m_recvs[l_re].nBuff*N_QUANTITIES*N_CRUNS + l_qt*N_CRUNS + l_cr ] = l_val[l_cr];
+        }
       }
       // set time
       m_recvs[l_re].buffTime[ m_recvs[l_re].nBuff ] = m_recvs[l_re].time;
@@ -284,13 +341,72 @@ void edge::io::Receivers::flush( unsigned int i_re ) {
   m_recvs[i_re].nBuff = 0;
 }
 
+void edge::io::Receivers::flushBin() {
+  std::size_t l_nVals = 1 + std::size_t(m_nQts) * N_CRUNS;
+
+  // assemble the chunk
+  std::uint32_t l_nEntries = 0;
+  std::size_t l_size = sizeof(std::uint32_t);
+  for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
+    if( m_recvs[l_re].nBuff == 0 ) continue;
+    l_nEntries++;
+    l_size += 2*sizeof(std::uint32_t) + sizeof(float) * l_nVals * m_recvs[l_re].nBuff;
+  }
+  if( l_nEntries == 0 ) return;
+
+  m_binBuff.resize( l_size );
+  char *l_ptr = m_binBuff.data();
+  std::memcpy( l_ptr, &l_nEntries, sizeof(std::uint32_t) ); l_ptr += sizeof(std::uint32_t);
+
+  for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
+    Recv & l_recv = m_recvs[l_re];
+    if( l_recv.nBuff == 0 ) continue;
+
+    std::uint32_t l_info[2] = { std::uint32_t(l_re), l_recv.nBuff };
+    std::memcpy( l_ptr, l_info, 2*sizeof(std::uint32_t) ); l_ptr += 2*sizeof(std::uint32_t);
+
+    float *l_vals = (float *) l_ptr;
+    for( unsigned int l_bu = 0; l_bu < l_recv.nBuff; l_bu++ ) {
+      l_vals[l_bu*l_nVals] = l_recv.buffTime[l_bu];
+      for( std::size_t l_va = 0; l_va < l_nVals-1; l_va++ )
+        l_vals[l_bu*l_nVals + 1 + l_va] = l_recv.buffer[ l_bu*(l_nVals-1) + l_va ];
+    }
+    l_ptr += sizeof(float) * l_nVals * l_recv.nBuff;
+
+    l_recv.nBuff = 0;
+  }
+
+  // single contiguous write
+  std::ofstream l_file( m_binPath, std::ios::binary | std::ios::app );
+  if( !l_file.is_open() ) EDGE_LOG_FATAL << "could not open the binary recv-file: " << m_binPath;
+  l_file.write( m_binBuff.data(), l_size );
+  if( !l_file.good() ) EDGE_LOG_FATAL << "failed writing the binary recv-file: " << m_binPath;
+}
+
 void edge::io::Receivers::flushAll() {
+  if( m_binary ) {
+    flushBin();
+    return;
+  }
+
   // iterate over all receivers
   for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) flush( l_re );
 }
 
 void edge::io::Receivers::flushIf( unsigned int i_tresh ) {
   for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
-    if( m_buffSize - m_recvs[l_re].nBuff < i_tresh ) flush( l_re );
+    if( m_buffSize - m_recvs[l_re].nBuff < i_tresh ) {
+      // binary output writes all receivers at once
+      if( m_binary ) {
+        flushBin();
+        return;
+      }
+      flush( l_re );
+    }
   }
 }
+
+template void edge::io::Receivers::writeRecvAll< float  >( int_el,
+                                                           const float  [N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
+template void edge::io::Receivers::writeRecvAll< double >( int_el,
+                                                           const double [N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
@@ -27,6 +27,7 @@
 #include "constants.hpp"
 #include "data/EntityLayout.type"
 #include <string>
+#include <vector>
 
 namespace edge {
   namespace io {
@@ -59,6 +60,8 @@ class edge::io::Receivers {
       real_base evaBasis[N_ELEMENT_MODES];
       //! path to the receiver's file
       std::string path;
+      //! name of the receiver
+      std::string name;
     };
     // receiver under control; entity ids are ascending
     std::vector< Recv > m_recvs;
@@ -75,6 +78,15 @@ class edge::io::Receivers {
     //! sampling frequency of the receivers
     double m_freq;
 
+    //! true if all receivers are written to a single binary file (per rank) instead of one csv-file per receiver
+    bool m_binary;
+
+    //! path to the binary file
+    std::string m_binPath;
+
+    //! staging buffer, which holds a flush of all receivers for a single contiguous write
+    std::vector< char > m_binBuff;
+
     /**
      * Touches the output for the first time and writes the headers.
      *
@@ -84,6 +96,32 @@ class edge::io::Receivers {
     void touchOutput( std::string const (*i_recvNames) = nullptr,
                       real_mesh   const (*i_recvCrds)[3] = nullptr );
 
+    /**
+     * Writes the header and the receiver index of the binary output.
+     *
+     * Format (native byte order), see tools/processing/recvs_bin_to_csv.py for a converter to csv:
+     *   char[8]   "EDGERECV"
+     *   uint32    version of the format (1)
+     *   uint32    number of receivers R
+     *   uint32    number of quantities Q
+     *   uint32    number of fused runs C
+     *   uint32    length L of the shared header text, followed by char[L]
+     *   R times:  uint32 length N of the receiver's name, followed by char[N],
+     *             double[3] specified coordinates (NaN if not available),
+     *             double[3] projected coordinates
+     *   repeated until EOF, one chunk per flush:
+     *             uint32 number of receivers in the chunk E
+     *             E times: uint32 id of the receiver in the index, uint32 number of samples S,
+     *                      float[S][1+Q*C] with time first, then the quantities with fused runs as fastest dimension
+     *
+     * @param i_header shared header text.
+     * @param i_recvNames name of the receivers.
+     * @param i_recvCrds specified coordinates of the receivers.
+     **/
+    void touchOutputBin( std::string const  &i_header,
+                         std::string const (*i_recvNames),
+                         real_mesh   const (*i_recvCrds)[3] );
+
     /**
      * Flushes a receiver to disk.
      *
@@ -91,11 +129,23 @@ class edge::io::Receivers {
      **/
     void flush( unsigned int i_recv );
 
+    /**
+     * Flushes all receivers to the binary file through a single write.
+     **/
+    void flushBin();
+
     /**
      * Flushes all receivers to disk.
      **/
     void flushAll();
   public:
+    /**
+     * Constructor.
+     *
+     * @param i_binary true if the receivers are written to a single binary file per rank, false for one csv-file per receiver.
+     **/
+    Receivers( bool i_binary = false ): m_binary( i_binary ) {};
+
     /**
      * Destructor which flushes everything to disk.
      **/
@@ -155,11 +205,16 @@ class edge::io::Receivers {
      *
      * Remark: It is the callers responsibility to ensure that the DOFs are evaluated at the correct time.
      *
+     * The evaluation in space is accumulated in double precision.
+     *
      * @param i_spEn sparse entity.
      * @param i_dofs degrees of freedom, which get evaluated in space.
+     *
+     * @paramt TL_T_REAL floating point type of the DOFs (float or double).
      **/
-    void writeRecvAll(        int_el   i_spEn,
-                       const real_base i_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
+    template< typename TL_T_REAL >
+    void writeRecvAll(       int_el    i_spEn,
+                       const TL_T_REAL i_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
 
     /**
      * Flushes receiver's buffers to disk if the remaining size in the buffer if below the treshold.
@@ -21,6 +21,8 @@
  * Unit tests for receiver output.
  **/
 #include <catch.hpp>
+#include <fstream>
+#include <cstdint>
 #include "Receivers.h"
 
 TEST_CASE( "Receivers: Initialization", "[receivers][init]" ) {
@@ -79,3 +81,101 @@ TEST_CASE( "Receivers: Initialization", "[receivers][init]" ) {
   REQUIRE( l_enRecv[0]     == 4 );
 #endif
 }
+
+TEST_CASE( "Receivers: Binary output", "[receivers][binary]" ) {
+#ifdef PP_T_ELEMENTS_TET4
+  t_enLayout l_elLayout;
+  l_elLayout.timeGroups.resize( 1 );
+  l_elLayout.timeGroups[0].nEntsOwn    = 2;
+  l_elLayout.timeGroups[0].nEntsNotOwn = 0;
+
+  real_mesh l_recvCrds[3][3] = { { 0.15, 0.15, 0.15 },
+                                 { 0.20, 0.10, 8.05 },
+                                 { 0.10, 0.10, 0.10 } };
+
+  t_vertexChars l_veChars[8] = { {{0.0, 0.0, 0.0}, 0},
+                                 {{1.0, 0.0, 0.0}, 0},
+                                 {{0.0, 1.0, 0.0}, 0},
+                                 {{0.0, 0.0, 1.0}, 0},
+                                 {{0.0, 0.0, 8.0}, 0},
+                                 {{1.0, 0.0, 8.0}, 0},
+                                 {{0.0, 1.0, 8.0}, 0},
+                                 {{0.0, 0.0, 9.0}, 0} };
+  int_el l_enVe[2][4] = { {0,1,2,3},
+                          {4,5,6,7} };
+
+  std::string l_recvNames[3] = { "r0", "r1", "r2" };
+
+  // constant DOFs: the receivers output the first mode
+  real_base l_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS];
+  for( int_qt l_qt = 0; l_qt < N_QUANTITIES; l_qt++ )
+    for( int_md l_md = 0; l_md < N_ELEMENT_MODES; l_md++ )
+      for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ )
+        l_dofs[l_qt][l_md][l_cr] = (l_md == 0) ? l_qt + 0.5 * l_cr : 0;
+
+  {
+    edge::io::Receivers l_recv( true );
+    l_recv.init( TET4, 3, "/tmp/edge_recvs_bin", l_recvNames, l_recvCrds, 0.1, l_elLayout, l_enVe[0], l_veChars, 10 );
+
+    // two samples in the first element, one in the second; destructor flushes
+    l_recv.writeRecvAll( 0, l_dofs );
+    l_recv.writeRecvAll( 0, l_dofs );
+    l_recv.writeRecvAll( 1, l_dofs );
+  }
+
+  std::ifstream l_file( "/tmp/edge_recvs_bin/0/recvs.bin", std::ios::binary );
+  REQUIRE( l_file.is_open() );
+
+  char l_magic[8];
+  l_file.read( l_magic, 8 );
+  REQUIRE( std::string( l_magic, 8 ) == "EDGERECV" );
+
+  std::uint32_t l_meta[5];
+  l_file.read( (char *) l_meta, sizeof(l_meta) );
+  REQUIRE( l_meta[0] == 1 );
+  REQUIRE( l_meta[1] == 3 );
+  REQUIRE( l_meta[2] == N_QUANTITIES );
+  REQUIRE( l_meta[3] == N_CRUNS );
+  l_file.seekg( l_meta[4], std::ios::cur );
+
+  // receivers are ordered by their elements
+  std::string l_names[3] = { "r0", "r2", "r1" };
+  for( unsigned short l_re = 0; l_re < 3; l_re++ ) {
+    std::uint32_t l_size;
+    l_file.read( (char *) &l_size, sizeof(l_size) );
+    std::string l_name( l_size, ' ' );
+    l_file.read( &l_name[0], l_size );
+    REQUIRE( l_name == l_names[l_re] );
+
+    double l_crds[6];
+    l_file.read( (char *) l_crds, sizeof(l_crds) );
+    REQUIRE( l_crds[0] == Approx( l_crds[3] ) );
+  }
+
+  // single chunk
+  std::uint32_t l_nEntries;
+  l_file.read( (char *) &l_nEntries, sizeof(l_nEntries) );
+  REQUIRE( l_nEntries == 3 );
+
+  std::uint32_t l_nSamples[3] = { 2, 2, 1 };
+  for( unsigned short l_re = 0; l_re < 3; l_re++ ) {
+    std::uint32_t l_info[2];
+    l_file.read( (char *) l_info, sizeof(l_info) );
+    REQUIRE( l_info[0] == l_re );
+    REQUIRE( l_info[1] == l_nSamples[l_re] );
+
+    for( unsigned short l_sa = 0; l_sa < l_info[1]; l_sa++ ) {
+      float l_vals[1+N_QUANTITIES*N_CRUNS];
+      l_file.read( (char *) l_vals, sizeof(l_vals) );
+      REQUIRE( l_vals[0] == Approx( 0.1 * l_sa ) );
+      for( int_qt l_qt = 0; l_qt < N_QUANTITIES; l_qt++ )
+        for( int_cfr l_cr = 0; l_cr < N_CRUNS; l_cr++ )
+          REQUIRE( l_vals[1 + l_qt*N_CRUNS + l_cr] == Approx( l_qt + 0.5 * l_cr ) );
+    }
+  }
+
+  // end of file
+  l_file.peek();
+  REQUIRE( l_file.eof() );
+#endif
+}
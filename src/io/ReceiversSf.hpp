@@ -30,6 +30,8 @@
 #include "data/EntityLayout.type"
 #include "linalg/Mappings.hpp"
 #include "linalg/Geom.hpp"
+#include "data/Sort.hpp"
+#include "mesh/Bvh.hpp"
 #include "FileSystem.hpp"
 #include <limits>
 
@@ -89,6 +91,13 @@ class edge::io::ReceiversSf: public Receivers {
     std::vector< RecvSf > m_recvsSf;
 
   public:
+    /**
+     * Constructor.
+     *
+     * @param i_binary true if the receivers are written to a single binary file per rank, false for one csv-file per receiver.
+     **/
+    ReceiversSf( bool i_binary = false ): Receivers( i_binary ) {};
+
     /**
      * Intitializes receivers at sub-faces.
      *
@@ -172,6 +181,11 @@ class edge::io::ReceiversSf: public Receivers {
       }
 
 
+      // sub-face points of the considered faces in the order of their traversal: faces, sub-faces and coordinates
+      std::vector< TL_T_INT_LID > l_spFa;
+      std::vector< unsigned short > l_spSf;
+      std::vector< double > l_spCrds;
+
       TL_T_INT_LID l_first = 0;
 
       // iterate over all time groups
@@ -222,21 +236,11 @@ class edge::io::ReceiversSf: public Receivers {
                                             l_refCrds,
                                             l_meshCrds );
 
-                // iterate over receivers and determine the distance
-                for( unsigned int l_re = 0; l_re < i_nRecvs; l_re++ ) {
-                  double l_dist = linalg::GeomT<TL_N_DIS>::norm( l_meshCrds,
-                                                                 i_recvCrds[l_re] );
-
-                  // store the info if this a new minimum
-                  if( l_minDist[l_re] > l_dist ) {
-                    l_minDist[l_re] = l_dist;
-                    l_minFa[l_re]   = l_faId;
-                    l_minSf[l_re]   = l_sf;
-
-                    for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
-                      l_sfCrds[l_di][l_re] = l_meshCrds[l_di];
-                    }
-                  }
+                // store the sub-face point
+                l_spFa.push_back( l_faId );
+                l_spSf.push_back( l_sf );
+                for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+                  l_spCrds.push_back( (l_di < TL_N_DIS) ? l_meshCrds[l_di] : 0 );
                 }
               }
             }
@@ -248,6 +252,45 @@ class edge::io::ReceiversSf: public Receivers {
         l_first += i_elLayout.timeGroups[l_tg].nEntsNotOwn;
     }
 
+    // search the closest-by sub-face point of every receiver, ties resolve to the first point in the traversal
+    std::size_t l_nSps = l_spFa.size();
+    std::vector< double > l_spBoxes( l_nSps * 6 );
+    for( std::size_t l_sp = 0; l_sp < l_nSps; l_sp++ ) {
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        l_spBoxes[l_sp*6 +     l_di] = l_spCrds[l_sp*3 + l_di];
+        l_spBoxes[l_sp*6 + 3 + l_di] = l_spCrds[l_sp*3 + l_di];
+      }
+    }
+    mesh::Bvh< double, std::size_t > l_bvh;
+    l_bvh.init( l_nSps,
+                (double (*)[2][3]) l_spBoxes.data() );
+
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+    for( unsigned int l_re = 0; l_re < i_nRecvs; l_re++ ) {
+      double l_reCrds[3] = { 0, 0, 0 };
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) l_reCrds[l_di] = i_recvCrds[l_re][l_di];
+
+      auto l_dist = [&]( std::size_t i_sp ) {
+        return linalg::GeomT<TL_N_DIS>::norm( &l_spCrds[i_sp*3],
+                                              i_recvCrds[l_re] );
+      };
+
+      std::size_t l_sp = l_bvh.nearest( l_reCrds,
+                                        l_dist,
+                                        l_minDist[l_re] );
+
+      if( l_sp != std::numeric_limits< std::size_t >::max() ) {
+        l_minFa[l_re] = l_spFa[l_sp];
+        l_minSf[l_re] = l_spSf[l_sp];
+
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          l_sfCrds[l_di][l_re] = l_spCrds[l_sp*3 + l_di];
+        }
+      }
+    }
+
     // determine if we hold the sub-face with the minimum distance to the receiver
     std::vector< unsigned short > l_recvOwn( i_nRecvs );
     parallel::Mpi::min( i_nRecvs,
@@ -265,6 +308,17 @@ class edge::io::ReceiversSf: public Receivers {
     // frequency
     m_freq = i_freq;
 
+    // owned receivers ordered by their faces
+    std::vector< TL_T_INT_LID > l_reFas( i_nRecvs );
+    for( unsigned int l_re = 0; l_re < i_nRecvs; l_re++ ) {
+      l_reFas[l_re] = (l_recvOwn[l_re] == 1) ? l_minFa[l_re] : std::numeric_limits< TL_T_INT_LID >::max();
+    }
+    std::vector< unsigned int > l_reOrd( i_nRecvs );
+    data::Sort::perm( i_nRecvs,
+                      l_reFas.data(),
+                      l_reOrd.data() );
+    unsigned int l_nx = 0;
+
     TL_T_INT_LID l_spId = 0;
 
     // number of sparse receiver entities
@@ -282,38 +336,40 @@ class edge::io::ReceiversSf: public Receivers {
         if( (io_faChars[l_fa].spType & i_spType) == i_spType ) {
           bool l_reFa = false;
 
-          // iterate over receivers
-          for( unsigned int l_re = 0; l_re < i_nRecvs; l_re++ ) {
-            if(    l_recvOwn[l_re] == 1
-                && l_minFa[l_re] == l_fa ) {
-              // add this receiver
-              m_recvs.resize( m_recvs.size() + 1 );
-              m_recvsSf.resize( m_recvsSf.size() + 1 );
-
-              // update face type
-              io_faChars[l_fa].spType |= RECEIVER;
-
-              // init receiver data
-              m_recvs.back().nBuff = 0;
-              m_recvs.back().buffer.resize( i_bufferSize*i_nQts*TL_N_CRS );
-              m_recvs.back().buffTime.resize( m_buffSize );
-              m_recvs.back().time  = i_time;
-              m_recvs.back().tg    = l_tg;
-              m_recvs.back().en    = l_spId;
-              m_recvs.back().enTg  = l_spIdTg;
-              std::string l_dir    = i_outDir + "/" + std::to_string(parallel::g_rank);
-              m_recvs.back().path  = l_dir + "/" + i_recvNames[l_re]+".csv";
-
-              m_recvsSf.back().sf = l_minSf[l_re];
-              for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
-                m_recvsSf.back().crds[l_di] = l_sfCrds[l_di][l_re];
-
-              // set sparse entitity ids of the receivers
-              if( l_reFa == false ) {
-                m_spEnToRecv.resize( l_spRe+1 );
-                m_spEnToRecv[l_spRe] = m_recvs.size()-1;
-                l_reFa = true;
-              }
+          // iterate over the owned receivers of the face
+          for( ; l_nx < i_nRecvs && l_reFas[ l_reOrd[l_nx] ] == l_fa; l_nx++ ) {
+            unsigned int l_re = l_reOrd[l_nx];
+
+            // add this receiver
+            m_recvs.resize( m_recvs.size() + 1 );
+            m_recvsSf.resize( m_recvsSf.size() + 1 );
+
+            // update face type
+            io_faChars[l_fa].spType |= RECEIVER;
+
+            // init receiver data
+            m_recvs.back().nBuff = 0;
+            m_recvs.back().buffer.resize( i_bufferSize*i_nQts*TL_N_CRS );
+            m_recvs.back().buffTime.resize( m_buffSize );
+            m_recvs.back().time  = i_time;
+            m_recvs.back().tg    = l_tg;
+            m_recvs.back().en    = l_spId;
+            m_recvs.back().enTg  = l_spIdTg;
+            std::string l_dir    = i_outDir + "/" + std::to_string(parallel::g_rank);
+            m_recvs.back().path  = l_dir + "/" + i_recvNames[l_re]+".csv";
+            m_recvs.back().name  = i_recvNames[l_re];
+            for( unsigned short l_di = 0; l_di < 3; l_di++ )
+              m_recvs.back().coords[l_di] = (l_di < TL_N_DIS) ? l_sfCrds[l_di][l_re] : 0;
+
+            m_recvsSf.back().sf = l_minSf[l_re];
+            for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+              m_recvsSf.back().crds[l_di] = l_sfCrds[l_di][l_re];
+
+            // set sparse entitity ids of the receivers
+            if( l_reFa == false ) {
+              m_spEnToRecv.resize( l_spRe+1 );
+              m_spEnToRecv[l_spRe] = m_recvs.size()-1;
+              l_reFa = true;
             }
           }
           if( l_reFa == true ) l_spRe++;
@@ -327,8 +383,9 @@ class edge::io::ReceiversSf: public Receivers {
 
     // create directories and touch output
     if( i_nRecvs > 0 ) {
-      std::string l_dirCreate = i_outDir + "/" + std::to_string(parallel::g_nRanks);
+      std::string l_dirCreate = i_outDir + "/" + std::to_string(parallel::g_rank);
       FileSystem::createDir( l_dirCreate );
+      m_binPath = l_dirCreate + "/recvs.bin";
 
       touchOutput();
     }
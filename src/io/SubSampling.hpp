@@ -0,0 +1,254 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Sub-sampled wave field output: evaluation of the modal DOFs at the sub-vertices of a regular sub-grid.
+ **/
+#ifndef EDGE_IO_SUB_SAMPLING_HPP
+#define EDGE_IO_SUB_SAMPLING_HPP
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include "constants.hpp"
+#include "sc/SubGrid.hpp"
+#include "dg/Basis.h"
+#include "linalg/Matrix.h"
+#include "linalg/Mappings.hpp"
+
+namespace edge {
+  namespace io {
+    template< typename       TL_T_REAL,
+              t_entityType   TL_T_EL,
+              unsigned short TL_O_SP,
+              unsigned short TL_N_QTS,
+              unsigned short TL_N_CRS >
+    class SubSampling;
+  }
+}
+
+/**
+ * Evaluates the modal DOFs at the sub-vertices of a regular sub-grid of every element.
+ * The basis is evaluated once at the sub-vertices; the output is a small matrix-matrix multiplication per element.
+ *
+ * @paramt TL_T_REAL floating point precision of the DOFs.
+ * @paramt TL_T_EL element type.
+ * @paramt TL_O_SP order in space.
+ * @paramt TL_N_QTS number of quantities.
+ * @paramt TL_N_CRS number of concurrent forward runs (fused simulations).
+ **/
+template< typename       TL_T_REAL,
+          t_entityType   TL_T_EL,
+          unsigned short TL_O_SP,
+          unsigned short TL_N_QTS,
+          unsigned short TL_N_CRS >
+class edge::io::SubSampling {
+  private:
+    //! number of dimensions
+    static unsigned short const TL_N_DIS = C_ENT[TL_T_EL].N_DIM;
+
+    //! number of vertices per element / sub-cell
+    static unsigned short const TL_N_VES = C_ENT[TL_T_EL].N_VERTICES;
+
+    //! number of element modes
+    static unsigned short const TL_N_MDS = CE_N_ELEMENT_MODES( TL_T_EL, TL_O_SP );
+
+    //! number of sub-divisions per reference edge, 0 if not initialized
+    unsigned short m_nSds = 0;
+
+    //! number of sub-vertices per element
+    unsigned int m_nSvs = 0;
+
+    //! number of sub-cells per element
+    unsigned int m_nScs = 0;
+
+    //! reference coordinates of the sub-vertices
+    std::vector< real_mesh > m_svCrds;
+
+    //! sub-vertices adjacent to the sub-cells
+    std::vector< unsigned int > m_scSv;
+
+    //! basis evaluated at the sub-vertices, [*][]: mode, [][*]: sub-vertex
+    std::vector< TL_T_REAL > m_basis;
+
+  public:
+    /**
+     * Initializes the sub-grid and evaluates the basis at the sub-vertices.
+     *
+     * @param i_nSds number of sub-divisions per reference edge.
+     **/
+    void init( unsigned short i_nSds ) {
+      m_nSds = i_nSds;
+      sc::SubGrid< TL_T_EL, TL_O_SP >::regular( i_nSds,
+                                                m_svCrds,
+                                                m_scSv );
+      m_nSvs = m_svCrds.size() / TL_N_DIS;
+      m_nScs = m_scSv.size() / TL_N_VES;
+
+      m_basis.resize( std::size_t(TL_N_MDS) * m_nSvs );
+      for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+        for( unsigned int l_sv = 0; l_sv < m_nSvs; l_sv++ ) {
+          real_mesh l_pt[3] = {0, 0, 0};
+          for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+            l_pt[l_di] = m_svCrds[l_sv*TL_N_DIS + l_di];
+
+          real_base l_val;
+          dg::Basis::evalBasis( l_md,
+                                TL_T_EL,
+                                l_val,
+                                l_pt,
+                                -1,
+                                TL_O_SP );
+
+          // the generated simplex bases have removable singularities at collapsed vertices and edges:
+          // evaluate slightly inside the element instead
+          if( !std::isfinite( l_val ) ) {
+            real_mesh l_shift = std::sqrt( std::numeric_limits< real_mesh >::epsilon() );
+            for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+              l_pt[l_di] += l_shift * ( real_mesh(1) / TL_N_VES - l_pt[l_di] );
+
+            dg::Basis::evalBasis( l_md,
+                                  TL_T_EL,
+                                  l_val,
+                                  l_pt,
+                                  -1,
+                                  TL_O_SP );
+          }
+          m_basis[l_md*m_nSvs + l_sv] = l_val;
+        }
+      }
+    }
+
+    /**
+     * Gets the number of sub-divisions per reference edge.
+     *
+     * @return number of sub-divisions, 0 if not initialized.
+     **/
+    unsigned short getNSds() const { return m_nSds; }
+
+    /**
+     * Gets the number of sub-vertices per element.
+     *
+     * @return number of sub-vertices.
+     **/
+    unsigned int getNSvs() const { return m_nSvs; }
+
+    /**
+     * Gets the number of sub-cells per element.
+     *
+     * @return number of sub-cells.
+     **/
+    unsigned int getNScs() const { return m_nScs; }
+
+    /**
+     * Derives the sub-sampled mesh: every element contributes its own sub-vertices (discontinuous output).
+     *
+     * @param i_nEls number of elements.
+     * @param i_elIds ids of the elements.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_veChars vertex characteristics.
+     * @param o_coords will be set to the physical coordinates of the sub-vertices, [*][]: el*#sub-vertices + sub-vertex, [][*]: x, y, z.
+     * @param o_conn will be set to the sub-vertices adjacent to the sub-cells, [*][]: el*#sub-cells + sub-cell, [][*]: vertex.
+     *
+     * @paramt TL_T_LID integral type of local ids.
+     * @paramt TL_T_VE_CHARS type of the vertex characteristics, offers coordinates through .coords.
+     **/
+    template< typename TL_T_LID,
+              typename TL_T_VE_CHARS >
+    void mesh( TL_T_LID              i_nEls,
+               TL_T_LID      const * i_elIds,
+               TL_T_LID      const (*i_elVe)[TL_N_VES],
+               TL_T_VE_CHARS const * i_veChars,
+               float               * o_coords,
+               int                 * o_conn ) const {
+      for( TL_T_LID l_el = 0; l_el < i_nEls; l_el++ ) {
+        TL_T_LID l_elId = i_elIds[l_el];
+
+        // vertex coordinates of the element
+        real_mesh l_ves[TL_N_DIS][TL_N_VES];
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+          for( unsigned short l_ve = 0; l_ve < TL_N_VES; l_ve++ )
+            l_ves[l_di][l_ve] = i_veChars[ i_elVe[l_elId][l_ve] ].coords[l_di];
+
+        for( unsigned int l_sv = 0; l_sv < m_nSvs; l_sv++ ) {
+          real_mesh l_pt[3] = {0, 0, 0};
+          linalg::Mappings::refToPhy( TL_T_EL,
+                                      l_ves[0],
+                                      m_svCrds.data() + l_sv*TL_N_DIS,
+                                      l_pt );
+
+          for( unsigned short l_di = 0; l_di < 3; l_di++ )
+            o_coords[ (std::size_t(l_el)*m_nSvs + l_sv)*3 + l_di ] = l_pt[l_di];
+        }
+
+        for( unsigned int l_sc = 0; l_sc < m_nScs; l_sc++ )
+          for( unsigned short l_ve = 0; l_ve < TL_N_VES; l_ve++ )
+            o_conn[ (std::size_t(l_el)*m_nScs + l_sc)*TL_N_VES + l_ve ] = l_el*m_nSvs + m_scSv[l_sc*TL_N_VES + l_ve];
+      }
+    }
+
+    /**
+     * Evaluates the DOFs at the sub-vertices.
+     * Per element, this is a single matrix-matrix multiplication: sub-vertex values (quantities x sub-vertices)
+     * are given by the DOFs (quantities x modes) times the evaluated basis (modes x sub-vertices), fused runs are the fastest dimension.
+     *
+     * @param i_nEls number of elements.
+     * @param i_elIds ids of the elements.
+     * @param i_dofs DOFs.
+     * @param o_vals will be set to the values at the sub-vertices in single precision, [*][][]: run, [][*][]: quantity, [][][*]: el*#sub-vertices + sub-vertex.
+     *
+     * @paramt TL_T_LID integral type of local ids.
+     **/
+    template< typename TL_T_LID >
+    void eval( TL_T_LID          i_nEls,
+               TL_T_LID  const * i_elIds,
+               TL_T_REAL const (*i_dofs)[TL_N_QTS][TL_N_MDS][TL_N_CRS],
+               float           * o_vals ) const {
+      std::size_t l_nPts = std::size_t(i_nEls) * m_nSvs;
+
+#ifdef PP_USE_OMP
+#pragma omp parallel
+#endif
+      {
+        // values at the sub-vertices of a single element
+        std::vector< TL_T_REAL > l_svVals( TL_N_QTS * m_nSvs * TL_N_CRS );
+
+#ifdef PP_USE_OMP
+#pragma omp for
+#endif
+        for( TL_T_LID l_el = 0; l_el < i_nEls; l_el++ ) {
+          linalg::Matrix::matMulFusedAC( TL_N_CRS,
+                                         TL_N_QTS, m_nSvs,   TL_N_MDS,
+                                         TL_N_MDS, m_nSvs,   m_nSvs,
+                                         TL_T_REAL(1), TL_T_REAL(0),
+                                         i_dofs[ i_elIds[l_el] ][0][0],
+                                         m_basis.data(),
+                                         l_svVals.data() );
+
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS; l_qt++ )
+            for( unsigned int l_sv = 0; l_sv < m_nSvs; l_sv++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                o_vals[   (std::size_t(l_cr)*TL_N_QTS + l_qt) * l_nPts
+                        + std::size_t(l_el)*m_nSvs + l_sv ] = l_svVals[ (l_qt*m_nSvs + l_sv)*TL_N_CRS + l_cr ];
+        }
+      }
+    }
+};
+
+#endif
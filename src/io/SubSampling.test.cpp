@@ -0,0 +1,137 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the sub-sampled wave field output.
+ **/
+#include <catch.hpp>
+#define private public
+#include "SubSampling.hpp"
+#undef private
+
+TEST_CASE( "Sub-sampling: evaluation of the DOFs at the sub-vertices.", "[io][SubSampling]" ) {
+  edge::io::SubSampling< double, TET4, 3, 2, 2 > l_subSa;
+  l_subSa.init( 3 );
+
+  REQUIRE( l_subSa.getNSds() == 3 );
+  REQUIRE( l_subSa.getNSvs() == 20 );
+  REQUIRE( l_subSa.getNScs() == 27 );
+
+  // two elements, second one is printed first
+  double l_dofs[2][2][10][2];
+  for( unsigned short l_el = 0; l_el < 2; l_el++ )
+    for( unsigned short l_qt = 0; l_qt < 2; l_qt++ )
+      for( unsigned short l_md = 0; l_md < 10; l_md++ )
+        for( unsigned short l_cr = 0; l_cr < 2; l_cr++ )
+          l_dofs[l_el][l_qt][l_md][l_cr] = (l_el+1) * 0.3 - l_qt * 0.7 + l_md * 0.11 * (l_md%3) - l_cr * 0.05 * l_md;
+
+  int l_elIds[2] = { 1, 0 };
+  std::vector< float > l_vals( 2*2*2*20 );
+  l_subSa.eval( 2,
+                l_elIds,
+                l_dofs,
+                l_vals.data() );
+
+  // compare to a point-wise evaluation of the modal representation
+  for( unsigned short l_el = 0; l_el < 2; l_el++ ) {
+    for( unsigned short l_sv = 0; l_sv < 20; l_sv++ ) {
+      real_mesh l_pt[3];
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        l_pt[l_di] = l_subSa.m_svCrds[l_sv*3 + l_di];
+
+      for( unsigned short l_qt = 0; l_qt < 2; l_qt++ ) {
+        for( unsigned short l_cr = 0; l_cr < 2; l_cr++ ) {
+          double l_ref = 0;
+          for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+            real_base l_val;
+            edge::dg::Basis::evalBasis( l_md, TET4, l_val, l_pt, -1, 3 );
+            l_ref += l_val * l_dofs[ l_elIds[l_el] ][l_qt][l_md][l_cr];
+          }
+          REQUIRE( l_vals[ (l_cr*2 + l_qt)*40 + l_el*20 + l_sv ] == Approx( l_ref ) );
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE( "Sub-sampling: sub-sampled mesh.", "[io][SubSampling]" ) {
+  edge::io::SubSampling< float, TRIA3, 2, 1, 1 > l_subSa;
+  l_subSa.init( 2 );
+
+  REQUIRE( l_subSa.getNSvs() == 6 );
+  REQUIRE( l_subSa.getNScs() == 4 );
+
+  // two triangles, sharing the edge (1,0)-(0,1)
+  struct {
+    real_mesh coords[3];
+  } l_veChars[4] = { { {0, 0, 0} },
+                     { {2, 0, 0} },
+                     { {0, 2, 0} },
+                     { {2, 2, 0} } };
+  int l_elVe[2][3] = { {0, 1, 2},
+                       {3, 2, 1} };
+  int l_elIds[2] = { 0, 1 };
+
+  float l_coords[2*6][3];
+  int l_conn[2*4][3];
+  l_subSa.mesh( 2,
+                l_elIds,
+                l_elVe,
+                l_veChars,
+                l_coords[0],
+                l_conn[0] );
+
+  // sub-vertices of the first element are scaled reference coordinates
+  for( unsigned short l_sv = 0; l_sv < 6; l_sv++ ) {
+    REQUIRE( l_coords[l_sv][0] == Approx( 2*l_subSa.m_svCrds[l_sv*2+0] ) );
+    REQUIRE( l_coords[l_sv][1] == Approx( 2*l_subSa.m_svCrds[l_sv*2+1] ) );
+    REQUIRE( l_coords[l_sv][2] == 0 );
+  }
+
+  // reference vertices of the second element
+  REQUIRE( l_coords[6+0][0] == Approx( 2 ) );
+  REQUIRE( l_coords[6+0][1] == Approx( 2 ) );
+  REQUIRE( l_coords[6+2][0] == Approx( 0 ) );
+  REQUIRE( l_coords[6+2][1] == Approx( 2 ) );
+  REQUIRE( l_coords[6+5][0] == Approx( 2 ) );
+  REQUIRE( l_coords[6+5][1] == Approx( 0 ) );
+
+  // connectivity is offset by the element's sub-vertices
+  for( unsigned short l_sc = 0; l_sc < 4; l_sc++ ) {
+    for( unsigned short l_ve = 0; l_ve < 3; l_ve++ ) {
+      REQUIRE( l_conn[  l_sc][l_ve] == (int) l_subSa.m_scSv[l_sc*3 + l_ve] );
+      REQUIRE( l_conn[4+l_sc][l_ve] == (int) l_subSa.m_scSv[l_sc*3 + l_ve] + 6 );
+    }
+  }
+}
+
+TEST_CASE( "Sub-sampling: basis at collapsed vertices.", "[io][SubSampling]" ) {
+  edge::io::SubSampling< double, TET4, 4, 1, 1 > l_subSa;
+  l_subSa.init( 2 );
+
+  for( std::size_t l_en = 0; l_en < l_subSa.m_basis.size(); l_en++ )
+    REQUIRE( std::isfinite( l_subSa.m_basis[l_en] ) );
+
+  // last sub-vertex is the reference vertex (0, 0, 1), compare to the limit
+  REQUIRE( l_subSa.m_svCrds[9*3+2] == 1 );
+  real_mesh l_pt[3] = { 1E-5, 1E-5, 1-2E-5 };
+  real_base l_val;
+  edge::dg::Basis::evalBasis( 19, TET4, l_val, l_pt, -1, 4 );
+  REQUIRE( l_subSa.m_basis[19*10 + 9] == Approx( l_val ).margin( 1E-3 ) );
+}
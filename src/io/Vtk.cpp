@@ -29,12 +29,16 @@ void edge::io::Vtk::init(       int_el                 i_nVe,
                           const std::vector< int_el > &i_elPrint,
                           const t_vertexChars         *i_veChars,
                           const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES] ) {
+  // number of points and cells in the output
+  std::size_t l_nPts   = (m_subSa.getNSds() > 0) ? getNVals( i_elPrint.size() ) : i_nVe;
+  std::size_t l_nCells = getNCells( i_elPrint.size() );
+
   // allocate buffers for output matching the format of the visit_writer
-  m_coordsVe       = (float*)  data::common::allocate( sizeof(float)  * i_nVe * 3                                            );
-  m_connElVe       = (int*)    data::common::allocate( sizeof(int)    * i_elPrint.size() * C_ENT[T_SDISC.ELEMENT].N_VERTICES );
-  m_limSync        = (float*)  data::common::allocate( sizeof(float)  * i_elPrint.size() * N_QUANTITIES     * N_CRUNS        );
-  m_dofs           = (float*)  data::common::allocate( sizeof(float)  * i_elPrint.size() * N_QUANTITIES     * N_CRUNS        );
-  m_ptrs           = (float**) data::common::allocate( sizeof(float*)                    * (N_QUANTITIES+1) * N_CRUNS        );
+  m_coordsVe       = (float*)  data::common::allocate( sizeof(float)  * l_nPts * 3                                           );
+  m_connElVe       = (int*)    data::common::allocate( sizeof(int)    * l_nCells * C_ENT[T_SDISC.ELEMENT].N_VERTICES         );
+  m_limSync        = (float*)  data::common::allocate( sizeof(float)  * l_nCells * N_CRUNS                                   );
+  m_dofs           = (float*)  data::common::allocate( sizeof(float)  * getNVals( i_elPrint.size() ) * N_QUANTITIES * N_CRUNS );
+  m_cellTypes      = (int*)    data::common::allocate( sizeof(int)    * l_nCells                                             );
 
   // set the visit element type dependent on our build config
   if(       T_SDISC.ELEMENT == LINE   ) m_visitElType = VISIT_LINE;
@@ -46,19 +50,30 @@ void edge::io::Vtk::init(       int_el                 i_nVe,
    EDGE_LOG_FATAL << "missing element type " << T_SDISC.ELEMENT;
   }
 
-  // set up variable names and ptrs
+  // set up variable names
   for( int_cfr l_run = 0; l_run < N_CRUNS; l_run++ ) {
     for( int_md l_q = 0; l_q < N_QUANTITIES; l_q++ ) {
       m_varNames[   l_run*N_QUANTITIES+l_q] =   "crun_" + std::to_string( (unsigned long long) l_run)
                                               + "_var_" + std::to_string( (unsigned long long) l_q);
       m_varNamesC[  l_run*N_QUANTITIES+l_q] = m_varNames[l_run*N_QUANTITIES+l_q].c_str();
-      m_ptrs[l_run*N_QUANTITIES+l_q]    = m_dofs+(i_elPrint.size()*(N_QUANTITIES*l_run + l_q));
     }
 
     // counter for the limiter
     m_varNames[  N_CRUNS*N_QUANTITIES + l_run ] =   "crun_" + std::to_string( (unsigned long long) l_run ) + "_lim";
     m_varNamesC[ N_CRUNS*N_QUANTITIES + l_run ] = m_varNames[N_CRUNS*N_QUANTITIES + l_run].c_str();
-    m_ptrs[      N_CRUNS*N_QUANTITIES + l_run ] = m_limSync+(i_elPrint.size()*l_run);
+  }
+
+  for( std::size_t l_ce = 0; l_ce < l_nCells; l_ce++ ) m_cellTypes[l_ce] = m_visitElType;
+
+  // setup sub-vertex coords and sub-cell connectivity
+  if( m_subSa.getNSds() > 0 ) {
+    m_subSa.mesh( (int_el) i_elPrint.size(),
+                  i_elPrint.data(),
+                  i_elVe,
+                  i_veChars,
+                  m_coordsVe,
+                  m_connElVe );
+    return;
   }
 
   // setup vertices coords
@@ -83,7 +98,7 @@ edge::io::Vtk::~Vtk() {
      data::common::release( m_connElVe );
      data::common::release( m_limSync  );
      data::common::release( m_dofs     );
-     data::common::release( m_ptrs     );
+     data::common::release( m_cellTypes );
   }
 }
 
@@ -96,6 +111,43 @@ void edge::io::Vtk::write( const std::string           &i_outFile,
                            const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                            const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
                            const unsigned int         (*i_limSync)[N_CRUNS] ) {
+  // init before passing the internal buffers
+  if( !m_initialized ) {
+    init( i_nVe,
+          i_elPrint,
+          i_veChars,
+          i_elVe );
+
+    m_initialized = true;
+  }
+
+  stage( i_nVe,
+         i_elPrint,
+         i_lePrint,
+         i_veChars,
+         i_elVe,
+         i_dofs,
+         i_limSync,
+         m_dofs,
+         m_limSync );
+
+  writeStaged( i_outFile,
+               i_binary,
+               i_nVe,
+               i_elPrint.size(),
+               m_dofs,
+               (i_limSync != nullptr) ? m_limSync : nullptr );
+}
+
+void edge::io::Vtk::stage(       int_el                 i_nVe,
+                           const std::vector< int_el > &i_elPrint,
+                           const std::vector< int_el > &i_lePrint,
+                           const t_vertexChars         *i_veChars,
+                           const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                           const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
+                           const unsigned int         (*i_limSync)[N_CRUNS],
+                                 float                 *o_dofs,
+                                 float                 *o_limSync ) {
   // do the init if not already accomplished
   if( !m_initialized ) {
     init( i_nVe,
@@ -106,12 +158,51 @@ void edge::io::Vtk::write( const std::string           &i_outFile,
     m_initialized = true;
   }
 
+  if( m_subSa.getNSds() == 0 ) {
+    reorder( i_elPrint,
+             i_lePrint,
+             i_dofs,
+             i_limSync,
+             o_dofs,
+             o_limSync );
+    return;
+  }
+
+  // evaluate the DOFs at the sub-vertices
+  m_subSa.eval( (int_el) i_elPrint.size(),
+                i_elPrint.data(),
+                i_dofs,
+                o_dofs );
+
+  // limiter info is constant in the sub-cells of an element
+  if( i_limSync != nullptr ) {
+    std::size_t l_nCells = getNCells( i_elPrint.size() );
+    unsigned int l_nScs = m_subSa.getNScs();
+
+    for( int_el l_el = 0; l_el < (int_el) i_elPrint.size(); l_el++ ) {
+      int_el l_le = i_lePrint[l_el];
+
+      for( unsigned short l_ru = 0; l_ru < N_CRUNS; l_ru++ ) {
+        float l_lim = ( l_le == std::numeric_limits< int_el >::max() ) ? -1 : i_limSync[l_le][l_ru];
+        for( unsigned int l_sc = 0; l_sc < l_nScs; l_sc++ )
+          o_limSync[l_nCells*l_ru + std::size_t(l_el)*l_nScs + l_sc] = l_lim;
+      }
+    }
+  }
+}
+
+void edge::io::Vtk::reorder( const std::vector< int_el > &i_elPrint,
+                             const std::vector< int_el > &i_lePrint,
+                             const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
+                             const unsigned int         (*i_limSync)[N_CRUNS],
+                                   float                 *o_dofs,
+                                   float                 *o_limSync ) {
   // reorder the DOFs and fill the buffer
   for( int_el l_el = 0; l_el < (int_el) i_elPrint.size(); l_el++ ) {
     int_el l_elId = i_elPrint[l_el];
     for( int_md l_q = 0; l_q < N_QUANTITIES; l_q++ ) {
       for( int_cfr l_crun = 0; l_crun < N_CRUNS; l_crun++ ) {
-        m_dofs[i_elPrint.size()*(N_QUANTITIES*l_crun + l_q) + l_el] = i_dofs[l_elId][l_q][0][l_crun];
+        o_dofs[i_elPrint.size()*(N_QUANTITIES*l_crun + l_q) + l_el] = i_dofs[l_elId][l_q][0][l_crun];
       }
     }
   }
@@ -123,12 +214,55 @@ void edge::io::Vtk::write( const std::string           &i_outFile,
 
       for( unsigned short l_ru = 0; l_ru < N_CRUNS; l_ru++ ) {
         if( l_le == std::numeric_limits< int_el >::max() )
-          m_limSync[i_elPrint.size()*l_ru + l_el] = -1;
+          o_limSync[i_elPrint.size()*l_ru + l_el] = -1;
         else
-          m_limSync[i_elPrint.size()*l_ru + l_el] = i_limSync[l_le][l_ru];
+          o_limSync[i_elPrint.size()*l_ru + l_el] = i_limSync[l_le][l_ru];
       }
     }
   }
+}
+
+void edge::io::Vtk::writeStaged( const std::string &i_outFile,
+                                       bool         i_binary,
+                                       int_el       i_nVe,
+                                       int_el       i_nEls,
+                                       float       *i_dofs,
+                                       float       *i_limSync ) const {
+  // number of values per variable
+  std::size_t l_nVals  = getNVals(  i_nEls );
+  std::size_t l_nCells = getNCells( i_nEls );
+
+  // pointers to the stride-1 element regions
+  float *l_ptrs[(N_QUANTITIES+1) * N_CRUNS];
+  for( int_cfr l_run = 0; l_run < N_CRUNS; l_run++ ) {
+    for( int_md l_q = 0; l_q < N_QUANTITIES; l_q++ )
+      l_ptrs[l_run*N_QUANTITIES+l_q] = i_dofs + (l_nVals*(N_QUANTITIES*l_run + l_q));
+    l_ptrs[N_CRUNS*N_QUANTITIES + l_run] = i_limSync + (l_nCells*l_run);
+  }
+
+  // sub-sampled output: DOFs as point data, limiter info as cell data
+  if( m_subSa.getNSds() > 0 ) {
+    int l_varDim[(N_QUANTITIES+1) * N_CRUNS];
+    int l_centering[(N_QUANTITIES+1) * N_CRUNS];
+    for( unsigned short l_va = 0; l_va < (N_QUANTITIES+1) * N_CRUNS; l_va++ ) {
+      l_varDim[l_va] = 1;
+      l_centering[l_va] = (l_va < N_CRUNS*N_QUANTITIES) ? 1 : 0;
+    }
+
+    write_unstructured_mesh( i_outFile.c_str(),
+                             i_binary,
+                             l_nVals,
+                             m_coordsVe,
+                             l_nCells,
+                             m_cellTypes,
+                             m_connElVe,
+                             N_CRUNS*N_QUANTITIES + (i_limSync!=nullptr),
+                             l_varDim,
+                             l_centering,
+                             m_varNamesC,
+                             l_ptrs );
+    return;
+  }
 
   // write the data, now..
   edge_write_unstructured_mesh( i_outFile.c_str(),
@@ -136,9 +270,9 @@ void edge::io::Vtk::write( const std::string           &i_outFile,
                                 i_nVe,
                                 m_coordsVe,
                                 N_CRUNS*N_QUANTITIES + (i_limSync!=nullptr),
-                                i_elPrint.size(),
+                                i_nEls,
                                 m_visitElType,
                                 m_connElVe,
                                 m_varNamesC,
-                                m_ptrs );
+                                l_ptrs );
 }
@@ -25,6 +25,7 @@
 #define EDGE_IO_VTK_H
 
 #include "constants.hpp"
+#include "SubSampling.hpp"
 #include <string>
 #include <vector>
 
@@ -48,15 +49,22 @@ class edge::io::Vtk {
     //! number of time an element was limited since the last sync; TODO: stored as float since this is all our vtk-writer supports.
     float *m_limSync;
 
-    //! 1st order dofs in single precision, storage is element as ld, then quantities, then cruns (slowest dim).
+    //! 1st order dofs (or sub-vertex values) in single precision, storage is element (or sub-vertex) as ld, then quantities, then cruns (slowest dim).
     float *m_dofs;
 
-    //! pointers to the stride-1 element regions.
-    float **m_ptrs;
-
     //! element type used in visit_writer lib.
     int m_visitElType;
 
+    //! cell types of the sub-sampled output (all sub-cells have the element type).
+    int *m_cellTypes;
+
+    //! evaluation of the DOFs at sub-vertices, not initialized for output of the cell averages
+    SubSampling< real_base,
+                 T_SDISC.ELEMENT,
+                 ORDER,
+                 N_QUANTITIES,
+                 N_CRUNS > m_subSa;
+
     //! var names in the vtk output
     std::string  m_varNames[N_CRUNS*(N_QUANTITIES+1)];
 
@@ -84,14 +92,40 @@ class edge::io::Vtk {
      * the overhead >50% of the 1st order DOFs requirements. Future implementations might work with a buffer to reduce this.
      * Remark: The respective data structures are initialized in the first call of write([...]).
      *         -> Constructing a Vtk writer has almost no overhead.
+     *
+     * @param i_nSds number of sub-divisions per reference edge for sub-sampled output.
+     *               The modal DOFs are evaluated at the sub-vertices and written as point data.
+     *               0 writes the cell averages (mode 0) as cell data.
      **/
-    Vtk(): m_initialized(false){};
+    Vtk( unsigned short i_nSds = 0 ): m_initialized(false) {
+      if( i_nSds > 0 ) m_subSa.init( i_nSds );
+    };
 
     /**
      * Destructs Vtk (including mem releases).
      **/
     ~Vtk();
 
+    /**
+     * Gets the number of staged values per quantity and run.
+     *
+     * @param i_nEls number of print elements.
+     * @return number of print elements or, for sub-sampled output, number of sub-vertices of all print elements.
+     **/
+    std::size_t getNVals( int_el i_nEls ) const {
+      return (m_subSa.getNSds() > 0) ? std::size_t(i_nEls) * m_subSa.getNSvs() : std::size_t(i_nEls);
+    }
+
+    /**
+     * Gets the number of cells in the output.
+     *
+     * @param i_nEls number of print elements.
+     * @return number of print elements or, for sub-sampled output, number of sub-cells of all print elements.
+     **/
+    std::size_t getNCells( int_el i_nEls ) const {
+      return (m_subSa.getNSds() > 0) ? std::size_t(i_nEls) * m_subSa.getNScs() : std::size_t(i_nEls);
+    }
+
     /**
      * Interface to visit_writer output.
      * If this function is called for the first time, the data structures of Vtk are allocated and initialized.
@@ -115,6 +149,65 @@ class edge::io::Vtk {
                 const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                 const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
                 const unsigned int         (*i_limSync)[N_CRUNS]=nullptr );
+
+    /**
+     * Stages the DOFs and limiter info in the format of visit_writer.
+     * If this function is called for the first time, the data structures of Vtk are allocated and initialized.
+     *
+     * @param i_nVe number of vertices.
+     * @param i_elPrint print elements.
+     * @param i_lePrint sparse ids of limited print elements.
+     * @param i_veChars vertex characteristics.
+     * @param i_elVe ids of the elements' adjacent vertices.
+     * @param i_dofs DOFs.
+     * @param i_limSync optitional number of times the elements were limited.
+     * @param o_dofs will be set to the staged DOFs, size: getNVals(#print elements) * N_QUANTITIES * N_CRUNS.
+     * @param o_limSync will be set to the staged limiter info (if i_limSync is given), size: getNCells(#print elements) * N_CRUNS.
+     **/
+    void stage(       int_el                 i_nVe,
+                const std::vector< int_el > &i_elPrint,
+                const std::vector< int_el > &i_lePrint,
+                const t_vertexChars         *i_veChars,
+                const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
+                const unsigned int         (*i_limSync)[N_CRUNS],
+                      float                 *o_dofs,
+                      float                 *o_limSync );
+
+    /**
+     * Reorders the DOFs and limiter info: element as leading dimension, then quantities, then cruns (slowest dim).
+     *
+     * @param i_elPrint print elements.
+     * @param i_lePrint sparse ids of limited print elements.
+     * @param i_dofs DOFs.
+     * @param i_limSync optitional number of times the elements were limited.
+     * @param o_dofs will be set to the first-order DOFs in single precision, size: #print elements * N_QUANTITIES * N_CRUNS.
+     * @param o_limSync will be set to the limiter info (if i_limSync is given), size: #print elements * N_CRUNS.
+     **/
+    static void reorder( const std::vector< int_el > &i_elPrint,
+                         const std::vector< int_el > &i_lePrint,
+                         const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
+                         const unsigned int         (*i_limSync)[N_CRUNS],
+                               float                 *o_dofs,
+                               float                 *o_limSync );
+
+    /**
+     * Writes staged data through visit_writer.
+     * Remark: Vtk has to be initialized through stage([...]) before, visit_writer doesn't support concurrent calls.
+     *
+     * @param i_outFile file to which the output is written.
+     * @param i_binary true for binary output.
+     * @param i_nVe number of vertices.
+     * @param i_nEls number of print elements.
+     * @param i_dofs staged DOFs.
+     * @param i_limSync staged limiter info, nullptr if not available.
+     **/
+    void writeStaged( const std::string &i_outFile,
+                            bool         i_binary,
+                            int_el       i_nVe,
+                            int_el       i_nEls,
+                            float       *i_dofs,
+                            float       *i_limSync ) const;
 };
 
 #endif
@@ -38,7 +38,10 @@ edge::io::WaveField::WaveField(       std::string      i_type,
                                 const t_elementChars  *i_elChars,
                                 const int_el         (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                                 const real_base      (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
-                                      int_spType       i_spType ):
+                                      int_spType       i_spType,
+                                      unsigned short   i_nInFlight,
+                                      unsigned short   i_nSds ):
+ m_vtk(i_nSds),
  m_veChars(i_veChars),
  m_elChars(i_elChars),
  m_elVe(i_elVe),
@@ -101,10 +104,20 @@ edge::io::WaveField::WaveField(       std::string      i_type,
 
   if(      i_type == "vtk_ascii"  ) m_type = vtkAscii;
   else if( i_type == "vtk_binary" ) m_type = vtkBinary;
+  else if( i_type == "xdmf"       ) m_type = xdmf;
   else                              m_type = none;
 
+  // single, shared file
+  if( m_type == xdmf ) {
+    EDGE_LOG_INFO << "setting up wave field output";
+    std::string l_dir, l_file;
+    FileSystem::splitPathLast( i_outFile, l_dir, l_file );
+    if( parallel::g_rank == 0 ) FileSystem::createDir( l_dir );
+
+    m_outFile = i_outFile;
+  }
   // create new directory
-  if( m_type != none ) {
+  else if( m_type != none ) {
     EDGE_LOG_INFO << "setting up wave field output";
     std::string l_dir, l_file;
     FileSystem::splitPathLast( i_outFile, l_dir, l_file );
@@ -116,11 +129,38 @@ edge::io::WaveField::WaveField(       std::string      i_type,
       l_dir = l_dir + "/" + std::to_string(parallel::g_rank) + '/';
       m_outFile = l_dir + l_file;
     }
+
+    if( i_nSds > 0 )
+      EDGE_LOG_INFO << "  sub-sampling the DOFs with " << i_nSds << " sub-divisions per reference edge";
   }
 
   m_nVe = i_inMap->veDaMe.size();
 
   m_writeStep = 0;
+
+  // staging buffer of the collective writes
+  if( m_type == xdmf ) {
+    if( i_nInFlight > 0 ) EDGE_LOG_WARNING << "  ignoring asynchronous writes for collective xdmf output";
+    if( i_nSds > 0 )      EDGE_LOG_WARNING << "  ignoring sub-sampling for xdmf output, writing cell averages";
+
+    m_stDofs.resize( 1 );
+    m_stLimSync.resize( 1 );
+    m_stDofs[0].resize(    m_elPrint.size() * N_QUANTITIES * N_CRUNS );
+    m_stLimSync[0].resize( m_elPrint.size() * N_CRUNS );
+  }
+  // set up asynchronous writes
+  else if( m_type != none && i_nInFlight > 0 && m_elPrint.size() > 0 ) {
+    EDGE_LOG_INFO << "  writing up to " << i_nInFlight << " snapshots asynchronously";
+
+    m_stDofs.resize( i_nInFlight );
+    m_stLimSync.resize( i_nInFlight );
+    for( unsigned short l_sl = 0; l_sl < i_nInFlight; l_sl++ ) {
+      m_stDofs[l_sl].resize(    m_vtk.getNVals(  m_elPrint.size() ) * N_QUANTITIES * N_CRUNS );
+      m_stLimSync[l_sl].resize( m_vtk.getNCells( m_elPrint.size() ) * N_CRUNS );
+    }
+
+    m_async.start( i_nInFlight );
+  }
 }
 
 void edge::io::WaveField::write( double         i_time,
@@ -128,13 +168,61 @@ void edge::io::WaveField::write( double         i_time,
   PP_INSTR_FUN("write_wf")
 
 //  if( m_type == netcdf ) writeNetcdf( i_time, i_dofs );
-  if ( m_type == vtkAscii || m_type == vtkBinary ) {
+  if( m_type == xdmf ) {
+    // create the file and write the mesh in the first call
+    if( m_writeStep == 0 ) {
+      m_xdmf.init( m_outFile,
+                   m_nVe,
+                   m_elPrint,
+                   m_veChars,
+                   m_elVe,
+                   i_limSync != nullptr );
+    }
+
+    Vtk::reorder( m_elPrint,
+                  m_liPrint,
+                  m_dofs,
+                  i_limSync,
+                  m_stDofs[0].data(),
+                  m_stLimSync[0].data() );
+
+    m_xdmf.write( i_time,
+                  m_stDofs[0].data(),
+                  m_stLimSync[0].data() );
+  }
+  else if ( m_type == vtkAscii || m_type == vtkBinary ) {
     // create file name
     std::string l_outFile = m_outFile;
     l_outFile += "_" + parallel::g_rankStr + "_" + std::to_string((unsigned long long) m_writeStep) + ".vtk";
 
+    // stage the snapshot and write asynchronously
+    if( m_elPrint.size() > 0 && m_async.getNSlots() > 0 ) {
+      unsigned short l_sl = m_async.acquire();
+
+      m_vtk.stage( m_nVe,
+                   m_elPrint,
+                   m_liPrint,
+                   m_veChars,
+                   m_elVe,
+                   m_dofs,
+                   i_limSync,
+                   m_stDofs[l_sl].data(),
+                   m_stLimSync[l_sl].data() );
+
+      bool l_binary = (m_type == vtkBinary);
+      float *l_limSync = (i_limSync != nullptr) ? m_stLimSync[l_sl].data() : nullptr;
+      m_async.submit( l_sl,
+                      [this, l_outFile, l_binary, l_sl, l_limSync]() {
+                        m_vtk.writeStaged( l_outFile,
+                                           l_binary,
+                                           m_nVe,
+                                           m_elPrint.size(),
+                                           m_stDofs[l_sl].data(),
+                                           l_limSync );
+                      } );
+    }
     // write output
-    if( m_elPrint.size() > 0 )
+    else if( m_elPrint.size() > 0 )
       m_vtk.write( l_outFile,
                    m_type==vtkBinary,
                    m_nVe,
@@ -148,3 +236,10 @@ void edge::io::WaveField::write( double         i_time,
 
   m_writeStep++;
 }
+
+void edge::io::WaveField::finish() {
+  if( m_async.getNSlots() > 0 ) {
+    m_async.finish();
+    m_async.logStats( "  asynchronous wave field output, " );
+  }
+}
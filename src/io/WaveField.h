@@ -25,9 +25,12 @@
 #define EDGE_IO_WAVE_FIELD_H
 
 #include "Vtk.h"
+#include "AsyncIo.h"
+#include "Xdmf.h"
 
 #include <string>
 #include <limits>
+#include <vector>
 #include "constants.hpp"
 #include "data/EntityLayout.type"
 
@@ -41,11 +44,15 @@ class edge::io::WaveField {
   //private:
     enum Type{ none,
                vtkAscii,
-               vtkBinary };
+               vtkBinary,
+               xdmf };
 
     //! vtk interfaces
     Vtk m_vtk;
 
+    //! single-file HDF5 output
+    Xdmf m_xdmf;
+
     //! type of the output
     Type m_type;
 
@@ -76,11 +83,20 @@ class edge::io::WaveField {
     //! sparse ids of limited print element (std::limit<int_el>::max() if not a limited element)
     std::vector< int_el > m_liPrint;
 
+    //! staged DOFs of the in-flight snapshots
+    std::vector< std::vector< float > > m_stDofs;
+
+    //! staged limiter info of the in-flight snapshots
+    std::vector< std::vector< float > > m_stLimSync;
+
+    //! asynchronous writes, destructed (and thus completed) before the staging buffers
+    AsyncIo m_async;
+
   public:
     /**
      * Constructor of the DoF writer.
      *
-     * @param i_type type of the output
+     * @param i_type type of the output: vtk_ascii, vtk_binary or xdmf (single HDF5-file, requires HDF5).
      * @param i_outFile output file.
      * @param i_elLayout entity layout of the elements.
      * @param i_inMap index mapping
@@ -89,6 +105,8 @@ class edge::io::WaveField {
      * @param i_elVe vertices adjacent to the elements.
      * @param i_dofs location of degrees of freedom, which will get written in corresponding calls.
      * @param i_spType sparse type for elements, which are printed. If numeric_limits<>::max(), all elements are printed.
+     * @param i_nInFlight number of snapshots, which are written asynchronously while the computations continue. 0 for synchronous writes.
+     * @param i_nSds number of sub-divisions per reference edge (vtk only), the DOFs are evaluated at the sub-vertices. 0 for cell averages.
      **/
     WaveField(       std::string      i_type,
                      std::string      i_outFile,
@@ -98,16 +116,25 @@ class edge::io::WaveField {
                const t_elementChars  *i_elChars,
                const int_el         (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                const real_base      (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
-                     int_spType       i_spType = std::numeric_limits< int_spType >::max() );
+                     int_spType       i_spType = std::numeric_limits< int_spType >::max(),
+                     unsigned short   i_nInFlight = 0,
+                     unsigned short   i_nSds = 0 );
 
     /**
      * Writes the given dofs.
+     * In asynchronous mode, the DOFs are staged and written by the I/O thread.
+     * The call blocks only if all in-flight snapshots are in use.
      *
-     * @param i_time time of this snapshot
+     * @param i_time simulation time of this snapshot
      * @param i_limSync optional number of times the elements were limited since the last sync.
      **/
     void write( double         i_time,
                 unsigned int (*i_limSync)[N_CRUNS] = nullptr );
+
+    /**
+     * Completes pending asynchronous writes and logs how much of the write time was hidden.
+     **/
+    void finish();
 };
 
 #endif
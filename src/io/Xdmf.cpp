@@ -0,0 +1,232 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel wave field output: a single HDF5-file, described by XDMF.
+ **/
+#include "Xdmf.h"
+#include <fstream>
+#include "FileSystem.hpp"
+#include "logging.h"
+#include "parallel/global.h"
+#ifdef PP_USE_MPI
+#include "parallel/mpi_wrapper.inc"
+#endif
+
+edge::io::Xdmf::~Xdmf() {
+#ifdef PP_HAS_HDF5
+  if( m_xfer >= 0 ) H5Pclose( m_xfer );
+  if( m_file >= 0 ) H5Fclose( m_file );
+#endif
+}
+
+#ifdef PP_HAS_HDF5
+void edge::io::Xdmf::writeBlock( hid_t               i_loc,
+                                 std::string const & i_name,
+                                 unsigned long long  i_nRowsGlo,
+                                 unsigned long long  i_firstRow,
+                                 unsigned long long  i_nRows,
+                                 unsigned short      i_nCols,
+                                 hid_t               i_type,
+                                 void        const * i_data ) {
+  herr_t l_err;
+  int l_nDis = (i_nCols == 0) ? 1 : 2;
+
+  hsize_t l_dimsGlo[2] = { i_nRowsGlo, i_nCols };
+  hsize_t l_first[2]   = { i_firstRow, 0 };
+  hsize_t l_count[2]   = { i_nRows,    i_nCols };
+
+  // create the dataset
+  hid_t l_spFile = H5Screate_simple( l_nDis, l_dimsGlo, NULL );
+  EDGE_CHECK_GE( l_spFile, 0 );
+  hid_t l_dset = H5Dcreate( i_loc, i_name.c_str(), i_type, l_spFile, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  EDGE_CHECK_GE( l_dset, 0 );
+
+  // select our block, ranks without data participate through empty selections
+  hid_t l_spMem = H5Screate_simple( l_nDis, l_count, NULL );
+  EDGE_CHECK_GE( l_spMem, 0 );
+  if( i_nRows > 0 ) {
+    l_err = H5Sselect_hyperslab( l_spFile, H5S_SELECT_SET, l_first, NULL, l_count, NULL );
+  }
+  else {
+    l_err = H5Sselect_none( l_spFile );
+    EDGE_CHECK_GE( l_err, 0 );
+    l_err = H5Sselect_none( l_spMem );
+  }
+  EDGE_CHECK_GE( l_err, 0 );
+
+  l_err = H5Dwrite( l_dset, i_type, l_spMem, l_spFile, m_xfer, i_data );
+  EDGE_CHECK_GE( l_err, 0 );
+
+  H5Sclose( l_spMem );
+  H5Dclose( l_dset );
+  H5Sclose( l_spFile );
+}
+#endif
+
+void edge::io::Xdmf::writeXdmf() const {
+  if( parallel::g_rank != 0 ) return;
+
+  // types of the elements in XDMF
+  std::string l_topo;
+  if(      T_SDISC.ELEMENT == LINE   ) l_topo = "Polyline\" NodesPerElement=\"2";
+  else if( T_SDISC.ELEMENT == TRIA3  ) l_topo = "Triangle";
+  else if( T_SDISC.ELEMENT == QUAD4R ) l_topo = "Quadrilateral";
+  else if( T_SDISC.ELEMENT == TET4   ) l_topo = "Tetrahedron";
+  else if( T_SDISC.ELEMENT == HEX8R  ) l_topo = "Hexahedron";
+  else EDGE_LOG_FATAL << "missing element type " << T_SDISC.ELEMENT;
+
+  // the XDMF-file references the HDF5-file relative to its location
+  std::string l_dir, l_fileH5;
+  FileSystem::splitPathLast( m_pathH5, l_dir, l_fileH5 );
+
+  std::ofstream l_xdmf( m_pathXdmf, std::ios::out | std::ios::trunc );
+  EDGE_CHECK( l_xdmf.is_open() ) << "could not open " << m_pathXdmf;
+
+  l_xdmf << "<?xml version=\"1.0\" ?>\n"
+         << "<Xdmf Version=\"3.0\">\n"
+         << " <Domain>\n"
+         << "  <Grid Name=\"wave_field\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for( std::size_t l_st = 0; l_st < m_times.size(); l_st++ ) {
+    l_xdmf << "   <Grid Name=\"step_" << l_st << "\" GridType=\"Uniform\">\n"
+           << "    <Time Value=\"" << m_times[l_st] << "\"/>\n"
+           << "    <Topology TopologyType=\"" << l_topo << "\" NumberOfElements=\"" << m_nElsGlo << "\">\n"
+           << "     <DataItem Dimensions=\"" << m_nElsGlo << " " << C_ENT[T_SDISC.ELEMENT].N_VERTICES
+           << "\" NumberType=\"Int\" Precision=\"8\" Format=\"HDF\">" << l_fileH5 << ":/mesh/connect</DataItem>\n"
+           << "    </Topology>\n"
+           << "    <Geometry GeometryType=\"XYZ\">\n"
+           << "     <DataItem Dimensions=\"" << m_nVesGlo << " 3\" NumberType=\"Float\" Precision=\"4\" Format=\"HDF\">"
+           << l_fileH5 << ":/mesh/coords</DataItem>\n"
+           << "    </Geometry>\n";
+
+    for( std::size_t l_va = 0; l_va < m_varNames.size(); l_va++ ) {
+      l_xdmf << "    <Attribute Name=\"" << m_varNames[l_va] << "\" AttributeType=\"Scalar\" Center=\"Cell\">\n"
+             << "     <DataItem Dimensions=\"" << m_nElsGlo << "\" NumberType=\"Float\" Precision=\"4\" Format=\"HDF\">"
+             << l_fileH5 << ":/fields/" << l_st << "/" << m_varNames[l_va] << "</DataItem>\n"
+             << "    </Attribute>\n";
+    }
+    l_xdmf << "   </Grid>\n";
+  }
+
+  l_xdmf << "  </Grid>\n"
+         << " </Domain>\n"
+         << "</Xdmf>\n";
+}
+
+void edge::io::Xdmf::init( std::string           const & i_path,
+                           int_el                        i_nVe,
+                           std::vector< int_el > const & i_elPrint,
+                           t_vertexChars         const * i_veChars,
+                           int_el                const (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                           bool                          i_lim ) {
+#ifndef PP_HAS_HDF5
+  EDGE_LOG_FATAL << "XDMF output requires HDF5 support";
+#else
+#if defined(PP_USE_MPI) && !defined(H5_HAVE_PARALLEL)
+  EDGE_CHECK_EQ( parallel::g_nRanks, 1 ) << "XDMF output of MPI-parallel runs requires a parallel HDF5 library";
+#endif
+  m_pathH5   = i_path + ".h5";
+  m_pathXdmf = i_path + ".xdmf";
+  m_lim      = i_lim;
+  m_nEls     = i_elPrint.size();
+
+  // derive the global sizes and our offsets
+  unsigned long long l_sizes[2] = { (unsigned long long) i_nVe, m_nEls };
+  unsigned long long l_first[2] = { 0, 0 };
+  m_nVesGlo = l_sizes[0];
+  m_nElsGlo = l_sizes[1];
+#ifdef PP_USE_MPI
+  unsigned long long l_sizesGlo[2];
+  int l_errMpi = MPI_Exscan( l_sizes, l_first, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+  EDGE_CHECK_EQ( l_errMpi, MPI_SUCCESS );
+  if( parallel::g_rank == 0 ) { l_first[0] = 0; l_first[1] = 0; }
+  l_errMpi = MPI_Allreduce( l_sizes, l_sizesGlo, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+  EDGE_CHECK_EQ( l_errMpi, MPI_SUCCESS );
+  m_nVesGlo = l_sizesGlo[0];
+  m_nElsGlo = l_sizesGlo[1];
+#endif
+  m_firstVe = l_first[0];
+  m_firstEl = l_first[1];
+
+  // names of the variables
+  for( int_cfr l_ru = 0; l_ru < N_CRUNS; l_ru++ )
+    for( int_qt l_qt = 0; l_qt < N_QUANTITIES; l_qt++ )
+      m_varNames.push_back( "crun_" + std::to_string(l_ru) + "_var_" + std::to_string(l_qt) );
+  if( m_lim )
+    for( int_cfr l_ru = 0; l_ru < N_CRUNS; l_ru++ )
+      m_varNames.push_back( "crun_" + std::to_string(l_ru) + "_lim" );
+
+  // create the file
+  hid_t l_acc = H5Pcreate( H5P_FILE_ACCESS );
+  m_xfer = H5Pcreate( H5P_DATASET_XFER );
+#if defined(PP_USE_MPI) && defined(H5_HAVE_PARALLEL)
+  H5Pset_fapl_mpio( l_acc, MPI_COMM_WORLD, MPI_INFO_NULL );
+  H5Pset_dxpl_mpio( m_xfer, H5FD_MPIO_COLLECTIVE );
+#endif
+  m_file = H5Fcreate( m_pathH5.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, l_acc );
+  EDGE_CHECK_GE( m_file, 0 ) << "could not create " << m_pathH5;
+  H5Pclose( l_acc );
+
+  // write the mesh
+  std::vector< float > l_coords( std::size_t(i_nVe) * 3 );
+  for( int_el l_ve = 0; l_ve < i_nVe; l_ve++ )
+    for( unsigned short l_di = 0; l_di < 3; l_di++ )
+      l_coords[l_ve*3 + l_di] = i_veChars[l_ve].coords[l_di];
+
+  std::vector< long long > l_connect( m_nEls * C_ENT[T_SDISC.ELEMENT].N_VERTICES );
+  for( std::size_t l_el = 0; l_el < m_nEls; l_el++ )
+    for( unsigned short l_ve = 0; l_ve < C_ENT[T_SDISC.ELEMENT].N_VERTICES; l_ve++ )
+      l_connect[l_el * C_ENT[T_SDISC.ELEMENT].N_VERTICES + l_ve] = m_firstVe + i_elVe[ i_elPrint[l_el] ][l_ve];
+
+  hid_t l_mesh = H5Gcreate( m_file, "mesh", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  EDGE_CHECK_GE( l_mesh, 0 );
+  writeBlock( l_mesh, "coords",  m_nVesGlo, m_firstVe, i_nVe,  3,                                    H5T_NATIVE_FLOAT,    l_coords.data()  );
+  writeBlock( l_mesh, "connect", m_nElsGlo, m_firstEl, m_nEls, C_ENT[T_SDISC.ELEMENT].N_VERTICES, H5T_NATIVE_LLONG, l_connect.data() );
+  H5Gclose( l_mesh );
+
+  hid_t l_fields = H5Gcreate( m_file, "fields", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  EDGE_CHECK_GE( l_fields, 0 );
+  H5Gclose( l_fields );
+#endif
+}
+
+void edge::io::Xdmf::write( double        i_time,
+                            float const * i_dofs,
+                            float const * i_limSync ) {
+#ifdef PP_HAS_HDF5
+  EDGE_CHECK_GE( m_file, 0 );
+
+  std::string l_name = "/fields/" + std::to_string( m_times.size() );
+  hid_t l_step = H5Gcreate( m_file, l_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  EDGE_CHECK_GE( l_step, 0 );
+
+  // the staged data is stored variable by variable
+  for( std::size_t l_va = 0; l_va < m_varNames.size(); l_va++ ) {
+    float const * l_data = (l_va < N_CRUNS*N_QUANTITIES) ? i_dofs    + l_va                         * m_nEls
+                                                         : i_limSync + (l_va - N_CRUNS*N_QUANTITIES) * m_nEls;
+    writeBlock( l_step, m_varNames[l_va], m_nElsGlo, m_firstEl, m_nEls, 0, H5T_NATIVE_FLOAT, l_data );
+  }
+  H5Gclose( l_step );
+  H5Fflush( m_file, H5F_SCOPE_GLOBAL );
+
+  m_times.push_back( i_time );
+  writeXdmf();
+#endif
+}
@@ -0,0 +1,151 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Parallel wave field output: a single HDF5-file, described by XDMF.
+ **/
+#ifndef EDGE_IO_XDMF_H
+#define EDGE_IO_XDMF_H
+
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#ifdef PP_HAS_HDF5
+#include "hdf5.h"
+#endif
+
+namespace edge {
+  namespace io {
+    class Xdmf;
+  }
+}
+
+/**
+ * Writes the wave field of all ranks to a single HDF5-file.
+ * Coordinates and connectivity are written once, followed by the element-wise fields of every step.
+ * Every rank owns a contiguous block of the vertices and elements, the offsets follow from the ranks' sizes.
+ * An XDMF-file, describing the HDF5-datasets as temporal collection, is rewritten by rank 0 after every step.
+ *
+ * Layout of the HDF5-file:
+ *   /mesh/coords:    [#vertices][3], single precision.
+ *   /mesh/connect:   [#elements][#vertices per element], 64 bit integers.
+ *   /fields/<step>/: [#elements] per variable, single precision.
+ **/
+class edge::io::Xdmf {
+  private:
+    //! path to the HDF5-file
+    std::string m_pathH5;
+
+    //! path to the XDMF-file
+    std::string m_pathXdmf;
+
+    //! number of vertices of all ranks
+    unsigned long long m_nVesGlo = 0;
+
+    //! number of elements of all ranks
+    unsigned long long m_nElsGlo = 0;
+
+    //! first vertex of this rank
+    unsigned long long m_firstVe = 0;
+
+    //! first element of this rank
+    unsigned long long m_firstEl = 0;
+
+    //! number of elements of this rank
+    unsigned long long m_nEls = 0;
+
+    //! names of the variables
+    std::vector< std::string > m_varNames;
+
+    //! times of the written steps
+    std::vector< double > m_times;
+
+    //! true if the steps contain limiter info
+    bool m_lim = false;
+
+#ifdef PP_HAS_HDF5
+    //! HDF5-file
+    hid_t m_file = -1;
+
+    //! property list of the transfers (collective for parallel HDF5)
+    hid_t m_xfer = -1;
+
+    /**
+     * Writes a contiguous block of rows of a dataset; all ranks participate.
+     *
+     * @param i_loc location of the dataset.
+     * @param i_name name of the dataset.
+     * @param i_nRowsGlo number of rows of all ranks.
+     * @param i_firstRow first row of this rank.
+     * @param i_nRows number of rows of this rank.
+     * @param i_nCols number of columns, 0 for a one-dimensional dataset.
+     * @param i_type HDF5 type of the file and memory data.
+     * @param i_data data of this rank.
+     **/
+    void writeBlock( hid_t               i_loc,
+                     std::string const & i_name,
+                     unsigned long long  i_nRowsGlo,
+                     unsigned long long  i_firstRow,
+                     unsigned long long  i_nRows,
+                     unsigned short      i_nCols,
+                     hid_t               i_type,
+                     void        const * i_data );
+#endif
+
+    /**
+     * Writes the XDMF-file (rank 0 only).
+     **/
+    void writeXdmf() const;
+
+  public:
+    /**
+     * Destructor, closes the HDF5-file.
+     **/
+    ~Xdmf();
+
+    /**
+     * Creates the HDF5-file and writes the mesh. Collective operation.
+     *
+     * @param i_path path of the output, without extension.
+     * @param i_nVe number of vertices of this rank.
+     * @param i_elPrint print elements of this rank.
+     * @param i_veChars vertex characteristics.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_lim true if the steps contain limiter info.
+     **/
+    void init( std::string           const & i_path,
+               int_el                        i_nVe,
+               std::vector< int_el > const & i_elPrint,
+               t_vertexChars         const * i_veChars,
+               int_el                const (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+               bool                          i_lim );
+
+    /**
+     * Appends a step. Collective operation.
+     *
+     * @param i_time simulation time of the step.
+     * @param i_dofs first-order DOFs of the print elements, as given by Vtk::reorder.
+     * @param i_limSync limiter info of the print elements, as given by Vtk::reorder; ignored if the output has no limiter info.
+     **/
+    void write( double        i_time,
+                float const * i_dofs,
+                float const * i_limSync );
+};
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the single-file HDF5 output.
+ **/
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "Xdmf.h"
+
+TEST_CASE( "Xdmf: Mesh and steps in a single HDF5-file.", "[Xdmf]" ) {
+  // two elements, each using the first vertices
+  unsigned short const l_nVesEl = C_ENT[T_SDISC.ELEMENT].N_VERTICES;
+  int_el l_nVe = l_nVesEl+1;
+
+  std::vector< t_vertexChars > l_veChars( l_nVe );
+  for( int_el l_ve = 0; l_ve < l_nVe; l_ve++ )
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_veChars[l_ve].coords[l_di] = l_ve + 0.25 * l_di;
+
+  std::vector< int_el > l_elVeRaw( 3*l_nVesEl );
+  for( int_el l_el = 0; l_el < 3; l_el++ )
+    for( unsigned short l_ve = 0; l_ve < l_nVesEl; l_ve++ ) l_elVeRaw[l_el*l_nVesEl + l_ve] = l_el + l_ve;
+  int_el (*l_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES] = (int_el (*)[C_ENT[T_SDISC.ELEMENT].N_VERTICES]) l_elVeRaw.data();
+
+  // print the first and last element
+  std::vector< int_el > l_elPrint = { 0, 2 };
+
+  // staged data: element as leading dimension
+  std::vector< float > l_dofs( 2 * N_QUANTITIES * N_CRUNS );
+  for( std::size_t l_en = 0; l_en < l_dofs.size(); l_en++ ) l_dofs[l_en] = l_en;
+
+  std::string l_path = "xdmf_test";
+
+#ifdef PP_HAS_HDF5
+  {
+    edge::io::Xdmf l_xdmf;
+    l_xdmf.init( l_path,
+                 l_nVe,
+                 l_elPrint,
+                 l_veChars.data(),
+                 l_elVe,
+                 false );
+    l_xdmf.write( 0.5, l_dofs.data(), nullptr );
+    for( std::size_t l_en = 0; l_en < l_dofs.size(); l_en++ ) l_dofs[l_en] *= 2;
+    l_xdmf.write( 1.0, l_dofs.data(), nullptr );
+  }
+
+  // check the mesh
+  hid_t l_file = H5Fopen( (l_path+".h5").c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  REQUIRE( l_file >= 0 );
+
+  std::vector< long long > l_connect( 2*l_nVesEl );
+  hid_t l_dset = H5Dopen( l_file, "/mesh/connect", H5P_DEFAULT );
+  REQUIRE( H5Dread( l_dset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, l_connect.data() ) >= 0 );
+  H5Dclose( l_dset );
+  for( unsigned short l_ve = 0; l_ve < l_nVesEl; l_ve++ ) {
+    REQUIRE( l_connect[l_ve]          == l_ve   );
+    REQUIRE( l_connect[l_nVesEl+l_ve] == l_ve+2 );
+  }
+
+  std::vector< float > l_coords( 3*l_nVe );
+  l_dset = H5Dopen( l_file, "/mesh/coords", H5P_DEFAULT );
+  REQUIRE( H5Dread( l_dset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, l_coords.data() ) >= 0 );
+  H5Dclose( l_dset );
+  REQUIRE( l_coords[3*1+2] == Approx(1.5) );
+
+  // check the second step
+  std::string l_name = "/fields/1/crun_" + std::to_string(N_CRUNS-1) + "_var_" + std::to_string(N_QUANTITIES-1);
+  float l_var[2];
+  l_dset = H5Dopen( l_file, l_name.c_str(), H5P_DEFAULT );
+  REQUIRE( H5Dread( l_dset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, l_var ) >= 0 );
+  H5Dclose( l_dset );
+  REQUIRE( l_var[0] == Approx( 2 * (2*N_QUANTITIES*N_CRUNS - 2) ) );
+  REQUIRE( l_var[1] == Approx( 2 * (2*N_QUANTITIES*N_CRUNS - 1) ) );
+
+  H5Fclose( l_file );
+
+  // the XDMF-file references both steps
+  std::ifstream l_xdmfFile( l_path+".xdmf" );
+  std::string l_xdmfStr( (std::istreambuf_iterator< char >( l_xdmfFile )), std::istreambuf_iterator< char >() );
+  REQUIRE( l_xdmfStr.find( "<Time Value=\"0.5\"/>" ) != std::string::npos );
+  REQUIRE( l_xdmfStr.find( "<Time Value=\"1\"/>"   ) != std::string::npos );
+  REQUIRE( l_xdmfStr.find( "xdmf_test.h5:/fields/1/crun_0_var_0" ) != std::string::npos );
+
+  std::remove( (l_path+".h5").c_str() );
+  std::remove( (l_path+".xdmf").c_str() );
+#endif
+}
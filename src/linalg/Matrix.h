@@ -905,7 +905,7 @@ class edge::linalg::Matrix {
      * @param i_tol tolerance/delta which is considered to be zero for the matrix entries.
      * @param i_subMatRows numeber of rows in the sub-matrix extracted.
      * @param i_subMatCols numeber of cols in the sub-matrix extracted.
-     * @param i_fillIn fill in strategy.
+     * @param i_fillIn fill in strategy: none, qfma or dense (all entries of the sub-matrix are stored).
      *
      * @paramt TL_T_REAL floating point precision.
      **/
@@ -929,6 +929,11 @@ class edge::linalg::Matrix {
       if( i_fillIn == "qfma" ) {
         fillInQfma( i_nRows, i_nCols, i_a, l_tmpDe, i_tol );
       }
+      else if( i_fillIn == "dense" ) {
+        for( unsigned int l_va = 0; l_va < i_nRows*i_nCols; l_va++ )
+          if( std::abs( l_tmpDe[l_va] ) <= i_tol ) l_tmpDe[l_va] = std::numeric_limits< TL_T_REAL >::max();
+      }
+      else EDGE_CHECK_EQ( i_fillIn, "none" );
 
       // temporary coord matrix
       t_matCrd l_tmpCrd;
@@ -947,7 +952,7 @@ class edge::linalg::Matrix {
 
       // replace max-values, generated by fill-in with zeros
       for( std::size_t l_nz = 0; l_nz < o_csc.val.size(); l_nz++ ) {
-        if( o_csc.val[l_nz] == std::numeric_limits< TL_T_REAL >::max() ) {
+        if( o_csc.val[l_nz] == static_cast< real_base >( std::numeric_limits< TL_T_REAL >::max() ) ) {
           EDGE_CHECK_NE( i_fillIn, "none" );
           o_csc.val[l_nz] = 0;
         }
@@ -156,6 +156,26 @@ TEST_CASE( "Matrix: Tests the dense to compressed sparse column format conversio
   REQUIRE( l_res.rowIdx[3] == 0 );
   REQUIRE( l_res.rowIdx[4] == 1 );
   REQUIRE( l_res.rowIdx[5] == 2 );
+
+  // dense fill-in of the upper-left 2x3 sub-matrix
+  edge::linalg::Matrix::denseToCsc( 3, 3, l_mat[0], l_res, 0.000001, 2, 3, "dense" );
+  REQUIRE( l_res.val.size()    == 6 );
+  REQUIRE( l_res.rowIdx.size() == 6 );
+  REQUIRE( l_res.colPtr.size() == 4 );
+
+  REQUIRE( l_res.val[0] == (real_base) 1.0 );
+  REQUIRE( l_res.val[1] == (real_base) 0.0 );
+  REQUIRE( l_res.val[2] == (real_base) 0.0 );
+  REQUIRE( l_res.val[3] == (real_base) 0.0 );
+  REQUIRE( l_res.val[4] == (real_base) 2.0 );
+  REQUIRE( l_res.val[5] == (real_base) 3.0 );
+
+  for( unsigned short l_co = 0; l_co < 4; l_co++ ) {
+    REQUIRE( l_res.colPtr[l_co] == l_co*2 );
+  }
+  for( unsigned short l_nz = 0; l_nz < 6; l_nz++ ) {
+    REQUIRE( l_res.rowIdx[l_nz] == l_nz%2 );
+  }
 }
 
 TEST_CASE( "Matrix: Tests the qfma fill-in strategy", "[matrix][qfmaFillIn]") {
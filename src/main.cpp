@@ -22,6 +22,7 @@
  **/
 
 #include "parallel/Mpi.h"
+#include "parallel/HaloCodec.h"
 #include "parallel/Shared.h"
 
 #include "io/logging.h"
@@ -30,7 +31,9 @@ INITIALIZE_EASYLOGGINGPP
 #endif
 
 #include <limits>
+#include <list>
 #include <string>
+#include <vector>
 #include "io/OptionParser.h"
 #include "io/Config.h"
 #include "dg/Basis.h"
@@ -51,6 +54,7 @@ INITIALIZE_EASYLOGGINGPP
 #include "mesh/SparseTypes.hpp"
 #include "mesh/setup_dep.inc"
 #include "monitor/Timer.hpp"
+#include "monitor/Phases.hpp"
 #include "monitor/instrument.hpp"
 
 // include dependencies of the setups
@@ -79,6 +83,8 @@ int main( int i_argc, char *i_argv[] ) {
   // create a timer
   edge::monitor::Timer l_timer;
   l_timer.start();
+  edge::monitor::Phases l_phases;
+  l_phases.start( "runtime and config" );
   PP_INSTR_REG_DEF(init)
   PP_INSTR_REG_BEG(init,"init")
 
@@ -132,11 +138,17 @@ int main( int i_argc, char *i_argv[] ) {
   EDGE_LOG_INFO << "parsing xml config";
   edge::io::Config l_config( l_options.getXmlPath() );
 
+  // configure the work distribution of the workers
+  l_shared.config( l_config.m_sharedSpinIters,
+                   l_config.m_sharedChunkSize );
+
   // parse mesh
+  l_phases.start( "mesh" );
   EDGE_LOG_INFO << "parsing mesh";
 #include "mesh/setup.inc"
 
   // get the data layout
+  l_phases.start( "data layout" );
   EDGE_LOG_INFO << "taking care of data layout now";
 #include "data/setup.inc"
 
@@ -148,6 +160,7 @@ int main( int i_argc, char *i_argv[] ) {
                          l_enLayouts[2].nEnts );
 
   // setup constant data structures for DG
+  l_phases.start( "basis and dg" );
   EDGE_LOG_INFO << "setting up basis and DG-structure";
   edge::dg::Basis l_basis( T_SDISC.ELEMENT, ORDER );
   l_basis.print();
@@ -156,6 +169,7 @@ int main( int i_argc, char *i_argv[] ) {
 #include "sc/setup.inc"
 
   // initialize internal chars and connectivity information
+  l_phases.start( "chars and connectivity" );
   EDGE_LOG_INFO << "initializing internal chars and connectivity info";
   l_mesh.getVeChars( l_internal.m_vertexChars  );
   l_mesh.getElChars( l_internal.m_elementChars );
@@ -197,11 +211,13 @@ std::vector< int_gid > l_gIdsEl;
 l_mesh.getGIdsEl( l_gIdsEl );
 
   // setup receivers
+  l_phases.start( "receivers" );
 #include "io/inc/setup_recv.inc"
 
   // time step statistics
   double l_dT[3];
 
+  l_phases.start( "equation-specific" );
   EDGE_LOG_INFO << "performing equation-specific setup";
   PP_INSTR_REG_DEF(equSpe)
   PP_INSTR_REG_BEG(equSpe,"eq_spec_setup")
@@ -214,7 +230,11 @@ l_mesh.getGIdsEl( l_gIdsEl );
 #endif
   PP_INSTR_REG_END(equSpe)
 
+  // messages to ranks on the same node use shared-memory windows, requires all MPI groups
+  if( l_config.m_mpiShm ) l_mpi.initShm();
+
   // determine global time step stats
+  l_phases.start( "time stepping and output" );
   double l_dtG[3];
 #ifdef PP_USE_MPI
   MPI_Allreduce( l_dT,   l_dtG,   1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
@@ -227,17 +247,25 @@ l_mesh.getGIdsEl( l_gIdsEl );
 #endif
   l_dtG[1] /= edge::parallel::g_nRanks;
 
-  // construct single GTS cluster
-  edge::time::TimeGroupStatic l_cluster( std::numeric_limits< int_ts >::max(),
-                                         1,
-                                         l_internal );
+  // construct clusters, time group #tg advances with 2^tg times the fundamental time step
+  std::vector< edge::time::TimeGroupStatic > l_clusters;
+  l_clusters.reserve( l_enLayouts[2].timeGroups.size() );
+  for( int_tg l_tg = 0; l_tg < l_enLayouts[2].timeGroups.size(); l_tg++ ) {
+    l_clusters.emplace_back( std::numeric_limits< int_ts >::max(),
+                             int_ts(1) << l_tg,
+                             l_internal );
+  }
+  if( l_clusters.size() > 1 ) {
+    EDGE_LOG_INFO << "using local time stepping with " << l_clusters.size() << " time groups";
+  }
 
   EDGE_LOG_INFO << "time step stats coming thru (min,ave,max): "
                 << l_dtG[0] << ", " << l_dtG[1] << ", " << l_dtG[2];
 
-  // add cluster to time manager
+  // add clusters to time manager
   edge::time::Manager l_time( l_dtG[0], l_shared, l_mpi, l_receivers, l_recvsSf );
-  l_time.add( &l_cluster );
+  for( std::size_t l_cl = 0; l_cl < l_clusters.size(); l_cl++ )
+    l_time.add( &l_clusters[l_cl] );
 
   // set up simulation times and synchronization intervals
   double l_simTime = 0;
@@ -257,7 +285,9 @@ l_mesh.getGIdsEl( l_gIdsEl );
                                 l_internal.m_elementChars,
                                 l_internal.m_connect.elVe,
                                 l_internal.m_elementModePrivate1,
-                                l_config.m_waveFieldSpType );
+                                l_config.m_waveFieldSpType,
+                                l_config.m_waveFieldInFlight,
+                                l_config.m_waveFieldRefine );
 
   // write setup
   EDGE_LOG_INFO << "reached synchronization point #0";
@@ -287,6 +317,7 @@ l_mesh.getGIdsEl( l_gIdsEl );
   l_timer.end();
   PP_INSTR_REG_END(init)
   EDGE_LOG_INFO << "initialization phase took us " << l_timer.elapsed() << " seconds";
+  l_phases.print();
   l_timer.reset();
 
   PP_INSTR_REG_DEF(comp)
@@ -330,7 +361,7 @@ l_mesh.getGIdsEl( l_gIdsEl );
     // write this sync step
     if( l_simTime + TOL.TIME > (l_stepWf+1)*l_config.m_waveFieldInt ) {
       EDGE_LOG_INFO << "  writing wave field #" << l_stepWf+1;
-      l_writer.write( l_stepTime,
+      l_writer.write( l_simTime,
                       l_internal.m_globalShared2[0].limSync );
       l_stepWf++;
     }
@@ -361,12 +392,16 @@ l_mesh.getGIdsEl( l_gIdsEl );
     if( l_syncInt < TOL.TIME ) l_syncInt = l_endTime;
   }
 
+  // complete pending wave field output
+  l_writer.finish();
+
   // print time info for compute
   l_timer.end();
   PP_INSTR_REG_END(comp)
   EDGE_LOG_INFO << "that's the duration of the computations ("
-                << l_cluster.getUpdatesPer() << " time steps): "
+                << l_clusters[0].getUpdatesPer() << " time steps): "
                 << l_timer.elapsed() << " seconds";
+  l_time.logStats();
   l_timer.reset();
   PP_INSTR_REG_DEF(fin)
   PP_INSTR_REG_BEG(fin,"fin")
@@ -0,0 +1,114 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmarks the derivation of dense element ids from points.
+ **/
+#include <catch.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+#define private public
+#include "regular/Tet.h"
+#undef private
+#include "data/SparseEntities.hpp"
+#include "io/logging.h"
+#include "monitor/Timer.hpp"
+
+TEST_CASE( "Benchmark: Point location through brute force and the bounding volume hierarchy.", "[.][bench][Bvh]" ) {
+  // regular mesh on a single rank
+  unsigned int l_nHex[3] = { 24, 24, 24 };
+  double l_corner[3] = { 0, 0, 0 };
+  double l_dX[3] = { 1, 1, 1 };
+
+  edge::mesh::regular::Tet l_mesh;
+  l_mesh.init( l_nHex, 0, 1, l_corner, l_dX );
+
+  int_el l_nEl = l_mesh.getNEl();
+  int_el l_nVe = l_mesh.getVeLayout().nEnts;
+  t_enLayout l_elLayout = l_mesh.getElLayout();
+
+  std::vector< int_el > l_elVe( 4*std::size_t(l_nEl) );
+  std::vector< t_vertexChars > l_veChars( l_nVe );
+  l_mesh.getElVe(    (int_el (*)[4]) l_elVe.data() );
+  l_mesh.getVeChars( l_veChars.data() );
+
+  // random points, partially outside of the mesh
+  int_el l_nPts = 500;
+  std::vector< real_mesh > l_pts( 3*std::size_t(l_nPts) );
+  std::mt19937 l_gen( 1511 );
+  std::uniform_real_distribution< real_mesh > l_uni( -2, 26 );
+  for( std::size_t l_en = 0; l_en < l_pts.size(); l_en++ ) l_pts[l_en] = l_uni( l_gen );
+  real_mesh const (*l_ptCrds)[3] = (real_mesh const (*)[3]) l_pts.data();
+
+  edge::monitor::Timer l_timer;
+
+  // brute force
+  std::vector< int_el > l_ref( l_nPts );
+  std::vector< real_mesh > l_refDist( l_nPts );
+
+  l_timer.start();
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( int_el l_pt = 0; l_pt < l_nPts; l_pt++ ) {
+    l_ref[l_pt]     = std::numeric_limits< int_el >::max();
+    l_refDist[l_pt] = std::numeric_limits< real_mesh >::max();
+
+    for( int_el l_el = 0; l_el < l_nEl; l_el++ ) {
+      real_mesh l_veCrds[3*4];
+      for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_veCrds[l_di*4 + l_ve] = l_veChars[ l_elVe[l_el*4 + l_ve] ].coords[l_di];
+
+      real_mesh l_crds[3] = { l_ptCrds[l_pt][0], l_ptCrds[l_pt][1], l_ptCrds[l_pt][2] };
+      edge::linalg::Geom::closestPoint( TET4, l_veCrds, l_crds );
+      real_mesh l_dist = edge::linalg::GeomT< 3 >::norm( l_crds, l_ptCrds[l_pt] );
+
+      if( l_dist < l_refDist[l_pt] ) {
+        l_ref[l_pt]     = l_el;
+        l_refDist[l_pt] = l_dist;
+      }
+    }
+  }
+  l_timer.end();
+  double l_timeBf = l_timer.elapsed();
+
+  // bounding volume hierarchy
+  std::vector< int_el > l_de( l_nPts );
+
+  l_timer.reset();
+  l_timer.start();
+  edge::data::SparseEntities::ptToEn( TET4,
+                                      l_nPts,
+                                      l_ptCrds,
+                                      l_elLayout,
+                                      l_elVe.data(),
+                                      l_veChars.data(),
+                                      l_de.data() );
+  l_timer.end();
+  double l_timeBvh = l_timer.elapsed();
+
+  EDGE_LOG_INFO << "point location, #elements: " << l_nEl << ", #points: " << l_nPts;
+  EDGE_LOG_INFO << "  brute force: " << l_timeBf  << " s";
+  EDGE_LOG_INFO << "  bvh:         " << l_timeBvh << " s";
+  EDGE_LOG_INFO << "  speedup:     " << l_timeBf / l_timeBvh;
+
+  for( int_el l_pt = 0; l_pt < l_nPts; l_pt++ ) REQUIRE( l_de[l_pt] == l_ref[l_pt] );
+}
@@ -0,0 +1,264 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy of axis-aligned boxes.
+ **/
+#ifndef EDGE_MESH_BVH_HPP
+#define EDGE_MESH_BVH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "io/logging.h"
+
+namespace edge {
+  namespace mesh {
+    template< typename TL_T_REAL,
+              typename TL_T_LID >
+    class Bvh;
+  }
+}
+
+/**
+ * Bounding volume hierarchy (BVH) of axis-aligned bounding boxes (AABBs).
+ * The hierarchy is built top-down by splitting the boxes at the median of their centers along the longest extent.
+ * Queries search for the nearest entity w.r.t. a user-defined distance, where the distance of a point to an entity's box is used as lower bound.
+ * Points inside of an entity (distance zero) prune all boxes, which don't contain the point.
+ * Pruning is slightly conservative, such that ties in the distance are found despite rounding.
+ *
+ * @paramt TL_T_REAL floating point type.
+ * @paramt TL_T_LID integral type of the entity ids.
+ **/
+template< typename TL_T_REAL,
+          typename TL_T_LID >
+class edge::mesh::Bvh {
+  private:
+    //! node of the hierarchy
+    typedef struct {
+      //! bounding box: [0][*]: minimum, [1][*]: maximum
+      TL_T_REAL box[2][3];
+      //! first entry in the ids (leaves) or id of the right child (inner nodes), left child is the next node
+      TL_T_LID first;
+      //! number of ids (leaves), zero for inner nodes
+      TL_T_LID size;
+    } Node;
+
+    //! nodes, the root is the first one
+    std::vector< Node > m_nodes;
+
+    //! entity ids, ordered by the leaves
+    std::vector< TL_T_LID > m_ids;
+
+    //! boxes of the entities
+    std::vector< TL_T_REAL > m_boxes;
+
+    //! maximum number of entities per leaf
+    TL_T_LID m_leafSize = 4;
+
+    /**
+     * Gets the squared distance of a point to a box.
+     *
+     * @param i_box bounding box.
+     * @param i_pt point.
+     * @return squared distance, zero if the point is inside.
+     **/
+    static TL_T_REAL distSq( TL_T_REAL const i_box[2][3],
+                             TL_T_REAL const i_pt[3] ) {
+      TL_T_REAL l_dist = 0;
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        TL_T_REAL l_diff = 0;
+        if(      i_pt[l_di] < i_box[0][l_di] ) l_diff = i_box[0][l_di] - i_pt[l_di];
+        else if( i_pt[l_di] > i_box[1][l_di] ) l_diff = i_pt[l_di] - i_box[1][l_di];
+        l_dist += l_diff * l_diff;
+      }
+      return l_dist;
+    }
+
+    /**
+     * Recursively builds the hierarchy for a range of ids.
+     *
+     * @param i_first first id.
+     * @param i_size number of ids.
+     **/
+    void build( TL_T_LID i_first,
+                TL_T_LID i_size ) {
+      TL_T_LID l_no = m_nodes.size();
+      m_nodes.push_back( Node() );
+
+      // bounding box of the boxes and of their centers
+      TL_T_REAL l_ctrs[2][3];
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        m_nodes[l_no].box[0][l_di] = l_ctrs[0][l_di] =  std::numeric_limits< TL_T_REAL >::max();
+        m_nodes[l_no].box[1][l_di] = l_ctrs[1][l_di] =  std::numeric_limits< TL_T_REAL >::lowest();
+      }
+      for( TL_T_LID l_id = i_first; l_id < i_first+i_size; l_id++ ) {
+        TL_T_REAL const *l_box = &m_boxes[ std::size_t(m_ids[l_id]) * 6 ];
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          m_nodes[l_no].box[0][l_di] = std::min( m_nodes[l_no].box[0][l_di], l_box[l_di]   );
+          m_nodes[l_no].box[1][l_di] = std::max( m_nodes[l_no].box[1][l_di], l_box[3+l_di] );
+
+          TL_T_REAL l_ctr = (l_box[l_di] + l_box[3+l_di]) / 2;
+          l_ctrs[0][l_di] = std::min( l_ctrs[0][l_di], l_ctr );
+          l_ctrs[1][l_di] = std::max( l_ctrs[1][l_di], l_ctr );
+        }
+      }
+
+      // create a leaf
+      if( i_size <= m_leafSize ) {
+        m_nodes[l_no].first = i_first;
+        m_nodes[l_no].size  = i_size;
+        return;
+      }
+
+      // split at the median of the centers along the longest extent
+      unsigned short l_ax = 0;
+      for( unsigned short l_di = 1; l_di < 3; l_di++ ) {
+        if( l_ctrs[1][l_di] - l_ctrs[0][l_di] > l_ctrs[1][l_ax] - l_ctrs[0][l_ax] ) l_ax = l_di;
+      }
+
+      TL_T_LID l_sizeL = i_size / 2;
+      TL_T_REAL const *l_boxes = m_boxes.data();
+      std::nth_element( m_ids.begin() + i_first,
+                        m_ids.begin() + i_first + l_sizeL,
+                        m_ids.begin() + i_first + i_size,
+                        [l_boxes, l_ax]( TL_T_LID i_a, TL_T_LID i_b ) {
+                          TL_T_REAL l_ctrA = l_boxes[std::size_t(i_a)*6 + l_ax] + l_boxes[std::size_t(i_a)*6 + 3 + l_ax];
+                          TL_T_REAL l_ctrB = l_boxes[std::size_t(i_b)*6 + l_ax] + l_boxes[std::size_t(i_b)*6 + 3 + l_ax];
+                          return l_ctrA < l_ctrB || ( l_ctrA == l_ctrB && i_a < i_b );
+                        } );
+
+      m_nodes[l_no].size = 0;
+      build( i_first,         l_sizeL        );
+      m_nodes[l_no].first = m_nodes.size();
+      build( i_first+l_sizeL, i_size-l_sizeL );
+    }
+
+  public:
+    /**
+     * Builds the hierarchy.
+     *
+     * @param i_nEns number of entities.
+     * @param i_boxes bounding boxes of the entities: [*][0][]: minimum, [*][1][]: maximum.
+     * @param i_leafSize maximum number of entities per leaf.
+     **/
+    void init( TL_T_LID         i_nEns,
+               TL_T_REAL const (*i_boxes)[2][3],
+               TL_T_LID         i_leafSize = 4 ) {
+      EDGE_CHECK_GT( i_leafSize, 0 );
+      m_leafSize = i_leafSize;
+
+      m_boxes.resize( std::size_t(i_nEns) * 6 );
+      m_ids.resize( i_nEns );
+      for( TL_T_LID l_en = 0; l_en < i_nEns; l_en++ ) {
+        m_ids[l_en] = l_en;
+        for( unsigned short l_mm = 0; l_mm < 2; l_mm++ )
+          for( unsigned short l_di = 0; l_di < 3; l_di++ )
+            m_boxes[std::size_t(l_en)*6 + l_mm*3 + l_di] = i_boxes[l_en][l_mm][l_di];
+      }
+
+      m_nodes.clear();
+      if( i_nEns > 0 ) {
+        m_nodes.reserve( 2 * (i_nEns / m_leafSize + 1) );
+        build( 0, i_nEns );
+      }
+    }
+
+    /**
+     * Gets the number of nodes in the hierarchy.
+     *
+     * @return number of nodes.
+     **/
+    std::size_t nNodes() const {
+      return m_nodes.size();
+    }
+
+    /**
+     * Searches for the nearest entity.
+     * The distance of the point to an entity has to be bounded from below by the distance to the entity's box.
+     * Ties are broken by the smaller entity id.
+     *
+     * @param i_pt coordinates of the point.
+     * @param i_dist functor computing the distance of the point to an entity: TL_T_REAL i_dist( TL_T_LID ).
+     * @param o_dist will be set to the distance of the nearest entity, std::numeric_limits< TL_T_REAL >::max() if the hierarchy is empty.
+     * @return id of the nearest entity, std::numeric_limits< TL_T_LID >::max() if the hierarchy is empty.
+     *
+     * @paramt TL_T_DIST type of the distance functor.
+     **/
+    template< typename TL_T_DIST >
+    TL_T_LID nearest( TL_T_REAL const  i_pt[3],
+                      TL_T_DIST        i_dist,
+                      TL_T_REAL       &o_dist ) const {
+      TL_T_LID l_nearest = std::numeric_limits< TL_T_LID >::max();
+      o_dist = std::numeric_limits< TL_T_REAL >::max();
+      if( m_nodes.size() == 0 ) return l_nearest;
+
+      // squared distance of the nearest entity, used for pruning
+      TL_T_REAL l_distSq = std::numeric_limits< TL_T_REAL >::max();
+
+      // relative slack of the pruning, which accounts for rounding in the box and entity distances
+      TL_T_REAL l_slack = 1 + 256 * std::numeric_limits< TL_T_REAL >::epsilon();
+
+      // stack of nodes, which have to be visited, and their squared box distances
+      std::vector< std::pair< TL_T_LID, TL_T_REAL > > l_stack;
+      l_stack.reserve( 64 );
+      l_stack.push_back( std::make_pair( TL_T_LID(0), distSq( m_nodes[0].box, i_pt ) ) );
+
+      while( l_stack.size() > 0 ) {
+        TL_T_LID  l_no  = l_stack.back().first;
+        TL_T_REAL l_bSq = l_stack.back().second;
+        l_stack.pop_back();
+
+        // prune if the box is further away than the nearest entity
+        if( l_bSq > l_distSq ) continue;
+
+        Node const & l_node = m_nodes[l_no];
+        if( l_node.size > 0 ) {
+          for( TL_T_LID l_id = l_node.first; l_id < l_node.first+l_node.size; l_id++ ) {
+            TL_T_LID l_en = m_ids[l_id];
+            TL_T_REAL const (*l_box)[3] = (TL_T_REAL const (*)[3]) &m_boxes[ std::size_t(l_en)*6 ];
+            if( distSq( l_box, i_pt ) > l_distSq ) continue;
+
+            TL_T_REAL l_dist = i_dist( l_en );
+            if( l_dist < o_dist || ( l_dist == o_dist && l_en < l_nearest ) ) {
+              o_dist    = l_dist;
+              l_distSq  = l_dist * l_dist * l_slack;
+              l_nearest = l_en;
+            }
+          }
+        }
+        else {
+          // visit the closer child first
+          TL_T_LID l_chs[2] = { TL_T_LID(l_no+1), l_node.first };
+          TL_T_REAL l_chSq[2];
+          for( unsigned short l_ch = 0; l_ch < 2; l_ch++ ) l_chSq[l_ch] = distSq( m_nodes[ l_chs[l_ch] ].box, i_pt );
+
+          unsigned short l_fi = (l_chSq[1] < l_chSq[0]) ? 1 : 0;
+          if( l_chSq[1-l_fi] <= l_distSq ) l_stack.push_back( std::make_pair( l_chs[1-l_fi], l_chSq[1-l_fi] ) );
+          if( l_chSq[  l_fi] <= l_distSq ) l_stack.push_back( std::make_pair( l_chs[  l_fi], l_chSq[  l_fi] ) );
+        }
+      }
+
+      return l_nearest;
+    }
+};
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the bounding volume hierarchy.
+ **/
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <catch.hpp>
+#include "Bvh.hpp"
+
+TEST_CASE( "Bvh: Nearest boxes.", "[Bvh][nearest]" ) {
+  // unit cubes along the diagonal and a duplicate of the second one
+  float l_boxes[5][2][3] = { { {0, 0, 0}, {1, 1, 1} },
+                             { {2, 2, 2}, {3, 3, 3} },
+                             { {4, 4, 4}, {5, 5, 5} },
+                             { {2, 2, 2}, {3, 3, 3} },
+                             { {6, 6, 6}, {7, 7, 7} } };
+
+  edge::mesh::Bvh< float, unsigned int > l_bvh;
+  l_bvh.init( 5, l_boxes, 1 );
+  REQUIRE( l_bvh.nNodes() == 9 );
+
+  // distance to the boxes
+  float const (*l_bs)[2][3] = l_boxes;
+  float l_pt[3] = { 0, 0, 0 };
+  auto l_dist = [&]( unsigned int i_en ) {
+    float l_sq = 0;
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      float l_diff = std::max( l_bs[i_en][0][l_di] - l_pt[l_di], std::max( float(0), l_pt[l_di] - l_bs[i_en][1][l_di] ) );
+      l_sq += l_diff * l_diff;
+    }
+    return std::sqrt( l_sq );
+  };
+
+  float l_min = 0;
+
+  // inside
+  l_pt[0] = 4.5; l_pt[1] = 4.2; l_pt[2] = 4.9;
+  REQUIRE( l_bvh.nearest( l_pt, l_dist, l_min ) == 2 );
+  REQUIRE( l_min == 0 );
+
+  // inside of duplicated boxes resolves to the smaller id
+  l_pt[0] = 2.5; l_pt[1] = 2.5; l_pt[2] = 2.5;
+  REQUIRE( l_bvh.nearest( l_pt, l_dist, l_min ) == 1 );
+
+  // outside
+  l_pt[0] = 9; l_pt[1] = 7; l_pt[2] = 7;
+  REQUIRE( l_bvh.nearest( l_pt, l_dist, l_min ) == 4 );
+  REQUIRE( l_min == Approx(2) );
+
+  l_pt[0] = -1; l_pt[1] = 0.5; l_pt[2] = 0.5;
+  REQUIRE( l_bvh.nearest( l_pt, l_dist, l_min ) == 0 );
+  REQUIRE( l_min == Approx(1) );
+
+  // empty hierarchy
+  edge::mesh::Bvh< float, unsigned int > l_empty;
+  l_empty.init( 0, l_boxes );
+  REQUIRE( l_empty.nearest( l_pt, l_dist, l_min ) == std::numeric_limits< unsigned int >::max() );
+}
+
+TEST_CASE( "Bvh: Nearest points, compared to brute force.", "[Bvh][points]" ) {
+  std::mt19937 l_gen( 71 );
+  std::uniform_real_distribution< double > l_uni( -10, 10 );
+
+  // random points, given as degenerated boxes
+  std::size_t l_nPts = 2000;
+  std::vector< double > l_boxes( l_nPts*6 );
+  for( std::size_t l_pt = 0; l_pt < l_nPts; l_pt++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_boxes[l_pt*6 + l_di] = l_boxes[l_pt*6 + 3 + l_di] = l_uni( l_gen );
+    }
+  }
+
+  edge::mesh::Bvh< double, std::size_t > l_bvh;
+  l_bvh.init( l_nPts, (double (*)[2][3]) l_boxes.data() );
+
+  for( unsigned short l_qu = 0; l_qu < 200; l_qu++ ) {
+    double l_pt[3];
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_pt[l_di] = 1.2 * l_uni( l_gen );
+
+    auto l_dist = [&]( std::size_t i_pt ) {
+      double l_sq = 0;
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        l_sq += (l_boxes[i_pt*6 + l_di] - l_pt[l_di]) * (l_boxes[i_pt*6 + l_di] - l_pt[l_di]);
+      return std::sqrt( l_sq );
+    };
+
+    // brute force
+    std::size_t l_ref = 0;
+    for( std::size_t l_en = 1; l_en < l_nPts; l_en++ ) {
+      if( l_dist( l_en ) < l_dist( l_ref ) ) l_ref = l_en;
+    }
+
+    double l_min = 0;
+    REQUIRE( l_bvh.nearest( l_pt, l_dist, l_min ) == l_ref );
+    REQUIRE( l_min == l_dist( l_ref ) );
+  }
+}
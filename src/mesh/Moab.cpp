@@ -22,8 +22,12 @@
  **/
 
 #include "Moab.h"
+#include "data/Sort.hpp"
 #include <cassert>
 #include <cmath>
+#include <algorithm>
+#include <array>
+#include <unordered_map>
 #ifdef PP_USE_MPI
 #include <MBParallelConventions.h>
 #endif
@@ -201,7 +205,7 @@ void edge::mesh::Moab::setPeriodicAdjacenciesDim( const std::vector< int_el >  &
         // remove one face from faces
         m_faces.erase( std::remove( m_faces.begin(), m_faces.end(), l_faHandleP ), m_faces.end() );
 
-        // TODO: Needs to be fixed for LTS, this is GTS only
+        // faces are always assigned to a single time group
         m_faLayout.nEnts--;
         m_faLayout.timeGroups[0].inner.size--;
         m_faLayout.timeGroups[0].nEntsOwn--;
@@ -504,19 +508,22 @@ void edge::mesh::Moab::setupEnLayout( int_tg                             i_tg,
   moab::ErrorCode l_error;
 
   // allocate total ent size with 5% overhead
-  o_ents.reserve( i_ents.size() * 1.05 );
+  std::size_t l_first = o_ents.size();
+  o_ents.reserve( l_first + i_ents.size() * 1.05 );
 
   // get inner-elements
   for( moab::Range::const_iterator l_en = i_ents.begin(); l_en != i_ents.end(); l_en++ ) {
     if( getEnMpiType(*l_en) == 0 ) o_ents.push_back( *l_en );
   }
-  EDGE_CHECK_GT( o_ents.size(), 0 ); // make sure we have inner entities
+  std::size_t l_nInner = o_ents.size() - l_first;
+  // make sure we have inner entities, LTS-groups might be empty on some ranks
+  if( o_enLayout.timeGroups.size() == 1 ) EDGE_CHECK_GT( l_nInner, 0 );
 
   // store the inner info
   o_enLayout.timeGroups[i_tg].inner.first = o_enLayout.nEnts;
-  o_enLayout.timeGroups[i_tg].inner.size  = o_ents.size();
-  o_enLayout.nEnts                       += o_ents.size();
-  o_enLayout.timeGroups[i_tg].nEntsOwn    = o_ents.size();
+  o_enLayout.timeGroups[i_tg].inner.size  = l_nInner;
+  o_enLayout.nEnts                       += l_nInner;
+  o_enLayout.timeGroups[i_tg].nEntsOwn    = l_nInner;
 
   // get neighboring ranks (sets are sorted)
   std::set< unsigned int > l_neRanks;
@@ -583,9 +590,8 @@ void edge::mesh::Moab::setupEnLayout( int_tg                             i_tg,
     o_enLayout.timeGroups[i_tg].nEntsOwn         += l_enSe.size();
     o_enLayout.timeGroups[i_tg].neRanks[l_nId]    = *l_nr;
 
-    // set neighboring time group
-    EDGE_CHECK( i_tg == 0 ); // TODO: Add LTS support for MPI
-    o_enLayout.timeGroups[i_tg].neTgs[l_nId] = 0;
+    // set neighboring time group, ghosts are assigned to the group of their owner
+    o_enLayout.timeGroups[i_tg].neTgs[l_nId] = i_tg;
 
     l_nId++;
   }
@@ -632,13 +638,6 @@ void edge::mesh::Moab::setupEnLayout( int_tg                             i_tg,
 }
 
 void edge::mesh::Moab::setupDataLayout() {
-  // setup a single time stepping group for now
-  unsigned int l_nTimeGroups = 1;
-  m_elLayout.nEnts = m_faLayout.nEnts = m_veLayout.nEnts = 0;
-  m_elLayout.timeGroups.resize(l_nTimeGroups);
-  m_faLayout.timeGroups.resize(l_nTimeGroups);
-  m_veLayout.timeGroups.resize(l_nTimeGroups);
-
   moab::ErrorCode l_error;
 
   // get ghost entities
@@ -714,14 +713,146 @@ void edge::mesh::Moab::setupDataLayout() {
   l_error = m_core.tag_get_data( l_tagMoabGId, l_faces, &l_tmpGId[0] ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
   l_error = m_core.tag_set_data( m_tagGId,     l_faces, &l_tmpGId[0] ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
 
+  // derive the time groups of the elements
+  std::vector< int_tg > l_elTgs;
+  int_tg l_nTimeGroups = getElTgs( l_elements, l_elTgs );
+
+  // vertices and faces are assigned to a single group, elements are grouped by their time step
+  m_elLayout.nEnts = m_faLayout.nEnts = m_veLayout.nEnts = 0;
+  m_elLayout.timeGroups.resize(l_nTimeGroups);
+  m_faLayout.timeGroups.resize(1);
+  m_veLayout.timeGroups.resize(1);
+
   // setup the data layout for the entities
+  setupEnLayout( 0, l_vertices, m_veLayout, m_vertices );
+  setupEnLayout( 0, l_faces,    m_faLayout, m_faces    );
+
   for( int_tg l_tg = 0; l_tg < l_nTimeGroups; l_tg++ ) {
-    setupEnLayout( l_tg, l_vertices, m_veLayout, m_vertices );
-    setupEnLayout( l_tg, l_faces,    m_faLayout, m_faces    );
-    setupEnLayout( l_tg, l_elements, m_elLayout, m_elements );
+    moab::Range l_elTg;
+    for( std::size_t l_el = 0; l_el < l_elements.size(); l_el++ ) {
+      if( l_elTgs[l_el] == l_tg ) l_elTg.insert( l_elements[l_el] );
+    }
+
+    setupEnLayout( l_tg, l_elTg, m_elLayout, m_elements );
+  }
+}
+
+void edge::mesh::Moab::reorderSfc( Sfc::t_curve i_curve ) {
+  moab::ErrorCode l_error;
+
+  /*
+   * elements: sort inner elements of every time group by their barycenters
+   */
+  for( std::size_t l_tg = 0; l_tg < m_elLayout.timeGroups.size(); l_tg++ ) {
+    std::size_t l_first = m_elLayout.timeGroups[l_tg].inner.first;
+    std::size_t l_size  = m_elLayout.timeGroups[l_tg].inner.size;
+    if( l_size == 0 ) continue;
+
+    // derive barycenters
+    std::vector< double > l_bary( l_size*3, 0 );
+    for( std::size_t l_el = 0; l_el < l_size; l_el++ ) {
+      moab::EntityHandle const * l_conn;
+      int l_nConn;
+      l_error = m_core.get_connectivity( m_elements[l_first+l_el], l_conn, l_nConn, true );
+      EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+
+      std::vector< double > l_crds( l_nConn*3 );
+      l_error = m_core.get_coords( l_conn, l_nConn, l_crds.data() ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+
+      for( int l_ve = 0; l_ve < l_nConn; l_ve++ )
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_bary[l_el*3 + l_di] += l_crds[l_ve*3 + l_di] / l_nConn;
+    }
+
+    // sort along the curve
+    std::vector< std::size_t > l_perm( l_size );
+    Sfc::sort( i_curve,
+               m_dim,
+               l_size,
+               (double (*)[3]) l_bary.data(),
+               l_perm.data() );
+
+    std::vector< moab::EntityHandle > l_tmp( m_elements.begin()+l_first,
+                                             m_elements.begin()+l_first+l_size );
+    for( std::size_t l_el = 0; l_el < l_size; l_el++ ) m_elements[l_first+l_el] = l_tmp[ l_perm[l_el] ];
+  }
+
+  /*
+   * faces and vertices: sort inner entities by first touch
+   */
+  for( unsigned short l_en = 0; l_en < 2; l_en++ ) {
+    int l_dim = (l_en == 0) ? m_dim-1 : 0;
+    t_enLayout const & l_layout = (l_en == 0) ? m_faLayout : m_veLayout;
+    std::vector< moab::EntityHandle > & l_ents = (l_en == 0) ? m_faces : m_vertices;
+
+    // derive the first touch
+    std::unordered_map< moab::EntityHandle, std::size_t > l_touch;
+    l_touch.reserve( l_ents.size() );
+    for( std::size_t l_el = 0; l_el < m_elements.size(); l_el++ ) {
+      std::vector< moab::EntityHandle > l_adj;
+      l_error = m_core.get_adjacencies( &m_elements[l_el], 1, l_dim, false, l_adj );
+      EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+
+      for( std::size_t l_ad = 0; l_ad < l_adj.size(); l_ad++ ) {
+        l_touch.insert( std::make_pair( l_adj[l_ad], l_touch.size() ) );
+      }
+    }
+
+    // sort the inner entities, untouched entities are moved to the end
+    std::vector< moab::EntityHandle >::iterator l_beg = l_ents.begin() + l_layout.timeGroups[0].inner.first;
+    std::stable_sort( l_beg,
+                      l_beg + l_layout.timeGroups[0].inner.size,
+                      [&l_touch]( moab::EntityHandle i_a, moab::EntityHandle i_b ) {
+                        std::unordered_map< moab::EntityHandle, std::size_t >::const_iterator l_a = l_touch.find( i_a );
+                        std::unordered_map< moab::EntityHandle, std::size_t >::const_iterator l_b = l_touch.find( i_b );
+                        std::size_t l_tA = (l_a != l_touch.end()) ? l_a->second : std::numeric_limits< std::size_t >::max();
+                        std::size_t l_tB = (l_b != l_touch.end()) ? l_b->second : std::numeric_limits< std::size_t >::max();
+                        return l_tA < l_tB;
+                      } );
   }
 }
 
+int_tg edge::mesh::Moab::getElTgs( moab::Range           const &i_elements,
+                                   std::vector< int_tg >       &o_tgs ) {
+  moab::ErrorCode l_error;
+  o_tgs.resize( i_elements.size() );
+
+  // default to a single time group if the mesh doesn't provide one
+  moab::Tag l_tagTg;
+  l_error = m_core.tag_get_handle( "TIME_GROUP",
+                                   1,
+                                   moab::MB_TYPE_INTEGER,
+                                   l_tagTg );
+  if( l_error != moab::MB_SUCCESS ) {
+    for( std::size_t l_el = 0; l_el < o_tgs.size(); l_el++ ) o_tgs[l_el] = 0;
+    return 1;
+  }
+
+  // get a consistent view for the ghost elements
+#ifdef PP_USE_MPI
+  l_error = m_pcomm.exchange_tags( l_tagTg, i_elements ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+#endif
+
+  std::vector< int > l_tgs( i_elements.size() );
+  l_error = m_core.tag_get_data( l_tagTg, i_elements, &l_tgs[0] ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+
+  int l_max = 0;
+  for( std::size_t l_el = 0; l_el < l_tgs.size(); l_el++ ) {
+    EDGE_CHECK_GE( l_tgs[l_el], 0 );
+    o_tgs[l_el] = l_tgs[l_el];
+    l_max = std::max( l_max, l_tgs[l_el] );
+  }
+
+  // the number of time groups is a global property
+#ifdef PP_USE_MPI
+  int l_maxGlo = 0;
+  MPI_Allreduce( &l_max, &l_maxGlo, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD );
+  l_max = l_maxGlo;
+#endif
+
+  return l_max+1;
+}
+
 void edge::mesh::Moab::sortGId( std::vector< moab::EntityHandle > &io_ents ) {
   moab::ErrorCode l_error;
 
@@ -739,31 +870,16 @@ void edge::mesh::Moab::sortGId( std::vector< moab::EntityHandle > &io_ents ) {
   EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
 
   // sort the entities by their id
-  for( std::size_t l_en = 0; l_en < io_ents.size(); l_en++ ) {
-   int_el l_minPos = l_en;
-   // find position of minimum id of upcoming vertices
-   for( std::size_t l_enUp = l_en+1; l_enUp < io_ents.size(); l_enUp++ ) {
-     if( l_gIds[l_enUp] < l_gIds[l_minPos] ) {
-       l_minPos = l_enUp;
-     }
-   }
-   // exchange the global ids with the upcoming min
-   int_gid l_tmpGid     = l_gIds[l_en];
-   l_gIds[l_en]     = l_gIds[l_minPos];
-   l_gIds[l_minPos] = l_tmpGid;
-
-   // exchange ent with the upoming minimum
-   moab::EntityHandle l_tmpEn = io_ents[l_en];
-   io_ents[l_en]              = io_ents[l_minPos];
-   io_ents[l_minPos]          = l_tmpEn;
-  }
+  data::Sort::byKey( io_ents.size(),
+                     l_gIds.data(),
+                     io_ents.data() );
 }
 
 void edge::mesh::Moab::sortElFaEntities( std::vector< moab::EntityHandle > &io_faHas ) {
   moab::ErrorCode l_error;
 
   // global ids of the faces' vertices
-  int_gid l_faVes[C_ENT[T_SDISC.ELEMENT].N_FACES][C_ENT[T_SDISC.FACE].N_VERTICES];
+  std::array< int_gid, C_ENT[T_SDISC.FACE].N_VERTICES > l_faVes[C_ENT[T_SDISC.ELEMENT].N_FACES];
   assert( C_ENT[T_SDISC.ELEMENT].N_FACES >= io_faHas.size() );
 
   // iterate over faces and get the sorted ids of the vertices
@@ -776,55 +892,21 @@ void edge::mesh::Moab::sortElFaEntities( std::vector< moab::EntityHandle > &io_f
     assert( l_verts.size() == C_ENT[T_SDISC.FACE].N_VERTICES );
 
     // get the global ids of the vertices
-    l_error = m_core.tag_get_data( m_tagGId, l_verts, l_faVes[l_fa] ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
+    l_error = m_core.tag_get_data( m_tagGId, l_verts, l_faVes[l_fa].data() ); EDGE_CHECK_EQ( l_error, moab::MB_SUCCESS );
 
     // sort them for this face
-    for( unsigned int l_ve = 0; l_ve < C_ENT[T_SDISC.FACE].N_VERTICES; l_ve++ ) {
-      unsigned int l_minPos = l_ve;
-      for( unsigned int l_veUp = l_ve+1; l_veUp < C_ENT[T_SDISC.FACE].N_VERTICES; l_veUp++ ) {
-        if( l_faVes[l_fa][l_minPos] > l_faVes[l_fa][l_veUp] ) {
-          l_minPos = l_veUp;
-        }
-      }
-      // exchange values
-      int_gid l_veTmp = l_faVes[l_fa][l_ve];
-      l_faVes[l_fa][l_ve] = l_faVes[l_fa][l_minPos];
-      l_faVes[l_fa][l_minPos] = l_veTmp;
-    }
+    std::sort( l_faVes[l_fa].begin(), l_faVes[l_fa].end() );
   }
 
-  // lets go, sort the entities
-  for( std::size_t l_fa = 0; l_fa < io_faHas.size(); l_fa++ ) {
-    unsigned int l_minPos = l_fa;
-    for( std::size_t l_faUp = l_fa+1; l_faUp < io_faHas.size(); l_faUp++ ) {
-      // iterate over vertices and check if the next face has a smaller combined index
-      for( unsigned int l_ve = 0; l_ve < C_ENT[T_SDISC.FACE].N_VERTICES; l_ve++ ) {
-        if( l_faVes[l_minPos][l_ve] > l_faVes[l_faUp][l_ve] ) {
-          l_minPos = l_faUp;
-          break;
-        }
-        else if ( l_faVes[l_minPos][l_ve] < l_faVes[l_faUp][l_ve] ) {
-          break;
-        }
-      }
-    }
-
-    // do the exchange w.r.t to the array of vertices
-    for( unsigned int l_ve = 0; l_ve < C_ENT[T_SDISC.FACE].N_VERTICES; l_ve++ ) {
-      int_gid l_veTmp = l_faVes[l_fa][l_ve];
-      l_faVes[l_fa][l_ve] = l_faVes[l_minPos][l_ve];
-      l_faVes[l_minPos][l_ve] = l_veTmp;
-    }
-
-    // accomplish our original goal: sorting the entity ids
-    moab::EntityHandle l_entTmp = io_faHas[l_fa];
-    io_faHas[l_fa] = io_faHas[l_minPos];
-    io_faHas[l_minPos] = l_entTmp;
-  }
+  // sort the faces lexicographically w.r.t. the ids of their vertices
+  data::Sort::byKey( io_faHas.size(),
+                     l_faVes,
+                     io_faHas.data() );
 }
 
-void edge::mesh::Moab::read( const std::string &i_pathToMesh,
-                             const std::string &i_optRead ) {
+void edge::mesh::Moab::read( const std::string  &i_pathToMesh,
+                             const std::string  &i_optRead,
+                                   Sfc::t_curve  i_curve ) {
   moab::ErrorCode l_error;
   // load the mesh
   EDGE_LOG_INFO << "  loading mesh";
@@ -863,6 +945,12 @@ void edge::mesh::Moab::read( const std::string &i_pathToMesh,
   // setup our custom data layout
   setupDataLayout();
 
+  // reorder for cache locality
+  if( i_curve != Sfc::NONE ) {
+    EDGE_LOG_INFO << "  reordering inner entities along space-filling curve #" << i_curve;
+    reorderSfc( i_curve );
+  }
+
   // get the boundary mesh sets
   if( m_nBndVals > 0 ) {
     moab::Range l_mSets;
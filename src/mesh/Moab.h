@@ -31,6 +31,7 @@
 #include "io/logging.h"
 #include "constants.hpp"
 #include "data/EntityLayout.type"
+#include "Sfc.hpp"
 
 #include <string>
 #include <cstdlib>
@@ -235,9 +236,35 @@ class edge::mesh::Moab {
      * with respect to a a single neighboring rank are sorted by the global ids of the entities. This is to ensure
      * a consistent ordering of the send-entities w.r.t. to the remote receive-ents and vice versa.
      * For vertices and faces, we consider only consider interface-data to be shared.
+     *
+     * Remark: The time groups of the elements are given by the optional element tag TIME_GROUP.
+     *         Vertices and faces are always assigned to a single time group.
      **/
     void setupDataLayout();
 
+    /**
+     * Reorders the inner entities along a space-filling curve for cache locality.
+     * Inner elements of every time group are sorted by the curve's keys of their barycenters.
+     * Inner faces and vertices follow in the order of their first touch through the reordered elements.
+     * Send- and receive-entities keep their order, which is matched by the remote ranks.
+     *
+     * Remark: This has to be called after setting up the layout and before initializing the local ids.
+     *
+     * @param i_curve space-filling curve.
+     **/
+    void reorderSfc( Sfc::t_curve i_curve );
+
+    /**
+     * Gets the time groups of the elements from the mesh's TIME_GROUP tag.
+     * If the tag is not present, all elements are assigned to time group 0.
+     *
+     * @param i_elements elements (including ghosts) for which the time groups are derived.
+     * @param o_tgs will be set to the time groups of the elements.
+     * @return global number of time groups.
+     **/
+    int_tg getElTgs( moab::Range           const &i_elements,
+                     std::vector< int_tg >       &o_tgs );
+
     /**
      * Sorts the given array by the global ids of the entities.
      *
@@ -326,9 +353,11 @@ class edge::mesh::Moab {
      *
      * @param i_pathToMesh path to mesh.
      * @param i_optRead read options forwarded to MOAB.
+     * @param i_curve space-filling curve, used to reorder the inner entities.
      **/
-    void read( const std::string &i_pathToMesh,
-               const std::string &i_optRead );
+    void read( const std::string  &i_pathToMesh,
+               const std::string  &i_optRead,
+                     Sfc::t_curve  i_curve = Sfc::NONE );
 
     /**
      * Writes the mesh, including all information added during processing.
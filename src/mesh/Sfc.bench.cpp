@@ -0,0 +1,177 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmarks the neighboring surface integration for different element orderings.
+ **/
+#include <catch.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "Sfc.hpp"
+#define private public
+#include "regular/Tet.h"
+#undef private
+#include "data/Dynamic.h"
+#include "monitor/Timer.hpp"
+#include "impl/seismic/kernels/Kernels.hpp"
+
+TEST_CASE( "Benchmark: Neighboring surface integration for regular, shuffled and curve-ordered elements.", "[.][bench][Sfc]" ) {
+  // number of element modes, quantities and entries in the flux solvers
+  static unsigned short const l_nMds   = CE_N_ELEMENT_MODES( TET4, ORDER );
+  static unsigned short const l_nMdsFa = CE_N_ELEMENT_MODES( TRIA3, ORDER );
+  static unsigned short const l_nQts   = CE_N_QTS_E( 3 );
+  static unsigned short const l_nEnsFs = CE_N_ENS_FS_E_DE( 3 );
+
+  // number of repetitions
+  unsigned short l_nReps = 5;
+
+  // regular, periodic mesh on a single rank
+  unsigned int l_nHex[3] = { 24, 24, 24 };
+  double l_corner[3] = { 0, 0, 0 };
+  double l_dX[3] = { 1, 1, 1 };
+
+  edge::mesh::regular::Tet l_mesh;
+  l_mesh.init( l_nHex, 0, 1, l_corner, l_dX );
+
+  int_el l_nEl = l_mesh.getNEl();
+  int_el l_nVe = l_mesh.getVeLayout().nEnts;
+
+  std::vector< int_el > l_elVeRaw( 4*std::size_t(l_nEl) );
+  std::vector< int_el > l_elFaElRaw( 4*std::size_t(l_nEl) );
+  std::vector< t_vertexChars > l_veChars( l_nVe );
+  l_mesh.getElVe(    (int_el (*)[4]) l_elVeRaw.data() );
+  l_mesh.getElFaEl(  (int_el (*)[4]) l_elFaElRaw.data() );
+  l_mesh.getVeChars( l_veChars.data() );
+
+  // barycenters of the elements
+  std::vector< double > l_bary( 3*std::size_t(l_nEl), 0 );
+  for( int_el l_el = 0; l_el < l_nEl; l_el++ )
+    for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        l_bary[l_el*3 + l_di] += l_veChars[ l_elVeRaw[l_el*4 + l_ve] ].coords[l_di] * 0.25;
+
+  // orderings of the elements: o_perm[new] = old
+  std::vector< std::string > l_names = { "regular", "regular+hilbert", "shuffled", "shuffled+hilbert" };
+  std::vector< std::vector< int_el > > l_perms( 4, std::vector< int_el >( l_nEl ) );
+
+  for( int_el l_el = 0; l_el < l_nEl; l_el++ ) l_perms[0][l_el] = l_el;
+  edge::mesh::Sfc::sort( edge::mesh::Sfc::HILBERT, 3, l_nEl, (double (*)[3]) l_bary.data(), l_perms[1].data() );
+
+  l_perms[2] = l_perms[0];
+  std::mt19937 l_gen( 3343 );
+  std::shuffle( l_perms[2].begin(), l_perms[2].end(), l_gen );
+
+  // the curve ignores the input order of the shuffled elements, up to ties
+  std::vector< double > l_baryShuf( l_bary.size() );
+  for( int_el l_el = 0; l_el < l_nEl; l_el++ )
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_baryShuf[l_el*3 + l_di] = l_bary[ l_perms[2][l_el]*3 + l_di ];
+
+  std::vector< int_el > l_permSfc( l_nEl );
+  edge::mesh::Sfc::sort( edge::mesh::Sfc::HILBERT, 3, l_nEl, (double (*)[3]) l_baryShuf.data(), l_permSfc.data() );
+  for( int_el l_el = 0; l_el < l_nEl; l_el++ ) l_perms[3][l_el] = l_perms[2][ l_permSfc[l_el] ];
+
+  // kernels of the build
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::Kernels< real_base,
+                                   0,
+                                   TET4,
+                                   ORDER,
+                                   ORDER,
+                                   N_CRUNS > l_kernels( nullptr, l_dynMem );
+  real_base l_scratch[2][l_nQts][l_nMdsFa][N_CRUNS];
+
+  // flux solvers, identical for all elements
+  std::vector< real_base > l_fsE( l_nEnsFs );
+  for( unsigned short l_en = 0; l_en < l_nEnsFs; l_en++ ) l_fsE[l_en] = real_base(1) / (l_en+1);
+
+  // results in the original ordering
+  std::vector< real_base > l_ref;
+
+  for( unsigned short l_or = 0; l_or < l_perms.size(); l_or++ ) {
+    std::vector< int_el > const & l_perm = l_perms[l_or];
+
+    // inverse permutation
+    std::vector< int_el > l_inv( l_nEl );
+    for( int_el l_el = 0; l_el < l_nEl; l_el++ ) l_inv[ l_perm[l_el] ] = l_el;
+
+    // renumbered connectivity
+    int_el (*l_elFaEl)[4] = (int_el (*)[4]) l_dynMem.allocate( 4 * std::size_t(l_nEl) * sizeof(int_el) );
+    for( int_el l_el = 0; l_el < l_nEl; l_el++ ) {
+      for( unsigned short l_fa = 0; l_fa < 4; l_fa++ ) {
+        int_el l_ne = l_elFaElRaw[ l_perm[l_el]*4 + l_fa ];
+        l_elFaEl[l_el][l_fa] = (l_ne < l_nEl) ? l_inv[l_ne] : l_el;
+      }
+    }
+
+    // time integrated DOFs and DOFs, following the ordering
+    std::size_t l_size = std::size_t(l_nEl) * l_nQts * l_nMds * N_CRUNS * sizeof(real_base);
+    real_base (*l_tDofs)[l_nQts][l_nMds][N_CRUNS] = (real_base (*)[l_nQts][l_nMds][N_CRUNS]) l_dynMem.allocate( l_size, ALIGNMENT.BASE.HEAP );
+    real_base (*l_dofs)[l_nQts][l_nMds][N_CRUNS]  = (real_base (*)[l_nQts][l_nMds][N_CRUNS]) l_dynMem.allocate( l_size, ALIGNMENT.BASE.HEAP );
+
+    for( int_el l_el = 0; l_el < l_nEl; l_el++ )
+      for( unsigned short l_qt = 0; l_qt < l_nQts; l_qt++ )
+        for( unsigned short l_md = 0; l_md < l_nMds; l_md++ )
+          for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+            l_tDofs[l_el][l_qt][l_md][l_cr] = real_base( (l_perm[l_el] % 101) + l_qt + l_md ) / 128;
+            l_dofs[l_el][l_qt][l_md][l_cr]  = 0;
+          }
+
+    // neighboring updates, following the data access of the ADER-DG solver
+    edge::monitor::Timer l_timer;
+    l_timer.start();
+    for( unsigned short l_re = 0; l_re < l_nReps; l_re++ ) {
+      for( int_el l_el = 0; l_el < l_nEl; l_el++ ) {
+        for( unsigned short l_fa = 0; l_fa < 4; l_fa++ ) {
+          int_el l_ne = l_elFaEl[l_el][l_fa];
+          int_el l_neUp = (l_fa < 3) ? l_elFaEl[l_el][l_fa+1] : l_elFaEl[ std::min(l_el+1, l_nEl-1) ][0];
+
+          l_kernels.m_surfInt.neigh( l_fa,
+                                     0,
+                                     l_fa,
+                                     l_fsE.data(),
+                                     nullptr,
+                                     l_tDofs[l_ne],
+                                     l_dofs[l_el],
+                                     nullptr,
+                                     l_scratch,
+                                     l_tDofs[l_neUp] );
+        }
+      }
+    }
+    l_timer.end();
+
+    EDGE_LOG_INFO << "neighboring updates, " << l_names[l_or] << " ordering: "
+                  << (double(l_nEl) * l_nReps) / l_timer.elapsed() << " elements/s";
+
+    // gather the results in the original ordering
+    std::vector< real_base > l_res( std::size_t(l_nEl) * l_nQts * l_nMds * N_CRUNS );
+    for( int_el l_el = 0; l_el < l_nEl; l_el++ )
+      std::copy( l_dofs[l_el][0][0],
+                 l_dofs[l_el][0][0] + l_nQts * l_nMds * N_CRUNS,
+                 l_res.begin() + std::size_t( l_perm[l_el] ) * l_nQts * l_nMds * N_CRUNS );
+
+    // all orderings yield identical results
+    if( l_or == 0 ) l_ref = l_res;
+    else {
+      for( std::size_t l_va = 0; l_va < l_res.size(); l_va++ ) REQUIRE( l_res[l_va] == l_ref[l_va] );
+    }
+  }
+}
@@ -0,0 +1,217 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Space-filling curves for locality-preserving orderings of entities.
+ **/
+#ifndef EDGE_MESH_SFC_HPP
+#define EDGE_MESH_SFC_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "io/logging.h"
+#include "data/Sort.hpp"
+
+namespace edge {
+  namespace mesh {
+    class Sfc;
+  }
+}
+
+/**
+ * Morton (Z-order) and Hilbert curves, used for the cache-friendly ordering of entities by their location.
+ **/
+class edge::mesh::Sfc {
+  public:
+    //! supported curves
+    typedef enum {
+      NONE    = 0,
+      MORTON  = 1,
+      HILBERT = 2
+    } t_curve;
+
+    /**
+     * Gets the curve for the given name.
+     *
+     * @param i_name name of the curve: "" or "none", "morton", "hilbert".
+     * @return respective curve.
+     **/
+    static t_curve getCurve( std::string const & i_name ) {
+      if(      i_name == "" || i_name == "none" ) return NONE;
+      else if( i_name == "morton"  )            return MORTON;
+      else if( i_name == "hilbert" )            return HILBERT;
+
+      EDGE_LOG_FATAL << "unknown space-filling curve: " << i_name;
+      return NONE;
+    }
+
+    /**
+     * Gets the number of bits per dimension, used in the keys.
+     *
+     * @param i_nDis number of dimensions.
+     * @return number of bits per dimension.
+     **/
+    static unsigned short nBits( unsigned short i_nDis ) {
+      EDGE_CHECK( i_nDis > 0 && i_nDis <= 3 );
+      return std::min( 63 / i_nDis, 32 );
+    }
+
+    /**
+     * Interleaves the bits of the coordinates. The first dimension is the most significant.
+     *
+     * @param i_nDis number of dimensions.
+     * @param i_crds integer coordinates, using nBits( i_nDis ) bits each.
+     * @return interleaved key.
+     **/
+    static std::uint64_t morton( unsigned short        i_nDis,
+                                 std::uint32_t const * i_crds ) {
+      unsigned short l_nBits = nBits( i_nDis );
+
+      std::uint64_t l_key = 0;
+      for( int l_bi = l_nBits-1; l_bi >= 0; l_bi-- )
+        for( unsigned short l_di = 0; l_di < i_nDis; l_di++ )
+          l_key = (l_key << 1) | ( (i_crds[l_di] >> l_bi) & 1 );
+
+      return l_key;
+    }
+
+    /**
+     * Derives the position of the coordinates on the Hilbert curve.
+     * The coordinates are transposed to the Hilbert index by Skilling's algorithm (AIP Conf. Proc. 707, 2004) and interleaved afterwards.
+     *
+     * @param i_nDis number of dimensions.
+     * @param i_crds integer coordinates, using nBits( i_nDis ) bits each.
+     * @return Hilbert key.
+     **/
+    static std::uint64_t hilbert( unsigned short        i_nDis,
+                                  std::uint32_t const * i_crds ) {
+      unsigned short l_nBits = nBits( i_nDis );
+
+      std::uint32_t l_x[3];
+      for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) l_x[l_di] = i_crds[l_di];
+
+      std::uint32_t l_m = std::uint32_t(1) << (l_nBits-1);
+
+      // inverse undo
+      for( std::uint32_t l_q = l_m; l_q > 1; l_q >>= 1 ) {
+        std::uint32_t l_p = l_q - 1;
+        for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) {
+          // invert
+          if( l_x[l_di] & l_q ) l_x[0] ^= l_p;
+          // exchange
+          else {
+            std::uint32_t l_t = (l_x[0] ^ l_x[l_di]) & l_p;
+            l_x[0]    ^= l_t;
+            l_x[l_di] ^= l_t;
+          }
+        }
+      }
+
+      // gray encode
+      for( unsigned short l_di = 1; l_di < i_nDis; l_di++ ) l_x[l_di] ^= l_x[l_di-1];
+      std::uint32_t l_t = 0;
+      for( std::uint32_t l_q = l_m; l_q > 1; l_q >>= 1 ) {
+        if( l_x[i_nDis-1] & l_q ) l_t ^= l_q - 1;
+      }
+      for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) l_x[l_di] ^= l_t;
+
+      // the transposed index is interleaved
+      return morton( i_nDis, l_x );
+    }
+
+    /**
+     * Derives the key of a point in the given bounding box.
+     *
+     * @param i_curve curve.
+     * @param i_nDis number of dimensions.
+     * @param i_pt coordinates of the point.
+     * @param i_min minimum coordinates of the bounding box.
+     * @param i_max maximum coordinates of the bounding box.
+     * @return key of the point.
+     **/
+    static std::uint64_t key( t_curve         i_curve,
+                              unsigned short  i_nDis,
+                              double const  * i_pt,
+                              double const  * i_min,
+                              double const  * i_max ) {
+      unsigned short l_nBits = nBits( i_nDis );
+      double l_maxInt = double( (std::uint64_t(1) << l_nBits) - 1 );
+
+      // quantize the coordinates
+      std::uint32_t l_crds[3];
+      for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) {
+        double l_ext = i_max[l_di] - i_min[l_di];
+        double l_rel = (l_ext > 0) ? (i_pt[l_di] - i_min[l_di]) / l_ext : 0;
+        l_rel = std::max( 0.0, std::min( 1.0, l_rel ) );
+        l_crds[l_di] = std::uint32_t( l_rel * l_maxInt );
+      }
+
+      if( i_curve == MORTON ) return morton(  i_nDis, l_crds );
+      else                    return hilbert( i_nDis, l_crds );
+    }
+
+    /**
+     * Sorts the points along the curve.
+     * Points with equal keys keep their relative order.
+     *
+     * @param i_curve curve.
+     * @param i_nDis number of dimensions.
+     * @param i_nPts number of points.
+     * @param i_pts coordinates of the points.
+     * @param o_perm will be set to the sorted ids: o_perm[new] = old.
+     *
+     * @paramt TL_T_LID integral type of the ids.
+     **/
+    template< typename TL_T_LID >
+    static void sort( t_curve                  i_curve,
+                      unsigned short           i_nDis,
+                      TL_T_LID                 i_nPts,
+                      double           const (*i_pts)[3],
+                      TL_T_LID               * o_perm ) {
+      for( TL_T_LID l_pt = 0; l_pt < i_nPts; l_pt++ ) o_perm[l_pt] = l_pt;
+      if( i_curve == NONE || i_nPts == 0 ) return;
+
+      // bounding box
+      double l_min[3], l_max[3];
+      for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) {
+        l_min[l_di] =  std::numeric_limits< double >::max();
+        l_max[l_di] = -std::numeric_limits< double >::max();
+      }
+      for( TL_T_LID l_pt = 0; l_pt < i_nPts; l_pt++ ) {
+        for( unsigned short l_di = 0; l_di < i_nDis; l_di++ ) {
+          l_min[l_di] = std::min( l_min[l_di], i_pts[l_pt][l_di] );
+          l_max[l_di] = std::max( l_max[l_di], i_pts[l_pt][l_di] );
+        }
+      }
+
+      // derive keys
+      std::vector< std::uint64_t > l_keys( i_nPts );
+      for( TL_T_LID l_pt = 0; l_pt < i_nPts; l_pt++ )
+        l_keys[l_pt] = key( i_curve, i_nDis, i_pts[l_pt], l_min, l_max );
+
+      data::Sort::perm( i_nPts,
+                        l_keys.data(),
+                        o_perm );
+    }
+};
+
+#endif
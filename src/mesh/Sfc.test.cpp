@@ -0,0 +1,89 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the space-filling curves.
+ **/
+#include <catch.hpp>
+#include <cstdlib>
+#include "Sfc.hpp"
+
+TEST_CASE( "Morton order.", "[Sfc][morton]" ) {
+  // 2x2 points in the corners of the unit square
+  double l_pts[4][3] = { {1, 1, 0},
+                         {0, 1, 0},
+                         {1, 0, 0},
+                         {0, 0, 0} };
+
+  int l_perm[4];
+  edge::mesh::Sfc::sort( edge::mesh::Sfc::MORTON, 2, 4, l_pts, l_perm );
+
+  // x is the most significant dimension
+  REQUIRE( l_perm[0] == 3 );
+  REQUIRE( l_perm[1] == 1 );
+  REQUIRE( l_perm[2] == 2 );
+  REQUIRE( l_perm[3] == 0 );
+
+  // no reordering
+  edge::mesh::Sfc::sort( edge::mesh::Sfc::NONE, 2, 4, l_pts, l_perm );
+  for( int l_pt = 0; l_pt < 4; l_pt++ ) REQUIRE( l_perm[l_pt] == l_pt );
+}
+
+TEST_CASE( "Hilbert order.", "[Sfc][hilbert]" ) {
+  for( unsigned short l_nDis = 2; l_nDis <= 3; l_nDis++ ) {
+    // centers of 8^d cells, reversed
+    unsigned int l_nPts = (l_nDis == 2) ? 8*8 : 8*8*8;
+    std::vector< double > l_pts( l_nPts*3, 0 );
+    for( unsigned int l_pt = 0; l_pt < l_nPts; l_pt++ ) {
+      unsigned int l_id = l_nPts - 1 - l_pt;
+      for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) {
+        l_pts[l_pt*3 + l_di] = (l_id % 8) + 0.5;
+        l_id /= 8;
+      }
+    }
+
+    std::vector< unsigned int > l_perm( l_nPts );
+    edge::mesh::Sfc::sort( edge::mesh::Sfc::HILBERT,
+                           l_nDis,
+                           l_nPts,
+                           (double (*)[3]) l_pts.data(),
+                           l_perm.data() );
+
+    // every cell is visited once
+    std::vector< unsigned int > l_sorted = l_perm;
+    std::sort( l_sorted.begin(), l_sorted.end() );
+    for( unsigned int l_pt = 0; l_pt < l_nPts; l_pt++ ) REQUIRE( l_sorted[l_pt] == l_pt );
+
+    // consecutive cells are face-adjacent
+    for( unsigned int l_pt = 1; l_pt < l_nPts; l_pt++ ) {
+      double l_dist = 0;
+      for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) {
+        l_dist += std::abs( l_pts[l_perm[l_pt]*3 + l_di] - l_pts[l_perm[l_pt-1]*3 + l_di] );
+      }
+      REQUIRE( l_dist == Approx(1) );
+    }
+  }
+}
+
+TEST_CASE( "Curve names.", "[Sfc][names]" ) {
+  REQUIRE( edge::mesh::Sfc::getCurve( ""        ) == edge::mesh::Sfc::NONE    );
+  REQUIRE( edge::mesh::Sfc::getCurve( "none"    ) == edge::mesh::Sfc::NONE    );
+  REQUIRE( edge::mesh::Sfc::getCurve( "morton"  ) == edge::mesh::Sfc::MORTON  );
+  REQUIRE( edge::mesh::Sfc::getCurve( "hilbert" ) == edge::mesh::Sfc::HILBERT );
+}
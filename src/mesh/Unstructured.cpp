@@ -23,6 +23,7 @@
 
 #include "Unstructured.h"
 #include "common.hpp"
+#include "Sfc.hpp"
 #include "linalg/Geom.hpp"
 #include <io/logging.h>
 #include <cassert>
@@ -152,10 +153,12 @@ void edge::mesh::Unstructured::printStats() {
 }
 
 void edge::mesh::Unstructured::read( const std::string &i_pathToMesh,
-                                     const std::string &i_optRead ) {
+                                     const std::string &i_optRead,
+                                     const std::string &i_reorder ) {
 #ifdef PP_USE_MOAB
   m_moab.read( i_pathToMesh,
-               i_optRead );
+               i_optRead,
+               Sfc::getCurve( i_reorder ) );
 #else
   assert( false );
 #endif
@@ -144,9 +144,11 @@ class edge::mesh::Unstructured {
      *
      * @param i_pathToMesh path to mesh.
      * @param i_optRead read options forwarded to the meshing interface.
+     * @param i_reorder space-filling curve, used to reorder the inner entities ("", "none", "morton" or "hilbert").
      **/
     void read( const std::string &i_pathToMesh,
-               const std::string &i_optRead );
+               const std::string &i_optRead,
+               const std::string &i_reorder = "" );
 
     /**
      * Writes the processed, unstructured mesh.
@@ -0,0 +1,146 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Timing of consecutive phases, e.g., the setup of the solver.
+ **/
+#ifndef EDGE_MONITOR_PHASES_HPP
+#define EDGE_MONITOR_PHASES_HPP
+
+#include <string>
+#include <vector>
+#include "Timer.hpp"
+#include "io/logging.h"
+#include "parallel/global.h"
+#ifdef PP_USE_MPI
+#include "parallel/mpi_wrapper.inc"
+#endif
+
+namespace edge {
+  namespace monitor {
+    class Phases;
+  }
+}
+
+/**
+ * Times consecutive phases.
+ * Starting a phase ends the previous one.
+ **/
+class edge::monitor::Phases {
+  private:
+    //! names of the phases
+    std::vector< std::string > m_names;
+
+    //! timers of the phases
+    std::vector< Timer > m_timers;
+
+    //! true if a phase is running
+    bool m_running = false;
+
+  public:
+    /**
+     * Starts a new phase, ends the running one (if any).
+     *
+     * @param i_name name of the phase.
+     **/
+    void start( std::string const & i_name ) {
+      end();
+
+      m_names.push_back( i_name );
+      m_timers.push_back( Timer() );
+      m_timers.back().start();
+      m_running = true;
+    }
+
+    /**
+     * Ends the running phase (if any).
+     **/
+    void end() {
+      if( !m_running ) return;
+
+      m_timers.back().end();
+      m_running = false;
+    }
+
+    /**
+     * Gets the number of phases.
+     *
+     * @return number of phases.
+     **/
+    std::size_t size() const {
+      return m_names.size();
+    }
+
+    /**
+     * Gets the elapsed time of a phase.
+     *
+     * @param i_ph id of the phase.
+     * @return elapsed time in seconds.
+     **/
+    double elapsed( std::size_t i_ph ) const {
+      return m_timers[i_ph].elapsed();
+    }
+
+    /**
+     * Prints the elapsed time of the phases.
+     * In the case of MPI, minimum, average and maximum over all ranks are printed.
+     * Remark: Collective operation for MPI-parallel runs.
+     **/
+    void print() {
+      end();
+
+      std::size_t l_nPhs = m_names.size();
+      double l_total = 0;
+      std::vector< double > l_time[3];
+      for( unsigned short l_st = 0; l_st < 3; l_st++ ) l_time[l_st].resize( l_nPhs+1 );
+
+      for( std::size_t l_ph = 0; l_ph < l_nPhs; l_ph++ ) {
+        l_time[0][l_ph] = elapsed( l_ph );
+        l_total += l_time[0][l_ph];
+      }
+      l_time[0][l_nPhs] = l_total;
+
+#ifdef PP_USE_MPI
+      int l_err;
+      l_err = MPI_Allreduce( l_time[0].data(), l_time[1].data(), l_nPhs+1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+      l_err = MPI_Allreduce( l_time[0].data(), l_time[2].data(), l_nPhs+1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+      l_err = MPI_Allreduce( MPI_IN_PLACE, l_time[0].data(), l_nPhs+1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+      for( std::size_t l_ph = 0; l_ph <= l_nPhs; l_ph++ ) l_time[1][l_ph] /= parallel::g_nRanks;
+#else
+      l_time[1] = l_time[0];
+      l_time[2] = l_time[0];
+#endif
+
+      EDGE_LOG_INFO << "  phase timings (min / avg / max over ranks in seconds):";
+      for( std::size_t l_ph = 0; l_ph <= l_nPhs; l_ph++ ) {
+        double l_share = (l_time[1][l_nPhs] > 0) ? 100 * l_time[1][l_ph] / l_time[1][l_nPhs] : 0;
+
+        EDGE_LOG_INFO << "    " << ( (l_ph < l_nPhs) ? m_names[l_ph] : "total" ) << ": "
+                      << l_time[0][l_ph] << " / "
+                      << l_time[1][l_ph] << " / "
+                      << l_time[2][l_ph] << " ("
+                      << l_share << "%)";
+      }
+    }
+};
+
+#endif
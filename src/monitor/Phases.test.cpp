@@ -0,0 +1,49 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the timing of phases.
+ **/
+#include <catch.hpp>
+#include "Phases.hpp"
+
+TEST_CASE( "Monitor: Phases.", "[phases][monitor]" ) {
+  edge::monitor::Phases l_phases;
+  REQUIRE( l_phases.size() == 0 );
+
+  // keep the CPU busy in two phases
+  volatile unsigned int l_state = 0;
+  l_phases.start( "first" );
+  for( unsigned int l_it = 0; l_it < 100000; l_it++ ) l_state++;
+  l_phases.start( "second" );
+  for( unsigned int l_it = 0; l_it < 100000; l_it++ ) l_state++;
+  l_phases.end();
+  REQUIRE( l_state == 200000 );
+
+  REQUIRE( l_phases.size() == 2 );
+  REQUIRE( l_phases.elapsed(0) > 0 );
+  REQUIRE( l_phases.elapsed(1) > 0 );
+
+  // ending twice doesn't change the timings
+  double l_elapsed = l_phases.elapsed(1);
+  l_phases.end();
+  REQUIRE( l_phases.elapsed(1) == l_elapsed );
+
+  l_phases.print();
+}
@@ -0,0 +1,195 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Precision-reduced encoding of modal halo data.
+ **/
+#include "HaloCodec.h"
+#include "Mpi.h"
+#include "io/logging.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+std::uint16_t edge::parallel::HaloCodec::toBf16( float i_val ) {
+  std::uint32_t l_bits;
+  std::memcpy( &l_bits, &i_val, sizeof(float) );
+
+  // keep NaNs quiet, round to nearest even otherwise
+  if( (l_bits & 0x7fffffff) > 0x7f800000 ) return (l_bits >> 16) | 0x0040;
+  l_bits += 0x7fff + ( (l_bits >> 16) & 1 );
+
+  return l_bits >> 16;
+}
+
+float edge::parallel::HaloCodec::fromBf16( std::uint16_t i_bits ) {
+  std::uint32_t l_bits = std::uint32_t(i_bits) << 16;
+  float l_val;
+  std::memcpy( &l_val, &l_bits, sizeof(float) );
+
+  return l_val;
+}
+
+edge::parallel::HaloCodec::HaloCodec( std::size_t                        i_nBls,
+                                      std::size_t                        i_nQts,
+                                      std::size_t                        i_nMds,
+                                      std::size_t                        i_nCrs,
+                                      std::vector< std::size_t > const & i_nMdsFull,
+                                      bool                               i_bf16,
+                                      bool                               i_test ): m_nBls( i_nBls ),
+                                                                                   m_nQts( i_nQts ),
+                                                                                   m_nMds( i_nMds ),
+                                                                                   m_nCrs( i_nCrs ),
+                                                                                   m_bf16( i_bf16 ),
+                                                                                   m_test( i_test ) {
+  EDGE_CHECK( i_nMdsFull.size() == 1 || i_nMdsFull.size() == m_nQts )
+    << "expected one or " << m_nQts << " thresholds of the halo codec, got " << i_nMdsFull.size();
+
+  m_nMdsFull.resize( m_nQts );
+  for( std::size_t l_qt = 0; l_qt < m_nQts; l_qt++ ) {
+    m_nMdsFull[l_qt] = std::min( i_nMdsFull[ (i_nMdsFull.size() == 1) ? 0 : l_qt ], m_nMds );
+
+    m_nVals[0] += m_nBls * m_nMdsFull[l_qt] * m_nCrs;
+    m_nVals[1] += m_nBls * (m_nMds - m_nMdsFull[l_qt]) * m_nCrs;
+  }
+
+  m_errs[0].assign( m_nQts, 0 );
+  m_errs[1].assign( m_nQts, 0 );
+}
+
+void edge::parallel::HaloCodec::enc( double        const * i_raw,
+                                     std::size_t           i_nEns,
+                                     unsigned char       * o_enc ) {
+  double        *l_full = reinterpret_cast< double* >( o_enc );
+  unsigned char *l_red  = o_enc + i_nEns * m_nVals[0] * sizeof(double);
+  std::size_t l_vaRe = 0;
+
+  for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+    for( std::size_t l_bl = 0; l_bl < m_nBls; l_bl++ ) {
+      for( std::size_t l_qt = 0; l_qt < m_nQts; l_qt++ ) {
+        std::size_t l_nFull = m_nMdsFull[l_qt] * m_nCrs;
+        std::size_t l_nAll  = m_nMds * m_nCrs;
+
+        for( std::size_t l_va = 0; l_va < l_nFull; l_va++ ) *l_full++ = i_raw[l_va];
+
+        for( std::size_t l_va = l_nFull; l_va < l_nAll; l_va++ ) {
+          float l_val = i_raw[l_va];
+          double l_dec;
+
+          if( m_bf16 ) {
+            std::uint16_t l_bits = toBf16( l_val );
+            std::memcpy( l_red + l_vaRe * 2, &l_bits, 2 );
+            l_dec = fromBf16( l_bits );
+          }
+          else {
+            std::memcpy( l_red + l_vaRe * 4, &l_val, 4 );
+            l_dec = l_val;
+          }
+          l_vaRe++;
+
+          if( m_test ) {
+            m_errs[0][l_qt] = std::max( m_errs[0][l_qt], std::abs( l_dec - i_raw[l_va] ) );
+          }
+        }
+
+        if( m_test ) {
+          for( std::size_t l_va = 0; l_va < l_nAll; l_va++ )
+            m_errs[1][l_qt] = std::max( m_errs[1][l_qt], std::abs( i_raw[l_va] ) );
+        }
+
+        i_raw += l_nAll;
+      }
+    }
+  }
+
+  m_nEns += i_nEns;
+}
+
+void edge::parallel::HaloCodec::dec( unsigned char const * i_enc,
+                                     std::size_t           i_nEns,
+                                     double              * o_raw ) const {
+  double        const *l_full = reinterpret_cast< double const * >( i_enc );
+  unsigned char const *l_red  = i_enc + i_nEns * m_nVals[0] * sizeof(double);
+  std::size_t l_vaRe = 0;
+
+  for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+    for( std::size_t l_bl = 0; l_bl < m_nBls; l_bl++ ) {
+      for( std::size_t l_qt = 0; l_qt < m_nQts; l_qt++ ) {
+        std::size_t l_nFull = m_nMdsFull[l_qt] * m_nCrs;
+        std::size_t l_nAll  = m_nMds * m_nCrs;
+
+        for( std::size_t l_va = 0; l_va < l_nFull; l_va++ ) o_raw[l_va] = *l_full++;
+
+        for( std::size_t l_va = l_nFull; l_va < l_nAll; l_va++ ) {
+          if( m_bf16 ) {
+            std::uint16_t l_bits;
+            std::memcpy( &l_bits, l_red + l_vaRe * 2, 2 );
+            o_raw[l_va] = fromBf16( l_bits );
+          }
+          else {
+            float l_val;
+            std::memcpy( &l_val, l_red + l_vaRe * 4, 4 );
+            o_raw[l_va] = l_val;
+          }
+          l_vaRe++;
+        }
+
+        o_raw += l_nAll;
+      }
+    }
+  }
+}
+
+void edge::parallel::HaloCodec::attach( unsigned short   i_mg,
+                                        Mpi            & io_mpi ) {
+  HaloCodec *l_codec = this;
+
+  io_mpi.setCodec( i_mg,
+                   bytesRaw(),
+                   bytesEnc(),
+                   [l_codec]( unsigned char const * i_raw, std::size_t i_nEns, unsigned char * o_enc ) {
+                     l_codec->enc( reinterpret_cast< double const * >( i_raw ), i_nEns, o_enc );
+                   },
+                   [l_codec]( unsigned char const * i_enc, std::size_t i_nEns, unsigned char * o_raw ) {
+                     l_codec->dec( i_enc, i_nEns, reinterpret_cast< double * >( o_raw ) );
+                   } );
+}
+
+void edge::parallel::HaloCodec::logStats( std::string const & i_prefix ) const {
+  unsigned long long l_nEns = m_nEns;
+  std::vector< double > l_errs[2] = { m_errs[0], m_errs[1] };
+#ifdef PP_USE_MPI
+  MPI_Allreduce( &m_nEns, &l_nEns, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+  MPI_Allreduce( m_errs[0].data(), l_errs[0].data(), m_nQts, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+  MPI_Allreduce( m_errs[1].data(), l_errs[1].data(), m_nQts, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+#endif
+
+  EDGE_LOG_INFO << i_prefix << "#entities: " << l_nEns
+                << ", bytes per entity: " << bytesEnc() << " instead of " << bytesRaw()
+                << ", sent: " << l_nEns * bytesEnc() << " instead of " << l_nEns * bytesRaw();
+
+  if( m_test ) {
+    for( std::size_t l_qt = 0; l_qt < m_nQts; l_qt++ ) {
+      EDGE_LOG_INFO << i_prefix << "quantity #" << l_qt
+                    << " (max. abs. error, max. abs. value, ratio): "
+                    << l_errs[0][l_qt] << ", " << l_errs[1][l_qt] << ", "
+                    << ( (l_errs[1][l_qt] > 0) ? l_errs[0][l_qt] / l_errs[1][l_qt] : 0 );
+    }
+  }
+}
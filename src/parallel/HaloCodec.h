@@ -0,0 +1,167 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Precision-reduced encoding of modal halo data.
+ **/
+#ifndef EDGE_PARALLEL_HALO_CODEC_H
+#define EDGE_PARALLEL_HALO_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace edge {
+  namespace parallel {
+    class HaloCodec;
+    class Mpi;
+  }
+}
+
+/**
+ * Encodes the fp64 modal data of halo entities for communication.
+ * The data of an entity is given as [#blocks][#quantities][#modes][#fused runs];
+ * the first modes of every quantity are sent in fp64, the remaining (higher) modes in fp32 or bfloat16.
+ *
+ * An encoded message stores the fp64 values of all entities, followed by the reduced values of all entities.
+ **/
+class edge::parallel::HaloCodec {
+  private:
+    //! number of blocks per entity
+    std::size_t m_nBls;
+
+    //! number of quantities per block
+    std::size_t m_nQts;
+
+    //! number of modes per quantity
+    std::size_t m_nMds;
+
+    //! number of fused runs
+    std::size_t m_nCrs;
+
+    //! number of modes per quantity, which are sent in fp64
+    std::vector< std::size_t > m_nMdsFull;
+
+    //! number of fp64 and reduced values per entity
+    std::size_t m_nVals[2] = { 0, 0 };
+
+    //! true if the higher modes are sent as bfloat16, false for fp32
+    bool m_bf16;
+
+    //! true if the errors of the encoding are tracked
+    bool m_test;
+
+    //! test mode: max. absolute error and max. absolute value per quantity
+    std::vector< double > m_errs[2];
+
+    //! number of encoded entities
+    unsigned long long m_nEns = 0;
+
+  public:
+    /**
+     * Converts an fp32 value to bfloat16 (round to nearest even).
+     *
+     * @param i_val value.
+     * @return bfloat16 bits.
+     **/
+    static std::uint16_t toBf16( float i_val );
+
+    /**
+     * Converts bfloat16 bits to fp32.
+     *
+     * @param i_bits bfloat16 bits.
+     * @return value.
+     **/
+    static float fromBf16( std::uint16_t i_bits );
+
+    /**
+     * Constructor.
+     *
+     * @param i_nBls number of blocks per entity.
+     * @param i_nQts number of quantities per block.
+     * @param i_nMds number of modes per quantity.
+     * @param i_nCrs number of fused runs.
+     * @param i_nMdsFull number of modes sent in fp64: one per quantity or a single one for all quantities; values larger than i_nMds are clipped.
+     * @param i_bf16 true if the higher modes are sent as bfloat16, false for fp32.
+     * @param i_test true if the errors of the encoding are tracked.
+     **/
+    HaloCodec( std::size_t                        i_nBls,
+               std::size_t                        i_nQts,
+               std::size_t                        i_nMds,
+               std::size_t                        i_nCrs,
+               std::vector< std::size_t > const & i_nMdsFull,
+               bool                               i_bf16,
+               bool                               i_test );
+
+    /**
+     * Gets the number of bytes of an entity's raw data.
+     *
+     * @return number of bytes.
+     **/
+    std::size_t bytesRaw() const { return (m_nVals[0] + m_nVals[1]) * sizeof(double); }
+
+    /**
+     * Gets the number of bytes of an entity's encoded data.
+     *
+     * @return number of bytes.
+     **/
+    std::size_t bytesEnc() const { return m_nVals[0] * sizeof(double) + m_nVals[1] * (m_bf16 ? 2 : 4); }
+
+    /**
+     * Encodes the data of the given entities.
+     *
+     * @param i_raw raw data.
+     * @param i_nEns number of entities.
+     * @param o_enc will be set to the encoded data.
+     **/
+    void enc( double        const * i_raw,
+              std::size_t           i_nEns,
+              unsigned char       * o_enc );
+
+    /**
+     * Decodes the data of the given entities.
+     *
+     * @param i_enc encoded data.
+     * @param i_nEns number of entities.
+     * @param o_raw will be set to the decoded data.
+     **/
+    void dec( unsigned char const * i_enc,
+              std::size_t           i_nEns,
+              double              * o_raw ) const;
+
+    /**
+     * Uses the codec for the messages of an MPI group.
+     *
+     * @param i_mg internal id of the MPI group.
+     * @param io_mpi MPI parallelization.
+     **/
+    void attach( unsigned short   i_mg,
+                 Mpi            & io_mpi );
+
+    /**
+     * Logs the bandwidth reduction and, in test mode, the errors of the encoding per quantity.
+     * Called by all ranks.
+     *
+     * @param i_prefix prefix of the log messages.
+     **/
+    void logStats( std::string const & i_prefix ) const;
+};
+
+#endif
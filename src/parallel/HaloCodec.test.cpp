@@ -0,0 +1,87 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests of the precision-reduced encoding of halo data.
+ **/
+#include <catch.hpp>
+#include <cmath>
+#include <vector>
+#define private public
+#include "HaloCodec.h"
+#undef private
+
+TEST_CASE( "HaloCodec: Conversion to bfloat16.", "[HaloCodec][bf16]" ) {
+  // exactly representable values
+  REQUIRE( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16(  1.0f ) ) ==  1.0f );
+  REQUIRE( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16( -0.5f ) ) == -0.5f );
+  REQUIRE( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16(  0.0f ) ) ==  0.0f );
+
+  // rounding to nearest, 8 bits of mantissa
+  float l_val = 1.0f + 1.0f/256.0f + 1.0f/1024.0f;
+  REQUIRE( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16( l_val ) ) == 1.0f + 1.0f/128.0f );
+  REQUIRE( std::abs( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16( 3.14159f ) ) - 3.14159f ) < 3.14159f / 256 );
+
+  // NaNs stay NaNs
+  REQUIRE( std::isnan( edge::parallel::HaloCodec::fromBf16( edge::parallel::HaloCodec::toBf16( std::nanf("") ) ) ) );
+}
+
+TEST_CASE( "HaloCodec: Encoding and decoding of modal data.", "[HaloCodec][encDec]" ) {
+  // 2 entities, 2 blocks, 3 quantities, 4 modes, 2 fused runs
+  std::size_t l_nEns = 2;
+  std::size_t l_nVals = 2*3*4*2;
+  std::vector< double > l_raw( l_nEns * l_nVals );
+  for( std::size_t l_va = 0; l_va < l_raw.size(); l_va++ ) l_raw[l_va] = 1.0 / (l_va + 3);
+
+  for( unsigned short l_bf = 0; l_bf < 2; l_bf++ ) {
+    // first quantity: 1 mode in fp64, second: all, third: none
+    edge::parallel::HaloCodec l_codec( 2, 3, 4, 2, { 1, 5, 0 }, l_bf == 1, true );
+
+    REQUIRE( l_codec.bytesRaw() == l_nVals * 8 );
+    REQUIRE( l_codec.bytesEnc() == 2*(1+4)*2 * 8 + 2*(3+4)*2 * (l_bf == 1 ? 2 : 4) );
+
+    std::vector< unsigned char > l_enc( l_nEns * l_codec.bytesEnc() );
+    std::vector< double > l_dec( l_raw.size() );
+    l_codec.enc( l_raw.data(), l_nEns, l_enc.data() );
+    l_codec.dec( l_enc.data(), l_nEns, l_dec.data() );
+
+    for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) {
+      for( std::size_t l_bl = 0; l_bl < 2; l_bl++ ) {
+        for( std::size_t l_qt = 0; l_qt < 3; l_qt++ ) {
+          for( std::size_t l_md = 0; l_md < 4; l_md++ ) {
+            for( std::size_t l_cr = 0; l_cr < 2; l_cr++ ) {
+              std::size_t l_va = (((l_en*2 + l_bl)*3 + l_qt)*4 + l_md)*2 + l_cr;
+              bool l_full = (l_qt == 1) || (l_qt == 0 && l_md == 0);
+
+              if( l_full )         REQUIRE( l_dec[l_va] == l_raw[l_va] );
+              else if( l_bf == 0 ) REQUIRE( l_dec[l_va] == (double) (float) l_raw[l_va] );
+              else                 REQUIRE( l_dec[l_va] == Approx( l_raw[l_va] ).epsilon( 1.0 / 256 ) );
+            }
+          }
+        }
+      }
+    }
+
+    // tracked errors: none for the fp64 quantity
+    REQUIRE( l_codec.m_errs[0][1] == 0 );
+    REQUIRE( l_codec.m_errs[0][2] > 0 );
+    REQUIRE( l_codec.m_errs[1][0] == Approx( 1.0 / 3 ) );
+    REQUIRE( l_codec.m_nEns == l_nEns );
+  }
+}
@@ -77,35 +77,85 @@ void edge::parallel::LoadBalancing::balanceWrkRgn( unsigned short i_id ) {
     m_wrkRgns[i_id].elaMax  = std::max( m_wrkRgns[i_id].elaMax, l_elapsed.back() );
     m_wrkRgns[i_id].elaSum += l_elapsed.back();
   }
+  m_wrkRgns[i_id].elaTot += m_wrkRgns[i_id].elaSum;
 
   // fill in pseudo-data if any of the elapsed times is non-positive or the imbalance criterion is not fullfilled
   double l_imbalance  = (m_wrkRgns[i_id].elaMax - m_wrkRgns[i_id].elaMin);
          l_imbalance /= std::max( m_wrkRgns[i_id].elaSum / m_nWrks, m_zeroTime );
+  bool l_pseudo = false;
   if( m_wrkRgns[i_id].elaMin < m_zeroTime || l_imbalance < m_maxImbalance ) {
     for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) l_elapsed[l_wo] = 3343;
+    l_pseudo = true;
   }
 
+  // weights of the entities
+  float const * l_wgts = m_wrkRgns[i_id].wgts;
+
   // derive entity throughput per second
   std::vector< double > l_through;
   l_through.reserve( m_nWrks );
   double l_throughSum = 0;
   for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
-    l_through.push_back( l_wps[l_wo].size / l_elapsed[l_wo] );
+    // entities processed by the worker, which might differ from the package's size through work stealing
+    std::size_t l_nEns = (l_wps[l_wo].nEns > 0) ? l_wps[l_wo].nEns : l_wps[l_wo].size;
+    l_wps[l_wo].nEns = 0;
+
+    // weighted regions: work throughput, derived from the average weight of the worker's package; equal weights for pseudo-data
+    double l_wgt = 1;
+    if( l_wgts != nullptr ) {
+      if( l_pseudo || l_wps[l_wo].size == 0 || l_wps[l_wo].size > m_wrkRgns[i_id].size ) {
+        l_nEns = 1;
+      }
+      else {
+        l_wgt = 0;
+        for( std::size_t l_en = l_wps[l_wo].first; l_en < l_wps[l_wo].first+l_wps[l_wo].size; l_en++ ) l_wgt += l_wgts[l_en];
+        l_wgt /= l_wps[l_wo].size;
+      }
+    }
+
+    l_through.push_back( l_nEns * l_wgt / l_elapsed[l_wo] );
     l_throughSum += l_through.back();
   }
 
   // distribute the work by relative throughput
   std::size_t l_dist = 0;
-  for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
-    // continue for undefined
-    if( l_throughSum == 0.0  ) {
-      l_wps[l_wo].size = 0;
-      continue;
+  if( l_wgts == nullptr ) {
+    for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+      // continue for undefined
+      if( l_throughSum == 0.0  ) {
+        l_wps[l_wo].size = 0;
+        continue;
+      }
+
+      // resize
+      l_wps[l_wo].size = ( l_through[l_wo] / l_throughSum ) * m_wrkRgns[i_id].size;
+      l_dist += l_wps[l_wo].size;
     }
+  }
+  // weighted regions: cut the region at the prefix sums of the weights
+  else {
+    std::size_t l_last = m_wrkRgns[i_id].first + m_wrkRgns[i_id].size;
+
+    double l_wgtSum = 0;
+    for( std::size_t l_en = m_wrkRgns[i_id].first; l_en < l_last; l_en++ ) l_wgtSum += l_wgts[l_en];
+
+    double l_wgtTrg = 0;
+    double l_wgtAcc = 0;
+    std::size_t l_en = m_wrkRgns[i_id].first;
+    for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+      std::size_t l_first = l_en;
+      if( l_throughSum > 0 ) l_wgtTrg += ( l_through[l_wo] / l_throughSum ) * l_wgtSum;
+
+      // the last worker takes the remainder
+      if( l_wo == m_nWrks-1 && l_throughSum > 0 ) l_en = l_last;
+      while( l_en < l_last && l_wgtAcc + 0.5 * l_wgts[l_en] <= l_wgtTrg ) {
+        l_wgtAcc += l_wgts[l_en];
+        l_en++;
+      }
 
-    // resize
-    l_wps[l_wo].size = ( l_through[l_wo] / l_throughSum ) * m_wrkRgns[i_id].size;
-    l_dist += l_wps[l_wo].size;
+      l_wps[l_wo].size = l_en - l_first;
+      l_dist += l_wps[l_wo].size;
+    }
   }
 
   // remove entries, if too many have been distributed
@@ -146,6 +196,14 @@ void edge::parallel::LoadBalancing::balanceWrkRgn( unsigned short i_id ) {
   resolveSpEn( i_id );
 }
 
+void edge::parallel::LoadBalancing::setWgts( unsigned short   i_wrkRgn,
+                                             float    const * i_wgts ) {
+  EDGE_CHECK_LT( i_wrkRgn, m_wrkRgns.size() );
+  m_wrkRgns[i_wrkRgn].wgts = i_wgts;
+
+  balanceWrkRgn( i_wrkRgn );
+}
+
 void edge::parallel::LoadBalancing::balance() {
   for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) balanceWrkRgn( l_rg );
   m_nBalanced++;
@@ -157,8 +215,10 @@ void edge::parallel::LoadBalancing::startClock( unsigned short i_wrkRgn,
 }
 
 void edge::parallel::LoadBalancing::stopClock( unsigned short i_wrkRgn,
-                                               unsigned short i_thread ) {
+                                               unsigned short i_thread,
+                                               std::size_t    i_nEns ) {
   m_wrkRgns[i_wrkRgn].wrkPkgs[i_thread].timer.end();
+  m_wrkRgns[i_wrkRgn].wrkPkgs[i_thread].nEns += i_nEns;
 }
 
 void edge::parallel::LoadBalancing::print() {
@@ -212,4 +272,35 @@ void edge::parallel::LoadBalancing::print() {
     EDGE_LOG_INFO << "    max time of any worker:       " << l_maxG[l_wr] << "s";
     EDGE_LOG_INFO << "    max imbalance over all ranks: " << l_imbG[l_wr];
   } 
-}
\ No newline at end of file
+}
+
+void edge::parallel::LoadBalancing::logImbalance( std::string const & i_prefix ) const {
+  // busy time of the rank: time of the workers in all regions, including the current balancing step, averaged over the workers
+  double l_busy = 0;
+  for( std::size_t l_wr = 0; l_wr < m_wrkRgns.size(); l_wr++ ) {
+    l_busy += m_wrkRgns[l_wr].elaTot;
+    for( std::size_t l_wp = 0; l_wp < m_wrkRgns[l_wr].wrkPkgs.size(); l_wp++ )
+      l_busy += m_wrkRgns[l_wr].wrkPkgs[l_wp].timer.elapsed();
+  }
+  if( m_nWrks > 0 ) l_busy /= m_nWrks;
+
+  double l_min = l_busy;
+  double l_sum = l_busy;
+  // value-rank pairs for the MPI_MAXLOC reduction
+  struct t_valRank { double val; int rank; };
+  t_valRank l_max = { l_busy, g_rank };
+#ifdef PP_USE_MPI
+  t_valRank l_busyRank = l_max;
+  MPI_Allreduce( &l_busy,     &l_min, 1, MPI_DOUBLE,     MPI_MIN,    MPI_COMM_WORLD );
+  MPI_Allreduce( &l_busy,     &l_sum, 1, MPI_DOUBLE,     MPI_SUM,    MPI_COMM_WORLD );
+  MPI_Allreduce( &l_busyRank, &l_max, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD );
+#endif
+  double l_ave = l_sum / g_nRanks;
+
+  EDGE_LOG_INFO << i_prefix << "busy time of the workers per rank (min, ave, max): "
+                << l_min << "s, " << l_ave << "s, " << l_max.val << "s, slowest rank: " << l_max.rank;
+  EDGE_LOG_INFO << i_prefix << "imbalance of the ranks ((max-ave)/ave): "
+                << ( (l_ave > 0) ? (l_max.val - l_ave) / l_ave : 0 )
+                << ", share of the slowest rank's busy time, saved by a balanced decomposition: "
+                << ( (l_max.val > 0) ? (l_max.val - l_ave) / l_max.val : 0 );
+}
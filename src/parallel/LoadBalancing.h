@@ -23,6 +23,8 @@
 #ifndef EDGE_PARALLEL_LOADBALANCING_H
 #define EDGE_PARALLEL_LOADBALANCING_H
 
+#include <algorithm>
+#include <string>
 #include <vector>
 #include "constants.hpp"
 #include "data/SparseEntities.hpp"
@@ -60,6 +62,9 @@ class edge::parallel::LoadBalancing {
       //! size of the work package
       std::size_t size;
 
+      //! number of entities processed by the worker since the last balancing (includes stolen work)
+      std::size_t nEns;
+
       //! first sparse entities of the work package
       std::vector< size_t > firstSp;
     };
@@ -81,6 +86,9 @@ class edge::parallel::LoadBalancing {
       //! sparse-dense link for the given work region
       std::vector< std::vector < std::size_t > > spDe;
 
+      //! work-weights of the dense entities (global ids), nullptr if all entities carry the same work
+      float const * wgts;
+
       //! minimum elapsed time of previous balancing (not the current one)
       double elaMin;
 
@@ -89,6 +97,9 @@ class edge::parallel::LoadBalancing {
 
       //! maximum elapsed time of previous balancing (not the current one)
       double elaMax;
+
+      //! summed elapsed time of all workers over all completed balancing steps
+      double elaTot;
     };
 
     //! work regions present in the simulation
@@ -169,12 +180,15 @@ class edge::parallel::LoadBalancing {
       l_wrkRgn.wrkPkgs.resize( m_nWrks );
 
       // init
+      l_wrkRgn.wgts = nullptr;
       l_wrkRgn.elaMin = 0;
       l_wrkRgn.elaSum = 0;
       l_wrkRgn.elaMax = 0;
+      l_wrkRgn.elaTot = 0;
       for( unsigned short l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
         l_wrkRgn.wrkPkgs[l_wo].size  = std::numeric_limits< std::size_t >::max();
         l_wrkRgn.wrkPkgs[l_wo].first = std::numeric_limits< std::size_t >::max();
+        l_wrkRgn.wrkPkgs[l_wo].nEns  = 0;
         l_wrkRgn.wrkPkgs[l_wo].firstSp.resize( i_nSpTypes );
       }
 
@@ -215,6 +229,17 @@ class edge::parallel::LoadBalancing {
       balanceWrkRgn( i_pos );
     }
 
+    /**
+     * @brief Sets the work-weights of a work region's entities and rebalances the region.
+     *        The weights are read in every balancing step and might change in between.
+     *        Work packages of weighted regions carry equal weights, scaled by the measured throughput of the workers.
+     *
+     * @param i_wrkRgn id of the work region.
+     * @param i_wgts work-weights of the dense entities (global ids), nullptr to disable weighting.
+     */
+    void setWgts( unsigned short   i_wrkRgn,
+                  float    const * i_wgts );
+
     /**
      * @brief Gets work for the given worker in the specified region.
      * 
@@ -241,6 +266,58 @@ class edge::parallel::LoadBalancing {
       }
     }
 
+    /**
+     * @brief Gets the size of the given work package.
+     * 
+     * @param i_wrkRgn id of the work region.
+     * @param i_wrkPkg id of the work package.
+     * @return number of entities in the work package.
+     */
+    std::size_t getSize( unsigned short i_wrkRgn,
+                         unsigned short i_wrkPkg ) const {
+      return m_wrkRgns[i_wrkRgn].wrkPkgs[i_wrkPkg].size;
+    }
+
+    /**
+     * @brief Gets a chunk of the given work package.
+     *        The chunk is clamped to the end of the work package.
+     * 
+     * @param i_wrkRgn id of the work region.
+     * @param i_wrkPkg id of the work package.
+     * @param i_off offset of the chunk, relative to the first entity of the work package.
+     * @param i_maxSize maximum size of the chunk.
+     * @param o_first will be set to first entity of the chunk.
+     * @param o_size will be set to number of entities in the chunk.
+     * @param o_firstSp will be set to first sparse entities of the chunk (if any).
+     * 
+     * @paramt TL_T_LID type of the local ids.
+     */
+    template< typename TL_T_LID >
+    void getWrkChunk( unsigned short   i_wrkRgn,
+                      unsigned short   i_wrkPkg,
+                      std::size_t      i_off,
+                      std::size_t      i_maxSize,
+                      TL_T_LID       & o_first,
+                      TL_T_LID       & o_size,
+                      TL_T_LID       * o_firstSp ) const {
+      WrkRgnLb const & l_rg = m_wrkRgns[i_wrkRgn];
+      WrkPkgLb const & l_wp = l_rg.wrkPkgs[i_wrkPkg];
+      EDGE_CHECK_LT( i_off, l_wp.size );
+
+      o_first = l_wp.first + i_off;
+      o_size  = std::min( i_maxSize, l_wp.size - i_off );
+
+      // first sparse entities: first sparse entities of the package plus those in the package, preceding the chunk
+      unsigned short l_nSpTy = l_wp.firstSp.size();
+      for( unsigned short l_ty = 0; l_ty < l_nSpTy; l_ty++ ) {
+        std::size_t l_spFirst = l_wp.firstSp[l_ty] - l_rg.firstSp[l_ty];
+        std::vector< std::size_t >::const_iterator l_it = std::lower_bound( l_rg.spDe[l_ty].begin() + l_spFirst,
+                                                                            l_rg.spDe[l_ty].end(),
+                                                                            std::size_t(o_first) );
+        o_firstSp[l_ty] = l_rg.firstSp[l_ty] + (l_it - l_rg.spDe[l_ty].begin());
+      }
+    }
+
     /**
      * @brief Starts the time monitoring for the given work package.
      * 
@@ -256,14 +333,24 @@ class edge::parallel::LoadBalancing {
      * 
      * @param i_wrkRgn id of the work region
      * @param i_worker id of the worker. 
+     * @param i_nEns number of entities processed by the worker between start and stop.
      */
     void stopClock( unsigned short i_wrkRgn,
-                    unsigned short i_worker );
+                    unsigned short i_worker,
+                    std::size_t    i_nEns = 0 );
 
     /**
      * @brief Prints summarized information on the performed load balancing.
      */
     void print();
+
+    /**
+     * @brief Logs the imbalance of the ranks, derived from the busy times of the workers over the entire run.
+     *        Called by all ranks.
+     *
+     * @param i_prefix prefix of the log messages.
+     */
+    void logImbalance( std::string const & i_prefix ) const;
 };
 
 #endif
\ No newline at end of file
@@ -175,6 +175,69 @@ TEST_CASE( "Load balancing: balance function.", "[balance][loadBalancing]" ) {
   REQUIRE( l_lb1.m_wrkRgns[2].wrkPkgs[6].size  ==   896 );
 }
 
+TEST_CASE( "Load balancing: weighted entities.", "[weights][loadBalancing]" ) {
+  // weights: active entities 10-29, quiescent entities 30-49
+  float l_wgts[50];
+  for( unsigned short l_en =  0; l_en < 30; l_en++ ) l_wgts[l_en] = 1;
+  for( unsigned short l_en = 30; l_en < 50; l_en++ ) l_wgts[l_en] = 0.05f;
+
+  // init the load balancing with 4 workers
+  edge::parallel::LoadBalancing l_lb1;
+  l_lb1.init( 4 );
+
+  l_lb1.regWrkRgn( 0,
+                   10,
+                   40 );
+
+  /*
+   * equal distribution of the weights (nothing elapsed)
+   *
+   * summed weight of 21, 5.25 per worker
+   */
+  l_lb1.setWgts( 0,
+                 l_wgts );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[0].first == 10 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[0].size  ==  5 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].first == 15 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].size  ==  6 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[2].first == 21 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[2].size  ==  5 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[3].first == 26 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[3].size  == 24 );
+
+  /*
+   * distribution with imbalance
+   *
+   * weight  time  throughput  target (prefix)
+   *  5      2      2.5         2.84
+   *  6      1      6           9.65
+   *  5      1      5          15.32
+   *  5      1      5          21.00
+   */
+  l_lb1.m_wrkRgns[0].wrkPkgs[0].timer.m_elapsed = 2;
+  l_lb1.m_wrkRgns[0].wrkPkgs[1].timer.m_elapsed = 1;
+  l_lb1.m_wrkRgns[0].wrkPkgs[2].timer.m_elapsed = 1;
+  l_lb1.m_wrkRgns[0].wrkPkgs[3].timer.m_elapsed = 1;
+
+  l_lb1.balanceWrkRgn( 0 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[0].first == 10 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[0].size  ==  3 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].first == 13 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].size  ==  7 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[2].first == 20 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[2].size  ==  5 );
+
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[3].first == 25 );
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[3].size  == 25 );
+}
+
 TEST_CASE( "Load balancing: sparse entities.", "[spEn][loadBalancing]" ) {
   // our sparse types
   struct {
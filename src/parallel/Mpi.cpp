@@ -23,7 +23,10 @@
 
 #include "Mpi.h"
 #include "io/logging.h"
+#include <map>
 #include <set>
+#include <algorithm>
+#include <cstring>
 #include "monitor/instrument.hpp"
 
 void edge::parallel::Mpi::start( int i_argc, char *i_argv[] ) {
@@ -57,8 +60,10 @@ void edge::parallel::Mpi::init( int_tg             i_tgFirst,
                                 unsigned short     i_grpId,
                                 t_enLayout const & i_enLay,
                                 t_grp            & o_grp ) {
-  // set identifier
+  // set identifier, number of global time groups and bundle
   o_grp.id = i_id;
+  o_grp.nTgGlo = i_nTgGlo;
+  o_grp.bndl = std::numeric_limits< unsigned short >::max();
 
   // set statuses to undefined
   o_grp.sendTest.resize( i_enLay.timeGroups.size() );
@@ -67,6 +72,8 @@ void edge::parallel::Mpi::init( int_tg             i_tgFirst,
     o_grp.sendTest[l_tg] = -1;
     o_grp.recvTest[l_tg] = -1;
   }
+  o_grp.bndlWait[0].assign( i_enLay.timeGroups.size(), 0 );
+  o_grp.bndlWait[1].assign( i_enLay.timeGroups.size(), 0 );
 
   // prepare the messages
   o_grp.send.resize( i_enLay.timeGroups.size() );
@@ -103,6 +110,15 @@ void edge::parallel::Mpi::init( int_tg             i_tgFirst,
 
       o_grp.send[l_tg][l_ne].request = MPI_REQUEST_NULL;
       o_grp.recv[l_tg][l_ne].request = MPI_REQUEST_NULL;
+
+      o_grp.send[l_tg][l_ne].type = MPI_BYTE;
+      o_grp.recv[l_tg][l_ne].type = MPI_BYTE;
+
+      o_grp.send[l_tg][l_ne].shm = nullptr;
+      o_grp.recv[l_tg][l_ne].shm = nullptr;
+
+      o_grp.send[l_tg][l_ne].raw = nullptr;
+      o_grp.recv[l_tg][l_ne].raw = nullptr;
     }
   }
 
@@ -114,6 +130,77 @@ void edge::parallel::Mpi::init( int_tg             i_tgFirst,
     }
   }
 }
+
+void edge::parallel::Mpi::initReq( t_msg          & io_msg,
+                                   unsigned short   i_sr ) {
+  // check that the message fits in int-type
+  EDGE_CHECK_LT( io_msg.size, (std::size_t) std::numeric_limits< int >::max() );
+  int l_count = (io_msg.type == MPI_BYTE) ? io_msg.size : 1;
+
+  int l_error;
+  if( i_sr == 0 ) l_error = MPI_Send_init( io_msg.ptr, l_count, io_msg.type, io_msg.rank, io_msg.tag, m_comm, &io_msg.request );
+  else            l_error = MPI_Recv_init( io_msg.ptr, l_count, io_msg.type, io_msg.rank, io_msg.tag, m_comm, &io_msg.request );
+  EDGE_CHECK( l_error == MPI_SUCCESS );
+}
+
+void edge::parallel::Mpi::beginBndl( int_tg         i_tg,
+                                     unsigned short i_mg,
+                                     unsigned short i_sr ) {
+  unsigned short l_bn = m_grps[i_mg].bndl;
+  m_grps[i_mg].bndlWait[i_sr][i_tg] = 1;
+  if( i_sr == 0 ) m_grps[i_mg].sendTest[i_tg] = 0;
+  else            m_grps[i_mg].recvTest[i_tg] = 0;
+
+  // wait for the other members
+  for( std::size_t l_me = 0; l_me < m_grps[l_bn].mgs.size(); l_me++ )
+    if( m_grps[ m_grps[l_bn].mgs[l_me] ].bndlWait[i_sr][i_tg] == 0 ) return;
+
+  for( std::size_t l_me = 0; l_me < m_grps[l_bn].mgs.size(); l_me++ )
+    m_grps[ m_grps[l_bn].mgs[l_me] ].bndlWait[i_sr][i_tg] = 0;
+
+  if( i_sr == 0 ) beginSends( i_tg, l_bn );
+  else            beginRecvs( i_tg, l_bn );
+}
+
+void edge::parallel::Mpi::shmSend( t_msg & io_msg ) {
+  // the slot is free once the receiver consumed the previous message;
+  // the sends of a time group only begin again once finished, i.e., acknowledged, thus a mismatch is a scheduling error
+  EDGE_CHECK_EQ( io_msg.shmAck->load( std::memory_order_acquire ), io_msg.shmCnt );
+
+  if( io_msg.type == MPI_BYTE ) {
+    std::memcpy( io_msg.shm, io_msg.ptr, io_msg.size );
+  }
+  else {
+    int l_pos = 0;
+    int l_error = MPI_Pack( io_msg.ptr, 1, io_msg.type, io_msg.shm, std::numeric_limits< int >::max(), &l_pos, m_comm );
+    EDGE_CHECK( l_error == MPI_SUCCESS );
+  }
+
+  io_msg.shmCnt++;
+  MPI_Win_sync( m_shmWin );
+  io_msg.shmSeq->store( io_msg.shmCnt, std::memory_order_release );
+}
+
+bool edge::parallel::Mpi::shmTest( t_msg          & io_msg,
+                                   unsigned short   i_sr ) {
+  if( i_sr == 0 ) return io_msg.shmAck->load( std::memory_order_acquire ) == io_msg.shmCnt;
+
+  // wait for the sender to publish
+  if( io_msg.shmSeq->load( std::memory_order_acquire ) < io_msg.shmCnt ) return false;
+  MPI_Win_sync( m_shmWin );
+
+  if( io_msg.type == MPI_BYTE ) {
+    std::memcpy( io_msg.ptr, io_msg.shm, io_msg.size );
+  }
+  else {
+    int l_pos = 0;
+    int l_error = MPI_Unpack( io_msg.shm, std::numeric_limits< int >::max(), &l_pos, io_msg.ptr, 1, io_msg.type, m_comm );
+    EDGE_CHECK( l_error == MPI_SUCCESS );
+  }
+
+  io_msg.shmAck->store( io_msg.shmCnt, std::memory_order_release );
+  return true;
+}
 #endif
 
 unsigned short edge::parallel::Mpi::addDefault( const t_enLayout     &i_enLayout,
@@ -144,11 +231,13 @@ unsigned short edge::parallel::Mpi::addDefault( const t_enLayout     &i_enLayout
     for( unsigned int l_ne = 0; l_ne < m_grps.back().send[l_tg].size(); l_ne++ ) {
       m_grps.back().send[l_tg][l_ne].ptr  = l_data;
       m_grps.back().send[l_tg][l_ne].size = i_enLayout.timeGroups[l_tg].send[l_ne].size * i_bytesPerEntry;
+      m_grps.back().send[l_tg][l_ne].sizeRef = m_grps.back().send[l_tg][l_ne].size;
       l_data += m_grps.back().send[l_tg][l_ne].size;
     }
     for( unsigned int l_ne = 0; l_ne < m_grps.back().recv[l_tg].size(); l_ne++ ) {
       m_grps.back().recv[l_tg][l_ne].ptr  = l_data;
       m_grps.back().recv[l_tg][l_ne].size = i_enLayout.timeGroups[l_tg].receive[l_ne].size * i_bytesPerEntry;
+      m_grps.back().recv[l_tg][l_ne].sizeRef = m_grps.back().recv[l_tg][l_ne].size;
       l_data += m_grps.back().recv[l_tg][l_ne].size;
     }
   }
@@ -211,9 +300,11 @@ unsigned short  edge::parallel::Mpi::addCustom( t_enLayout            const &i_e
     for( std::size_t l_mr = 0; l_mr < i_enLayout.timeGroups[l_tg].send.size(); l_mr++ ) {
       m_grps.back().send[l_tg][l_mr].ptr  = i_sendData[l_tg][l_mr];
       m_grps.back().send[l_tg][l_mr].size = i_sendData[l_tg][l_mr+1] -  i_sendData[l_tg][l_mr];
+      m_grps.back().send[l_tg][l_mr].sizeRef = m_grps.back().send[l_tg][l_mr].size;
 
       m_grps.back().recv[l_tg][l_mr].ptr  = i_recvData[l_tg][l_mr];
       m_grps.back().recv[l_tg][l_mr].size = i_recvData[l_tg][l_mr+1] -  i_recvData[l_tg][l_mr];
+      m_grps.back().recv[l_tg][l_mr].sizeRef = m_grps.back().recv[l_tg][l_mr].size;
     }
   }
 
@@ -232,75 +323,448 @@ unsigned short  edge::parallel::Mpi::addCustom( t_enLayout            const &i_e
 #endif
 }
 
+void edge::parallel::Mpi::setCodec( unsigned short i_mg,
+                                    std::size_t    i_bytesRaw,
+                                    std::size_t    i_bytesEnc,
+                                    t_codec        i_enc,
+                                    t_codec        i_dec ) {
+#ifdef PP_USE_MPI
+  EDGE_CHECK_LT( i_mg, m_grps.size() );
+  EDGE_CHECK( m_shmWin == MPI_WIN_NULL );
+  t_grp &l_grp = m_grps[i_mg];
+  EDGE_CHECK_EQ( l_grp.bndl, std::numeric_limits< unsigned short >::max() );
+  EDGE_CHECK_EQ( l_grp.mgs.size(), 0 );
+  EDGE_CHECK( !l_grp.codec[0] );
+
+  l_grp.codec[0] = i_enc;
+  l_grp.codec[1] = i_dec;
+  l_grp.codecBytes[0] = i_bytesRaw;
+  l_grp.codecBytes[1] = i_bytesEnc;
+
+  // sizes of the encoded messages, aligned to cache lines
+  std::size_t const l_line = 64;
+  std::size_t l_bytes = 0;
+  for( std::size_t l_tg = 0; l_tg < l_grp.send.size(); l_tg++ ) {
+    for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+      std::vector< t_msg > &l_msgs = (l_sr == 0) ? l_grp.send[l_tg] : l_grp.recv[l_tg];
+      for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+        EDGE_CHECK_EQ( l_msgs[l_ms].size % i_bytesRaw, 0 );
+        std::size_t l_size = (l_msgs[l_ms].size / i_bytesRaw) * i_bytesEnc;
+        l_bytes += ( (l_size + l_line - 1) / l_line ) * l_line;
+      }
+    }
+  }
+
+  m_codecBuffs.emplace_back( l_bytes + l_line );
+  unsigned char *l_buff = m_codecBuffs.back().data();
+  l_buff += ( l_line - reinterpret_cast< std::uintptr_t >( l_buff ) % l_line ) % l_line;
+
+  // redirect the messages to the buffer
+  for( std::size_t l_tg = 0; l_tg < l_grp.send.size(); l_tg++ ) {
+    for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+      std::vector< t_msg > &l_msgs = (l_sr == 0) ? l_grp.send[l_tg] : l_grp.recv[l_tg];
+      for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+        t_msg &l_msg = l_msgs[l_ms];
+        if( l_msg.request != MPI_REQUEST_NULL ) MPI_Request_free( &l_msg.request );
+
+        l_msg.raw  = l_msg.ptr;
+        l_msg.ptr  = l_buff;
+        l_msg.size = (l_msg.size / i_bytesRaw) * i_bytesEnc;
+        l_buff += ( (l_msg.size + l_line - 1) / l_line ) * l_line;
+      }
+    }
+  }
+#endif
+}
+
+void edge::parallel::Mpi::setBytesRef( unsigned short       i_mg,
+                                       t_enLayout     const & i_enLayout,
+                                       std::size_t          i_bytesPerEntry ) {
+#ifdef PP_USE_MPI
+  EDGE_CHECK_LT( i_mg, m_grps.size() );
+  t_grp &l_grp = m_grps[i_mg];
+  EDGE_CHECK_EQ( l_grp.bndl, std::numeric_limits< unsigned short >::max() );
+  EDGE_CHECK_EQ( l_grp.mgs.size(), 0 );
+  EDGE_CHECK_EQ( l_grp.send.size(), i_enLayout.timeGroups.size() );
+
+  for( std::size_t l_tg = 0; l_tg < l_grp.send.size(); l_tg++ ) {
+    EDGE_CHECK_EQ( l_grp.send[l_tg].size(), i_enLayout.timeGroups[l_tg].send.size() );
+    EDGE_CHECK_EQ( l_grp.recv[l_tg].size(), i_enLayout.timeGroups[l_tg].receive.size() );
+
+    for( std::size_t l_ms = 0; l_ms < l_grp.send[l_tg].size(); l_ms++ ) {
+      l_grp.send[l_tg][l_ms].sizeRef = i_enLayout.timeGroups[l_tg].send[l_ms].size    * i_bytesPerEntry;
+      l_grp.recv[l_tg][l_ms].sizeRef = i_enLayout.timeGroups[l_tg].receive[l_ms].size * i_bytesPerEntry;
+    }
+  }
+#endif
+}
+
+void edge::parallel::Mpi::initShm() {
+#ifdef PP_USE_MPI
+  EDGE_CHECK( m_shmWin == MPI_WIN_NULL );
+
+  // ranks sharing the node
+  int l_error = MPI_Comm_split_type( m_comm, MPI_COMM_TYPE_SHARED, g_rank, MPI_INFO_NULL, &m_shmComm );
+  EDGE_CHECK( l_error == MPI_SUCCESS );
+  int l_nRanksNode;
+  MPI_Comm_size( m_shmComm, &l_nRanksNode );
+  std::vector< int > l_ranksNode( l_nRanksNode );
+  MPI_Allgather( &g_rank, 1, MPI_INT, l_ranksNode.data(), 1, MPI_INT, m_shmComm );
+
+  // node-local rank of the world ranks on the node
+  std::map< int, int > l_rankNode;
+  for( int l_ra = 0; l_ra < l_nRanksNode; l_ra++ ) l_rankNode[ l_ranksNode[l_ra] ] = l_ra;
+
+  // node-local messages, [0]: sends, [1]: receives; members of bundles communicate through the bundle
+  std::vector< t_msg* > l_msgs[2];
+  for( std::size_t l_mg = 0; l_mg < m_grps.size(); l_mg++ ) {
+    if( m_grps[l_mg].bndl != std::numeric_limits< unsigned short >::max() ) continue;
+
+    for( std::size_t l_tg = 0; l_tg < m_grps[l_mg].send.size(); l_tg++ ) {
+      for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+        std::vector< t_msg > &l_grMsgs = (l_sr == 0) ? m_grps[l_mg].send[l_tg] : m_grps[l_mg].recv[l_tg];
+        for( std::size_t l_ms = 0; l_ms < l_grMsgs.size(); l_ms++ ) {
+          if( l_grMsgs[l_ms].size > 0 && l_rankNode.count( l_grMsgs[l_ms].rank ) == 1 ) l_msgs[l_sr].push_back( &l_grMsgs[l_ms] );
+        }
+      }
+    }
+  }
+
+  // offsets of the send messages' slots in the window: sequence counter, acknowledgement counter and data in separate cache lines
+  std::size_t const l_line = 64;
+  std::vector< MPI_Aint > l_offs[2];
+  l_offs[0].resize( l_msgs[0].size() );
+  l_offs[1].resize( l_msgs[1].size() );
+  MPI_Aint l_bytes = 0;
+  for( std::size_t l_ms = 0; l_ms < l_msgs[0].size(); l_ms++ ) {
+    int l_size = l_msgs[0][l_ms]->size;
+    if( l_msgs[0][l_ms]->type != MPI_BYTE ) MPI_Pack_size( 1, l_msgs[0][l_ms]->type, m_comm, &l_size );
+
+    l_offs[0][l_ms] = l_bytes;
+    l_bytes += 2*l_line + ( (l_size + l_line - 1) / l_line ) * l_line;
+  }
+
+  unsigned char *l_base = nullptr;
+  l_error = MPI_Win_allocate_shared( std::max( l_bytes, MPI_Aint(1) ),
+                                     1,
+                                     MPI_INFO_NULL,
+                                     m_shmComm,
+                                     &l_base,
+                                     &m_shmWin );
+  EDGE_CHECK( l_error == MPI_SUCCESS );
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, m_shmWin );
+
+  for( std::size_t l_ms = 0; l_ms < l_msgs[0].size(); l_ms++ ) {
+    unsigned char *l_slot = l_base + l_offs[0][l_ms];
+    l_msgs[0][l_ms]->shmSeq = new( l_slot          ) std::atomic< std::uint64_t >( 0 );
+    l_msgs[0][l_ms]->shmAck = new( l_slot + l_line ) std::atomic< std::uint64_t >( 0 );
+  }
+  MPI_Win_sync( m_shmWin );
+
+  // exchange the offsets, matched through the tags of the messages
+  std::vector< MPI_Request > l_reqs;
+  l_reqs.reserve( l_msgs[0].size() + l_msgs[1].size() );
+  for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+    for( std::size_t l_ms = 0; l_ms < l_msgs[l_sr].size(); l_ms++ ) {
+      l_reqs.resize( l_reqs.size()+1 );
+      if( l_sr == 0 ) l_error = MPI_Isend( &l_offs[0][l_ms], 1, MPI_AINT, l_msgs[0][l_ms]->rank, l_msgs[0][l_ms]->tag, m_comm, &l_reqs.back() );
+      else            l_error = MPI_Irecv( &l_offs[1][l_ms], 1, MPI_AINT, l_msgs[1][l_ms]->rank, l_msgs[1][l_ms]->tag, m_comm, &l_reqs.back() );
+      EDGE_CHECK( l_error == MPI_SUCCESS );
+    }
+  }
+  if( l_reqs.size() > 0 ) waitAll( l_reqs.size(), l_reqs.data() );
+
+  // receivers read the slots in the windows of the senders
+  for( std::size_t l_ms = 0; l_ms < l_msgs[1].size(); l_ms++ ) {
+    MPI_Aint l_size;
+    int l_disp;
+    unsigned char *l_baseSe;
+    MPI_Win_shared_query( m_shmWin, l_rankNode[ l_msgs[1][l_ms]->rank ], &l_size, &l_disp, &l_baseSe );
+
+    unsigned char *l_slot = l_baseSe + l_offs[1][l_ms];
+    l_msgs[1][l_ms]->shmSeq = reinterpret_cast< std::atomic< std::uint64_t >* >( l_slot          );
+    l_msgs[1][l_ms]->shmAck = reinterpret_cast< std::atomic< std::uint64_t >* >( l_slot + l_line );
+  }
+
+  // switch the node-local messages to the window
+  for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+    for( std::size_t l_ms = 0; l_ms < l_msgs[l_sr].size(); l_ms++ ) {
+      t_msg &l_msg = *l_msgs[l_sr][l_ms];
+      l_msg.shm = reinterpret_cast< unsigned char* >( l_msg.shmSeq ) + 2*l_line;
+      l_msg.shmCnt = 0;
+      if( l_msg.request != MPI_REQUEST_NULL ) MPI_Request_free( &l_msg.request );
+    }
+  }
+
+  // all counters are initialized once the exchange of the offsets is complete
+  MPI_Barrier( m_shmComm );
+
+  unsigned long long l_nMsgs[2] = { l_msgs[0].size(), 0 };
+  for( std::size_t l_mg = 0; l_mg < m_grps.size(); l_mg++ ) {
+    if( m_grps[l_mg].bndl != std::numeric_limits< unsigned short >::max() ) continue;
+    for( std::size_t l_tg = 0; l_tg < m_grps[l_mg].send.size(); l_tg++ )
+      for( std::size_t l_ms = 0; l_ms < m_grps[l_mg].send[l_tg].size(); l_ms++ )
+        if( m_grps[l_mg].send[l_tg][l_ms].size > 0 ) l_nMsgs[1]++;
+  }
+  unsigned long long l_nMsgsGlo[2];
+  MPI_Allreduce( l_nMsgs, l_nMsgsGlo, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, m_comm );
+  EDGE_LOG_INFO << "  moved " << l_nMsgsGlo[0] << " of " << l_nMsgsGlo[1]
+                << " send messages (all ranks) to shared-memory windows of the nodes";
+#endif
+}
+
+unsigned short edge::parallel::Mpi::addBundle( std::vector< unsigned short > const & i_mgs ) {
+#ifdef PP_USE_MPI
+  EDGE_CHECK_GT( i_mgs.size(), 0 );
+  EDGE_LOG_INFO << "  adding MPI-group #" << m_grps.size() << " (bundle of " << i_mgs.size() << " groups)";
+
+  unsigned short l_bnId = m_grps.size();
+  m_grps.resize( m_grps.size()+1 );
+  t_grp &l_bn = m_grps.back();
+  t_grp const &l_mg0 = m_grps[ i_mgs[0] ];
+
+  l_bn.id = 0;
+  l_bn.nTgGlo = l_mg0.nTgGlo;
+  l_bn.bndl = std::numeric_limits< unsigned short >::max();
+  l_bn.mgs = i_mgs;
+
+  std::size_t l_nTgs = l_mg0.send.size();
+  l_bn.sendTest.assign( l_nTgs, -1 );
+  l_bn.recvTest.assign( l_nTgs, -1 );
+  l_bn.bndlWait[0].assign( l_nTgs, 0 );
+  l_bn.bndlWait[1].assign( l_nTgs, 0 );
+  l_bn.send.resize( l_nTgs );
+  l_bn.recv.resize( l_nTgs );
+
+  // the tags of the groups are unique in the time groups' part, which is shared by the members
+  int l_nTgSq = l_bn.nTgGlo * l_bn.nTgGlo;
+
+  for( std::size_t l_tg = 0; l_tg < l_nTgs; l_tg++ ) {
+    for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+      // blocks of the bundle's messages in the order of the members, key: neighboring rank and time groups' part of the tag
+      std::map< std::pair< int, int >,
+                std::vector< std::pair< unsigned char*, std::size_t > > > l_blocks;
+      // reference sizes of the bundle's messages
+      std::map< std::pair< int, int >, std::size_t > l_sizesRef;
+
+      for( std::size_t l_me = 0; l_me < i_mgs.size(); l_me++ ) {
+        t_grp const &l_mg = m_grps[ i_mgs[l_me] ];
+        EDGE_CHECK_LT( i_mgs[l_me], l_bnId );
+        EDGE_CHECK_EQ( l_mg.bndl, std::numeric_limits< unsigned short >::max() );
+        EDGE_CHECK_EQ( l_mg.mgs.size(), 0 );
+        EDGE_CHECK( m_shmWin == MPI_WIN_NULL );
+        EDGE_CHECK_EQ( l_mg.nTgGlo, l_bn.nTgGlo );
+        EDGE_CHECK_EQ( l_mg.send.size(), l_nTgs );
+
+        std::vector< t_msg > const &l_msgs = (l_sr == 0) ? l_mg.send[l_tg] : l_mg.recv[l_tg];
+        for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+          if( l_msgs[l_ms].size == 0 ) continue;
+
+          std::pair< int, int > l_key( l_msgs[l_ms].rank, l_msgs[l_ms].tag % l_nTgSq );
+          l_blocks[l_key].push_back( std::make_pair( l_msgs[l_ms].ptr, l_msgs[l_ms].size ) );
+          l_sizesRef[l_key] += l_msgs[l_ms].sizeRef;
+        }
+      }
+
+      std::vector< t_msg > &l_msgs = (l_sr == 0) ? l_bn.send[l_tg] : l_bn.recv[l_tg];
+      for( auto l_bl = l_blocks.begin(); l_bl != l_blocks.end(); l_bl++ ) {
+        t_msg l_msg;
+        l_msg.rank    = l_bl->first.first;
+        l_msg.tag     = l_bnId * l_nTgSq + l_bl->first.second;
+        l_msg.test    = 0;
+        l_msg.request = MPI_REQUEST_NULL;
+        l_msg.cmmTd   = -2;
+        l_msg.shm     = nullptr;
+        l_msg.raw     = nullptr;
+        l_msg.size    = 0;
+        for( std::size_t l_en = 0; l_en < l_bl->second.size(); l_en++ ) l_msg.size += l_bl->second[l_en].second;
+        l_msg.sizeRef = l_sizesRef[l_bl->first];
+
+        // single blocks are communicated as bytes, multiple blocks through an hindexed datatype at absolute addresses
+        if( l_bl->second.size() == 1 ) {
+          l_msg.ptr  = l_bl->second[0].first;
+          l_msg.type = MPI_BYTE;
+        }
+        else {
+          std::vector< int > l_lens( l_bl->second.size() );
+          std::vector< MPI_Aint > l_disps( l_bl->second.size() );
+          for( std::size_t l_en = 0; l_en < l_bl->second.size(); l_en++ ) {
+            l_lens[l_en] = l_bl->second[l_en].second;
+            MPI_Get_address( l_bl->second[l_en].first, &l_disps[l_en] );
+          }
+
+          int l_error = MPI_Type_create_hindexed( l_lens.size(), l_lens.data(), l_disps.data(), MPI_BYTE, &l_msg.type );
+          EDGE_CHECK( l_error == MPI_SUCCESS );
+          l_error = MPI_Type_commit( &l_msg.type );
+          EDGE_CHECK( l_error == MPI_SUCCESS );
+
+          l_msg.ptr = (unsigned char*) MPI_BOTTOM;
+        }
+
+        l_msgs.push_back( l_msg );
+      }
+    }
+  }
+
+  // the members communicate through the bundle
+  for( std::size_t l_me = 0; l_me < i_mgs.size(); l_me++ ) {
+    t_grp &l_mg = m_grps[ i_mgs[l_me] ];
+    l_mg.bndl = l_bnId;
+
+    for( std::size_t l_tg = 0; l_tg < l_nTgs; l_tg++ ) {
+      for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+        std::vector< t_msg > &l_msgs = (l_sr == 0) ? l_mg.send[l_tg] : l_mg.recv[l_tg];
+        for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ )
+          if( l_msgs[l_ms].request != MPI_REQUEST_NULL ) MPI_Request_free( &l_msgs[l_ms].request );
+      }
+    }
+  }
+
+  return l_bnId;
+#else
+  return std::numeric_limits< unsigned short >::max();
+#endif
+}
+
 void edge::parallel::Mpi::comm(                bool  i_return,
                                 const volatile bool &i_finished,
                                                bool  i_isLead ) {
 #ifdef PP_USE_MPI
-  std::set< volatile t_msg* > l_msgs;
+  // flat arrays of the messages this thread progresses, their requests and the ids of completed requests
+  std::vector< volatile t_msg* > l_msgs;
+  std::vector< MPI_Request > l_reqs;
+  std::vector< int > l_ids;
+
+  // node-local messages this thread progresses, [0]: sends, [1]: receives
+  std::vector< t_msg* > l_shms[2];
 
   while( i_finished == false ) {
-    // collect messages this thread is repsosible for
+    if( i_isLead ) m_stats.timer.start();
+
+    // collect messages this thread is responsible for,
+    // in the case of more than one thread per message, only the comm lead progresses the message
+    l_msgs.clear();
+    l_reqs.clear();
+    l_shms[0].clear();
+    l_shms[1].clear();
     for( unsigned short l_mg = 0; l_mg < m_grps.size(); l_mg++ ) {
       for( int_tg l_tg = 0; l_tg < m_grps[l_mg].send.size(); l_tg++ ) {
-        for( unsigned int l_ne = 0; l_ne < m_grps[l_mg].send[l_tg].size(); l_ne++ ) {
-          // get send message
-          volatile t_msg* l_send = &m_grps[l_mg].send[l_tg][l_ne];
-
-          // add message if requrired
-          if( (l_send->cmmTd == g_thread || l_send->cmmTd == -1) && l_send->test == 0 ) {
-            l_msgs.insert( l_send );
-          }
-
-          // get recv message
-          volatile t_msg* l_recv = &m_grps[l_mg].recv[l_tg][l_ne];
-
-          // add message if required
-          if( (l_recv->cmmTd == g_thread || l_recv->cmmTd == -1) && l_recv->test == 0 ) {
-            l_msgs.insert( l_recv );
+        for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+          std::vector< t_msg > &l_grMsgs = (l_sr == 0) ? m_grps[l_mg].send[l_tg] : m_grps[l_mg].recv[l_tg];
+
+          for( unsigned int l_ne = 0; l_ne < l_grMsgs.size(); l_ne++ ) {
+            volatile t_msg* l_msg = &l_grMsgs[l_ne];
+
+            if(    ( (l_msg->cmmTd == -1 && i_isLead) || l_msg->cmmTd == g_thread )
+                && l_msg->test == 0 ) {
+              if( l_msg->shm != nullptr ) {
+                l_shms[l_sr].push_back( &l_grMsgs[l_ne] );
+              }
+              else {
+                MPI_Request l_req = l_msg->request;
+                l_msgs.push_back( l_msg );
+                l_reqs.push_back( l_req );
+              }
+            }
           }
         }
       }
     }
+    l_ids.resize( l_reqs.size() );
 
     // progress communication
     for( unsigned int l_it = 0; l_it < m_nIterPerCheck; l_it++ ) {
-      for ( std::set< volatile t_msg * >::iterator l_msg = l_msgs.begin(); l_msg != l_msgs.end(); ) {
-        MPI_Request l_requ = (*l_msg)->request;
-        int         l_test;
-
-        MPI_Test( &l_requ,
-                  &l_test,
-                  MPI_STATUS_IGNORE );
-
-        // in the case of more than one thread per message,
-        // only the comm lead is allowed to signal results with the scheduling thread
-        if( ( (*l_msg)->cmmTd == -1 && i_isLead ) ||
-            ( (*l_msg)->cmmTd == g_thread       )    ) {
-          // remove message if finished
-          if( l_test == 1 ) {
-            (*l_msg)->cmmTd = -2;
-            (*l_msg)->test  =  1;
+      // exit if there's no communication
+      if( l_reqs.size() == 0 && l_shms[0].size() == 0 && l_shms[1].size() == 0 ) break;
+
+      // progress node-local messages
+      for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+        std::size_t l_nRem = 0;
+        for( std::size_t l_ms = 0; l_ms < l_shms[l_sr].size(); l_ms++ ) {
+          if( shmTest( *l_shms[l_sr][l_ms], l_sr ) ) {
+            volatile t_msg *l_msg = l_shms[l_sr][l_ms];
+            l_msg->cmmTd = -2;
+            l_msg->test  =  1;
           }
+          else l_shms[l_sr][l_nRem++] = l_shms[l_sr][l_ms];
         }
+        l_shms[l_sr].resize( l_nRem );
+      }
 
-        // delete message form thread-local set in any case
-        if( l_test == 1 ) {
-          l_msg = l_msgs.erase(l_msg);
-          continue;
-        }
+      if( l_reqs.size() == 0 ) continue;
 
-        l_msg++;
+      int l_nDone = 0;
+      int l_error = MPI_Testsome( l_reqs.size(),
+                                  l_reqs.data(),
+                                 &l_nDone,
+                                  l_ids.data(),
+                                  MPI_STATUSES_IGNORE );
+      EDGE_CHECK( l_error == MPI_SUCCESS );
+      if( i_isLead ) m_stats.nTests++;
+
+      if( l_nDone == MPI_UNDEFINED || l_nDone == 0 ) continue;
+
+      // signal finished messages with the scheduling thread
+      for( int l_do = 0; l_do < l_nDone; l_do++ ) {
+        volatile t_msg *l_msg = l_msgs[ l_ids[l_do] ];
+        l_msg->cmmTd = -2;
+        l_msg->test  =  1;
+        l_msgs[ l_ids[l_do] ] = nullptr;
       }
 
-      // exit if there's no communication
-      if( l_msgs.size() == 0 ) break;
+      // remove finished messages from the thread-local arrays
+      std::size_t l_nRem = 0;
+      for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+        if( l_msgs[l_ms] == nullptr ) continue;
+        l_msgs[l_nRem] = l_msgs[l_ms];
+        l_reqs[l_nRem] = l_reqs[l_ms];
+        l_nRem++;
+      }
+      l_msgs.resize( l_nRem );
+      l_reqs.resize( l_nRem );
     }
 
+    if( i_isLead ) m_stats.timer.end();
+
     if( i_return == true ) break;
   }
 #endif
 }
 
+void edge::parallel::Mpi::logStats( std::string const & i_prefix,
+                                    std::size_t         i_nSteps ) const {
+#ifdef PP_USE_MPI
+  // sums over all ranks: [0-1]: messages, [2-3]: bytes, [4]: MPI_Testsome calls, [5-6]: node-local messages, [7-8]: reference bytes
+  unsigned long long l_loc[9] = { m_stats.nMsgs[0],     m_stats.nMsgs[1],
+                                  m_stats.nBytes[0],    m_stats.nBytes[1],
+                                  m_stats.nTests,
+                                  m_stats.nShmMsgs[0],  m_stats.nShmMsgs[1],
+                                  m_stats.nBytesRef[0], m_stats.nBytesRef[1] };
+  unsigned long long l_glo[9];
+  MPI_Allreduce( l_loc, l_glo, 9, MPI_UNSIGNED_LONG_LONG, MPI_SUM, m_comm );
+
+  double l_time = m_stats.timer.elapsed();
+  double l_timeMax = 0;
+  MPI_Allreduce( &l_time, &l_timeMax, 1, MPI_DOUBLE, MPI_MAX, m_comm );
+
+  double l_nSteps = std::max( i_nSteps, std::size_t(1) );
+  EDGE_LOG_INFO << i_prefix << "MPI messages per time step (sends, receives): "
+                << l_glo[0] / l_nSteps << ", " << l_glo[1] / l_nSteps
+                << ", node-local through shared memory: "
+                << l_glo[5] / l_nSteps << ", " << l_glo[6] / l_nSteps
+                << ", bytes per time step: "
+                << l_glo[2] / l_nSteps << ", " << l_glo[3] / l_nSteps;
+  // codecs and reduced halos communicate less than the reference
+  EDGE_LOG_INFO << i_prefix << "saved bytes per time step (sends, receives): "
+                << ( l_glo[7] - std::min( l_glo[7], l_glo[2] ) ) / l_nSteps << ", "
+                << ( l_glo[8] - std::min( l_glo[8], l_glo[3] ) ) / l_nSteps;
+  EDGE_LOG_INFO << i_prefix << "progression (#MPI_Testsome, max. time of the comm leads in s): "
+                << l_glo[4] << ", " << l_timeMax
+                << ", per time step: "
+                << l_glo[4] / l_nSteps << ", " << l_timeMax / l_nSteps;
+#endif
+}
+
 unsigned short edge::parallel::Mpi::getMg( std::uintptr_t i_id ) {
   unsigned short l_mg = std::numeric_limits< unsigned short >::max();
 
@@ -326,32 +790,64 @@ void edge::parallel::Mpi::beginSends( int_tg         i_tg,
   if( i_mg == std::numeric_limits< unsigned short >::max() ) return;
 
 #ifdef PP_USE_MPI
+  EDGE_CHECK_LT( i_tg, m_grps[i_mg].send.size() );
+
+  // encode the send data
+  if( m_grps[i_mg].codec[0] ) {
+    for( std::size_t l_ms = 0; l_ms < m_grps[i_mg].send[i_tg].size(); l_ms++ ) {
+      t_msg &l_msg = m_grps[i_mg].send[i_tg][l_ms];
+      if( l_msg.size != 0 ) m_grps[i_mg].codec[0]( l_msg.raw, l_msg.size / m_grps[i_mg].codecBytes[1], l_msg.ptr );
+    }
+  }
+
+  // members of bundles begin through the bundle
+  if( m_grps[i_mg].bndl != std::numeric_limits< unsigned short >::max() ) {
+    beginBndl( i_tg, i_mg, 0 );
+    return;
+  }
+
 #ifdef PP_USE_INSTR
   std::string l_regName = "send_" + std::to_string(i_tg) + "_" + std::to_string(i_mg);
   PP_INSTR_REG_NAME_BEG( l_regName.c_str() )
 #endif
 
+  // collect the persistent requests of the non-empty messages
+  std::vector< MPI_Request > l_reqs;
+  l_reqs.reserve( m_grps[i_mg].send[i_tg].size() );
+  for( std::size_t l_ms = 0; l_ms < m_grps[i_mg].send[i_tg].size(); l_ms++ ) {
+    t_msg &l_msg = m_grps[i_mg].send[i_tg][l_ms];
+
+    if( l_msg.size != 0 ) {
+      // node-local sends are published through the window
+      if( l_msg.shm != nullptr ) {
+        shmSend( l_msg );
+        m_stats.nShmMsgs[0]++;
+      }
+      else {
+        if( l_msg.request == MPI_REQUEST_NULL ) initReq( l_msg, 0 );
+        l_reqs.push_back( l_msg.request );
+        m_stats.nMsgs[0]++;
+      }
+      m_stats.nBytes[0] += l_msg.size;
+      m_stats.nBytesRef[0] += l_msg.sizeRef;
+    }
+  }
+
+  if( l_reqs.size() > 0 ) {
+    int l_error = MPI_Startall( l_reqs.size(),
+                                l_reqs.data() );
+    EDGE_CHECK( l_error == MPI_SUCCESS );
+  }
+
   for( std::size_t l_msg = 0; l_msg < m_grps[i_mg].send[i_tg].size(); l_msg++ ) {
     // get message
     volatile t_msg *l_send = &m_grps[i_mg].send[i_tg][l_msg];
 
-    // only issue non-empty messages
+    // empty messages are finished
     if( m_grps[i_mg].send[i_tg][l_msg].size == 0 ) {
       l_send->test = 1;
     }
     else {
-      MPI_Request l_req;
-      int l_error = MPI_Isend(  l_send->ptr,
-                                l_send->size,
-                                MPI_BYTE,
-                                l_send->rank,
-                                l_send->tag,
-                                m_comm,
-                              &l_req );
-      EDGE_CHECK( l_error == MPI_SUCCESS );
-
-      // update message info
-      l_send->request = l_req;
       l_send->test = 0;
       l_send->cmmTd = -1;
     }
@@ -368,27 +864,49 @@ void edge::parallel::Mpi::beginRecvs( int_tg         i_tg,
   if( i_mg == std::numeric_limits< unsigned short >::max() ) return;
 
 #ifdef PP_USE_MPI
+  // members of bundles begin through the bundle
+  if( m_grps[i_mg].bndl != std::numeric_limits< unsigned short >::max() ) {
+    beginBndl( i_tg, i_mg, 1 );
+    return;
+  }
+
+  // collect the persistent requests of the non-empty messages
+  std::vector< MPI_Request > l_reqs;
+  l_reqs.reserve( m_grps[i_mg].recv[i_tg].size() );
+  for( std::size_t l_ms = 0; l_ms < m_grps[i_mg].recv[i_tg].size(); l_ms++ ) {
+    t_msg &l_msg = m_grps[i_mg].recv[i_tg][l_ms];
+
+    if( l_msg.size != 0 ) {
+      // node-local receives wait for the sender's publication
+      if( l_msg.shm != nullptr ) {
+        l_msg.shmCnt++;
+        m_stats.nShmMsgs[1]++;
+      }
+      else {
+        if( l_msg.request == MPI_REQUEST_NULL ) initReq( l_msg, 1 );
+        l_reqs.push_back( l_msg.request );
+        m_stats.nMsgs[1]++;
+      }
+      m_stats.nBytes[1] += l_msg.size;
+      m_stats.nBytesRef[1] += l_msg.sizeRef;
+    }
+  }
+
+  if( l_reqs.size() > 0 ) {
+    int l_error = MPI_Startall( l_reqs.size(),
+                                l_reqs.data() );
+    EDGE_CHECK( l_error == MPI_SUCCESS );
+  }
+
   for( std::size_t l_msg = 0; l_msg < m_grps[i_mg].recv[i_tg].size(); l_msg++ ) {
     // get message
     volatile t_msg *l_recv = &m_grps[i_mg].recv[i_tg][l_msg];
 
-    // only issue non-empty messages
+    // empty messages are finished
     if( m_grps[i_mg].recv[i_tg][l_msg].size == 0 ) {
       l_recv->test = 1;
     }
     else {
-      MPI_Request l_req;
-      int l_error = MPI_Irecv(   l_recv->ptr,
-                                l_recv->size,
-                                MPI_BYTE,
-                                l_recv->rank,
-                                l_recv->tag,
-                                m_comm,
-                                &l_req );
-      EDGE_CHECK( l_error == MPI_SUCCESS );
-
-      // update message info
-      l_recv->request = l_req;
       l_recv->test = 0;
       l_recv->cmmTd = -1;
     }
@@ -408,6 +926,12 @@ bool edge::parallel::Mpi::finSends( int_tg         i_tg,
   EDGE_CHECK_LT( i_mg, m_grps.size() );
   EDGE_CHECK_LT( i_tg, m_grps[i_mg].send.size() );
 
+  // members of bundles are finished with the bundle
+  if( m_grps[i_mg].bndl != std::numeric_limits< unsigned short >::max() ) {
+    if( m_grps[i_mg].bndlWait[0][i_tg] == 1 ) return false;
+    return finSends( i_tg, m_grps[i_mg].bndl );
+  }
+
   // iterate over send messages of the time group
   for( std::size_t l_msg = 0; l_msg < m_grps[i_mg].send[i_tg].size(); l_msg++ ) {
     // get message
@@ -439,12 +963,27 @@ bool edge::parallel::Mpi::finRecvs( int_tg         i_tg,
   EDGE_CHECK_LT( i_mg, m_grps.size() );
   EDGE_CHECK_LT( i_tg, m_grps[i_mg].recv.size() );
 
-  // iterate over send messages of the time group
-  for( std::size_t l_msg = 0; l_msg < m_grps[i_mg].recv[i_tg].size(); l_msg++ ) {
-    // get message
-    volatile t_msg *l_recv = &m_grps[i_mg].recv[i_tg][l_msg];
+  // members of bundles are finished with the bundle
+  if( m_grps[i_mg].bndl != std::numeric_limits< unsigned short >::max() ) {
+    if( m_grps[i_mg].bndlWait[1][i_tg] == 1 ) return false;
+    if( finRecvs( i_tg, m_grps[i_mg].bndl ) == false ) return false;
+  }
+  else {
+    // iterate over send messages of the time group
+    for( std::size_t l_msg = 0; l_msg < m_grps[i_mg].recv[i_tg].size(); l_msg++ ) {
+      // get message
+      volatile t_msg *l_recv = &m_grps[i_mg].recv[i_tg][l_msg];
 
-    if( l_recv->test == 0 ) return false;
+      if( l_recv->test == 0 ) return false;
+    }
+  }
+
+  // decode the received data once
+  if( m_grps[i_mg].codec[1] && m_grps[i_mg].recvTest[i_tg] == 0 ) {
+    for( std::size_t l_ms = 0; l_ms < m_grps[i_mg].recv[i_tg].size(); l_ms++ ) {
+      t_msg &l_msg = m_grps[i_mg].recv[i_tg][l_ms];
+      if( l_msg.size != 0 ) m_grps[i_mg].codec[1]( l_msg.ptr, l_msg.size / m_grps[i_mg].codecBytes[1], l_msg.raw );
+    }
   }
 
   // set recv status of the group to finished
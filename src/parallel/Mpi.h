@@ -27,11 +27,15 @@
 #include "mpi_wrapper.inc"
 #endif
 #include <map>
+#include <list>
+#include <atomic>
 #include <functional>
 #include <string>
 #include <cstdint>
 #include <limits>
+#include <vector>
 #include "data/EntityLayout.type"
+#include "monitor/Timer.hpp"
 
 #include "parallel/global.h"
 
@@ -42,6 +46,10 @@ namespace edge {
 }
 
 class edge::parallel::Mpi {
+  public:
+    //! codec function of the messages: (input, #entities, output)
+    typedef std::function< void( unsigned char const *, std::size_t, unsigned char * ) > t_codec;
+
   private:
 #ifdef PP_USE_MPI
     //! number of iterations over comm list until a check for new work is performed
@@ -58,12 +66,26 @@ class edge::parallel::Mpi {
       int         tag;
       //! test flag
       int         test;
-      //! MPI request
+      //! persistent MPI request, MPI_REQUEST_NULL for empty messages and before the first begin
       MPI_Request request;
-      //! pointer to start of message
+      //! pointer to start of message, MPI_BOTTOM for derived datatypes
       unsigned char* ptr;
       //! size of the message in bytes
       std::size_t size;
+      //! reference size in bytes, i.e., without codecs or reduced halos; used for the statistics only
+      std::size_t sizeRef;
+      //! datatype of the message: MPI_BYTE or the derived datatype of a bundle
+      MPI_Datatype type;
+      //! node-local messages: data in the shared-memory window of the sender, nullptr for messages through MPI
+      unsigned char* shm;
+      //! node-local messages: number of messages published by the sender
+      std::atomic< std::uint64_t > *shmSeq;
+      //! node-local messages: number of messages consumed by the receiver
+      std::atomic< std::uint64_t > *shmAck;
+      //! node-local messages: number of begun operations of this rank
+      std::uint64_t shmCnt;
+      //! messages of groups with codec: raw data, nullptr otherwise
+      unsigned char* raw;
       //! responsible communication thread; -2 is inactive, -1 is all, 0+ is thread id
       int         cmmTd;
     } t_msg;
@@ -84,11 +106,59 @@ class edge::parallel::Mpi {
 
       //! receive status of the time groups: -1 undefined, 0 if ongoing, 1 if finished
       std::vector< int > recvTest;
+
+      //! number of global time groups
+      int_tg nTgGlo;
+
+      //! bundle, which communicates the messages of the group; numeric_limits< unsigned short >::max() if none
+      unsigned short bndl;
+
+      //! member groups if the group is a bundle, empty otherwise
+      std::vector< unsigned short > mgs;
+
+      //! bundle members: 1 if the group began its [0]: sends, [1]: receives of the time group and waits for the other members
+      std::vector< int > bndlWait[2];
+
+      //! codec of the messages: [0]: encodes raw data, [1]: decodes encoded data; empty if none
+      t_codec codec[2];
+
+      //! codec: number of bytes per entity, [0]: raw, [1]: encoded
+      std::size_t codecBytes[2];
     } t_grp;
 
+    //! buffers of the encoded messages; the list keeps the buffers in place
+    std::list< std::vector< unsigned char > > m_codecBuffs;
+
     //! mpi groups
     std::vector< t_grp > m_grps;
 
+    //! communicator of the ranks sharing the node, MPI_COMM_NULL if node-local messages use MPI
+    MPI_Comm m_shmComm = MPI_COMM_NULL;
+
+    //! shared-memory window holding the node-local send messages
+    MPI_Win m_shmWin = MPI_WIN_NULL;
+
+    //! communication statistics
+    struct {
+      //! number of started messages through MPI, [0]: sends, [1]: receives
+      unsigned long long nMsgs[2] = { 0, 0 };
+
+      //! number of started node-local messages through the shared-memory window, [0]: sends, [1]: receives
+      unsigned long long nShmMsgs[2] = { 0, 0 };
+
+      //! number of started bytes, [0]: sends, [1]: receives
+      unsigned long long nBytes[2] = { 0, 0 };
+
+      //! number of started bytes w.r.t. the reference sizes of the messages, [0]: sends, [1]: receives
+      unsigned long long nBytesRef[2] = { 0, 0 };
+
+      //! number of MPI_Testsome calls of the comm lead
+      unsigned long long nTests = 0;
+
+      //! time the comm lead spent in the progression of the messages
+      monitor::Timer timer;
+    } m_stats;
+
     /**
      * Initializes an MPI-group.
      *
@@ -105,6 +175,50 @@ class edge::parallel::Mpi {
                unsigned short     i_grpId,
                t_enLayout const & i_enLay,
                t_grp            & o_grp );
+
+    /**
+     * Initializes the persistent request of a non-empty message.
+     * Called when the message begins for the first time, after the group's setup (codec, bundle, shared memory) is final.
+     *
+     * @param io_msg MPI message.
+     * @param i_sr 0 for sends, 1 for receives.
+     **/
+    void initReq( t_msg          & io_msg,
+                  unsigned short   i_sr );
+
+    /**
+     * Marks the sends or receives of a bundle member as begun.
+     * The bundle begins once all of its members began.
+     *
+     * @param i_tg time group.
+     * @param i_mg mpi group, which is a member of a bundle.
+     * @param i_sr 0 for sends, 1 for receives.
+     **/
+    void beginBndl( int_tg         i_tg,
+                    unsigned short i_mg,
+                    unsigned short i_sr );
+
+    /**
+     * Copies a node-local send message to the shared-memory window and publishes it.
+     * Every message has a single slot: the receiver has to have acknowledged the previous message.
+     * This holds by construction, since the sends of a time group begin again only after finSends returned true,
+     * which requires the acknowledgement (see shmTest). A mismatch is a scheduling error and aborts.
+     *
+     * @param io_msg node-local send message.
+     **/
+    void shmSend( t_msg & io_msg );
+
+    /**
+     * Tests a node-local message for completion.
+     * Sends are complete once consumed by the receiver,
+     * receives copy the published message from the sender's window and acknowledge.
+     *
+     * @param io_msg node-local message.
+     * @param i_sr 0 for sends, 1 for receives.
+     * @return true if the message is complete.
+     **/
+    bool shmTest( t_msg          & io_msg,
+                  unsigned short   i_sr );
 #endif
 
   public:
@@ -178,6 +292,56 @@ class edge::parallel::Mpi {
                               int_tg                     i_nTgGlo,
                               std::uintptr_t             i_id = 0 );
 
+    /**
+     * Sets a codec for the messages of a group.
+     * Send data is encoded to an internal buffer when beginning the sends,
+     * received data is decoded to the receive regions when the receives are found finished.
+     * Has to be called before bundles or shared-memory windows are set up.
+     *
+     * @param i_mg internal id of the MPI group.
+     * @param i_bytesRaw number of bytes per entity of the raw data.
+     * @param i_bytesEnc number of bytes per entity of the encoded data.
+     * @param i_enc encodes the raw data of a number of entities.
+     * @param i_dec decodes the encoded data of a number of entities.
+     **/
+    void setCodec( unsigned short i_mg,
+                   std::size_t    i_bytesRaw,
+                   std::size_t    i_bytesEnc,
+                   t_codec        i_enc,
+                   t_codec        i_dec );
+
+    /**
+     * Sets the reference sizes of a group's messages, e.g., the sizes of the full element data which a reduced halo replaces.
+     * The statistics report the difference to the communicated bytes as savings.
+     * Has to be called before bundles are set up.
+     *
+     * @param i_mg internal id of the MPI group.
+     * @param i_enLayout layout of the entities, matching the group's time groups and regions.
+     * @param i_bytesPerEntry number of bytes per entity of the reference data.
+     **/
+    void setBytesRef( unsigned short       i_mg,
+                      t_enLayout     const & i_enLayout,
+                      std::size_t          i_bytesPerEntry );
+
+    /**
+     * Moves the messages to neighbors on the same node to an MPI-3 shared-memory window.
+     * Senders copy their messages to the window and signal through a counter, receivers copy from the sender's window.
+     * Messages to other nodes keep using MPI.
+     * Called by all ranks after all groups and bundles were added.
+     **/
+    void initShm();
+
+    /**
+     * Adds a bundle of MPI groups, which communicates all messages of the groups to the same neighbor in one message.
+     * The members keep their interface: begin- and fin-calls of a member are forwarded to the bundle,
+     * which begins once every member began. Thus, all members have to begin in the same step of the scheduling.
+     *
+     * @param i_mgs internal ids of the member groups (same for all ranks).
+     *
+     * @return internal id of the bundle. numeric_limits< unsigned short >::max() if none.
+     **/
+    unsigned short addBundle( std::vector< unsigned short > const & i_mgs );
+
     /**
      * Progresses communication using the calling thread.
      *
@@ -191,6 +355,16 @@ class edge::parallel::Mpi {
                const volatile bool &i_finished,
                               bool  i_isLead=false );
 
+    /**
+     * Logs the statistics of the communication, summed over all ranks.
+     * Called by all ranks.
+     *
+     * @param i_prefix prefix of the log messages.
+     * @param i_nSteps number of time steps, used for the per-step numbers.
+     **/
+    void logStats( std::string const & i_prefix,
+                   std::size_t         i_nSteps ) const;
+
     /**
      * Determines the message group for the given identifier.
      *
@@ -435,6 +609,26 @@ class edge::parallel::Mpi {
      **/
     void fin() {
 #ifdef PP_USE_MPI
+      // free the shared-memory window
+      if( m_shmWin != MPI_WIN_NULL ) {
+        MPI_Win_unlock_all( m_shmWin );
+        MPI_Win_free( &m_shmWin );
+        MPI_Comm_free( &m_shmComm );
+      }
+
+      // free the persistent requests and derived datatypes
+      for( std::size_t l_mg = 0; l_mg < m_grps.size(); l_mg++ ) {
+        for( std::size_t l_tg = 0; l_tg < m_grps[l_mg].send.size(); l_tg++ ) {
+          for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+            std::vector< t_msg > &l_msgs = (l_sr == 0) ? m_grps[l_mg].send[l_tg] : m_grps[l_mg].recv[l_tg];
+            for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+              if( l_msgs[l_ms].request != MPI_REQUEST_NULL ) MPI_Request_free( &l_msgs[l_ms].request );
+              if( l_msgs[l_ms].type    != MPI_BYTE         ) MPI_Type_free(    &l_msgs[l_ms].type    );
+            }
+          }
+        }
+      }
+
       MPI_Barrier(MPI_COMM_WORLD);
       MPI_Finalize();
 #endif
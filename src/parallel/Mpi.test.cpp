@@ -26,6 +26,74 @@
 #include "Mpi.h"
 #undef private
 
+#ifdef PP_USE_MPI
+/**
+ * Sets up an entity layout with a single time group, which exchanges two entities with the calling rank.
+ *   inner: [0], send: [1 - 2], receive: [3 - 4]
+ *
+ * @param o_enLa will be set to the entity layout.
+ **/
+static void selfLayout( t_enLayout & o_enLa ) {
+  o_enLa.nEnts = 5;
+  o_enLa.timeGroups.resize( 1 );
+  o_enLa.timeGroups[0].nEntsOwn    = 3;
+  o_enLa.timeGroups[0].nEntsNotOwn = 2;
+  o_enLa.timeGroups[0].inner.first = 0;
+  o_enLa.timeGroups[0].inner.size  = 1;
+
+  o_enLa.timeGroups[0].send.resize( 1 );
+  o_enLa.timeGroups[0].send[0].first = 1;
+  o_enLa.timeGroups[0].send[0].size  = 2;
+  o_enLa.timeGroups[0].receive.resize( 1 );
+  o_enLa.timeGroups[0].receive[0].first = 3;
+  o_enLa.timeGroups[0].receive[0].size  = 2;
+
+  o_enLa.timeGroups[0].neRanks.assign( 1, edge::parallel::g_rank );
+  o_enLa.timeGroups[0].neTgs.assign( 1, 0 );
+}
+
+/**
+ * Progresses the communication until the sends and receives of the given groups are finished.
+ *
+ * @param io_mpi MPI layer.
+ * @param i_mgs groups.
+ **/
+static void progress( edge::parallel::Mpi                 & io_mpi,
+                      std::vector< unsigned short > const & i_mgs ) {
+  volatile bool l_fin = false;
+  for( std::size_t l_me = 0; l_me < i_mgs.size(); l_me++ ) {
+    while( !io_mpi.finSends( 0, i_mgs[l_me] ) || !io_mpi.finRecvs( 0, i_mgs[l_me] ) ) {
+      io_mpi.comm( true, l_fin, true );
+    }
+  }
+}
+
+/**
+ * Frees the persistent requests, derived datatypes and shared-memory window without finalizing MPI.
+ *
+ * @param io_mpi MPI layer.
+ **/
+static void freeComm( edge::parallel::Mpi & io_mpi ) {
+  if( io_mpi.m_shmWin != MPI_WIN_NULL ) {
+    MPI_Win_unlock_all( io_mpi.m_shmWin );
+    MPI_Win_free( &io_mpi.m_shmWin );
+    MPI_Comm_free( &io_mpi.m_shmComm );
+  }
+
+  for( std::size_t l_mg = 0; l_mg < io_mpi.m_grps.size(); l_mg++ ) {
+    for( std::size_t l_tg = 0; l_tg < io_mpi.m_grps[l_mg].send.size(); l_tg++ ) {
+      for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+        auto &l_msgs = (l_sr == 0) ? io_mpi.m_grps[l_mg].send[l_tg] : io_mpi.m_grps[l_mg].recv[l_tg];
+        for( std::size_t l_ms = 0; l_ms < l_msgs.size(); l_ms++ ) {
+          if( l_msgs[l_ms].request != MPI_REQUEST_NULL ) MPI_Request_free( &l_msgs[l_ms].request );
+          if( l_msgs[l_ms].type    != MPI_BYTE         ) MPI_Type_free(    &l_msgs[l_ms].type    );
+        }
+      }
+    }
+  }
+}
+#endif
+
 TEST_CASE( "Initialization of the communication layout", "[initLayout]" ) {
   edge::parallel::Mpi l_mpi;
 #ifdef PP_USE_MPI
@@ -279,3 +347,363 @@ TEST_CASE( "Initialization of the communication layout", "[initLayout]" ) {
   edge::parallel::g_nRanks = l_nRanks;
 #endif
 }
+
+TEST_CASE( "Restart of the persistent requests in consecutive steps.", "[Mpi][persistent]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  double l_data[5];
+  unsigned short l_mg = l_mpi.addDefault( l_enLa, l_data, sizeof(double), 0, 1 );
+
+  // requests are created when the messages begin for the first time
+  REQUIRE( l_mpi.m_grps[l_mg].send[0][0].request == MPI_REQUEST_NULL );
+  REQUIRE( l_mpi.m_grps[l_mg].recv[0][0].request == MPI_REQUEST_NULL );
+
+  MPI_Request l_reqs[2] = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+  for( unsigned short l_st = 0; l_st < 3; l_st++ ) {
+    l_data[1] = 10*l_st + 1;
+    l_data[2] = 10*l_st + 2;
+    l_data[3] = l_data[4] = -1;
+
+    l_mpi.beginRecvs( 0, l_mg );
+    l_mpi.beginSends( 0, l_mg );
+
+    // the same requests are restarted in every step
+    if( l_st == 0 ) {
+      l_reqs[0] = l_mpi.m_grps[l_mg].send[0][0].request;
+      l_reqs[1] = l_mpi.m_grps[l_mg].recv[0][0].request;
+      REQUIRE( l_reqs[0] != MPI_REQUEST_NULL );
+      REQUIRE( l_reqs[1] != MPI_REQUEST_NULL );
+    }
+    REQUIRE( l_mpi.m_grps[l_mg].send[0][0].request == l_reqs[0] );
+    REQUIRE( l_mpi.m_grps[l_mg].recv[0][0].request == l_reqs[1] );
+
+    progress( l_mpi, {l_mg} );
+
+    REQUIRE( l_data[3] == 10*l_st + 1 );
+    REQUIRE( l_data[4] == 10*l_st + 2 );
+  }
+
+  REQUIRE( l_mpi.m_stats.nMsgs[0] == 3 );
+  REQUIRE( l_mpi.m_stats.nMsgs[1] == 3 );
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Bundles begin once all members began.", "[Mpi][bundle]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  double l_data[2][5];
+  unsigned short l_mgs[2];
+  l_mgs[0] = l_mpi.addDefault( l_enLa, l_data[0], sizeof(double), 0, 1 );
+  l_mgs[1] = l_mpi.addDefault( l_enLa, l_data[1], sizeof(double), 0, 1 );
+  unsigned short l_bn = l_mpi.addBundle( {l_mgs[0], l_mgs[1]} );
+
+  // the send regions of both members are combined in a single message
+  REQUIRE( l_mpi.m_grps[l_bn].send[0].size() == 1 );
+  REQUIRE( l_mpi.m_grps[l_bn].recv[0].size() == 1 );
+  REQUIRE( l_mpi.m_grps[l_bn].send[0][0].size == 4 * sizeof(double) );
+  REQUIRE( l_mpi.m_grps[l_bn].send[0][0].type != MPI_BYTE );
+
+  for( unsigned short l_st = 0; l_st < 2; l_st++ ) {
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      l_data[l_me][1] = 100*l_st + 10*l_me + 1;
+      l_data[l_me][2] = 100*l_st + 10*l_me + 2;
+      l_data[l_me][3] = l_data[l_me][4] = -1;
+    }
+
+    // first member: the bundle waits
+    l_mpi.beginRecvs( 0, l_mgs[0] );
+    l_mpi.beginSends( 0, l_mgs[0] );
+    REQUIRE( l_mpi.m_grps[l_mgs[0]].bndlWait[0][0] == 1 );
+    REQUIRE( l_mpi.m_grps[l_mgs[0]].bndlWait[1][0] == 1 );
+    REQUIRE( l_mpi.m_grps[l_bn].sendTest[0] != 0 );
+    REQUIRE( l_mpi.m_grps[l_bn].recvTest[0] != 0 );
+    REQUIRE( l_mpi.m_stats.nMsgs[0] == l_st );
+    REQUIRE( l_mpi.finSends( 0, l_mgs[0] ) == false );
+    REQUIRE( l_mpi.finRecvs( 0, l_mgs[0] ) == false );
+
+    // second member: the bundle begins
+    l_mpi.beginRecvs( 0, l_mgs[1] );
+    l_mpi.beginSends( 0, l_mgs[1] );
+    REQUIRE( l_mpi.m_stats.nMsgs[0] == l_st+1u );
+    REQUIRE( l_mpi.m_stats.nMsgs[1] == l_st+1u );
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      REQUIRE( l_mpi.m_grps[l_mgs[l_me]].bndlWait[0][0] == 0 );
+      REQUIRE( l_mpi.m_grps[l_mgs[l_me]].bndlWait[1][0] == 0 );
+    }
+
+    progress( l_mpi, {l_mgs[0], l_mgs[1]} );
+
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      REQUIRE( l_data[l_me][3] == 100*l_st + 10*l_me + 1 );
+      REQUIRE( l_data[l_me][4] == 100*l_st + 10*l_me + 2 );
+    }
+  }
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Reference bytes of reduced messages.", "[Mpi][bytesRef]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  // full data: doubles, reduced data: floats of the send and receive entities
+  double l_data[5];
+  float l_dataRed[2][2];
+  std::vector< std::vector< unsigned char * > > l_ptrs[2];
+  for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+    l_ptrs[l_sr].resize( 1 );
+    l_ptrs[l_sr][0].push_back( (unsigned char *) l_dataRed[l_sr] );
+    l_ptrs[l_sr][0].push_back( (unsigned char *) (l_dataRed[l_sr]+2) );
+  }
+
+  unsigned short l_mgs[2];
+  l_mgs[0] = l_mpi.addDefault( l_enLa, l_data, sizeof(double), 0, 1 );
+  l_mgs[1] = l_mpi.addCustom( l_enLa, l_ptrs[0], l_ptrs[1], 0, 1 );
+
+  // the reference sizes default to the sizes
+  REQUIRE( l_mpi.m_grps[l_mgs[0]].send[0][0].sizeRef == 2 * sizeof(double) );
+  REQUIRE( l_mpi.m_grps[l_mgs[1]].send[0][0].sizeRef == 2 * sizeof(float) );
+
+  l_mpi.setBytesRef( l_mgs[1], l_enLa, sizeof(double) );
+  for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+    REQUIRE( l_mpi.m_grps[l_mgs[l_me]].send[0][0].sizeRef == 2 * sizeof(double) );
+    REQUIRE( l_mpi.m_grps[l_mgs[l_me]].recv[0][0].sizeRef == 2 * sizeof(double) );
+  }
+
+  // the bundle sums the members
+  unsigned short l_bn = l_mpi.addBundle( {l_mgs[0], l_mgs[1]} );
+  REQUIRE( l_mpi.m_grps[l_bn].send[0][0].size    == 2 * sizeof(double) + 2 * sizeof(float) );
+  REQUIRE( l_mpi.m_grps[l_bn].send[0][0].sizeRef == 4 * sizeof(double) );
+
+  for( unsigned short l_st = 0; l_st < 2; l_st++ ) {
+    l_data[1] = 10*l_st + 1;
+    l_dataRed[0][1] = 10*l_st + 2;
+    l_data[3] = l_dataRed[1][1] = -1;
+
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      l_mpi.beginRecvs( 0, l_mgs[l_me] );
+      l_mpi.beginSends( 0, l_mgs[l_me] );
+    }
+    progress( l_mpi, {l_mgs[0], l_mgs[1]} );
+
+    REQUIRE( l_data[3] == 10*l_st + 1 );
+    REQUIRE( l_dataRed[1][1] == 10*l_st + 2 );
+  }
+
+  for( unsigned short l_sr = 0; l_sr < 2; l_sr++ ) {
+    REQUIRE( l_mpi.m_stats.nBytes[l_sr]    == 2 * ( 2 * sizeof(double) + 2 * sizeof(float) ) );
+    REQUIRE( l_mpi.m_stats.nBytesRef[l_sr] == 2 * 4 * sizeof(double) );
+  }
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Removal of finished requests in the progression.", "[Mpi][comm]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  double l_data[3][5];
+  unsigned short l_mgs[3];
+  for( unsigned short l_gr = 0; l_gr < 3; l_gr++ ) {
+    l_mgs[l_gr] = l_mpi.addDefault( l_enLa, l_data[l_gr], sizeof(double), 0, 1 );
+    l_data[l_gr][1] = 10*l_gr + 1;
+    l_data[l_gr][2] = 10*l_gr + 2;
+    l_data[l_gr][3] = l_data[l_gr][4] = -1;
+  }
+
+  // all receives begin, the sends of the middle group are held back
+  for( unsigned short l_gr = 0; l_gr < 3; l_gr++ ) l_mpi.beginRecvs( 0, l_mgs[l_gr] );
+  l_mpi.beginSends( 0, l_mgs[0] );
+  l_mpi.beginSends( 0, l_mgs[2] );
+
+  // the finished messages of the first and last group are removed from the progression, the middle receive remains
+  progress( l_mpi, {l_mgs[0], l_mgs[2]} );
+  volatile bool l_fin = false;
+  l_mpi.comm( true, l_fin, true );
+
+  REQUIRE( l_mpi.m_grps[l_mgs[1]].recv[0][0].test  ==  0 );
+  REQUIRE( l_mpi.m_grps[l_mgs[1]].recv[0][0].cmmTd == -1 );
+  REQUIRE( l_mpi.finRecvs( 0, l_mgs[1] ) == false );
+  for( unsigned short l_gr = 0; l_gr < 3; l_gr += 2 ) {
+    REQUIRE( l_mpi.m_grps[l_mgs[l_gr]].recv[0][0].cmmTd == -2 );
+    REQUIRE( l_data[l_gr][3] == 10*l_gr + 1 );
+    REQUIRE( l_data[l_gr][4] == 10*l_gr + 2 );
+  }
+  REQUIRE( l_data[1][3] == -1 );
+
+  // remaining message
+  l_mpi.beginSends( 0, l_mgs[1] );
+  progress( l_mpi, {l_mgs[1]} );
+  REQUIRE( l_data[1][3] == 11 );
+  REQUIRE( l_data[1][4] == 12 );
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Sequence and acknowledgement counters of node-local messages.", "[Mpi][shm]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  double l_data[5];
+  unsigned short l_mg = l_mpi.addDefault( l_enLa, l_data, sizeof(double), 0, 1 );
+  l_mpi.initShm();
+
+  auto &l_send = l_mpi.m_grps[l_mg].send[0][0];
+  auto &l_recv = l_mpi.m_grps[l_mg].recv[0][0];
+  REQUIRE( l_send.shm != nullptr );
+  REQUIRE( l_recv.shm == l_send.shm );
+  REQUIRE( l_send.shmSeq->load() == 0 );
+  REQUIRE( l_send.shmAck->load() == 0 );
+
+  for( unsigned short l_st = 0; l_st < 3; l_st++ ) {
+    l_data[1] = 10*l_st + 1;
+    l_data[2] = 10*l_st + 2;
+    l_data[3] = l_data[4] = -1;
+
+    // the sender publishes the message, the receiver did not consume it yet
+    l_mpi.beginRecvs( 0, l_mg );
+    l_mpi.beginSends( 0, l_mg );
+    REQUIRE( l_send.shmCnt == l_st+1u );
+    REQUIRE( l_recv.shmCnt == l_st+1u );
+    REQUIRE( l_send.shmSeq->load() == l_st+1u );
+    REQUIRE( l_send.shmAck->load() == l_st );
+
+    // the sends are not finished before the acknowledgement, thus cannot begin again
+    REQUIRE( l_mpi.finSends( 0, l_mg ) == false );
+
+    progress( l_mpi, {l_mg} );
+
+    // the acknowledgement matches the sender's count, which is required by the next publication
+    REQUIRE( l_send.shmAck->load() == l_send.shmCnt );
+    REQUIRE( l_data[3] == 10*l_st + 1 );
+    REQUIRE( l_data[4] == 10*l_st + 2 );
+  }
+
+  // no messages went through MPI
+  REQUIRE( l_mpi.m_stats.nMsgs[0]    == 0 );
+  REQUIRE( l_mpi.m_stats.nMsgs[1]    == 0 );
+  REQUIRE( l_mpi.m_stats.nShmMsgs[0] == 3 );
+  REQUIRE( l_mpi.m_stats.nShmMsgs[1] == 3 );
+  REQUIRE( l_send.request == MPI_REQUEST_NULL );
+  REQUIRE( l_recv.request == MPI_REQUEST_NULL );
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Node-local round trip of messages.", "[Mpi][shm]" ) {
+#ifdef PP_USE_MPI
+  // pairs of ranks exchange their data, a remaining rank exchanges with itself
+  int l_ne = edge::parallel::g_rank ^ 1;
+  if( l_ne >= edge::parallel::g_nRanks ) l_ne = edge::parallel::g_rank;
+
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+  l_enLa.timeGroups[0].neRanks[0] = l_ne;
+
+  double l_data[5];
+  unsigned short l_mg = l_mpi.addDefault( l_enLa, l_data, sizeof(double), 0, 1 );
+  l_mpi.initShm();
+
+  // neighbors on other nodes communicate through MPI
+  int l_shm = ( l_mpi.m_grps[l_mg].send[0][0].shm != nullptr );
+  int l_shmNe = 0;
+  MPI_Sendrecv( &l_shm, 1, MPI_INT, l_ne, 0, &l_shmNe, 1, MPI_INT, l_ne, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+  REQUIRE( l_shm == l_shmNe );
+
+  l_data[1] = 1000 * edge::parallel::g_rank + 1;
+  l_data[2] = 1000 * edge::parallel::g_rank + 2;
+
+  // there
+  l_mpi.beginRecvs( 0, l_mg );
+  l_mpi.beginSends( 0, l_mg );
+  progress( l_mpi, {l_mg} );
+  REQUIRE( l_data[3] == 1000 * l_ne + 1 );
+  REQUIRE( l_data[4] == 1000 * l_ne + 2 );
+
+  // and back
+  l_data[1] = l_data[3];
+  l_data[2] = l_data[4];
+  l_mpi.beginRecvs( 0, l_mg );
+  l_mpi.beginSends( 0, l_mg );
+  progress( l_mpi, {l_mg} );
+  REQUIRE( l_data[3] == 1000 * edge::parallel::g_rank + 1 );
+  REQUIRE( l_data[4] == 1000 * edge::parallel::g_rank + 2 );
+
+  freeComm( l_mpi );
+#endif
+}
+
+TEST_CASE( "Node-local messages of bundles, packed into the shared-memory window.", "[Mpi][shm][bundle]" ) {
+#ifdef PP_USE_MPI
+  edge::parallel::Mpi l_mpi;
+  t_enLayout l_enLa;
+  selfLayout( l_enLa );
+
+  double l_data[2][5];
+  unsigned short l_mgs[2];
+  l_mgs[0] = l_mpi.addDefault( l_enLa, l_data[0], sizeof(double), 0, 1 );
+  l_mgs[1] = l_mpi.addDefault( l_enLa, l_data[1], sizeof(double), 0, 1 );
+  unsigned short l_bn = l_mpi.addBundle( {l_mgs[0], l_mgs[1]} );
+  l_mpi.initShm();
+
+  // only the bundle's message goes through the window, using the derived datatype
+  auto &l_send = l_mpi.m_grps[l_bn].send[0][0];
+  REQUIRE( l_send.shm != nullptr );
+  REQUIRE( l_send.type != MPI_BYTE );
+  REQUIRE( l_mpi.m_grps[l_mgs[0]].send[0][0].shm == nullptr );
+  REQUIRE( l_mpi.m_grps[l_mgs[1]].send[0][0].shm == nullptr );
+
+  for( unsigned short l_st = 0; l_st < 2; l_st++ ) {
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      l_data[l_me][1] = 100*l_st + 10*l_me + 1;
+      l_data[l_me][2] = 100*l_st + 10*l_me + 2;
+      l_data[l_me][3] = l_data[l_me][4] = -1;
+    }
+
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      l_mpi.beginRecvs( 0, l_mgs[l_me] );
+      l_mpi.beginSends( 0, l_mgs[l_me] );
+    }
+
+    // the packed message holds the send regions of the members in order
+    double l_packed[4];
+    int l_pos = 0;
+    MPI_Unpack( l_send.shm, sizeof(l_packed), &l_pos, l_packed, 4, MPI_DOUBLE, MPI_COMM_WORLD );
+    REQUIRE( l_packed[0] == 100*l_st +  1 );
+    REQUIRE( l_packed[1] == 100*l_st +  2 );
+    REQUIRE( l_packed[2] == 100*l_st + 11 );
+    REQUIRE( l_packed[3] == 100*l_st + 12 );
+
+    progress( l_mpi, {l_mgs[0], l_mgs[1]} );
+
+    for( unsigned short l_me = 0; l_me < 2; l_me++ ) {
+      REQUIRE( l_data[l_me][3] == 100*l_st + 10*l_me + 1 );
+      REQUIRE( l_data[l_me][4] == 100*l_st + 10*l_me + 2 );
+    }
+  }
+
+  REQUIRE( l_mpi.m_stats.nShmMsgs[0] == 2 );
+  REQUIRE( l_mpi.m_stats.nMsgs[0] == 0 );
+
+  freeComm( l_mpi );
+#endif
+}
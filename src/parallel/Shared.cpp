@@ -22,8 +22,19 @@
  **/
 #include "Shared.h"
 #include "io/logging.h"
+#include <algorithm>
 #include <atomic>
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
 #ifdef PP_USE_OMP
 #include <omp.h>
 #endif
@@ -66,6 +77,13 @@ void edge::parallel::Shared::init( unsigned int i_nWrks ) {
 
   // init the load balancing
   m_balancing.init( m_nWrks );
+
+  // init the chunks of the workers
+  m_wrkTds.resize( m_nWrks );
+  for( int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+    m_wrkTds[l_wo].rg   = std::numeric_limits< std::size_t >::max();
+    m_wrkTds[l_wo].size = 0;
+  }
 }
 
 void edge::parallel::Shared::print() {
@@ -116,13 +134,31 @@ bool edge::parallel::Shared::isComm() {
   else                        return g_thread >= m_nWrks;
 }
 
-std::size_t edge::parallel::Shared::getWrkRgn( unsigned int i_id ) {
-  std::size_t l_rg;
-  for( l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
-    if( m_wrkRgns[l_rg].id == i_id ) break;
-    EDGE_CHECK( l_rg != m_wrkRgns.size()-1 );
-  }
-  return l_rg;
+void edge::parallel::Shared::config( unsigned int i_spinIters,
+                                     std::size_t  i_chunkSize ) {
+  // chunks are fixed at registration of the work regions
+  EDGE_CHECK_EQ( m_wrkRgns.size(), 0 );
+
+  m_spinIters = i_spinIters;
+  m_chunkSize = i_chunkSize;
+}
+
+bool edge::parallel::Shared::claim( std::size_t   i_rg,
+                                    std::size_t   i_wp,
+                                    std::size_t & o_off ) {
+  std::size_t l_size = m_balancing.getSize( i_rg, i_wp );
+  std::atomic< std::size_t > &l_next = m_wrkRgns[i_rg].wrkPkgs[i_wp].next.val;
+
+  // cheap check, avoiding contention on exhausted packages
+  if( l_next.load( std::memory_order_relaxed ) >= l_size ) return false;
+
+  // without work stealing, the package is a single chunk
+  std::size_t l_chunk = (m_chunkSize > 0) ? m_chunkSize : std::max( l_size, std::size_t(1) );
+
+  // acquire: synchronizes with the release-reset of the package by the scheduler
+  o_off = l_next.fetch_add( l_chunk, std::memory_order_acq_rel );
+
+  return o_off < l_size;
 }
 
 bool edge::parallel::Shared::getWrkTd( int_tg         & o_tg,
@@ -140,27 +176,36 @@ bool edge::parallel::Shared::getWrkTd( int_tg         & o_tg,
   o_first     = std::numeric_limits< int_el       >::max();
   o_size      = std::numeric_limits< int_el       >::max();
 
-  // iterate over work region
-  for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
-    volatile WrkPkg* l_wps = &m_wrkRgns[l_rg].wrkPkgs[0];
-
-    if( l_wps[g_thread].status == RDY ) {
-      o_tg    = m_wrkRgns[l_rg].tg;
-      o_step  = m_wrkRgns[l_rg].step;
-      o_id    = m_wrkRgns[l_rg].id;
+  // return early if no region is ready
+  if( m_nRdy.load( std::memory_order_acquire ) == 0 ) return false;
 
-      m_balancing.getWrkTd( l_rg,
-                            g_thread,
-                            o_first,
-                            o_size,
-                            o_firstSp );
-
-      // flush for a consistent view
-#ifdef PP_USE_OMP
-#pragma omp flush
-#endif
-
-      return true;
+  // iterate over work regions
+  for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
+    if( m_wrkRgns[l_rg].status.val.load( std::memory_order_acquire ) != RDY ) continue;
+
+    // own package first, steal from the others afterwards
+    for( int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+      std::size_t l_wp = (g_thread + l_wo) % m_nWrks;
+      std::size_t l_off;
+
+      if( claim( l_rg, l_wp, l_off ) ) {
+        o_tg    = m_wrkRgns[l_rg].tg;
+        o_step  = m_wrkRgns[l_rg].step;
+        o_id    = m_wrkRgns[l_rg].id;
+
+        m_balancing.getWrkChunk( l_rg,
+                                 l_wp,
+                                 l_off,
+                                 (m_chunkSize > 0) ? m_chunkSize : std::numeric_limits< std::size_t >::max(),
+                                 o_first,
+                                 o_size,
+                                 o_firstSp );
+
+        m_wrkTds[g_thread].rg   = l_rg;
+        m_wrkTds[g_thread].size = o_size;
+
+        return true;
+      }
     }
   }
 
@@ -170,78 +215,78 @@ bool edge::parallel::Shared::getWrkTd( int_tg         & o_tg,
 
 void edge::parallel::Shared::setStatusAll( t_status     i_status,
                                            unsigned int i_id ) {
-  // flush for a consistent view
-#ifdef PP_USE_OMP
-#pragma omp flush
-#endif
-
   std::size_t l_rg = getWrkRgn( i_id );
+  WrkRgn &l_wr = m_wrkRgns[l_rg];
 
-  volatile WrkPkg* l_wps = &m_wrkRgns[l_rg].wrkPkgs[0];
-
-  // iterate over all workers and set status
-  for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
-    if( i_status == RDY ) {
-      EDGE_CHECK( l_wps[l_td].status == FIN || l_wps[l_td].status == WAI );
-    }
-    else {
-      EDGE_LOG_FATAL << "status change not allowed";
-    }
+  if( i_status == RDY ) {
+    int l_st = l_wr.status.val.load( std::memory_order_acquire );
+    EDGE_CHECK( l_st == FIN || l_st == WAI );
+  }
+  else {
+    EDGE_LOG_FATAL << "status change not allowed";
+  }
 
-    // set status
-    l_wps[l_td].status = i_status;
+  // empty regions are finished right away
+  if( l_wr.size == 0 ) {
+    l_wr.status.val.store( FIN, std::memory_order_release );
+    return;
   }
+
+  // reset the packages
+  l_wr.nOpen.val.store( l_wr.size, std::memory_order_relaxed );
+  for( int l_wo = 0; l_wo < m_nWrks; l_wo++ )
+    l_wr.wrkPkgs[l_wo].next.val.store( 0, std::memory_order_release );
+
+  // release the region
+  m_nRdy.fetch_add( 1, std::memory_order_acq_rel );
+  l_wr.status.val.store( RDY, std::memory_order_release );
+
+  // wake sleeping workers
+  m_gen.fetch_add( 1, std::memory_order_acq_rel );
+  if( m_nSleep.load( std::memory_order_acquire ) > 0 ) wake();
 }
 
 void edge::parallel::Shared::resetStatus( t_status i_status ) {
-  // flush for a consistent view
-#ifdef PP_USE_OMP
-#pragma omp flush
-#endif
-
   // iterate over all regions
-  for( unsigned short l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
-    volatile WrkPkg* l_wps = &m_wrkRgns[l_rg].wrkPkgs[0];
-
-    // iterate over all workers
-    for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
-      // set status
-      l_wps[l_td].status = i_status;
-    }
+  for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
+    m_wrkRgns[l_rg].nOpen.val.store( 0, std::memory_order_relaxed );
+    m_wrkRgns[l_rg].status.val.store( i_status, std::memory_order_release );
   }
+
+  // derive number of ready regions
+  m_nRdy.store( (i_status == RDY) ? m_wrkRgns.size() : 0, std::memory_order_release );
 }
 
 void edge::parallel::Shared::setStatusTd(  t_status     i_status,
                                            unsigned int i_id ) {
-  // flush for a consistent view
-#ifdef PP_USE_OMP
-#pragma omp flush
-#endif
-
   // check that the calling thread is a worker
   EDGE_CHECK( g_thread < m_nWrks );
 
   std::size_t l_rg = getWrkRgn( i_id );
+  EDGE_CHECK_EQ( m_wrkTds[g_thread].rg, l_rg );
 
-  volatile t_status *l_st = &m_wrkRgns[l_rg].wrkPkgs[g_thread].status;
-
-  // check that the previous status matches
   if( i_status == IPR ) {
-    EDGE_CHECK( *l_st == RDY );
-    // start the timer for this work package, now having status "in progress"
+    // start the timer for this chunk, now having status "in progress"
     m_balancing.startClock( l_rg, g_thread );
   }
   else if( i_status == FIN ) {
-    EDGE_CHECK( *l_st == IPR );
-    // stop the timer for this work package, now having status "finished"
-    m_balancing.stopClock( l_rg, g_thread );
+    std::size_t l_size = m_wrkTds[g_thread].size;
+
+    // stop the timer for this chunk, now having status "finished"
+    m_balancing.stopClock( l_rg, g_thread, l_size );
+
+    // the last finished chunk finishes the region
+    std::size_t l_nOpen = m_wrkRgns[l_rg].nOpen.val.fetch_sub( l_size, std::memory_order_acq_rel );
+    EDGE_CHECK_GE( l_nOpen, l_size );
+
+    if( l_nOpen == l_size ) {
+      m_nRdy.fetch_sub( 1, std::memory_order_acq_rel );
+      m_wrkRgns[l_rg].status.val.store( FIN, std::memory_order_release );
+    }
   }
   else {
-    EDGE_LOG_FATAL << "previous status not matching: " << i_status;
+    EDGE_LOG_FATAL << "status not supported: " << i_status;
   }
-
-  // assign
-  *l_st = i_status;
 }
 
 bool edge::parallel::Shared::getStatusAll( t_status     i_status,
@@ -249,18 +294,58 @@ bool edge::parallel::Shared::getStatusAll( t_status     i_status,
   // find the correct work region
   std::size_t l_rg = getWrkRgn( i_id );
 
-  volatile WrkPkg* l_wps = &m_wrkRgns[l_rg].wrkPkgs[0];
+  int l_st = m_wrkRgns[l_rg].status.val.load( std::memory_order_acquire );
 
-  // iterate over all workers and check if we are finished
-  for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
-    if(l_wps[l_td].status != i_status) return false;
+  if( i_status == IPR ) {
+    return    l_st == RDY
+           && m_wrkRgns[l_rg].nOpen.val.load( std::memory_order_acquire ) < m_wrkRgns[l_rg].size;
   }
 
-#ifdef PP_USE_OMP
-#pragma omp flush
+  return l_st == i_status;
+}
+
+void edge::parallel::Shared::idle() {
+  // spin first
+  for( unsigned int l_it = 0; l_it < m_spinIters; l_it++ ) {
+    if( m_nRdy.load( std::memory_order_acquire ) > 0 ) return;
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
 #endif
+  }
 
-  return true;
+  // sleep afterwards, work released after reading the generation changes it and prevents the sleep
+  int l_gen = m_gen.load( std::memory_order_acquire );
+  if( m_nRdy.load( std::memory_order_acquire ) > 0 ) return;
+
+  m_nSleep.fetch_add( 1, std::memory_order_acq_rel );
+#ifdef __linux__
+  struct timespec l_timeout;
+  l_timeout.tv_sec  = 0;
+  l_timeout.tv_nsec = 1000000;
+  syscall( SYS_futex,
+           reinterpret_cast< int* >( &m_gen ),
+           FUTEX_WAIT_PRIVATE,
+           l_gen,
+           &l_timeout,
+           nullptr,
+           0 );
+#else
+  if( m_gen.load( std::memory_order_acquire ) == l_gen )
+    std::this_thread::sleep_for( std::chrono::microseconds( 50 ) );
+#endif
+  m_nSleep.fetch_sub( 1, std::memory_order_acq_rel );
+}
+
+void edge::parallel::Shared::wake() {
+#ifdef __linux__
+  syscall( SYS_futex,
+           reinterpret_cast< int* >( &m_gen ),
+           FUTEX_WAKE_PRIVATE,
+           std::numeric_limits< int >::max(),
+           nullptr,
+           nullptr,
+           0 );
+#endif
 }
 
 void edge::parallel::Shared::balance() {
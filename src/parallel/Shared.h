@@ -23,7 +23,9 @@
 #ifndef EDGE_PARALLEL_SHARED_H_
 #define EDGE_PARALLEL_SHARED_H_
 
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <vector>
 #include "data/SparseEntities.hpp"
 #include "data/EntityLayout.type"
@@ -51,10 +53,30 @@ class edge::parallel::Shared {
     } t_status;
 
    private:
+    /**
+     * Copyable atomic.
+     * Copies are only performed during setup, when no other thread accesses the data.
+     *
+     * @paramt TL_T_VAL type of the value.
+     **/
+    template< typename TL_T_VAL >
+    struct CpAtomic {
+      std::atomic< TL_T_VAL > val;
+
+      CpAtomic( TL_T_VAL i_val = TL_T_VAL() ): val( i_val ) {};
+
+      CpAtomic( CpAtomic const & i_other ): val( i_other.val.load( std::memory_order_relaxed ) ) {};
+
+      CpAtomic & operator=( CpAtomic const & i_other ) {
+        val.store( i_other.val.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        return *this;
+      }
+    };
+
     // definition of a reoccurring a work package
     struct WrkPkg {
-      //! status
-      t_status status;
+      //! next entity (relative to the package) which is not claimed by any worker
+      CpAtomic< std::size_t > next;
 
       //! 64byte padding for separate signaling cache lines
       uint64_t padding[8];
@@ -74,6 +96,15 @@ class edge::parallel::Shared {
       //! priority of the region
       int prio;
 
+      //! number of dense entities in the region
+      std::size_t size;
+
+      //! status of the region (WAI, RDY or FIN)
+      CpAtomic< int > status;
+
+      //! number of entities, which are not finished in the current round
+      CpAtomic< std::size_t > nOpen;
+
       //! sparse types
       std::vector< int_spType > spTypes;
 
@@ -81,9 +112,42 @@ class edge::parallel::Shared {
       std::vector< WrkPkg > wrkPkgs;
     };
 
+    // chunk of work, currently processed by a worker
+    struct WrkTd {
+      //! work region of the chunk
+      std::size_t rg;
+
+      //! size of the chunk
+      std::size_t size;
+
+      //! 64byte padding for separate cache lines
+      uint64_t padding[8];
+    };
+
     //! work regions present in the simulation, sorted by priority (descending).
     std::vector< WrkRgn > m_wrkRgns;
 
+    //! position of the work regions in m_wrkRgns, indexed by id
+    std::vector< std::size_t > m_idRgn;
+
+    //! chunks, currently processed by the workers
+    std::vector< WrkTd > m_wrkTds;
+
+    //! number of ready work regions
+    std::atomic< int > m_nRdy{0};
+
+    //! generation counter, incremented whenever work becomes available (futex word of idle workers)
+    std::atomic< int > m_gen{0};
+
+    //! number of sleeping workers
+    std::atomic< int > m_nSleep{0};
+
+    //! number of spin iterations of idle workers before sleeping
+    unsigned int m_spinIters = 4096;
+
+    //! number of entities, which are claimed at once by a worker; 0 disables work stealing
+    std::size_t m_chunkSize = 256;
+
     //! dynamic load balancing
     LoadBalancing m_balancing;
 
@@ -92,7 +156,23 @@ class edge::parallel::Shared {
      *
      * @param i_id id for which the work region is derived.
      **/
-    std::size_t getWrkRgn( unsigned int i_id );
+    std::size_t getWrkRgn( unsigned int i_id ) {
+      EDGE_CHECK_LT( i_id, m_idRgn.size() );
+      EDGE_CHECK_LT( m_idRgn[i_id], m_wrkRgns.size() );
+      return m_idRgn[i_id];
+    }
+
+    /**
+     * Claims a chunk of the given work package.
+     *
+     * @param i_rg work region.
+     * @param i_wp work package.
+     * @param o_off will be set to the offset of the chunk, relative to the work package.
+     * @return true if a chunk was claimed, false if the work package is exhausted.
+     **/
+    bool claim( std::size_t   i_rg,
+                std::size_t   i_wp,
+                std::size_t & o_off );
 
   public:
     /**
@@ -100,6 +180,14 @@ class edge::parallel::Shared {
      **/
     void print();
 
+    /**
+     * Logs the imbalance of the ranks, derived from the load balancing's timers.
+     * Called by all ranks.
+     *
+     * @param i_prefix prefix of the log messages.
+     **/
+    void logImbalance( std::string const & i_prefix ) const { m_balancing.logImbalance( i_prefix ); }
+
     /**
      * Constructor.
      *
@@ -124,6 +212,17 @@ class edge::parallel::Shared {
      **/
     void init( unsigned int i_nWrks = 0 );
 
+    /**
+     * Configures the work distribution and idling of the workers.
+     *
+     * Remark: This should be called outside of the omp-parallel region and before registering work regions.
+     *
+     * @param i_spinIters number of spin iterations of idle workers before sleeping.
+     * @param i_chunkSize number of entities, which are claimed at once by a worker; 0 disables work stealing.
+     **/
+    void config( unsigned int i_spinIters,
+                 std::size_t  i_chunkSize );
+
     /**
      * Determine if the thread is the lead of the communication threads
      *
@@ -190,11 +289,11 @@ class edge::parallel::Shared {
       l_wrkRgn.step = i_step;
       l_wrkRgn.id   = i_id;
       l_wrkRgn.prio = i_prio;
+      l_wrkRgn.size = i_size;
 
       // init to wait
-      for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
-        l_wrkRgn.wrkPkgs[l_td].status = WAI;
-      }
+      l_wrkRgn.status.val = WAI;
+      l_wrkRgn.nOpen.val = 0;
 
       // put the work region in the right spot based on priority
       std::size_t l_ps = m_wrkRgns.size();
@@ -208,6 +307,11 @@ class edge::parallel::Shared {
 
       m_wrkRgns.insert( m_wrkRgns.begin()+l_ps, l_wrkRgn );
 
+      // update the positions of the regions
+      if( i_id >= m_idRgn.size() ) m_idRgn.resize( i_id+1, std::numeric_limits< std::size_t >::max() );
+      EDGE_CHECK_EQ( m_idRgn[i_id], std::numeric_limits< std::size_t >::max() );
+      for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) m_idRgn[ m_wrkRgns[l_rg].id ] = l_rg;
+
       // register the work region in the dynamic load balancing
       m_balancing.regWrkRgn( l_ps,
                              i_first,
@@ -223,9 +327,27 @@ class edge::parallel::Shared {
 #endif
     }
 
+    /**
+     * Sets the work-weights of a work region's entities, which are used by the dynamic load balancing.
+     *
+     * @param i_id id of the region.
+     * @param i_wgts work-weights of the dense entities (global ids), nullptr to disable weighting.
+     **/
+    void setWrkRgnWgts( unsigned int   i_id,
+                        float  const * i_wgts ) {
+#ifdef PP_USE_OMP
+#pragma omp barrier
+#endif
+      if( g_thread == 0 ) m_balancing.setWgts( getWrkRgn( i_id ), i_wgts );
+#ifdef PP_USE_OMP
+#pragma omp barrier
+#endif
+    }
+
     /**
      * Gets work for the calling thread.
-     * If work is available, OMP-flush is called.
+     * The worker claims a chunk of its own work package in the ready region with the highest priority.
+     * If the own package is exhausted, chunks of the other workers' packages in the region are stolen.
      *
      * @param o_tg time group.
      * @param o_step step in the computational scheme.
@@ -244,8 +366,8 @@ class edge::parallel::Shared {
                    int_el         * o_spEn );
 
     /**
-     * Sets the given status of the work package in the respective region for the calling thread.
-     * Additionally, OMP-flush is called.
+     * Sets the given status of the chunk, which was obtained by the calling thread through getWrkTd.
+     * The region is finished (release semantics), once all of its chunks are finished.
      *
      * @param i_st status which is set.
      * @param i_id id of the work region.
@@ -254,19 +376,18 @@ class edge::parallel::Shared {
                       unsigned int i_id );
 
     /**
-     * Checks if the status of all workers matches for the region.
-     * If this is true, OMP-flush is called.
+     * Checks if the status of the region matches (acquire semantics).
+     * A region is in progress (IPR), if it is ready and some of its entities are finished.
      *
      * @param i_status status to check.
      * @param i_id id of the region.
-     * @return true if all workers' statuses matches, false otherwise.
+     * @return true if the status matches, false otherwise.
      **/
     bool getStatusAll( t_status     i_status,
                        unsigned int i_id );
 
     /**
-     * Sets the status of the region for all workers.
-     * Additionally, OMP-flush is called.
+     * Sets the status of the region (release semantics).
      *
      * @param i_status status to set.
      * @param i_id id of the region.
@@ -275,8 +396,18 @@ class edge::parallel::Shared {
                        unsigned int i_id );
 
     /**
-     * Resets the status for all regions for all workers to the given value.
-     * Additionally, OMP-flush is called.
+     * Idles the calling worker until work becomes available.
+     * The worker spins first and sleeps afterwards; the function returns after at most one sleep, which is bounded by a timeout.
+     **/
+    void idle();
+
+    /**
+     * Wakes all sleeping workers.
+     **/
+    void wake();
+
+    /**
+     * Resets the status of all regions to the given value.
      *
      * @param i_status status to reset to.
      **/
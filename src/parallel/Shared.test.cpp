@@ -59,4 +59,81 @@ TEST_CASE( "NUMA-aware initialization", "[numaInit]" ) {
   // check the result
   for( unsigned int l_en = 0; l_en < 73*31; l_en++ )  REQUIRE( l_arr1[l_en] == float(0) );
   for( unsigned int l_en = 0; l_en <     3; l_en++ )  REQUIRE( l_arr2[l_en] == float(0) );
-}
\ No newline at end of file
+}
+TEST_CASE( "Chunked work distribution and work stealing.", "[Shared][wrkStealing]" ) {
+  edge::parallel::g_thread   = 0;
+  edge::parallel::g_nThreads = 1;
+
+  // two workers, chunks of three entities
+  edge::parallel::Shared l_shared;
+  l_shared.init( 2 );
+  l_shared.config( 16, 3 );
+
+  // high priority region with 10 entities, low priority region with 4 entities
+  l_shared.regWrkRgn( 0, 0, 5, 0, 10, 2 );
+  l_shared.regWrkRgn( 0, 1, 7, 20, 4, 1 );
+
+  REQUIRE( l_shared.getWrkRgn(5) == 0 );
+  REQUIRE( l_shared.getWrkRgn(7) == 1 );
+
+  int_tg         l_tg;
+  unsigned short l_st;
+  unsigned int   l_id;
+  int_el         l_first;
+  int_el         l_size;
+  int_el         l_enSp[1];
+
+  // nothing is ready
+  REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) == false );
+  REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::WAI, 5 ) );
+
+  l_shared.setStatusAll( edge::parallel::Shared::RDY, 7 );
+  l_shared.setStatusAll( edge::parallel::Shared::RDY, 5 );
+  REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::RDY, 5 ) );
+  REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::IPR, 5 ) == false );
+
+  // worker 1 processes its own package of region 5 first (entities 5-9), steals from worker 0 afterwards
+  edge::parallel::g_thread = 1;
+  int_el l_expFirst[4] = { 5, 8, 0, 3 };
+  int_el l_expSize[4]  = { 3, 2, 3, 2 };
+  for( unsigned short l_ch = 0; l_ch < 4; l_ch++ ) {
+    REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+    REQUIRE( l_id    == 5 );
+    REQUIRE( l_tg    == 0 );
+    REQUIRE( l_st    == 0 );
+    REQUIRE( l_first == l_expFirst[l_ch] );
+    REQUIRE( l_size  == l_expSize[l_ch]  );
+
+    l_shared.setStatusTd( edge::parallel::Shared::IPR, l_id );
+    l_shared.setStatusTd( edge::parallel::Shared::FIN, l_id );
+
+    // region is finished with the last chunk
+    REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::FIN, 5 ) == (l_ch == 3) );
+    if( l_ch < 3 ) REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::IPR, 5 ) );
+  }
+
+  // remaining work in the lower priority region
+  edge::parallel::g_thread = 0;
+  REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+  REQUIRE( l_id    == 7 );
+  REQUIRE( l_first == 20 );
+  REQUIRE( l_size  == 2 );
+  l_shared.setStatusTd( edge::parallel::Shared::FIN, l_id );
+
+  REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+  REQUIRE( l_id    == 7 );
+  REQUIRE( l_first == 22 );
+  REQUIRE( l_size  == 2 );
+  l_shared.setStatusTd( edge::parallel::Shared::FIN, l_id );
+
+  REQUIRE( l_shared.getStatusAll( edge::parallel::Shared::FIN, 7 ) );
+  REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) == false );
+
+  // the region is released again in the next round
+  l_shared.setStatusAll( edge::parallel::Shared::RDY, 7 );
+  REQUIRE( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+  REQUIRE( l_first == 20 );
+
+  // idling returns right away if work is available
+  l_shared.idle();
+}
@@ -23,6 +23,9 @@
 #ifndef SC_SUBGRID_HPP
 #define SC_SUBGRID_HPP
 
+#include <vector>
+#include <limits>
+#include <algorithm>
 #include "constants.hpp"
 
 namespace edge {
@@ -163,6 +166,107 @@ class edge::sc::SubGrid {
         }
       }
     }
+
+    /**
+     * Derives the regular sub-grid of the reference element with the given number of sub-divisions per reference edge.
+     * The sub-vertices are the points of the lattice, the sub-cells have the element's type:
+     *   line, quad, hex: tensor-product cells of the lattice (i_nSds^TL_N_DIS sub-cells).
+     *   tria: "up" and "down" triangles of the lattice (i_nSds^2 sub-cells).
+     *   tet: per lattice cell an "up" tet, the octahedron split into four tets and a "down" tet (i_nSds^3 sub-cells).
+     * Sub-cells of simplices have the orientation of the reference element.
+     * For i_nSds = 2*TL_O_SP - 1, the numbers of sub-vertices and sub-cells match the sub-grid of the limiter.
+     *
+     * @param i_nSds number of sub-divisions per reference edge, 1 gives the element itself.
+     * @param o_svCrds will be set to the reference coordinates of the sub-vertices ([*][]: sub-vertex, [][*]: dimension).
+     * @param o_scSv will be set to the sub-vertices adjacent to the sub-cells ([*][]: sub-cell, [][*]: vertex).
+     *
+     * @paramt TL_T_REAL floating point type.
+     **/
+    template< typename TL_T_REAL >
+    static void regular( unsigned short               i_nSds,
+                         std::vector< TL_T_REAL >    &o_svCrds,
+                         std::vector< unsigned int > &o_scSv ) {
+      o_svCrds.clear();
+      o_scSv.clear();
+
+      // number of lattice points per dimension
+      unsigned int l_nLa = i_nSds+1;
+      bool l_simplex = (TL_T_EL == TRIA3 || TL_T_EL == TET4);
+
+      // ids of the sub-vertices at the lattice points, max() if outside of the element
+      std::vector< unsigned int > l_laSv( l_nLa * ( (TL_N_DIS > 1) ? l_nLa : 1 )
+                                                * ( (TL_N_DIS > 2) ? l_nLa : 1 ),
+                                          std::numeric_limits< unsigned int >::max() );
+
+      unsigned int l_nSvs = 0;
+      for( unsigned int l_z = 0; l_z < ( (TL_N_DIS > 2) ? l_nLa : 1 ); l_z++ ) {
+        for( unsigned int l_y = 0; l_y < ( (TL_N_DIS > 1) ? l_nLa : 1 ); l_y++ ) {
+          for( unsigned int l_x = 0; l_x < l_nLa; l_x++ ) {
+            if( l_simplex && l_x+l_y+l_z > i_nSds ) continue;
+
+            l_laSv[ (l_z*l_nLa + l_y)*l_nLa + l_x ] = l_nSvs;
+            unsigned int l_ids[3] = { l_x, l_y, l_z };
+            for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+              o_svCrds.push_back( TL_T_REAL(l_ids[l_di]) / i_nSds );
+            l_nSvs++;
+          }
+        }
+      }
+
+      // offsets of the lattice points, adjacent to the sub-cells, w.r.t. to the lattice cell
+      std::vector< std::vector< unsigned short > > l_offs;
+
+      if( TL_T_EL == LINE )        l_offs = { { 0, 1 } };
+      else if( TL_T_EL == QUAD4R ) l_offs = { { 0, 1, 3, 2 } };
+      else if( TL_T_EL == HEX8R )  l_offs = { { 0, 1, 3, 2, 4, 5, 7, 6 } };
+      else if( TL_T_EL == TRIA3 )  l_offs = { { 0, 1, 2 },
+                                              { 1, 3, 2 } };
+      // binary offsets: 1: x, 2: y, 4: z; octahedron split along the diagonal x <-> y+z
+      else if( TL_T_EL == TET4 )   l_offs = { { 0, 1, 2, 4 },
+                                              { 1, 6, 2, 4 },
+                                              { 1, 6, 4, 5 },
+                                              { 1, 6, 5, 3 },
+                                              { 1, 6, 3, 2 },
+                                              { 3, 5, 6, 7 } };
+
+      for( unsigned int l_z = 0; l_z < ( (TL_N_DIS > 2) ? i_nSds : 1 ); l_z++ ) {
+        for( unsigned int l_y = 0; l_y < ( (TL_N_DIS > 1) ? i_nSds : 1 ); l_y++ ) {
+          for( unsigned int l_x = 0; l_x < i_nSds; l_x++ ) {
+            for( std::size_t l_sc = 0; l_sc < l_offs.size(); l_sc++ ) {
+              unsigned int l_scSv[TL_N_VES];
+              bool l_in = true;
+
+              for( unsigned short l_ve = 0; l_ve < TL_N_VES; l_ve++ ) {
+                unsigned short l_of = l_offs[l_sc][l_ve];
+                unsigned int l_la = (   (l_z + ((l_of>>2)&1) ) * l_nLa
+                                      + (l_y + ((l_of>>1)&1) ) ) * l_nLa
+                                      + (l_x +  (l_of    &1) );
+                l_scSv[l_ve] = l_laSv[l_la];
+                l_in = l_in && ( l_scSv[l_ve] != std::numeric_limits< unsigned int >::max() );
+              }
+              if( !l_in ) continue;
+
+              // restore the orientation of the reference element
+              if( l_simplex ) {
+                TL_T_REAL l_jac[3][3] = { {1, 0, 0}, {0, 1, 0}, {0, 0, 1} };
+                for( unsigned short l_ve = 1; l_ve < TL_N_VES; l_ve++ )
+                  for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+                    l_jac[l_ve-1][l_di] =   o_svCrds[ l_scSv[l_ve]*TL_N_DIS + l_di ]
+                                          - o_svCrds[ l_scSv[0]   *TL_N_DIS + l_di ];
+
+                TL_T_REAL l_det =   l_jac[0][0] * ( l_jac[1][1]*l_jac[2][2] - l_jac[1][2]*l_jac[2][1] )
+                                  - l_jac[0][1] * ( l_jac[1][0]*l_jac[2][2] - l_jac[1][2]*l_jac[2][0] )
+                                  + l_jac[0][2] * ( l_jac[1][0]*l_jac[2][1] - l_jac[1][1]*l_jac[2][0] );
+                if( l_det < 0 ) std::swap( l_scSv[TL_N_VES-2], l_scSv[TL_N_VES-1] );
+              }
+
+              for( unsigned short l_ve = 0; l_ve < TL_N_VES; l_ve++ )
+                o_scSv.push_back( l_scSv[l_ve] );
+            }
+          }
+        }
+      }
+    }
 };
 
 #endif
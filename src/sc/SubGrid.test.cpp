@@ -100,3 +100,75 @@ TEST_CASE( "Sub-grid: ptSc.", "[subGrid][ptSc]" ) {
   l_sc = edge::sc::SubGrid< LINE, 4 >::ptSc( l_pt1, l_scSv1, l_vcChars1 );
   REQUIRE( l_sc == 6 );
 }
+
+TEST_CASE( "Sub-grid: regular refinement.", "[subGrid][regular]" ) {
+  std::vector< double > l_svCrds;
+  std::vector< unsigned int > l_scSv;
+
+  // line
+  edge::sc::SubGrid< LINE, 4 >::regular( 3, l_svCrds, l_scSv );
+  REQUIRE( l_svCrds.size() == 4 );
+  REQUIRE( l_scSv.size() == 3*2 );
+  REQUIRE( l_svCrds[2] == Approx( 2.0/3.0 ) );
+  REQUIRE( l_scSv[4] == 2 );
+  REQUIRE( l_scSv[5] == 3 );
+
+  // quad
+  edge::sc::SubGrid< QUAD4R, 4 >::regular( 2, l_svCrds, l_scSv );
+  REQUIRE( l_svCrds.size() == 9*2 );
+  REQUIRE( l_scSv.size() == 4*4 );
+  unsigned int l_scSvQuad[4] = { 4, 5, 8, 7 };
+  for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+    REQUIRE( l_scSv[3*4+l_ve] == l_scSvQuad[l_ve] );
+
+  // hex, vertex-counts match the limiter's sub-grid
+  edge::sc::SubGrid< HEX8R, 2 >::regular( 3, l_svCrds, l_scSv );
+  REQUIRE( l_svCrds.size() == std::size_t( CE_N_SUB_VERTICES( HEX8R, 2 ) )*3 );
+  REQUIRE( l_scSv.size() == std::size_t( CE_N_SUB_CELLS( HEX8R, 2 ) )*8 );
+
+  // triangles, sub-cells have to cover the reference element with positive orientation
+  for( unsigned int l_nSds = 1; l_nSds < 6; l_nSds++ ) {
+    edge::sc::SubGrid< TRIA3, 4 >::regular( l_nSds, l_svCrds, l_scSv );
+    REQUIRE( l_svCrds.size() == ((l_nSds+1)*(l_nSds+2))/2 * 2 );
+    REQUIRE( l_scSv.size() == l_nSds*l_nSds*3 );
+
+    double l_area = 0;
+    for( std::size_t l_sc = 0; l_sc < l_scSv.size()/3; l_sc++ ) {
+      double const *l_ve0 = l_svCrds.data() + l_scSv[l_sc*3+0]*2;
+      double const *l_ve1 = l_svCrds.data() + l_scSv[l_sc*3+1]*2;
+      double const *l_ve2 = l_svCrds.data() + l_scSv[l_sc*3+2]*2;
+      double l_det =   (l_ve1[0]-l_ve0[0]) * (l_ve2[1]-l_ve0[1])
+                     - (l_ve1[1]-l_ve0[1]) * (l_ve2[0]-l_ve0[0]);
+      REQUIRE( l_det == Approx( 1.0 / (l_nSds*l_nSds) ) );
+      l_area += 0.5 * l_det;
+    }
+    REQUIRE( l_area == Approx( 0.5 ) );
+  }
+
+  // tets
+  for( unsigned int l_nSds = 1; l_nSds < 6; l_nSds++ ) {
+    edge::sc::SubGrid< TET4, 4 >::regular( l_nSds, l_svCrds, l_scSv );
+    REQUIRE( l_svCrds.size() == ((l_nSds+1)*(l_nSds+2)*(l_nSds+3))/6 * 3 );
+    REQUIRE( l_scSv.size() == l_nSds*l_nSds*l_nSds*4 );
+
+    double l_vol = 0;
+    for( std::size_t l_sc = 0; l_sc < l_scSv.size()/4; l_sc++ ) {
+      double l_jac[3][3];
+      for( unsigned short l_ve = 0; l_ve < 3; l_ve++ )
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_jac[l_ve][l_di] =   l_svCrds[ l_scSv[l_sc*4+l_ve+1]*3 + l_di ]
+                              - l_svCrds[ l_scSv[l_sc*4       ]*3 + l_di ];
+      double l_det =   l_jac[0][0] * ( l_jac[1][1]*l_jac[2][2] - l_jac[1][2]*l_jac[2][1] )
+                     - l_jac[0][1] * ( l_jac[1][0]*l_jac[2][2] - l_jac[1][2]*l_jac[2][0] )
+                     + l_jac[0][2] * ( l_jac[1][0]*l_jac[2][1] - l_jac[1][1]*l_jac[2][0] );
+      REQUIRE( l_det == Approx( 1.0 / (l_nSds*l_nSds*l_nSds) ) );
+      l_vol += l_det / 6.0;
+    }
+    REQUIRE( l_vol == Approx( 1.0 / 6.0 ) );
+  }
+
+  // tets, counts match the limiter's sub-grid
+  edge::sc::SubGrid< TET4, 3 >::regular( 5, l_svCrds, l_scSv );
+  REQUIRE( l_svCrds.size() == std::size_t( CE_N_SUB_VERTICES( TET4, 3 ) )*3 );
+  REQUIRE( l_scSv.size() == std::size_t( CE_N_SUB_CELLS( TET4, 3 ) )*4 );
+}
@@ -0,0 +1,106 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Time step groups of local time stepping.
+ **/
+#ifndef EDGE_TIME_GROUPS_HPP
+#define EDGE_TIME_GROUPS_HPP
+
+#include <limits>
+#include "constants.hpp"
+#include "io/logging.h"
+
+namespace edge {
+  namespace time {
+    class Groups;
+  }
+}
+
+/**
+ * Time step groups of local time stepping (LTS).
+ *
+ * The time step of group tg is 2^tg times the fundamental time step.
+ * Face-adjacent elements are required to be in the same or a neighboring time group.
+ **/
+class edge::time::Groups {
+  public:
+    /**
+     * Sets the LTS sparse types of the elements (C_LTS_EL, C_LTS_AD) based on their time groups.
+     *
+     *   EL_SBUF: Element has a face-neighbor in the next-higher time group and accumulates time integrated DOFs.
+     *   EL_DBUF: Element has a face-neighbor in the next-lower time group and stores its time derivatives.
+     *   AD_LT/AD_EQ/AD_GT: The face-neighbor's time group is below/equal to/above the element's group.
+     *
+     * Remark: Elements without a face-neighbor are set to AD_EQ for the respective face.
+     *
+     * @param i_nEls number of elements.
+     * @param i_elFaEl elements adjacent to the elements (faces as bridge).
+     * @param i_elTgs time groups of the elements.
+     * @param io_elChars element characteristics, LTS sparse types will be added.
+     *
+     * @paramt TL_T_LID integral type of local ids.
+     * @paramt TL_T_TG integral type of the time groups.
+     * @paramt TL_T_EL_CHARS type of the element characteristics, offering member .spType.
+     * @paramt TL_N_FAS number of faces per element.
+     **/
+    template< typename       TL_T_LID,
+              typename       TL_T_TG,
+              typename       TL_T_EL_CHARS,
+              unsigned short TL_N_FAS >
+    static void setLtsTypes( TL_T_LID              i_nEls,
+                             TL_T_LID      const (*i_elFaEl)[TL_N_FAS],
+                             TL_T_TG       const  *i_elTgs,
+                             TL_T_EL_CHARS        *io_elChars ) {
+      static_assert( TL_N_FAS <= 6, "more than 6 faces not supported" );
+
+      for( TL_T_LID l_el = 0; l_el < i_nEls; l_el++ ) {
+        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+          TL_T_LID l_ne = i_elFaEl[l_el][l_fa];
+
+          // boundary faces are treated as GTS
+          if( l_ne == std::numeric_limits< TL_T_LID >::max() ) {
+            io_elChars[l_el].spType |= C_LTS_AD[l_fa][AD_EQ];
+            continue;
+          }
+
+          TL_T_TG l_tgEl = i_elTgs[l_el];
+          TL_T_TG l_tgNe = i_elTgs[l_ne];
+
+          if( l_tgNe == l_tgEl ) {
+            io_elChars[l_el].spType |= C_LTS_AD[l_fa][AD_EQ];
+          }
+          else if( l_tgNe+1 == l_tgEl ) {
+            io_elChars[l_el].spType |= C_LTS_AD[l_fa][AD_LT];
+            io_elChars[l_el].spType |= C_LTS_EL[EL_DBUF];
+          }
+          else if( l_tgNe == l_tgEl+1 ) {
+            io_elChars[l_el].spType |= C_LTS_AD[l_fa][AD_GT];
+            io_elChars[l_el].spType |= C_LTS_EL[EL_SBUF];
+          }
+          else {
+            EDGE_LOG_FATAL << "time groups of face-neighbors differ by more than one: "
+                           << l_el << " (" << l_tgEl << "), " << l_ne << " (" << l_tgNe << ")";
+          }
+        }
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the time step groups of local time stepping.
+ **/
+#include <catch.hpp>
+#include "Groups.hpp"
+
+TEST_CASE( "Time groups: LTS sparse types.", "[setLtsTypes][Groups]" ) {
+  struct { int_spType spType; } l_chars[4];
+  for( unsigned short l_el = 0; l_el < 4; l_el++ ) l_chars[l_el].spType = 0;
+
+  int_el l_bnd = std::numeric_limits< int_el >::max();
+
+  // chain of elements: 0 - 1 - 2 - 3
+  int_el l_elFaEl[4][3] = { { l_bnd, 1,     l_bnd },
+                            { 0,     l_bnd, 2     },
+                            { 1,     3,     l_bnd },
+                            { l_bnd, 2,     l_bnd } };
+
+  int_tg l_elTgs[4] = { 0, 1, 1, 2 };
+
+  edge::time::Groups::setLtsTypes( (int_el) 4,
+                                   l_elFaEl,
+                                   l_elTgs,
+                                   l_chars );
+
+  // element 0: higher neighbor only
+  REQUIRE( (l_chars[0].spType & C_LTS_EL[EL_SBUF]) == C_LTS_EL[EL_SBUF] );
+  REQUIRE( (l_chars[0].spType & C_LTS_EL[EL_DBUF]) == 0 );
+  REQUIRE( (l_chars[0].spType & C_LTS_AD[0][AD_EQ]) == C_LTS_AD[0][AD_EQ] );
+  REQUIRE( (l_chars[0].spType & C_LTS_AD[1][AD_GT]) == C_LTS_AD[1][AD_GT] );
+  REQUIRE( (l_chars[0].spType & C_LTS_AD[2][AD_EQ]) == C_LTS_AD[2][AD_EQ] );
+
+  // element 1: lower and same group
+  REQUIRE( (l_chars[1].spType & C_LTS_EL[EL_SBUF]) == 0 );
+  REQUIRE( (l_chars[1].spType & C_LTS_EL[EL_DBUF]) == C_LTS_EL[EL_DBUF] );
+  REQUIRE( (l_chars[1].spType & C_LTS_AD[0][AD_LT]) == C_LTS_AD[0][AD_LT] );
+  REQUIRE( (l_chars[1].spType & C_LTS_AD[2][AD_EQ]) == C_LTS_AD[2][AD_EQ] );
+  REQUIRE( (l_chars[1].spType & C_LTS_AD[2][AD_GT]) == 0 );
+
+  // element 2: same and higher group
+  REQUIRE( (l_chars[2].spType & C_LTS_EL[EL_SBUF]) == C_LTS_EL[EL_SBUF] );
+  REQUIRE( (l_chars[2].spType & C_LTS_EL[EL_DBUF]) == 0 );
+  REQUIRE( (l_chars[2].spType & C_LTS_AD[0][AD_EQ]) == C_LTS_AD[0][AD_EQ] );
+  REQUIRE( (l_chars[2].spType & C_LTS_AD[1][AD_GT]) == C_LTS_AD[1][AD_GT] );
+
+  // element 3: lower neighbor only
+  REQUIRE( (l_chars[3].spType & C_LTS_EL[EL_SBUF]) == 0 );
+  REQUIRE( (l_chars[3].spType & C_LTS_EL[EL_DBUF]) == C_LTS_EL[EL_DBUF] );
+  REQUIRE( (l_chars[3].spType & C_LTS_AD[1][AD_LT]) == C_LTS_AD[1][AD_LT] );
+}
@@ -24,6 +24,8 @@
 #include "Manager.h"
 #include "monitor/instrument.hpp"
 #include "sc/Steering.hpp"
+#include <algorithm>
+#include <cmath>
 
 void edge::time::Manager::schedule() {
 #if defined PP_T_EQUATIONS_ADVECTION
@@ -83,6 +85,8 @@ void edge::time::Manager::compute() {
       // set status to "finished"
       m_shared.setStatusTd( parallel::Shared::FIN, l_id );
     }
+    // pure workers back off if no work is available
+    else if( l_schdCmm == false ) m_shared.idle();
 
     // non-pure workers are allowed to exit
     if( l_schdCmm == true ) break;
@@ -93,18 +97,31 @@ void edge::time::Manager::simulate( double i_time ) {
   PP_INSTR_FUN("simulate")
 
   // propagate sync time to all time groups
-  for( int_tg l_tg = 0; l_tg < m_timeGroups.size(); l_tg++ ) {
-    m_timeGroups[l_tg]->setUp( m_dTfun,
-                               i_time );
+  if( m_timeGroups.size() == 1 ) {
+    m_timeGroups[0]->setUp( m_dTfun,
+                            i_time );
+  }
+  // LTS: the sync time has to be a multiple of the largest time step
+  else {
+    int_ts l_maxMult = m_timeGroups.back()->getFunMult();
+    int_ts l_nMacro = std::ceil( i_time / (m_dTfun * l_maxMult) );
+    l_nMacro = std::max( l_nMacro, int_ts(1) );
+
+    double l_dTfun = i_time / (l_nMacro * l_maxMult);
+    for( int_tg l_tg = 0; l_tg < m_timeGroups.size(); l_tg++ ) {
+      m_timeGroups[l_tg]->setUpLts( l_dTfun,
+                                    l_nMacro * l_maxMult );
+    }
   }
 
   // reset all statuses to wait
   m_shared.resetStatus( parallel::Shared::WAI );
 
   // reset control flow
-  for( unsigned short l_cf = 0; l_cf < N_ENTRIES_CONTROL_FLOW; l_cf++ ) {
-    m_cflow[l_cf] = std::numeric_limits< unsigned short >::max();
-  }
+  m_ltsTick = 0;
+
+  // reset the task graphs
+  for( std::size_t l_gr = 0; l_gr < m_graphs.size(); l_gr++ ) m_graphs[l_gr].reset();
 
   // we are not finished until the scheduling threads decides so
   m_finished = false;
@@ -115,7 +132,11 @@ void edge::time::Manager::simulate( double i_time ) {
 {
 #endif
   while( m_finished == false ) {
-    if( m_shared.isSched() ) schedule();
+    if( m_shared.isSched() ) {
+      schedule();
+      // release sleeping workers at the end of the simulation
+      if( m_finished == true ) m_shared.wake();
+    }
     if( m_shared.isComm()  ) communicate();
     if( m_shared.isWrk()   ) compute();
   }
@@ -126,8 +147,16 @@ void edge::time::Manager::simulate( double i_time ) {
   // (re-)balance work regions
   m_shared.balance();
 
-  // prepare limiter for sync
-  for( int_tg l_tg = 0; l_tg < m_timeGroups.size(); l_tg++ ) {
-    m_timeGroups[l_tg]->limSync();
+  // prepare limiter for sync, the limiter is restricted to global time stepping
+  m_timeGroups[0]->limSync();
+}
+
+void edge::time::Manager::logStats() const {
+  for( std::size_t l_gr = 0; l_gr < m_graphs.size(); l_gr++ ) {
+    m_graphs[l_gr].logStats( "  task graph #" + std::to_string(l_gr) + ", " );
   }
+
+  if( m_timeGroups.size() > 0 ) m_mpi.logStats( "  mpi, ", m_timeGroups[0]->getUpdatesPer() );
+
+  m_shared.logImbalance( "  load balancing, " );
 }
@@ -29,6 +29,7 @@
 #include "io/Receivers.h"
 #include "io/ReceiversSf.hpp"
 #include "TimeGroupStatic.h"
+#include "TaskGraph.h"
 #include <vector>
 
 namespace edge {
@@ -57,8 +58,15 @@ class edge::time::Manager {
     //! clusters under control of the time manager
     std::vector< TimeGroupStatic* > m_timeGroups;
 
-    //! control flow of the scheme
-    unsigned short m_cflow[N_ENTRIES_CONTROL_FLOW];
+
+    //! task graphs of the scheme
+    std::vector< TaskGraph > m_graphs;
+
+    //! MPI groups of data alternating between time steps, refreshed by the scheduler before progressing a time step
+    std::vector< unsigned short > m_mgsTs;
+
+    //! local time stepping: number of fundamental time steps since synchronization
+    int_ts m_ltsTick = 0;
 
     //! true if the manager reached the desired synchronization point
     volatile bool m_finished = false;
@@ -105,6 +113,12 @@ class edge::time::Manager {
      * @param i_time time to advance forward in time.
      **/
     void simulate( double i_time );
+
+    /**
+     * Logs the per-task timing of the task graphs, the communication statistics and the imbalance of the ranks.
+     * Called by all ranks.
+     **/
+    void logStats() const;
 };
 
 #endif
@@ -0,0 +1,171 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Dependency graph of the tasks in a time step.
+ **/
+#include "TaskGraph.h"
+#include "parallel/Shared.h"
+#include "parallel/Mpi.h"
+#include "io/logging.h"
+
+void edge::time::TaskGraph::begin( std::size_t i_ta ) {
+  EDGE_CHECK_EQ( m_tasks[i_ta].status, WAI );
+
+  m_tasks[i_ta].status = IPR;
+  m_tasks[i_ta].timer.start();
+  m_tasks[i_ta].begin();
+
+  m_ipr.push_back( i_ta );
+}
+
+std::size_t edge::time::TaskGraph::add( std::string             const & i_name,
+                                        std::function< void() > const & i_begin,
+                                        std::function< bool() > const & i_done ) {
+  Task l_task;
+  l_task.name = i_name;
+  l_task.begin = i_begin;
+  l_task.done = i_done;
+  l_task.nPreds = 0;
+  l_task.nPredsOpen = 0;
+  l_task.status = WAI;
+  l_task.nExes = 0;
+
+  m_tasks.push_back( l_task );
+
+  return m_tasks.size()-1;
+}
+
+std::size_t edge::time::TaskGraph::addCmp( std::string      const & i_name,
+                                           parallel::Shared       & i_shared,
+                                           unsigned int             i_id ) {
+  parallel::Shared *l_shared = &i_shared;
+
+  return add( i_name,
+              [l_shared, i_id](){ l_shared->setStatusAll( parallel::Shared::RDY, i_id ); },
+              [l_shared, i_id](){ return l_shared->getStatusAll( parallel::Shared::FIN, i_id ); } );
+}
+
+std::size_t edge::time::TaskGraph::addSend( std::string   const & i_name,
+                                            parallel::Mpi       & i_mpi,
+                                            int_tg                i_tg,
+                                            unsigned short        i_mg ) {
+  parallel::Mpi *l_mpi = &i_mpi;
+
+  return add( i_name,
+              [l_mpi, i_tg, i_mg](){ l_mpi->beginSends( i_tg, i_mg ); },
+              [l_mpi, i_tg, i_mg](){ return l_mpi->finSends( i_tg, i_mg ); } );
+}
+
+std::size_t edge::time::TaskGraph::addRecv( std::string   const & i_name,
+                                            parallel::Mpi       & i_mpi,
+                                            int_tg                i_tg,
+                                            unsigned short        i_mg ) {
+  parallel::Mpi *l_mpi = &i_mpi;
+
+  return add( i_name,
+              [l_mpi, i_tg, i_mg](){ l_mpi->beginRecvs( i_tg, i_mg ); },
+              [l_mpi, i_tg, i_mg](){ return l_mpi->finRecvs( i_tg, i_mg ); } );
+}
+
+void edge::time::TaskGraph::addDep( std::size_t i_pred,
+                                    std::size_t i_succ ) {
+  EDGE_CHECK_LT( i_pred, m_tasks.size() );
+  EDGE_CHECK_LT( i_succ, m_tasks.size() );
+  // successors have to be added after their predecessors, which rules out cycles
+  EDGE_CHECK_LT( i_pred, i_succ );
+
+  m_tasks[i_pred].succs.push_back( i_succ );
+  m_tasks[i_succ].nPreds++;
+  m_tasks[i_succ].nPredsOpen++;
+}
+
+void edge::time::TaskGraph::reset() {
+  EDGE_CHECK( m_started == false || finished() );
+
+  for( std::size_t l_ta = 0; l_ta < m_tasks.size(); l_ta++ ) {
+    m_tasks[l_ta].status = WAI;
+    m_tasks[l_ta].nPredsOpen = m_tasks[l_ta].nPreds;
+  }
+  m_ipr.clear();
+  m_nFin = 0;
+  m_started = false;
+}
+
+bool edge::time::TaskGraph::progress() {
+  // start the root tasks
+  if( m_started == false ) {
+    m_started = true;
+
+    for( std::size_t l_ta = 0; l_ta < m_tasks.size(); l_ta++ )
+      if( m_tasks[l_ta].nPreds == 0 ) begin( l_ta );
+  }
+
+  // poll the tasks in progress, successors are appended to the end
+  std::size_t l_ip = 0;
+  while( l_ip < m_ipr.size() ) {
+    std::size_t l_ta = m_ipr[l_ip];
+
+    if( m_tasks[l_ta].done() ) {
+      m_tasks[l_ta].timer.end();
+      m_tasks[l_ta].status = FIN;
+      m_tasks[l_ta].nExes++;
+      m_nFin++;
+
+      // remove from tasks in progress
+      m_ipr[l_ip] = m_ipr.back();
+      m_ipr.pop_back();
+
+      // release the successors
+      for( std::size_t l_su = 0; l_su < m_tasks[l_ta].succs.size(); l_su++ ) {
+        std::size_t l_ts = m_tasks[l_ta].succs[l_su];
+
+        m_tasks[l_ts].nPredsOpen--;
+        if( m_tasks[l_ts].nPredsOpen == 0 ) begin( l_ts );
+      }
+    }
+    else l_ip++;
+  }
+
+  return finished();
+}
+
+std::string const & edge::time::TaskGraph::getStats( std::size_t   i_ta,
+                                                     std::size_t & o_nExes,
+                                                     double      & o_time ) const {
+  EDGE_CHECK_LT( i_ta, m_tasks.size() );
+
+  o_nExes = m_tasks[i_ta].nExes;
+  o_time  = m_tasks[i_ta].timer.elapsed();
+
+  return m_tasks[i_ta].name;
+}
+
+void edge::time::TaskGraph::logStats( std::string const & i_prefix ) const {
+  for( std::size_t l_ta = 0; l_ta < m_tasks.size(); l_ta++ ) {
+    std::size_t l_nExes = 0;
+    double l_time = 0;
+    std::string const & l_name = getStats( l_ta, l_nExes, l_time );
+
+    EDGE_LOG_INFO << i_prefix << l_name
+                  << " (#exes, total, average in s): "
+                  << l_nExes << ", " << l_time << ", "
+                  << ( (l_nExes > 0) ? l_time / l_nExes : 0 );
+  }
+}
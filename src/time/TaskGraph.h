@@ -0,0 +1,219 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Dependency graph of the tasks in a time step.
+ **/
+#ifndef EDGE_TIME_TASK_GRAPH_H
+#define EDGE_TIME_TASK_GRAPH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "constants.hpp"
+#include "monitor/Timer.hpp"
+
+namespace edge {
+  namespace parallel {
+    class Shared;
+    class Mpi;
+  }
+  namespace time {
+    class TaskGraph;
+  }
+}
+
+/**
+ * Directed acyclic graph of tasks, e.g., the computations and communication of a time step.
+ * A task is started as soon as all of its predecessors completed.
+ * Only started tasks are polled for completion.
+ *
+ * Typical usage:
+ *   1) Register tasks and dependencies once.
+ *   2) Call reset() to start a new traversal.
+ *   3) Call progress() until it returns true.
+ **/
+class edge::time::TaskGraph {
+  private:
+    //! status of a task
+    typedef enum {
+      WAI = 0, // waiting for predecessors
+      IPR = 1, // started, in progress
+      FIN = 2  // finished
+    } t_status;
+
+    //! task
+    typedef struct {
+      //! name of the task
+      std::string name;
+
+      //! starts the task
+      std::function< void() > begin;
+
+      //! returns true if the task is finished
+      std::function< bool() > done;
+
+      //! successors of the task
+      std::vector< std::size_t > succs;
+
+      //! number of predecessors
+      std::size_t nPreds;
+
+      //! number of unfinished predecessors in the current traversal
+      std::size_t nPredsOpen;
+
+      //! status of the task in the current traversal
+      t_status status;
+
+      //! timer, measuring the time from start to detected completion
+      monitor::Timer timer;
+
+      //! number of completed executions
+      std::size_t nExes;
+    } Task;
+
+    //! tasks of the graph
+    std::vector< Task > m_tasks;
+
+    //! tasks in progress
+    std::vector< std::size_t > m_ipr;
+
+    //! number of finished tasks in the current traversal
+    std::size_t m_nFin = 0;
+
+    //! true if the root tasks of the current traversal were started
+    bool m_started = false;
+
+    /**
+     * Starts the given task.
+     *
+     * @param i_ta id of the task.
+     **/
+    void begin( std::size_t i_ta );
+
+  public:
+    /**
+     * Adds a generic task to the graph.
+     *
+     * @param i_name name of the task.
+     * @param i_begin function, which starts the task.
+     * @param i_done function, which returns true if the task is finished.
+     * @return id of the task.
+     **/
+    std::size_t add( std::string             const & i_name,
+                     std::function< void() > const & i_begin,
+                     std::function< bool() > const & i_done );
+
+    /**
+     * Adds a task, which computes a work region of the shared memory parallelization.
+     *
+     * @param i_name name of the task.
+     * @param i_shared shared memory parallelization.
+     * @param i_id id of the work region.
+     * @return id of the task.
+     **/
+    std::size_t addCmp( std::string      const & i_name,
+                        parallel::Shared       & i_shared,
+                        unsigned int             i_id );
+
+    /**
+     * Adds a task, which sends the data of an MPI group.
+     *
+     * @param i_name name of the task.
+     * @param i_mpi MPI parallelization.
+     * @param i_tg time group.
+     * @param i_mg MPI group.
+     * @return id of the task.
+     **/
+    std::size_t addSend( std::string   const & i_name,
+                         parallel::Mpi       & i_mpi,
+                         int_tg                i_tg,
+                         unsigned short        i_mg );
+
+    /**
+     * Adds a task, which receives the data of an MPI group.
+     *
+     * @param i_name name of the task.
+     * @param i_mpi MPI parallelization.
+     * @param i_tg time group.
+     * @param i_mg MPI group.
+     * @return id of the task.
+     **/
+    std::size_t addRecv( std::string   const & i_name,
+                         parallel::Mpi       & i_mpi,
+                         int_tg                i_tg,
+                         unsigned short        i_mg );
+
+    /**
+     * Adds a dependency: the successor is started after the predecessor finished.
+     *
+     * @param i_pred id of the predecessor.
+     * @param i_succ id of the successor.
+     **/
+    void addDep( std::size_t i_pred,
+                 std::size_t i_succ );
+
+    /**
+     * Prepares a new traversal of the graph.
+     * All tasks of the previous traversal have to be finished.
+     **/
+    void reset();
+
+    /**
+     * Progresses the graph: polls the tasks in progress and starts the successors of finished tasks.
+     *
+     * @return true if all tasks of the current traversal are finished, false otherwise.
+     **/
+    bool progress();
+
+    /**
+     * Checks if all tasks of the current traversal are finished.
+     *
+     * @return true if finished, false otherwise.
+     **/
+    bool finished() const { return m_nFin == m_tasks.size(); }
+
+    /**
+     * Gets the number of tasks.
+     *
+     * @return number of tasks.
+     **/
+    std::size_t size() const { return m_tasks.size(); }
+
+    /**
+     * Gets the timing of a task, accumulated over all completed traversals.
+     *
+     * @param i_ta id of the task.
+     * @param o_nExes will be set to the number of executions.
+     * @param o_time will be set to the accumulated time from start to detected completion (seconds).
+     * @return name of the task.
+     **/
+    std::string const & getStats( std::size_t   i_ta,
+                                  std::size_t & o_nExes,
+                                  double      & o_time ) const;
+
+    /**
+     * Logs the per-task timing.
+     *
+     * @param i_prefix prefix of the log lines.
+     **/
+    void logStats( std::string const & i_prefix ) const;
+};
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the task graph.
+ **/
+#include <catch.hpp>
+#include "TaskGraph.h"
+
+TEST_CASE( "Task graph: Release of successors.", "[TaskGraph]" ) {
+  edge::time::TaskGraph l_graph;
+
+  /*
+   * diamond with tail:
+   *
+   *   0 -> 1 -> 3 -> 4
+   *   0 -> 2 -> 3
+   */
+  bool l_began[5] = { false, false, false, false, false };
+  bool l_done[5]  = { false, false, false, false, false };
+
+  for( unsigned short l_ta = 0; l_ta < 5; l_ta++ ) {
+    std::size_t l_id = l_graph.add( "task_" + std::to_string(l_ta),
+                                    [&l_began, l_ta](){ l_began[l_ta] = true; },
+                                    [&l_done,  l_ta](){ return l_done[l_ta]; } );
+    REQUIRE( l_id == l_ta );
+  }
+  l_graph.addDep( 0, 1 );
+  l_graph.addDep( 0, 2 );
+  l_graph.addDep( 1, 3 );
+  l_graph.addDep( 2, 3 );
+  l_graph.addDep( 3, 4 );
+
+  for( unsigned short l_it = 0; l_it < 2; l_it++ ) {
+    l_graph.reset();
+    for( unsigned short l_ta = 0; l_ta < 5; l_ta++ ) {
+      l_began[l_ta] = false;
+      l_done[l_ta] = false;
+    }
+
+    // only the root is started
+    REQUIRE( l_graph.progress() == false );
+    REQUIRE( l_began[0] );
+    REQUIRE( !l_began[1] );
+    REQUIRE( !l_began[2] );
+
+    // finishing the root releases both branches
+    l_done[0] = true;
+    REQUIRE( l_graph.progress() == false );
+    REQUIRE( l_began[1] );
+    REQUIRE( l_began[2] );
+    REQUIRE( !l_began[3] );
+
+    // one branch is not sufficient for the join
+    l_done[2] = true;
+    REQUIRE( l_graph.progress() == false );
+    REQUIRE( !l_began[3] );
+
+    // the join and its successor finish in the same progress call
+    l_done[1] = true;
+    l_done[3] = true;
+    l_done[4] = true;
+    REQUIRE( l_graph.progress() == true );
+    REQUIRE( l_began[3] );
+    REQUIRE( l_began[4] );
+    REQUIRE( l_graph.finished() );
+  }
+
+  // check the stats
+  for( unsigned short l_ta = 0; l_ta < 5; l_ta++ ) {
+    std::size_t l_nExes = 0;
+    double l_time = -1;
+    std::string const & l_name = l_graph.getStats( l_ta, l_nExes, l_time );
+
+    REQUIRE( l_name == "task_" + std::to_string(l_ta) );
+    REQUIRE( l_nExes == 2 );
+    REQUIRE( l_time >= 0 );
+  }
+}
+
+TEST_CASE( "Task graph: Messages spanning traversals.", "[TaskGraph]" ) {
+  edge::time::TaskGraph l_graph;
+
+  /*
+   * message posted in traversal n and waited for in traversal n+1:
+   *
+   *   wait (root) -> compute -> post
+   */
+  unsigned short l_nTrs = 0;
+  bool l_inFlight = false;
+  bool l_delivered = false;
+  bool l_began = false;
+
+  std::size_t l_wait = l_graph.add( "wait",
+                                    [](){},
+                                    [&](){ return l_nTrs == 0 || !l_inFlight || l_delivered; } );
+  std::size_t l_cmp  = l_graph.add( "compute",
+                                    [&](){ l_began = true; },
+                                    [](){ return true; } );
+  std::size_t l_post = l_graph.add( "post",
+                                    [&](){ l_inFlight = true; l_delivered = false; },
+                                    [](){ return true; } );
+  l_graph.addDep( l_wait, l_cmp );
+  l_graph.addDep( l_cmp, l_post );
+
+  // first traversal: nothing in flight
+  l_graph.reset();
+  REQUIRE( l_graph.progress() == true );
+  REQUIRE( l_began );
+  REQUIRE( l_inFlight );
+  l_nTrs++;
+
+  // second traversal: the computation waits for the message of the first one
+  for( unsigned short l_tr = 0; l_tr < 2; l_tr++ ) {
+    l_graph.reset();
+    l_began = false;
+
+    REQUIRE( l_graph.progress() == false );
+    REQUIRE( l_graph.progress() == false );
+    REQUIRE( !l_began );
+
+    l_delivered = true;
+    REQUIRE( l_graph.progress() == true );
+    REQUIRE( l_began );
+    REQUIRE( l_delivered == false );
+    l_nTrs++;
+  }
+}
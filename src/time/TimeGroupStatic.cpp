@@ -70,6 +70,24 @@ void edge::time::TimeGroupStatic::setUp( double i_dTfun,
   setDt();
 }
 
+void edge::time::TimeGroupStatic::setUpLts( double i_dTfun,
+                                            int_ts i_nFunSteps ) {
+  EDGE_CHECK_EQ( i_nFunSteps % m_funMult, 0 );
+
+  // set general and final time step
+  m_dTgen = i_dTfun * m_funMult;
+  m_dTfin = m_dTgen;
+
+  // reset number of updates since sync
+  m_updatesSync = 0;
+
+  // derive number of required updates
+  m_updatesReq = i_nFunSteps / m_funMult;
+
+  // set time step of first update
+  setDt();
+}
+
 void edge::time::TimeGroupStatic::setDt() {
   if( m_updatesReq > 1 ) m_dT = m_dTgen;
   else                   m_dT = m_dTfin;
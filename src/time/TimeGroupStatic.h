@@ -93,6 +93,16 @@ class edge::time::TimeGroupStatic {
     void setUp( double i_dTfun,
                 double i_time );
 
+    /**
+     * Sets up the cluster for local time stepping until the given synchronization point.
+     * In contrast to setUp, all updates use the same time step.
+     *
+     * @param i_dTfun fundamental time step.
+     * @param i_nFunSteps number of fundamental time steps until synchronization, has to be a multiple of the cluster's fundamental time step multiple.
+     **/
+    void setUpLts( double i_dTfun,
+                   int_ts i_nFunSteps );
+
     /**
      * Updates the time step info.
      **/
@@ -163,6 +173,27 @@ class edge::time::TimeGroupStatic {
       return m_updatesReq == 0;
     }
 
+    /**
+     * Gets the fundamental time step multiple of the cluster.
+     *
+     * @return fundamental time step multiple.
+     **/
+    int_ts getFunMult() const { return m_funMult; }
+
+    /**
+     * Gets the unique identifier for the LTS data.
+     *
+     * @param i_lt local id of the LTS data (buffers of time integrated DOFs, time derivatives).
+     **/
+    std::uintptr_t getLtsDataId( unsigned short i_lt ) {
+      EDGE_CHECK_LT( i_lt, 2 );
+#ifdef PP_N_GLOBAL_SHARED_6
+      return reinterpret_cast< std::intptr_t >( m_internal.m_globalShared6[2+i_lt] );
+#else
+      return std::numeric_limits< std::uintptr_t >::max();
+#endif
+    }
+
     /**
      * Gets the unique identifier for the data of the admissibility.
      *
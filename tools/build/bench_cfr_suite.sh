@@ -0,0 +1,110 @@
+#!/bin/bash
+##
+# @file This file is part of EDGE.
+#
+# @author Alexander Breuer (anbreuer AT ucsd.edu)
+#
+# @section LICENSE
+# Copyright (c) 2019, Alexander Breuer
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Builds and runs the kernel benchmarks (edge_bench) for all combinations of precision and fused simulations.
+##
+
+# global build group variables
+if [[ -z $EDGE_DEPS ]]
+then
+  EDGE_DEPS=./deps
+fi
+
+if [[ -z $EDGE_CXX  ]]
+then
+  EDGE_CXX=g++
+fi
+
+if [[ -z $EDGE_PAR_COMPILE ]]
+then
+  EDGE_PAR_COMPILE=16
+fi
+
+if [[ -z $EDGE_ARCH ]]
+then
+  EDGE_ARCH=avx512
+fi
+
+if [[ -z $EDGE_ELEMENT ]]
+then
+  EDGE_ELEMENT=tet4
+fi
+
+if [[ -z $EDGE_EQUATION ]]
+then
+  EDGE_EQUATION=elastic
+fi
+
+if [[ -z $EDGE_ORDER ]]
+then
+  EDGE_ORDER=4
+fi
+
+if [[ -z $EDGE_BENCH_DIR ]]
+then
+  EDGE_BENCH_DIR=./bench/
+fi
+
+if [[ -z $EDGE_BENCH_ARGS ]]
+then
+  EDGE_BENCH_ARGS="--reps=10"
+fi
+
+# configs to benchmark, $precision_$cfr
+if [[ -z $EDGE_CONFIGS ]]
+then
+  EDGE_CONFIGS="32_2 32_4 32_8 32_16 32_32 64_2 64_4 64_8 64_16 64_32"
+fi
+
+# save current location
+PWD_JUMP_BACK=`pwd`
+
+if [[ -z ${EDGE_ROOT+x} ]]
+then
+  echo "EDGE_ROOT is not set, please set it!"
+  exit -1
+fi
+
+# switch into EDGE root
+cd ${EDGE_ROOT}
+
+mkdir -p ${EDGE_BENCH_DIR}
+
+for c in ${EDGE_CONFIGS}
+do
+  # extract config
+  EDGE_PRECISION=`echo ${c} | awk -F"_" '{print $1}'`
+  EDGE_CFR=`echo ${c} | awk -F"_" '{print $2}'`
+
+  # cleanup
+  rm -rf build/
+  rm -rf .sconf_temp
+  rm -rf .sconsign.dblite
+
+  # build the benchmarks, configs below 256 bit use the portable SIMD kernels instead of LIBXSMM
+  CXX=${EDGE_CXX} scons equations=${EDGE_EQUATION} order=${EDGE_ORDER} precision=${EDGE_PRECISION} cfr=${EDGE_CFR} element_type=${EDGE_ELEMENT} parallel=omp arch=${EDGE_ARCH} xsmm=${EDGE_DEPS} simd=yes bench=yes -j ${EDGE_PAR_COMPILE}
+
+  # run the benchmarks
+  EDGE_BENCH_OUT=${EDGE_BENCH_DIR}/bench_${EDGE_ARCH}_${EDGE_ELEMENT}_${EDGE_EQUATION}_${EDGE_ORDER}_${EDGE_PRECISION}_${EDGE_CFR}.json
+  ./build/edge_bench ${EDGE_BENCH_ARGS} --out=${EDGE_BENCH_OUT}
+done
+
+cd ${PWD_JUMP_BACK}
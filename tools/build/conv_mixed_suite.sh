@@ -0,0 +1,144 @@
+#!/bin/bash
+##
+# @file This file is part of EDGE.
+#
+# @author Alexander Breuer (anbreuer AT ucsd.edu)
+#
+# @section LICENSE
+# Copyright (c) 2019, Alexander Breuer
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Accuracy versus throughput of mixed precision: runs a convergence setup and the kernel benchmarks (edge_bench)
+# in 32-bit precision, 32-bit precision with compensated summation and 64-bit precision.
+#
+# The convergence setup is given as an XML configuration template (EDGE_CONV_CONFIG).
+# The template uses the tag REFINEMENT_TAG for the mesh refinement and the tag ERRORS_TAG for the location of the error norms,
+# i.e., <error_norms><file>ERRORS_TAG</file></error_norms>.
+# The collected error norms and timings are summarized by tools/numerics/conv_mixed.py.
+##
+
+# global build group variables
+if [[ -z $EDGE_DEPS ]]
+then
+  EDGE_DEPS=./deps
+fi
+
+if [[ -z $EDGE_CXX  ]]
+then
+  EDGE_CXX=g++
+fi
+
+if [[ -z $EDGE_PAR_COMPILE ]]
+then
+  EDGE_PAR_COMPILE=16
+fi
+
+if [[ -z $EDGE_ARCH ]]
+then
+  EDGE_ARCH=avx512
+fi
+
+if [[ -z $EDGE_ELEMENT ]]
+then
+  EDGE_ELEMENT=tet4
+fi
+
+if [[ -z $EDGE_EQUATION ]]
+then
+  EDGE_EQUATION=elastic
+fi
+
+if [[ -z $EDGE_ORDER ]]
+then
+  EDGE_ORDER=4
+fi
+
+if [[ -z $EDGE_CFR ]]
+then
+  EDGE_CFR=1
+fi
+
+if [[ -z $EDGE_CONV_DIR ]]
+then
+  EDGE_CONV_DIR=./conv_mixed/
+fi
+
+if [[ -z $EDGE_CONV_REFINEMENTS ]]
+then
+  EDGE_CONV_REFINEMENTS="2 4 8 16"
+fi
+
+if [[ -z $EDGE_BENCH_ARGS ]]
+then
+  EDGE_BENCH_ARGS="--reps=10"
+fi
+
+# configs to compare, $precision_$mixed
+if [[ -z $EDGE_CONFIGS ]]
+then
+  EDGE_CONFIGS="32_no 32_yes 64_no"
+fi
+
+# save current location
+PWD_JUMP_BACK=`pwd`
+
+if [[ -z ${EDGE_ROOT+x} ]]
+then
+  echo "EDGE_ROOT is not set, please set it!"
+  exit -1
+fi
+
+if [[ -z ${EDGE_CONV_CONFIG+x} ]]
+then
+  echo "EDGE_CONV_CONFIG is not set, please set it!"
+  exit -1
+fi
+
+# switch into EDGE root
+cd ${EDGE_ROOT}
+
+mkdir -p ${EDGE_CONV_DIR}
+
+for c in ${EDGE_CONFIGS}
+do
+  # extract config
+  EDGE_PRECISION=`echo ${c} | awk -F"_" '{print $1}'`
+  EDGE_MIXED=`echo ${c} | awk -F"_" '{print $2}'`
+
+  # cleanup
+  rm -rf build/
+  rm -rf .sconf_temp
+  rm -rf .sconsign.dblite
+
+  # build the solver and the benchmarks
+  CXX=${EDGE_CXX} scons equations=${EDGE_EQUATION} order=${EDGE_ORDER} precision=${EDGE_PRECISION} mixed=${EDGE_MIXED} cfr=${EDGE_CFR} element_type=${EDGE_ELEMENT} parallel=omp arch=${EDGE_ARCH} xsmm=${EDGE_DEPS} bench=yes -j ${EDGE_PAR_COMPILE}
+
+  # run the convergence setup
+  for r in ${EDGE_CONV_REFINEMENTS}
+  do
+    EDGE_CONV_XML=${EDGE_CONV_DIR}/config_${c}_${r}.xml
+    sed -e "s|REFINEMENT_TAG|${r}|g" \
+        -e "s|ERRORS_TAG|${EDGE_CONV_DIR}/errors_${c}_${r}.xml|g" \
+        ${EDGE_CONV_CONFIG} > ${EDGE_CONV_XML}
+    ./build/edge -x ${EDGE_CONV_XML} > ${EDGE_CONV_DIR}/log_${c}_${r}.log
+  done
+
+  # run the benchmarks
+  ./build/edge_bench ${EDGE_BENCH_ARGS} --out=${EDGE_CONV_DIR}/bench_${c}.json
+done
+
+# summarize accuracy versus throughput
+python3 tools/numerics/conv_mixed.py --dir ${EDGE_CONV_DIR} --configs ${EDGE_CONFIGS} --refinements ${EDGE_CONV_REFINEMENTS} --csv ${EDGE_CONV_DIR}/conv_mixed.csv
+
+cd ${PWD_JUMP_BACK}
@@ -0,0 +1,192 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Face adjacency of tetrahedral meshes.
+ **/
+#include "Graph.h"
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+void edge_part::Graph::faEl( int         i_nEls,
+                             int const * i_elVe,
+                             t_faEl    & o_faEl ) {
+  // local vertex ids of the faces
+  unsigned short const l_faVe[4][3] = { {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3} };
+
+  o_faEl.clear();
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) {
+    for( unsigned short l_fa = 0; l_fa < 4; l_fa++ ) {
+      std::array< int, 3 > l_key;
+      for( unsigned short l_ve = 0; l_ve < 3; l_ve++ )
+        l_key[l_ve] = i_elVe[ l_el*4 + l_faVe[l_fa][l_ve] ];
+      std::sort( l_key.begin(), l_key.end() );
+
+      o_faEl[l_key].push_back( l_el );
+    }
+  }
+}
+
+void edge_part::Graph::dual( int                  i_nEls,
+                             t_faEl       const & i_faEl,
+                             std::vector< int > & o_xadj,
+                             std::vector< int > & o_adj ) {
+  // count the neighbors
+  o_xadj.assign( i_nEls+1, 0 );
+  for( t_faEl::const_iterator l_it = i_faEl.begin(); l_it != i_faEl.end(); l_it++ ) {
+    if( l_it->second.size() != 2 ) continue;
+    o_xadj[ l_it->second[0]+1 ]++;
+    o_xadj[ l_it->second[1]+1 ]++;
+  }
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) o_xadj[l_el+1] += o_xadj[l_el];
+
+  // insert the neighbors
+  o_adj.resize( o_xadj[i_nEls] );
+  std::vector< int > l_pos( o_xadj.begin(), o_xadj.end()-1 );
+  for( t_faEl::const_iterator l_it = i_faEl.begin(); l_it != i_faEl.end(); l_it++ ) {
+    if( l_it->second.size() != 2 ) continue;
+    o_adj[ l_pos[ l_it->second[0] ]++ ] = l_it->second[1];
+    o_adj[ l_pos[ l_it->second[1] ]++ ] = l_it->second[0];
+  }
+}
+
+int edge_part::Graph::flagFaces( int                   i_nFas,
+                                 int           const * i_faVe,
+                                 t_faEl        const & i_faEl,
+                                 std::vector< char > & io_elFlags ) {
+  int l_nMiss = 0;
+
+  for( int l_fa = 0; l_fa < i_nFas; l_fa++ ) {
+    std::array< int, 3 > l_key = { i_faVe[l_fa*3+0], i_faVe[l_fa*3+1], i_faVe[l_fa*3+2] };
+    std::sort( l_key.begin(), l_key.end() );
+
+    t_faEl::const_iterator l_it = i_faEl.find( l_key );
+    if( l_it == i_faEl.end() ) {
+      l_nMiss++;
+      continue;
+    }
+
+    for( std::size_t l_ad = 0; l_ad < l_it->second.size(); l_ad++ )
+      io_elFlags[ l_it->second[l_ad] ] = 1;
+  }
+
+  return l_nMiss;
+}
+
+void edge_part::Graph::flagNeighs( std::vector< int  > const & i_xadj,
+                                   std::vector< int  > const & i_adj,
+                                   std::vector< char > const & i_elFlags,
+                                   std::vector< char >       & o_elFlags ) {
+  o_elFlags = i_elFlags;
+
+  for( std::size_t l_el = 0; l_el+1 < i_xadj.size(); l_el++ ) {
+    if( i_elFlags[l_el] == 0 ) continue;
+
+    for( int l_ad = i_xadj[l_el]; l_ad < i_xadj[l_el+1]; l_ad++ )
+      o_elFlags[ i_adj[l_ad] ] = 1;
+  }
+}
+
+void edge_part::Graph::locate( int                                            i_nEls,
+                               int                                    const * i_elVe,
+                               double                                 const (*i_veCrds)[3],
+                               std::vector< std::array< double, 3 > > const & i_ptCrds,
+                               std::vector< int >                           & o_ptEl ) {
+  // elements, sorted by the minimum x-coordinate of their vertices
+  std::vector< std::pair< double, int > > l_xMin( i_nEls );
+  double l_dxMax = 0;
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) {
+    double l_min = std::numeric_limits< double >::max();
+    double l_max = std::numeric_limits< double >::lowest();
+    for( unsigned short l_ve = 0; l_ve < 4; l_ve++ ) {
+      l_min = std::min( l_min, i_veCrds[ i_elVe[l_el*4+l_ve] ][0] );
+      l_max = std::max( l_max, i_veCrds[ i_elVe[l_el*4+l_ve] ][0] );
+    }
+    l_xMin[l_el] = std::make_pair( l_min, l_el );
+    l_dxMax = std::max( l_dxMax, l_max - l_min );
+  }
+  std::sort( l_xMin.begin(), l_xMin.end() );
+
+  o_ptEl.assign( i_ptCrds.size(), -1 );
+  for( std::size_t l_pt = 0; l_pt < i_ptCrds.size(); l_pt++ ) {
+    // candidates: elements, whose x-range might contain the point
+    std::vector< std::pair< double, int > >::const_iterator l_it = std::lower_bound( l_xMin.begin(),
+                                                                                   l_xMin.end(),
+                                                                                   std::make_pair( i_ptCrds[l_pt][0] - l_dxMax,
+                                                                                                   std::numeric_limits< int >::lowest() ) );
+
+    for( ; l_it != l_xMin.end() && l_it->first <= i_ptCrds[l_pt][0]; l_it++ ) {
+      int l_el = l_it->second;
+      double const *l_ve0 = i_veCrds[ i_elVe[l_el*4] ];
+
+      // edges, originating at the first vertex, and the point relative to it
+      double l_eds[4][3];
+      for( unsigned short l_ed = 0; l_ed < 3; l_ed++ )
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_eds[l_ed][l_di] = i_veCrds[ i_elVe[l_el*4+l_ed+1] ][l_di] - l_ve0[l_di];
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        l_eds[3][l_di] = i_ptCrds[l_pt][l_di] - l_ve0[l_di];
+
+      // barycentric coordinates through Cramer's rule
+      auto l_det = [&l_eds]( unsigned short i_c0, unsigned short i_c1, unsigned short i_c2 ) {
+        return l_eds[i_c0][0] * ( l_eds[i_c1][1]*l_eds[i_c2][2] - l_eds[i_c1][2]*l_eds[i_c2][1] )
+             - l_eds[i_c0][1] * ( l_eds[i_c1][0]*l_eds[i_c2][2] - l_eds[i_c1][2]*l_eds[i_c2][0] )
+             + l_eds[i_c0][2] * ( l_eds[i_c1][0]*l_eds[i_c2][1] - l_eds[i_c1][1]*l_eds[i_c2][0] );
+      };
+      double l_vol6 = l_det( 0, 1, 2 );
+      if( l_vol6 == 0 ) continue;
+
+      double l_bc[4];
+      l_bc[1] = l_det( 3, 1, 2 ) / l_vol6;
+      l_bc[2] = l_det( 0, 3, 2 ) / l_vol6;
+      l_bc[3] = l_det( 0, 1, 3 ) / l_vol6;
+      l_bc[0] = 1 - l_bc[1] - l_bc[2] - l_bc[3];
+
+      double const l_tol = 1E-8;
+      if(    l_bc[0] >= -l_tol && l_bc[1] >= -l_tol
+          && l_bc[2] >= -l_tol && l_bc[3] >= -l_tol ) {
+        o_ptEl[l_pt] = l_el;
+        break;
+      }
+    }
+  }
+}
+
+bool edge_part::Graph::readPts( std::string                      const & i_path,
+                                std::vector< std::array< double, 3 > > & o_ptCrds ) {
+  o_ptCrds.clear();
+
+  std::ifstream l_fs( i_path.c_str(), std::ios::in );
+  if( !l_fs.is_open() ) return false;
+
+  std::string l_line;
+  while( getline( l_fs, l_line ) ) {
+    std::size_t l_first = l_line.find_first_not_of( " \t" );
+    if( l_first == std::string::npos || l_line[l_first] == '#' ) continue;
+
+    std::istringstream l_ss( l_line );
+    std::array< double, 3 > l_crds;
+    if( l_ss >> l_crds[0] >> l_crds[1] >> l_crds[2] ) o_ptCrds.push_back( l_crds );
+  }
+
+  return true;
+}
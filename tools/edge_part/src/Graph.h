@@ -0,0 +1,122 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Face adjacency of tetrahedral meshes.
+ **/
+#ifndef EDGE_PART_GRAPH_H
+#define EDGE_PART_GRAPH_H
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace edge_part {
+  class Graph;
+}
+
+/**
+ * @brief Face adjacency of tetrahedral meshes and location of points in the elements.
+ */
+class edge_part::Graph {
+  public:
+    //! elements adjacent to the faces, the faces are given by their sorted vertex ids
+    typedef std::map< std::array< int, 3 >, std::vector< int > > t_faEl;
+
+    /**
+     * @brief Derives the elements adjacent to the faces.
+     *
+     * @param i_nEls number of elements.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param o_faEl will be set to the elements adjacent to the faces.
+     */
+    static void faEl( int         i_nEls,
+                      int const * i_elVe,
+                      t_faEl    & o_faEl );
+
+    /**
+     * @brief Derives the dual graph (face-adjacent elements) in compressed sparse row format.
+     *
+     * @param i_nEls number of elements.
+     * @param i_faEl elements adjacent to the faces.
+     * @param o_xadj will be set to the offsets of the elements' adjacency lists, i_nEls+1 entries.
+     * @param o_adj will be set to the adjacency lists.
+     */
+    static void dual( int                  i_nEls,
+                      t_faEl       const & i_faEl,
+                      std::vector< int > & o_xadj,
+                      std::vector< int > & o_adj );
+
+    /**
+     * @brief Flags the elements, which are adjacent to the given faces.
+     *
+     * @param i_nFas number of faces.
+     * @param i_faVe vertices adjacent to the faces.
+     * @param i_faEl elements adjacent to the faces.
+     * @param io_elFlags flags of the elements, adjacent elements will be set to 1.
+     * @return number of the given faces, which are not part of the mesh's elements.
+     */
+    static int flagFaces( int                   i_nFas,
+                          int           const * i_faVe,
+                          t_faEl        const & i_faEl,
+                          std::vector< char > & io_elFlags );
+
+    /**
+     * @brief Flags the face-neighbors of the flagged elements.
+     *
+     * @param i_xadj offsets of the elements' adjacency lists.
+     * @param i_adj adjacency lists.
+     * @param i_elFlags flags of the elements.
+     * @param o_elFlags will be set to 1 for flagged elements and their face-neighbors, 0 otherwise.
+     */
+    static void flagNeighs( std::vector< int  > const & i_xadj,
+                            std::vector< int  > const & i_adj,
+                            std::vector< char > const & i_elFlags,
+                            std::vector< char >       & o_elFlags );
+
+    /**
+     * @brief Locates the points in the elements.
+     *
+     * @param i_nEls number of elements.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_veCrds coordinates of the vertices.
+     * @param i_ptCrds coordinates of the points.
+     * @param o_ptEl will be set to the elements containing the points, -1 for points outside of the mesh.
+     */
+    static void locate( int                                            i_nEls,
+                        int                                    const * i_elVe,
+                        double                                 const (*i_veCrds)[3],
+                        std::vector< std::array< double, 3 > > const & i_ptCrds,
+                        std::vector< int >                           & o_ptEl );
+
+    /**
+     * @brief Reads the coordinates of points from a file.
+     *        Every line holds the x-, y- and z-coordinate of a point, separated by whitespace;
+     *        empty lines and lines starting with # are ignored.
+     *
+     * @param i_path path to the file.
+     * @param o_ptCrds will be set to the coordinates of the points.
+     * @return true if the file was read, false otherwise.
+     */
+    static bool readPts( std::string                      const & i_path,
+                         std::vector< std::array< double, 3 > > & o_ptCrds );
+};
+
+#endif
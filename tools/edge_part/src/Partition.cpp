@@ -0,0 +1,171 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Weighted partitioning of the elements.
+ **/
+#include "Partition.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#ifdef PP_USE_METIS
+#include <metis.h>
+#endif
+
+void edge_part::Partition::rcbRec( std::vector< std::array< double, 3 > > const & i_elBars,
+                                   std::vector< double >                  const & i_elWgts,
+                                   std::vector< int >                           & io_els,
+                                   std::size_t                                    i_first,
+                                   std::size_t                                    i_size,
+                                   int                                            i_firstPart,
+                                   int                                            i_nParts,
+                                   std::vector< int >                           & o_elParts ) {
+  if( i_nParts == 1 ) {
+    for( std::size_t l_el = i_first; l_el < i_first+i_size; l_el++ )
+      o_elParts[ io_els[l_el] ] = i_firstPart;
+    return;
+  }
+
+  // longest extent of the bounding box
+  double l_bb[2][3];
+  for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+    l_bb[0][l_di] = std::numeric_limits< double >::max();
+    l_bb[1][l_di] = std::numeric_limits< double >::lowest();
+  }
+  for( std::size_t l_el = i_first; l_el < i_first+i_size; l_el++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_bb[0][l_di] = std::min( l_bb[0][l_di], i_elBars[ io_els[l_el] ][l_di] );
+      l_bb[1][l_di] = std::max( l_bb[1][l_di], i_elBars[ io_els[l_el] ][l_di] );
+    }
+  }
+  unsigned short l_dim = 0;
+  for( unsigned short l_di = 1; l_di < 3; l_di++ )
+    if( l_bb[1][l_di] - l_bb[0][l_di] > l_bb[1][l_dim] - l_bb[0][l_dim] ) l_dim = l_di;
+
+  // sort the elements along the extent
+  std::sort( io_els.begin() + i_first,
+             io_els.begin() + i_first + i_size,
+             [&i_elBars, l_dim]( int i_el0, int i_el1 ) {
+               return i_elBars[i_el0][l_dim] < i_elBars[i_el1][l_dim];
+             } );
+
+  // cut at the weight, which corresponds to the number of partitions on the left
+  int l_nPartsL = i_nParts / 2;
+  double l_wgtSum = 0;
+  for( std::size_t l_el = i_first; l_el < i_first+i_size; l_el++ ) l_wgtSum += i_elWgts[ io_els[l_el] ];
+  double l_wgtL = l_wgtSum * l_nPartsL / i_nParts;
+
+  std::size_t l_sizeL = 0;
+  double l_wgt = 0;
+  while( l_sizeL < i_size ) {
+    double l_wgtEl = i_elWgts[ io_els[i_first+l_sizeL] ];
+    // stop before the element, if this is closer to the target
+    if( l_wgt + l_wgtEl > l_wgtL && (l_wgt + l_wgtEl - l_wgtL) > (l_wgtL - l_wgt) ) break;
+    l_wgt += l_wgtEl;
+    l_sizeL++;
+  }
+
+  rcbRec( i_elBars, i_elWgts, io_els, i_first,         l_sizeL,          i_firstPart,             l_nPartsL,            o_elParts );
+  rcbRec( i_elBars, i_elWgts, io_els, i_first+l_sizeL, i_size - l_sizeL, i_firstPart + l_nPartsL, i_nParts - l_nPartsL, o_elParts );
+}
+
+void edge_part::Partition::rcb( std::vector< std::array< double, 3 > > const & i_elBars,
+                                std::vector< double >                  const & i_elWgts,
+                                int                                            i_nParts,
+                                std::vector< int >                           & o_elParts ) {
+  assert( i_elBars.size() == i_elWgts.size() );
+  assert( i_nParts > 0 );
+
+  std::vector< int > l_els( i_elBars.size() );
+  for( std::size_t l_el = 0; l_el < l_els.size(); l_el++ ) l_els[l_el] = l_el;
+
+  o_elParts.resize( i_elBars.size() );
+  rcbRec( i_elBars, i_elWgts, l_els, 0, l_els.size(), 0, i_nParts, o_elParts );
+}
+
+#ifdef PP_USE_METIS
+bool edge_part::Partition::metis( std::vector< int >    const & i_xadj,
+                                  std::vector< int >    const & i_adj,
+                                  std::vector< double > const & i_elWgts,
+                                  int                           i_nParts,
+                                  std::vector< int >          & o_elParts ) {
+  idx_t l_nEls = i_elWgts.size();
+  o_elParts.assign( l_nEls, 0 );
+  if( i_nParts == 1 ) return true;
+
+  // integer weights with a resolution of 1/100 of a default element
+  double const l_sca = 100;
+  std::vector< idx_t > l_xadj( i_xadj.begin(), i_xadj.end() );
+  std::vector< idx_t > l_adj(  i_adj.begin(),  i_adj.end()  );
+  std::vector< idx_t > l_wgts( l_nEls );
+  for( idx_t l_el = 0; l_el < l_nEls; l_el++ )
+    l_wgts[l_el] = std::max( idx_t(1), idx_t( std::llround( i_elWgts[l_el] * l_sca ) ) );
+
+  idx_t l_nCon = 1;
+  idx_t l_nParts = i_nParts;
+  idx_t l_cut = 0;
+  idx_t l_opts[METIS_NOPTIONS];
+  METIS_SetDefaultOptions( l_opts );
+  l_opts[METIS_OPTION_NUMBERING] = 0;
+
+  std::vector< idx_t > l_parts( l_nEls );
+  int l_err = METIS_PartGraphKway( &l_nEls,
+                                   &l_nCon,
+                                   l_xadj.data(),
+                                   l_adj.data(),
+                                   l_wgts.data(),
+                                   nullptr,
+                                   nullptr,
+                                   &l_nParts,
+                                   nullptr,
+                                   nullptr,
+                                   l_opts,
+                                   &l_cut,
+                                   l_parts.data() );
+  if( l_err != METIS_OK ) return false;
+
+  for( idx_t l_el = 0; l_el < l_nEls; l_el++ ) o_elParts[l_el] = l_parts[l_el];
+  return true;
+}
+#endif
+
+std::size_t edge_part::Partition::stats( std::vector< int >    const & i_xadj,
+                                         std::vector< int >    const & i_adj,
+                                         std::vector< double > const & i_elWgts,
+                                         std::vector< int >    const & i_elParts,
+                                         int                           i_nParts,
+                                         std::vector< double >       & o_partWgts,
+                                         std::vector< int >          & o_partEls ) {
+  o_partWgts.assign( i_nParts, 0 );
+  o_partEls.assign( i_nParts, 0 );
+
+  std::size_t l_cut = 0;
+  for( std::size_t l_el = 0; l_el < i_elParts.size(); l_el++ ) {
+    assert( i_elParts[l_el] >= 0 && i_elParts[l_el] < i_nParts );
+    o_partWgts[ i_elParts[l_el] ] += i_elWgts[l_el];
+    o_partEls[  i_elParts[l_el] ]++;
+
+    for( int l_ad = i_xadj[l_el]; l_ad < i_xadj[l_el+1]; l_ad++ )
+      if( i_elParts[ i_adj[l_ad] ] != i_elParts[l_el] ) l_cut++;
+  }
+
+  // every face between partitions was counted from both sides
+  return l_cut / 2;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Weighted partitioning of the elements.
+ **/
+#ifndef EDGE_PART_PARTITION_H
+#define EDGE_PART_PARTITION_H
+
+#include <array>
+#include <vector>
+
+namespace edge_part {
+  class Partition;
+}
+
+/**
+ * @brief Weighted partitioning of the elements through METIS (if available) or a built-in recursive coordinate bisection.
+ */
+class edge_part::Partition {
+  private:
+    /**
+     * @brief Recursively bisects the given elements along the longest extent of their barycenters' bounding box.
+     *        The cuts split the summed weights proportional to the number of partitions on either side.
+     *
+     * @param i_elBars barycenters of the elements.
+     * @param i_elWgts work-weights of the elements.
+     * @param io_els elements, which are bisected; reordered on output.
+     * @param i_first first element in io_els.
+     * @param i_size number of elements in io_els.
+     * @param i_firstPart first partition.
+     * @param i_nParts number of partitions.
+     * @param o_elParts will be set to the partitions of the elements.
+     */
+    static void rcbRec( std::vector< std::array< double, 3 > > const & i_elBars,
+                        std::vector< double >                  const & i_elWgts,
+                        std::vector< int >                           & io_els,
+                        std::size_t                                    i_first,
+                        std::size_t                                    i_size,
+                        int                                            i_firstPart,
+                        int                                            i_nParts,
+                        std::vector< int >                           & o_elParts );
+
+  public:
+    /**
+     * @brief Partitions the elements through a recursive coordinate bisection of the elements' barycenters.
+     *
+     * @param i_elBars barycenters of the elements.
+     * @param i_elWgts work-weights of the elements.
+     * @param i_nParts number of partitions.
+     * @param o_elParts will be set to the partitions of the elements.
+     */
+    static void rcb( std::vector< std::array< double, 3 > > const & i_elBars,
+                     std::vector< double >                  const & i_elWgts,
+                     int                                            i_nParts,
+                     std::vector< int >                           & o_elParts );
+
+#ifdef PP_USE_METIS
+    /**
+     * @brief Partitions the elements through METIS' multilevel k-way partitioning of the dual graph.
+     *
+     * @param i_xadj offsets of the elements' adjacency lists.
+     * @param i_adj adjacency lists.
+     * @param i_elWgts work-weights of the elements.
+     * @param i_nParts number of partitions.
+     * @param o_elParts will be set to the partitions of the elements.
+     * @return true if successful, false otherwise.
+     */
+    static bool metis( std::vector< int >    const & i_xadj,
+                       std::vector< int >    const & i_adj,
+                       std::vector< double > const & i_elWgts,
+                       int                           i_nParts,
+                       std::vector< int >          & o_elParts );
+#endif
+
+    /**
+     * @brief Derives statistics of the partitioning.
+     *
+     * @param i_xadj offsets of the elements' adjacency lists.
+     * @param i_adj adjacency lists.
+     * @param i_elWgts work-weights of the elements.
+     * @param i_elParts partitions of the elements.
+     * @param i_nParts number of partitions.
+     * @param o_partWgts will be set to the summed work-weights of the partitions.
+     * @param o_partEls will be set to the number of elements in the partitions.
+     * @return number of faces between elements of different partitions.
+     */
+    static std::size_t stats( std::vector< int >    const & i_xadj,
+                              std::vector< int >    const & i_adj,
+                              std::vector< double > const & i_elWgts,
+                              std::vector< int >    const & i_elParts,
+                              int                           i_nParts,
+                              std::vector< double >       & o_partWgts,
+                              std::vector< int >          & o_partEls );
+};
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Runtime configuration.
+ **/
+#include "Config.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+edge_part::io::Config::Config( std::string const & i_pathToFile ) {
+  std::cout << "reading config file: " << i_pathToFile << std::endl;
+
+  std::ifstream l_fs( i_pathToFile.c_str(), std::ios::in );
+  if( !l_fs.is_open() ) {
+    std::cerr << "error: cannot open the config file" << std::endl;
+    exit( EXIT_FAILURE );
+  }
+
+  std::string l_line;
+  while( getline( l_fs, l_line ) ) {
+    std::size_t l_first = l_line.find_first_not_of( ' ' );
+    if( l_first == std::string::npos || l_line[l_first] == '#' ) continue;
+
+    std::size_t l_eq = l_line.find( '=', l_first );
+    if( l_eq == std::string::npos ) continue;
+
+    std::string l_name  = l_line.substr( l_first, l_eq - l_first );
+    std::string l_value = l_line.substr( l_eq + 1 );
+
+    if(      l_name == "mesh_file"         ) m_meshFn      = l_value;
+    else if( l_name == "out_file"          ) m_outFn       = l_value;
+    else if( l_name == "n_parts"           ) m_nParts      = std::stoi( l_value );
+    else if( l_name == "partitioner"       ) m_partitioner = l_value;
+    else if( l_name == "rupture_tag"       ) m_rupTag      = std::stoi( l_value );
+    else if( l_name == "weight_default"    ) m_wgtDefault  = std::stod( l_value );
+    else if( l_name == "weight_rupture"    ) m_wgts[0]     = std::stod( l_value );
+    else if( l_name == "weight_limit"      ) m_wgts[1]     = std::stod( l_value );
+    else if( l_name == "weight_limit_plus" ) m_wgts[2]     = std::stod( l_value );
+    else if( l_name == "weight_receiver"   ) m_wgts[3]     = std::stod( l_value );
+    else if( l_name == "weight_source"     ) m_wgts[4]     = std::stod( l_value );
+    else if( l_name == "receivers_file"    ) m_recvFn      = l_value;
+    else if( l_name == "sources_file"      ) m_srcFn       = l_value;
+    else if( l_name == "weight_tag"        ) m_wgtTag      = l_value;
+    else std::cout << "  unknown setting (" << l_name << "), ignored" << std::endl;
+  }
+
+  if( m_meshFn == "" || m_outFn == "" || m_nParts < 1 ) {
+    std::cerr << "error: mesh_file, out_file and a positive n_parts are required" << std::endl;
+    exit( EXIT_FAILURE );
+  }
+
+#ifdef PP_USE_METIS
+  if( m_partitioner != "metis" && m_partitioner != "rcb" ) {
+#else
+  if( m_partitioner != "rcb" ) {
+#endif
+    std::cerr << "error: unsupported partitioner: " << m_partitioner << std::endl;
+    exit( EXIT_FAILURE );
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Runtime configuration.
+ **/
+#ifndef EDGE_PART_IO_CONFIG_H
+#define EDGE_PART_IO_CONFIG_H
+
+#include <string>
+
+namespace edge_part {
+  namespace io {
+    class Config;
+  }
+}
+
+/**
+ * @brief Runtime configuration.
+ */
+class edge_part::io::Config {
+  public:
+    //! path to the input mesh
+    std::string m_meshFn;
+
+    //! path to the partitioned output mesh
+    std::string m_outFn;
+
+    //! number of partitions
+    int m_nParts = 1;
+
+    //! partitioner: metis or rcb (built-in recursive coordinate bisection)
+#ifdef PP_USE_METIS
+    std::string m_partitioner = "metis";
+#else
+    std::string m_partitioner = "rcb";
+#endif
+
+    //! value of the MATERIAL_SET tag of rupture faces
+    int m_rupTag = 201;
+
+    //! work-weight of a default element
+    double m_wgtDefault = 1;
+
+    //! additional work-weights, [0]: rupture elements, [1]: limited elements (rupture elements), [2]: limited plus elements (limited elements and their face-neighbors), [3]: per receiver, [4]: per point source
+    double m_wgts[5] = { 1, 0, 0, 0.05, 0.1 };
+
+    //! path to the coordinates of the receivers (optional)
+    std::string m_recvFn;
+
+    //! path to the coordinates of the point sources (optional)
+    std::string m_srcFn;
+
+    //! name of the element tag, which stores the work-weights in the output mesh; not stored if empty
+    std::string m_wgtTag;
+
+    /**
+     * @brief Initializes the configuration.
+     *
+     * @param i_pathToFile path to configuration file.
+     */
+    Config( std::string const & i_pathToFile );
+};
+
+#endif
@@ -0,0 +1,270 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Interface to MOAB.
+ **/
+#ifndef EDGE_PART_IO_MOAB_HPP
+#define EDGE_PART_IO_MOAB_HPP
+
+#include <moab/Interface.hpp>
+#include <moab/Core.hpp>
+#include <cassert>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace edge_part {
+  namespace io {
+    class Moab;
+  }
+}
+
+/**
+ * @brief Interface to MOAB for tetrahedral meshes.
+ *        The ids of the vertices and elements are given by MOAB's ids, starting at 0.
+ */
+class edge_part::io::Moab {
+  private:
+    //! moab interface
+    moab::Interface *m_moab;
+
+  public:
+    /**
+     * @brief Constructs a new Moab object.
+     *
+     * @param i_pathToMesh path to the mesh.
+     */
+    Moab( std::string const & i_pathToMesh ) {
+      m_moab = new moab::Core;
+
+      moab::ErrorCode l_err = m_moab->load_file( i_pathToMesh.c_str() );
+      assert( l_err == moab::MB_SUCCESS );
+    }
+
+    /**
+     * @brief Destroys the Moab object.
+     */
+    ~Moab() {
+      delete m_moab;
+    }
+
+    /**
+     * @brief Gets the number of entities by the number dimensions.
+     *
+     * @param i_nDis number of dimensions.
+     * @return number of entities.
+     */
+    int nEnsByDis( unsigned short i_nDis ) {
+      int l_nEns = std::numeric_limits< int >::max();
+      moab::ErrorCode l_err = m_moab->get_number_entities_by_dimension( 0,
+                                                                        i_nDis,
+                                                                        l_nEns );
+      assert( l_err == moab::MB_SUCCESS );
+
+      return l_nEns;
+    }
+
+    /**
+     * @brief Gets the coordinates of the (ordered) vertices.
+     *
+     * @param o_veCrds will be set to coordinates of the vertices.
+     */
+    void getVeCrds( double (*o_veCrds)[3] ) {
+      std::vector< moab::EntityHandle > l_ves;
+      moab::ErrorCode l_err = m_moab->get_entities_by_dimension( 0,
+                                                                 0,
+                                                                 l_ves );
+      assert( l_err == moab::MB_SUCCESS );
+
+      l_err = m_moab->get_coords( &l_ves[0],
+                                   l_ves.size(),
+                                   o_veCrds[0] );
+      assert( l_err == moab::MB_SUCCESS );
+    }
+
+    /**
+     * @brief Gets the vertices adjacent to the tetrahedral elements.
+     *
+     * @param o_elVe will be set to the vertex ids of the elements.
+     */
+    void getElVe( int *o_elVe ) {
+      std::vector< moab::EntityHandle > l_elVe;
+      moab::ErrorCode l_err = m_moab->get_connectivity_by_type( moab::MBTET,
+                                                                l_elVe );
+      assert( l_err == moab::MB_SUCCESS );
+
+      for( std::size_t l_ve = 0; l_ve < l_elVe.size(); l_ve++ )
+        o_elVe[l_ve] = m_moab->id_from_handle( l_elVe[l_ve] ) - 1;
+    }
+
+    /**
+     * @brief Gets the vertices of the triangular faces in the material sets with the given value.
+     *
+     * @param i_val value of the MATERIAL_SET tag.
+     * @param o_faVe will be set to the vertex ids of the faces, three per face.
+     */
+    void getFaVeMat( int                  i_val,
+                     std::vector< int > & o_faVe ) {
+      o_faVe.clear();
+
+      moab::Tag l_tagMat;
+      moab::ErrorCode l_err = m_moab->tag_get_handle( "MATERIAL_SET",
+                                                      1,
+                                                      moab::MB_TYPE_INTEGER,
+                                                      l_tagMat );
+      if( l_err != moab::MB_SUCCESS ) return;
+
+      int const *l_vals[1] = { &i_val };
+      moab::Range l_sets;
+      l_err = m_moab->get_entities_by_type_and_tag( 0,
+                                                    moab::MBENTITYSET,
+                                                    &l_tagMat,
+                                                    (void const * const *) l_vals,
+                                                    1,
+                                                    l_sets );
+      assert( l_err == moab::MB_SUCCESS );
+
+      for( moab::Range::const_iterator l_se = l_sets.begin(); l_se != l_sets.end(); l_se++ ) {
+        std::vector< moab::EntityHandle > l_fas;
+        l_err = m_moab->get_entities_by_type( *l_se,
+                                              moab::MBTRI,
+                                              l_fas,
+                                              true );
+        assert( l_err == moab::MB_SUCCESS );
+
+        for( std::size_t l_fa = 0; l_fa < l_fas.size(); l_fa++ ) {
+          moab::EntityHandle const *l_faVe;
+          int l_nVes;
+          l_err = m_moab->get_connectivity( l_fas[l_fa],
+                                            l_faVe,
+                                            l_nVes );
+          assert( l_err == moab::MB_SUCCESS );
+          assert( l_nVes == 3 );
+
+          for( int l_ve = 0; l_ve < 3; l_ve++ )
+            o_faVe.push_back( m_moab->id_from_handle( l_faVe[l_ve] ) - 1 );
+        }
+      }
+    }
+
+    /**
+     * @brief Sets the given data of the tetrahedral elements (as native double).
+     *
+     * @param i_tagName tag name.
+     * @param i_data data, which will be stored.
+     */
+    void setElData( std::string const & i_tagName,
+                    double      const * i_data ) {
+      std::vector< moab::EntityHandle > l_els;
+      moab::ErrorCode l_err = m_moab->get_entities_by_type( 0,
+                                                            moab::MBTET,
+                                                            l_els );
+      assert( l_err == moab::MB_SUCCESS );
+
+      moab::Tag l_tag;
+      l_err = m_moab->tag_get_handle( i_tagName.c_str(),
+                                      1,
+                                      moab::MB_TYPE_DOUBLE,
+                                      l_tag,
+                                      moab::MB_TAG_CREAT|moab::MB_TAG_DENSE );
+      assert( l_err == moab::MB_SUCCESS );
+
+      l_err = m_moab->tag_set_data( l_tag,
+                                    &l_els[0],
+                                    l_els.size(),
+                                    i_data );
+      assert( l_err == moab::MB_SUCCESS );
+    }
+
+    /**
+     * @brief Stores the partitions of the tetrahedral elements as entity sets with the PARALLEL_PARTITION tag.
+     *        Existing partition sets are replaced.
+     *
+     * @param i_nParts number of partitions.
+     * @param i_elParts partitions of the elements.
+     */
+    void setParts( int                        i_nParts,
+                   std::vector< int > const & i_elParts ) {
+      moab::Tag l_tagPart;
+      moab::ErrorCode l_err = m_moab->tag_get_handle( "PARALLEL_PARTITION",
+                                                      1,
+                                                      moab::MB_TYPE_INTEGER,
+                                                      l_tagPart,
+                                                      moab::MB_TAG_CREAT|moab::MB_TAG_SPARSE );
+      assert( l_err == moab::MB_SUCCESS );
+
+      // remove existing partition sets
+      moab::Range l_sets;
+      l_err = m_moab->get_entities_by_type_and_tag( 0,
+                                                    moab::MBENTITYSET,
+                                                    &l_tagPart,
+                                                    nullptr,
+                                                    1,
+                                                    l_sets );
+      assert( l_err == moab::MB_SUCCESS );
+      l_err = m_moab->delete_entities( l_sets );
+      assert( l_err == moab::MB_SUCCESS );
+
+      // gather the elements of the partitions
+      std::vector< moab::EntityHandle > l_els;
+      l_err = m_moab->get_entities_by_type( 0,
+                                            moab::MBTET,
+                                            l_els );
+      assert( l_err == moab::MB_SUCCESS );
+      assert( l_els.size() == i_elParts.size() );
+
+      std::vector< std::vector< moab::EntityHandle > > l_partEls( i_nParts );
+      for( std::size_t l_el = 0; l_el < l_els.size(); l_el++ )
+        l_partEls[ i_elParts[l_el] ].push_back( l_els[l_el] );
+
+      // create the partition sets
+      for( int l_pa = 0; l_pa < i_nParts; l_pa++ ) {
+        moab::EntityHandle l_set;
+        l_err = m_moab->create_meshset( moab::MESHSET_SET,
+                                        l_set );
+        assert( l_err == moab::MB_SUCCESS );
+
+        l_err = m_moab->tag_set_data( l_tagPart,
+                                      &l_set,
+                                      1,
+                                      &l_pa );
+        assert( l_err == moab::MB_SUCCESS );
+
+        if( l_partEls[l_pa].size() > 0 ) {
+          l_err = m_moab->add_entities( l_set,
+                                        &l_partEls[l_pa][0],
+                                        l_partEls[l_pa].size() );
+          assert( l_err == moab::MB_SUCCESS );
+        }
+      }
+    }
+
+    /**
+     * @brief Writes the database to the given file.
+     *
+     * @param i_pathToMesh path to the mesh.
+     */
+    void writeMesh( std::string const & i_pathToMesh ) {
+      moab::ErrorCode l_err = m_moab->write_file( i_pathToMesh.c_str() );
+      assert( l_err == moab::MB_SUCCESS );
+    }
+};
+
+#endif
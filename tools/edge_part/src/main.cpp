@@ -0,0 +1,223 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * This is the main file of EDGE-P, which partitions meshes with weighted elements.
+ **/
+
+#include "io/Config.h"
+#include "io/Moab.hpp"
+#include "Graph.h"
+#include "Partition.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Adds the given weight to the elements containing the points of a file.
+ *
+ * @param i_path path to the file with the coordinates of the points.
+ * @param i_type type of the points, used for the output.
+ * @param i_wgt weight, which is added per point.
+ * @param i_nEls number of elements.
+ * @param i_elVe vertices adjacent to the elements.
+ * @param i_veCrds coordinates of the vertices.
+ * @param io_elWgts work-weights of the elements, which are updated.
+ */
+static void addPts( std::string           const & i_path,
+                    std::string           const & i_type,
+                    double                        i_wgt,
+                    int                           i_nEls,
+                    int                   const * i_elVe,
+                    double                const (*i_veCrds)[3],
+                    std::vector< double >       & io_elWgts ) {
+  if( i_path == "" ) return;
+
+  std::vector< std::array< double, 3 > > l_ptCrds;
+  if( !edge_part::Graph::readPts( i_path, l_ptCrds ) ) {
+    std::cerr << "error: cannot open the " << i_type << " file: " << i_path << std::endl;
+    exit( EXIT_FAILURE );
+  }
+
+  std::vector< int > l_ptEl;
+  edge_part::Graph::locate( i_nEls,
+                            i_elVe,
+                            i_veCrds,
+                            l_ptCrds,
+                            l_ptEl );
+
+  std::size_t l_nOut = 0;
+  for( std::size_t l_pt = 0; l_pt < l_ptEl.size(); l_pt++ ) {
+    if( l_ptEl[l_pt] < 0 ) l_nOut++;
+    else io_elWgts[ l_ptEl[l_pt] ] += i_wgt;
+  }
+
+  std::cout << "  " << i_type << ": " << l_ptCrds.size() << " points, "
+            << l_nOut << " outside of the mesh" << std::endl;
+}
+
+int main( int i_argc, char **i_argv ) {
+  // check input arguments
+  if( i_argc != 3 || i_argv[1][0] != '-' || i_argv[1][1] != 'f' ) {
+    std::cerr << "Usage: " << i_argv[0] << " -f edge_part.conf" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // start time
+  clock_t l_tp = clock();
+
+  // parse config
+  std::string l_configFile = std::string( i_argv[2] );
+  edge_part::io::Config l_config( l_configFile );
+
+  // init MOAB mesh interface
+  std::cout << "reading mesh: " << l_config.m_meshFn << std::endl;
+  edge_part::io::Moab l_moab( l_config.m_meshFn );
+
+  int l_nVes = l_moab.nEnsByDis( 0 );
+  int l_nEls = l_moab.nEnsByDis( 3 );
+  std::cout << "  #vertices: " << l_nVes << ", #elements: " << l_nEls << std::endl;
+
+  std::vector< double > l_veCrdsRaw( std::size_t(l_nVes) * 3 );
+  double (*l_veCrds)[3] = reinterpret_cast< double (*)[3] >( l_veCrdsRaw.data() );
+  l_moab.getVeCrds( l_veCrds );
+
+  std::vector< int > l_elVe( std::size_t(l_nEls) * 4 );
+  l_moab.getElVe( l_elVe.data() );
+
+  // derive the dual graph
+  std::cout << "deriving the dual graph" << std::endl;
+  edge_part::Graph::t_faEl l_faEl;
+  edge_part::Graph::faEl( l_nEls,
+                          l_elVe.data(),
+                          l_faEl );
+
+  std::vector< int > l_xadj, l_adj;
+  edge_part::Graph::dual( l_nEls,
+                          l_faEl,
+                          l_xadj,
+                          l_adj );
+
+  // assemble the work-weights of the elements
+  std::cout << "assembling the work-weights of the elements" << std::endl;
+  std::vector< double > l_elWgts( l_nEls, l_config.m_wgtDefault );
+
+  // rupture elements, which are also limited
+  std::vector< int > l_rupFaVe;
+  l_moab.getFaVeMat( l_config.m_rupTag, l_rupFaVe );
+
+  std::vector< char > l_elRup( l_nEls, 0 );
+  int l_nMiss = edge_part::Graph::flagFaces( l_rupFaVe.size() / 3,
+                                             l_rupFaVe.data(),
+                                             l_faEl,
+                                             l_elRup );
+  if( l_nMiss > 0 ) std::cout << "  warning: " << l_nMiss << " rupture faces are not part of the elements" << std::endl;
+
+  // limited plus elements: limited elements and their face-neighbors
+  std::vector< char > l_elLimPlus;
+  edge_part::Graph::flagNeighs( l_xadj,
+                                l_adj,
+                                l_elRup,
+                                l_elLimPlus );
+
+  std::size_t l_nRup = 0, l_nLimPlus = 0;
+  for( int l_el = 0; l_el < l_nEls; l_el++ ) {
+    if( l_elRup[l_el] != 0 ) {
+      l_elWgts[l_el] += l_config.m_wgts[0] + l_config.m_wgts[1];
+      l_nRup++;
+    }
+    if( l_elLimPlus[l_el] != 0 ) {
+      l_elWgts[l_el] += l_config.m_wgts[2];
+      l_nLimPlus++;
+    }
+  }
+  std::cout << "  rupture / limited elements: " << l_nRup
+            << ", limited plus elements: " << l_nLimPlus << std::endl;
+
+  // receivers and point sources
+  addPts( l_config.m_recvFn, "receivers", l_config.m_wgts[3], l_nEls, l_elVe.data(), l_veCrds, l_elWgts );
+  addPts( l_config.m_srcFn,  "sources",   l_config.m_wgts[4], l_nEls, l_elVe.data(), l_veCrds, l_elWgts );
+
+  // partition the elements
+  std::cout << "partitioning the elements into " << l_config.m_nParts
+            << " parts, partitioner: " << l_config.m_partitioner << std::endl;
+  std::vector< int > l_elParts;
+
+#ifdef PP_USE_METIS
+  if( l_config.m_partitioner == "metis" ) {
+    if( !edge_part::Partition::metis( l_xadj, l_adj, l_elWgts, l_config.m_nParts, l_elParts ) ) {
+      std::cerr << "error: METIS failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  else
+#endif
+  {
+    std::vector< std::array< double, 3 > > l_elBars( l_nEls );
+    for( int l_el = 0; l_el < l_nEls; l_el++ ) {
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        l_elBars[l_el][l_di] = 0;
+        for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+          l_elBars[l_el][l_di] += 0.25 * l_veCrds[ l_elVe[l_el*4+l_ve] ][l_di];
+      }
+    }
+
+    edge_part::Partition::rcb( l_elBars, l_elWgts, l_config.m_nParts, l_elParts );
+  }
+
+  // report the predicted balance
+  std::vector< double > l_partWgts;
+  std::vector< int > l_partEls;
+  std::size_t l_cut = edge_part::Partition::stats( l_xadj,
+                                                   l_adj,
+                                                   l_elWgts,
+                                                   l_elParts,
+                                                   l_config.m_nParts,
+                                                   l_partWgts,
+                                                   l_partEls );
+
+  double l_wgtSum = 0;
+  for( int l_pa = 0; l_pa < l_config.m_nParts; l_pa++ ) l_wgtSum += l_partWgts[l_pa];
+  double l_wgtAve = l_wgtSum / l_config.m_nParts;
+  double l_wgtMax = *std::max_element( l_partWgts.begin(), l_partWgts.end() );
+
+  std::cout << "  #elements per part (min, max): "
+            << *std::min_element( l_partEls.begin(), l_partEls.end() ) << ", "
+            << *std::max_element( l_partEls.begin(), l_partEls.end() ) << std::endl;
+  std::cout << "  work-weight per part (min, ave, max): "
+            << *std::min_element( l_partWgts.begin(), l_partWgts.end() ) << ", "
+            << l_wgtAve << ", " << l_wgtMax << std::endl;
+  std::cout << "  predicted imbalance ((max-ave)/ave): "
+            << ( (l_wgtAve > 0) ? (l_wgtMax - l_wgtAve) / l_wgtAve : 0 ) << std::endl;
+  std::cout << "  faces between parts: " << l_cut << std::endl;
+
+  // write the partitioned mesh
+  std::cout << "writing the partitioned mesh: " << l_config.m_outFn << std::endl;
+  l_moab.setParts( l_config.m_nParts, l_elParts );
+  if( l_config.m_wgtTag != "" ) l_moab.setElData( l_config.m_wgtTag, l_elWgts.data() );
+  l_moab.writeMesh( l_config.m_outFn );
+
+  l_tp = clock() - l_tp;
+  std::cout << "finished in " << (float) l_tp / CLOCKS_PER_SEC << "s" << std::endl;
+
+  return EXIT_SUCCESS;
+}
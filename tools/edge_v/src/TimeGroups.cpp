@@ -0,0 +1,149 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Derivation of time groups for local time stepping.
+ **/
+#include "TimeGroups.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+double edge_v::TimeGroups::cfl( double const i_veCrds[4][3],
+                                double       i_vp ) {
+  // edges, originating at the first vertex
+  double l_eds[3][3];
+  for( unsigned short l_ed = 0; l_ed < 3; l_ed++ )
+    for( unsigned short l_di = 0; l_di < 3; l_di++ )
+      l_eds[l_ed][l_di] = i_veCrds[l_ed+1][l_di] - i_veCrds[0][l_di];
+
+  // six times the volume
+  double l_vol6 = l_eds[0][0] * ( l_eds[1][1]*l_eds[2][2] - l_eds[1][2]*l_eds[2][1] )
+                - l_eds[0][1] * ( l_eds[1][0]*l_eds[2][2] - l_eds[1][2]*l_eds[2][0] )
+                + l_eds[0][2] * ( l_eds[1][0]*l_eds[2][1] - l_eds[1][1]*l_eds[2][0] );
+  l_vol6 = std::abs( l_vol6 );
+
+  // local vertex ids of the faces
+  unsigned short const l_faVe[4][3] = { {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3} };
+
+  // two times the surface area
+  double l_area2 = 0;
+  for( unsigned short l_fa = 0; l_fa < 4; l_fa++ ) {
+    double l_e0[3], l_e1[3];
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_e0[l_di] = i_veCrds[ l_faVe[l_fa][1] ][l_di] - i_veCrds[ l_faVe[l_fa][0] ][l_di];
+      l_e1[l_di] = i_veCrds[ l_faVe[l_fa][2] ][l_di] - i_veCrds[ l_faVe[l_fa][0] ][l_di];
+    }
+
+    double l_cr[3];
+    l_cr[0] = l_e0[1]*l_e1[2] - l_e0[2]*l_e1[1];
+    l_cr[1] = l_e0[2]*l_e1[0] - l_e0[0]*l_e1[2];
+    l_cr[2] = l_e0[0]*l_e1[1] - l_e0[1]*l_e1[0];
+
+    l_area2 += std::sqrt( l_cr[0]*l_cr[0] + l_cr[1]*l_cr[1] + l_cr[2]*l_cr[2] );
+  }
+
+  // diameter of the insphere: 6V / A
+  double l_dia = l_vol6 / (0.5 * l_area2);
+
+  return l_dia / i_vp;
+}
+
+unsigned short edge_v::TimeGroups::bin( int            i_nEls,
+                                        int            i_nVes,
+                                        int    const * i_elVe,
+                                        double const (*i_veCrds)[3],
+                                        double const * i_elVps,
+                                        unsigned short i_nTgs,
+                                        int          * o_elTgs ) {
+  assert( i_nTgs > 0 );
+
+  // derive the time steps of the elements
+  std::vector< double > l_dts( i_nEls );
+  double l_dtMin = std::numeric_limits< double >::max();
+
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) {
+    double l_veCrds[4][3];
+    for( unsigned short l_ve = 0; l_ve < 4; l_ve++ ) {
+      int l_veId = i_elVe[l_el*4 + l_ve];
+      assert( l_veId < i_nVes );
+
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        l_veCrds[l_ve][l_di] = i_veCrds[l_veId][l_di];
+    }
+
+    l_dts[l_el] = cfl( l_veCrds, i_elVps[l_el] );
+    l_dtMin = std::min( l_dtMin, l_dts[l_el] );
+  }
+
+  // assign the largest possible power-of-two multiple of the minimum time step
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) {
+    int l_tg = std::floor( std::log2( l_dts[l_el] / l_dtMin ) );
+    o_elTgs[l_el] = std::max( 0, std::min( l_tg, i_nTgs-1 ) );
+  }
+
+  // derive the face-adjacent elements through the sorted vertex ids of the faces
+  unsigned short const l_faVe[4][3] = { {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3} };
+  std::map< std::array< int, 3 >, std::vector< int > > l_faEl;
+
+  for( int l_el = 0; l_el < i_nEls; l_el++ ) {
+    for( unsigned short l_fa = 0; l_fa < 4; l_fa++ ) {
+      std::array< int, 3 > l_key;
+      for( unsigned short l_ve = 0; l_ve < 3; l_ve++ )
+        l_key[l_ve] = i_elVe[ l_el*4 + l_faVe[l_fa][l_ve] ];
+      std::sort( l_key.begin(), l_key.end() );
+
+      l_faEl[l_key].push_back( l_el );
+    }
+  }
+
+  // reduce the time groups until adjacent elements differ by at most one
+  bool l_changed = true;
+  while( l_changed ) {
+    l_changed = false;
+
+    for( std::map< std::array< int, 3 >, std::vector< int > >::const_iterator l_it = l_faEl.begin();
+         l_it != l_faEl.end(); l_it++ ) {
+      if( l_it->second.size() != 2 ) continue;
+
+      int l_el0 = l_it->second[0];
+      int l_el1 = l_it->second[1];
+
+      if( o_elTgs[l_el0] > o_elTgs[l_el1] + 1 ) {
+        o_elTgs[l_el0] = o_elTgs[l_el1] + 1;
+        l_changed = true;
+      }
+      else if( o_elTgs[l_el1] > o_elTgs[l_el0] + 1 ) {
+        o_elTgs[l_el1] = o_elTgs[l_el0] + 1;
+        l_changed = true;
+      }
+    }
+  }
+
+  // derive number of used time groups
+  int l_tgMax = 0;
+  for( int l_el = 0; l_el < i_nEls; l_el++ )
+    l_tgMax = std::max( l_tgMax, o_elTgs[l_el] );
+
+  return l_tgMax + 1;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2019, Alexander Breuer
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Derivation of time groups for local time stepping.
+ **/
+#ifndef EDGE_V_TIME_GROUPS_H
+#define EDGE_V_TIME_GROUPS_H
+
+namespace edge_v {
+  class TimeGroups;
+}
+
+/**
+ * @brief Derivation of power-of-two time groups for tetrahedral elements.
+ *
+ * Time group #tg advances with 2^tg times the fundamental time step.
+ * The time groups of face-adjacent elements differ by at most one.
+ */
+class edge_v::TimeGroups {
+  public:
+    /**
+     * @brief Derives the CFL time step of a tetrahedron, given by the diameter of its insphere divided by the P-wave velocity.
+     *
+     * @param i_veCrds coordinates of the tetrahedron's four vertices.
+     * @param i_vp P-wave velocity of the element.
+     * @return CFL time step (without scaling through the order of convergence).
+     */
+    static double cfl( double const i_veCrds[4][3],
+                       double       i_vp );
+
+    /**
+     * @brief Bins the elements in time groups.
+     *
+     * @param i_nEls number of elements.
+     * @param i_nVes number of vertices.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_veCrds coordinates of the vertices.
+     * @param i_elVps P-wave velocities of the elements.
+     * @param i_nTgs maximum number of time groups.
+     * @param o_elTgs will be set to the time groups of the elements.
+     * @return number of time groups, which are used by at least one element.
+     */
+    static unsigned short bin( int            i_nEls,
+                               int            i_nVes,
+                               int    const * i_elVe,
+                               double const (*i_veCrds)[3],
+                               double const * i_elVps,
+                               unsigned short i_nTgs,
+                               int          * o_elTgs );
+};
+
+#endif
@@ -86,6 +86,7 @@ edge_v::io::Config::Config( const std::string &i_pathToFile ) {
     else if( l_varName.compare( "pos_file"                   ) == 0 ) m_posFn         = l_varValue;
     else if( l_varName.compare( "fault_input_file"           ) == 0 ) m_faultInputFns.push_back( l_varValue );
     else if( l_varName.compare( "tet_refinement"   ) == 0 ) m_tetRefinement = std::stoi( l_varValue );
+    else if( l_varName.compare( "time_groups"                ) == 0 ) m_nTgs          = std::stoi( l_varValue );
     else std::cout << "\nUnknown setting (" << l_varName << "). Ignored." << std::endl;
   }
 
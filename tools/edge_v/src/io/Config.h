@@ -110,6 +110,9 @@ class edge_v::io::Config {
 
     int                        m_tetRefinement = 0;
 
+    //! maximum number of time groups for local time stepping, the time groups are stored in the annotated mesh if >1
+    unsigned short             m_nTgs = 1;
+
     /**
      * @brief Initializes the configuration.
      * 
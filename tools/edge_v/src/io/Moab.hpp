@@ -179,6 +179,42 @@ class edge_v::io::Moab {
       assert( l_err == moab::MB_SUCCESS );
     }
 
+    /**
+     * @brief Sets the given data in MOAB (as native integer).
+     *
+     * @param i_enTy entity type to which this data belongs.
+     * @param i_tagName tag name.
+     * @param i_data data, which will be stored.
+     */
+    void setEnData( std::string const &i_enTy,
+                    std::string const &i_tagName,
+                    int               *i_data ) {
+      moab::EntityType l_ty = strToTy( i_enTy );
+
+      // get the entities by type
+      std::vector< moab::EntityHandle > l_ens;
+      moab::ErrorCode l_err = m_moab->get_entities_by_type( 0,
+                                                            l_ty,
+                                                            l_ens );
+      assert( l_err == moab::MB_SUCCESS );
+
+      // create the tag
+      moab::Tag l_tag;
+      l_err = m_moab->tag_get_handle( i_tagName.c_str(),
+                                      1,
+                                      moab::MB_TYPE_INTEGER,
+                                      l_tag,
+                                      moab::MB_TAG_CREAT|moab::MB_TAG_DENSE );
+      assert( l_err == moab::MB_SUCCESS );
+
+      // store the data
+      l_err = m_moab->tag_set_data( l_tag,
+                                    &l_ens[0],
+                                    l_ens.size(),
+                                    i_data );
+      assert( l_err == moab::MB_SUCCESS );
+    }
+
     /**
      * @brief Writes the database to the given file.
      *
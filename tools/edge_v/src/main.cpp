@@ -27,6 +27,7 @@
 #include "io/Moab.hpp"
 #include "io/Ucvm.hpp"
 #include "io/GmshView.hpp"
+#include "TimeGroups.h"
 #include <iostream>
 #include <cmath>
 
@@ -222,6 +223,26 @@ int main( int i_argc, char **i_argv ) {
                       "RHO",
                       l_elRhos );
 
+    // derive time groups for local time stepping
+    if( l_config.m_nTgs > 1 ) {
+      int (*l_elTgs) = new int[ l_nEns[3] ];
+
+      unsigned short l_nTgs = edge_v::TimeGroups::bin( l_nEns[3],
+                                                       l_nEns[0],
+                                                      &l_elVe[0],
+                                                       l_veCrds,
+                                                       l_elVps,
+                                                       l_config.m_nTgs,
+                                                       l_elTgs );
+
+      std::cout << "derived " << l_nTgs << " time groups" << std::endl;
+      l_moab.setEnData( "tet4",
+                        "TIME_GROUP",
+                        l_elTgs );
+
+      delete[] l_elTgs;
+    }
+
     std::cout << "writing annotated mesh: " << l_config.m_annoFn << std::endl;
     l_moab.writeMesh( l_config.m_annoFn );
 
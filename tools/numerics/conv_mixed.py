@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+##
+# @file This file is part of EDGE.
+#
+# @author Alexander Breuer (anbreuer AT ucsd.edu)
+#
+# @section LICENSE
+# Copyright (c) 2019, Alexander Breuer
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Summarizes accuracy versus throughput of mixed precision, see tools/build/conv_mixed_suite.sh.
+##
+
+import logging
+import argparse
+import json
+import os
+import xml.etree.ElementTree
+
+# set up logger
+logging.basicConfig( level=logging.DEBUG,
+                     format='%(asctime)s - %(name)s - %(levelname)s - %(message)s' )
+# command line arguments
+l_parser    = argparse.ArgumentParser( description='Summarizes accuracy versus throughput of mixed precision.' )
+l_parser.add_argument( '--dir',
+                       dest     = "dir",
+                       required = True,
+                       help     = "Directory containing the error norms errors_CONFIG_REFINEMENT.xml and the benchmarks bench_CONFIG.json.",
+                       metavar  = "DIR" )
+
+l_parser.add_argument( '--configs',
+                       dest     = "configs",
+                       required = True,
+                       nargs    = '+',
+                       help     = "Configs to compare, e.g. --configs 32_no 32_yes 64_no.",
+                       metavar  = "CONFIGS" )
+
+l_parser.add_argument( '--refinements',
+                       dest     = "refinements",
+                       required = True,
+                       nargs    = '+',
+                       help     = "Refinements of the convergence setup, e.g. --refinements 2 4 8.",
+                       metavar  = "REFINEMENTS" )
+
+l_parser.add_argument( '--csv',
+                       dest     = "csv",
+                       required = True,
+                       help     = "Output file.",
+                       metavar  = "OUT_FILE_CSV" )
+
+l_arguments = vars(l_parser.parse_args())
+
+##
+# Reads the maximum error over all quantities and fused simulations.
+#
+# @param i_file xml file containing the error norms.
+# @return dictionary with the maximum l1, l2 and linf error.
+##
+def readErrors( i_file ):
+  l_errs = {}
+  l_root = xml.etree.ElementTree.parse( i_file ).getroot()
+  for l_norm in [ 'l1', 'l2', 'linf' ]:
+    l_errs[l_norm] = max( [ float(l_cfr.text) for l_cfr in l_root.find( l_norm ).iter( 'cfr' ) ] )
+  return l_errs
+
+##
+# Reads the time per element update of the local and neighboring update.
+#
+# @param i_file json file written by edge_bench.
+# @return time per element update.
+##
+def readTime( i_file ):
+  with open( i_file ) as l_jsonFile:
+    l_bench = json.load( l_jsonFile )
+  l_time = 0
+  for l_res in l_bench['results']:
+    if l_res['kernel'] in [ 'AderDgLocal', 'AderDgNeigh' ]:
+      l_time = l_time + l_res['time_per_element_update']
+  return l_time
+
+logging.info( "reading files" )
+
+l_rows = []
+for l_co in l_arguments['configs']:
+  l_time = readTime( os.path.join( l_arguments['dir'], 'bench_'+l_co+'.json' ) )
+
+  for l_re in l_arguments['refinements']:
+    l_errs = readErrors( os.path.join( l_arguments['dir'], 'errors_'+l_co+'_'+l_re+'.xml' ) )
+    l_rows = l_rows + [ [ l_co, l_re, l_errs['l1'], l_errs['l2'], l_errs['linf'], l_time ] ]
+
+logging.info( "writing "+l_arguments['csv'] )
+
+with open( l_arguments['csv'], 'w' ) as l_csvFile:
+  l_csvFile.write( 'config,refinement,l1,l2,linf,time_per_element_update\n' )
+  for l_row in l_rows:
+    l_csvFile.write( ','.join( [ str(l_en) for l_en in l_row ] )+'\n' )
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+##
+# @file This file is part of EDGE.
+#
+# @author Alexander Breuer (anbreuer AT ucsd.edu)
+#
+# @section LICENSE
+# Copyright (c) 2019, Alexander Breuer
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Converts EDGE's binary receiver output (one file per rank) to the csv-layout (one file per receiver).
+##
+import logging
+import argparse
+import struct
+import math
+import os
+
+# set up logger
+logging.basicConfig( level=logging.INFO,
+                     format='%(asctime)s - %(name)s - %(levelname)s - %(message)s' )
+
+##
+# Reads the given number of bytes from the file.
+#
+# @param i_fi file which is read.
+# @param i_size number of bytes.
+# @return read bytes, None if the end of the file was reached before reading any byte.
+##
+def readBytes( i_fi, i_size ):
+  l_bytes = i_fi.read( i_size )
+  if len(l_bytes) == 0:
+    return None
+  assert( len(l_bytes) == i_size ), 'truncated receiver file'
+  return l_bytes
+
+##
+# Reads a binary receiver file.
+#
+# @param i_file file which is read.
+# @return header text, list of receivers (dictionaries with name, specified and projected coordinates, and samples).
+##
+def readBin( i_file ):
+  with open( i_file, 'rb' ) as l_fi:
+    assert( readBytes( l_fi, 8 ) == b'EDGERECV' ), 'not an EDGE receiver file: ' + i_file
+
+    l_version, l_nRecvs, l_nQts, l_nCrs, l_headerSize = struct.unpack( '=5I', readBytes( l_fi, 20 ) )
+    assert( l_version == 1 ), 'unsupported version: ' + str(l_version)
+    l_header = readBytes( l_fi, l_headerSize ).decode() if l_headerSize > 0 else ''
+
+    # receiver index
+    l_recvs = []
+    for l_re in range( l_nRecvs ):
+      l_nameSize = struct.unpack( '=I', readBytes( l_fi, 4 ) )[0]
+      l_name = readBytes( l_fi, l_nameSize ).decode()
+      l_crds = struct.unpack( '=6d', readBytes( l_fi, 48 ) )
+      l_recvs = l_recvs + [ { 'name':      l_name,
+                              'specified': l_crds[0:3],
+                              'projected': l_crds[3:6],
+                              'samples':   [] } ]
+
+    # chunks of samples
+    l_nVals = 1 + l_nQts * l_nCrs
+    while True:
+      l_bytes = readBytes( l_fi, 4 )
+      if l_bytes is None:
+        break
+      l_nEntries = struct.unpack( '=I', l_bytes )[0]
+
+      for l_en in range( l_nEntries ):
+        l_re, l_nSamples = struct.unpack( '=2I', readBytes( l_fi, 8 ) )
+        l_vals = struct.unpack( '=' + str(l_nSamples*l_nVals) + 'f',
+                                readBytes( l_fi, 4*l_nSamples*l_nVals ) )
+        for l_sa in range( l_nSamples ):
+          l_recvs[l_re]['samples'].append( l_vals[l_sa*l_nVals:(l_sa+1)*l_nVals] )
+
+  return l_header, l_nQts, l_nCrs, l_recvs
+
+##
+# Writes a receiver in EDGE's csv-layout.
+#
+# @param i_header shared header text.
+# @param i_nQts number of quantities.
+# @param i_nCrs number of fused runs.
+# @param i_recv receiver which is written.
+# @param i_file path to the output file.
+##
+def writeCsv( i_header, i_nQts, i_nCrs, i_recv, i_file ):
+  with open( i_file, 'w' ) as l_fi:
+    l_fi.write( i_header )
+
+    if not math.isnan( i_recv['specified'][0] ):
+      l_fi.write( '# receiver name: ' + i_recv['name'] + '\n' )
+      l_fi.write( '# specified coordinates: ' + ' '.join( [ '%g' % l_cr for l_cr in i_recv['specified'] ] ) + '\n' )
+      l_fi.write( '# projected coordinates: ' + ' '.join( [ '%g' % l_cr for l_cr in i_recv['projected'] ] ) + '\n' )
+
+    l_cols = [ 'time' ]
+    for l_qt in range( i_nQts ):
+      for l_cr in range( i_nCrs ):
+        l_cols = l_cols + [ 'Q' + str(l_qt) + '_C' + str(l_cr) ]
+    l_fi.write( ','.join( l_cols ) + '\n' )
+
+    for l_sa in i_recv['samples']:
+      l_fi.write( '%f' % l_sa[0] )
+      for l_va in l_sa[1:]:
+        l_fi.write( ',%e' % l_va )
+      l_fi.write( '\n' )
+
+# command line arguments
+l_parser = argparse.ArgumentParser( description='Converts binary receiver files to one csv-file per receiver.' )
+
+l_parser.add_argument( '--in_bin',
+                       dest     = 'in_bin',
+                       required = True,
+                       nargs    = '+',
+                       type     = str,
+                       help     = 'Paths of the binary receiver files, e.g., one per rank.' )
+
+l_parser.add_argument( '--out_dir',
+                       dest     = 'out_dir',
+                       required = True,
+                       type     = str,
+                       help     = 'Output directory for the csv-files.' )
+l_args = vars(l_parser.parse_args())
+
+if not os.path.exists( l_args['out_dir'] ):
+  os.makedirs( l_args['out_dir'] )
+
+for l_in in l_args['in_bin']:
+  logging.info( 'converting ' + l_in )
+  l_header, l_nQts, l_nCrs, l_recvs = readBin( l_in )
+
+  for l_recv in l_recvs:
+    writeCsv( l_header,
+              l_nQts,
+              l_nCrs,
+              l_recv,
+              os.path.join( l_args['out_dir'], l_recv['name'] + '.csv' ) )
+
+logging.info( 'done with converting' )